@@ -699,28 +699,24 @@ bool JsonStringifier::SerializeKeys(const JSHandle<JSObject> &obj, const JSHandl
     JSHandle<TaggedArray> propertiesArr(thread_, obj->GetProperties());
     if (!propertiesArr->IsDictionaryMode()) {
         JSHandle<JSHClass> jsHclass(thread_, obj->GetJSHClass());
-        JSTaggedValue enumCache = jsHclass->GetEnumCache();
+        JSTaggedValue enumCache = JSObject::GetOrCreateEnumCache(thread_, obj);
         if (!enumCache.IsNull()) {
-            int propsNumber = static_cast<int>(jsHclass->NumberOfProps());
             JSHandle<TaggedArray> cache(thread_, enumCache);
-            uint32_t length = cache->GetLength();
+            uint32_t length = JSObject::GetEnumCacheLength(*cache);
             for (uint32_t i = 0; i < length; i++) {
-                JSTaggedValue key = cache->Get(i);
-                if (!key.IsString()) {
-                    continue;
-                }
-                handleKey_.Update(key);
+                handleKey_.Update(cache->Get(i));
                 JSTaggedValue value;
-                LayoutInfo *layoutInfo = LayoutInfo::Cast(jsHclass->GetLayout().GetTaggedObject());
-                int index = layoutInfo->FindElementWithCache(thread_, *jsHclass, key, propsNumber);
-                PropertyAttributes attr(layoutInfo->GetAttr(index));
-                ASSERT(static_cast<int>(attr.GetOffset()) == index);
-                value = attr.IsInlinedProps()
-                        ? obj->GetPropertyInlinedProps(static_cast<uint32_t>(index))
-                        : propertiesArr->Get(static_cast<uint32_t>(index) - jsHclass->GetInlinedProperties());
-                if (UNLIKELY(value.IsAccessor())) {
-                    value = JSObject::CallGetter(thread_, AccessorData::Cast(value.GetTaggedObject()),
-                                                 JSHandle<JSTaggedValue>(obj));
+                // the cached index holds until a getter, toJSON or the replacer changes the shape of the object
+                if (obj->GetJSHClass() == *jsHclass) {
+                    value = obj->GetEnumCacheValue(*cache, i);
+                    if (UNLIKELY(value.IsAccessor())) {
+                        value = JSObject::CallGetter(thread_, AccessorData::Cast(value.GetTaggedObject()),
+                                                     JSHandle<JSTaggedValue>(obj));
+                        RETURN_VALUE_IF_ABRUPT_COMPLETION(thread_, false);
+                    }
+                } else {
+                    value = JSObject::GetProperty(thread_, obj, handleKey_).GetValue().GetTaggedValue();
+                    RETURN_VALUE_IF_ABRUPT_COMPLETION(thread_, false);
                 }
                 handleValue_.Update(value);
                 hasContent = JsonStringifier::AppendJsonString(obj, replacer, hasContent);
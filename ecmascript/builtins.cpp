@@ -596,6 +596,8 @@ void Builtins::InitializeSymbol(const JSHandle<GlobalEnv> &env, const JSHandle<J
     env->SetHoleySymbol(thread_, holeySymbol.GetTaggedValue());
     JSHandle<JSTaggedValue> elementIcSymbol(factory_->NewPrivateNameSymbolWithChar("element-ic"));
     env->SetElementICSymbol(thread_, elementIcSymbol.GetTaggedValue());
+    JSHandle<JSTaggedValue> elementsKindSymbol(factory_->NewPrivateNameSymbolWithChar("elements-kind"));
+    env->SetElementsKindSymbol(thread_, elementsKindSymbol.GetTaggedValue());
 
     // ecma 19.2.3.6 Function.prototype[@@hasInstance] ( V )
     JSHandle<JSObject> funcFuncPrototypeObj = JSHandle<JSObject>(env->GetFunctionPrototype());
@@ -685,6 +687,8 @@ void Builtins::InitializeSymbolWithRealm(const JSHandle<GlobalEnv> &realm,
     realm->SetHoleySymbol(thread_, holeySymbol.GetTaggedValue());
     JSHandle<JSTaggedValue> elementIcSymbol(factory_->NewPrivateNameSymbolWithChar("element-ic"));
     realm->SetElementICSymbol(thread_, elementIcSymbol.GetTaggedValue());
+    JSHandle<JSTaggedValue> elementsKindSymbol(factory_->NewPrivateNameSymbolWithChar("elements-kind"));
+    realm->SetElementsKindSymbol(thread_, elementsKindSymbol.GetTaggedValue());
 
     // ecma 19.2.3.6 Function.prototype[@@hasInstance] ( V )
     JSHandle<JSObject> funcFuncPrototypeObj = JSHandle<JSObject>(realm->GetFunctionPrototype());
@@ -1800,6 +1804,8 @@ void Builtins::InitializeArray(const JSHandle<GlobalEnv> &env, const JSHandle<JS
 
     //  Array.prototype_or_dynclass
     JSHandle<JSHClass> arrFuncInstanceDynclass = factory_->CreateJSArrayInstanceClass(arrFuncPrototypeValue);
+    // Arrays created by the Array function start with no element and track the kind of their elements.
+    arrFuncInstanceDynclass->SetElementsKind(ElementsKind::NONE);
 
     // Array = new Function()
     JSHandle<JSObject> arrayFunction(
@@ -3234,6 +3240,12 @@ JSHandle<JSObject> Builtins::InitializeArkTools(const JSHandle<GlobalEnv> &env)
     SetFunction(env, tools, "dumpHClass", builtins::BuiltinsArkTools::DumpHClass, FunctionLength::ONE);
     SetFunction(env, tools, "isTSHClass", builtins::BuiltinsArkTools::IsTSHClass, FunctionLength::ONE);
     SetFunction(env, tools, "getHClass", builtins::BuiltinsArkTools::GetHClass, FunctionLength::ONE);
+    SetFunction(env, tools, "startBytecodeProfiler", builtins::BuiltinsArkTools::StartBytecodeProfiler,
+                FunctionLength::ZERO);
+    SetFunction(env, tools, "stopBytecodeProfiler", builtins::BuiltinsArkTools::StopBytecodeProfiler,
+                FunctionLength::ZERO);
+    SetFunction(env, tools, "getBytecodeProfile", builtins::BuiltinsArkTools::GetBytecodeProfile,
+                FunctionLength::ZERO);
     return tools;
 }
 
@@ -15,6 +15,7 @@
 
 #include "ecmascript/builtins/builtins_ark_tools.h"
 #include "ecmascript/base/string_helper.h"
+#include "ecmascript/dfx/vmstat/bytecode_profiler.h"
 
 namespace panda::ecmascript::builtins {
 using StringHelper = base::StringHelper;
@@ -100,4 +101,31 @@ JSTaggedValue BuiltinsArkTools::GetHClass(EcmaRuntimeCallInfo *info)
     JSHClass* hclass = object->GetTaggedObject()->GetClass();
     return JSTaggedValue(hclass);
 }
+
+JSTaggedValue BuiltinsArkTools::StartBytecodeProfiler(EcmaRuntimeCallInfo *info)
+{
+    ASSERT(info);
+    BytecodeProfiler *profiler = info->GetThread()->GetEcmaVM()->GetBytecodeProfiler();
+    profiler->Clear();
+    profiler->Enable();
+    return JSTaggedValue::Undefined();
+}
+
+JSTaggedValue BuiltinsArkTools::StopBytecodeProfiler(EcmaRuntimeCallInfo *info)
+{
+    ASSERT(info);
+    info->GetThread()->GetEcmaVM()->GetBytecodeProfiler()->Disable();
+    return JSTaggedValue::Undefined();
+}
+
+JSTaggedValue BuiltinsArkTools::GetBytecodeProfile(EcmaRuntimeCallInfo *info)
+{
+    ASSERT(info);
+    JSThread *thread = info->GetThread();
+    [[maybe_unused]] EcmaHandleScope handleScope(thread);
+
+    EcmaVM *vm = thread->GetEcmaVM();
+    std::string profile = vm->GetBytecodeProfiler()->Dump();
+    return vm->GetFactory()->NewFromStdString(profile).GetTaggedValue();
+}
 }  // namespace panda::ecmascript::builtins
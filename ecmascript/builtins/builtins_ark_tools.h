@@ -34,6 +34,14 @@ public:
     static JSTaggedValue IsTSHClass(EcmaRuntimeCallInfo *info);
 
     static JSTaggedValue GetHClass(EcmaRuntimeCallInfo *info);
+
+    // count the bytecodes run by the interpreter from its next entry, the counts of an earlier run are cleared
+    static JSTaggedValue StartBytecodeProfiler(EcmaRuntimeCallInfo *info);
+
+    static JSTaggedValue StopBytecodeProfiler(EcmaRuntimeCallInfo *info);
+
+    // return the counts of the bytecode profiler as text
+    static JSTaggedValue GetBytecodeProfile(EcmaRuntimeCallInfo *info);
 };
 }  // namespace panda::ecmascript::builtins
 
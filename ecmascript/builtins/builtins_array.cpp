@@ -15,6 +15,7 @@
 
 #include "ecmascript/builtins/builtins_array.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include "ecmascript/base/array_helper.h"
@@ -92,6 +93,9 @@ JSTaggedValue BuiltinsArray::ArrayConstructor(EcmaRuntimeCallInfo *argv)
             if (JSTaggedNumber(len.GetTaggedValue()).GetNumber() != newLen) {
                 THROW_RANGE_ERROR_AND_RETURN(thread, "The length is out of range.", JSTaggedValue::Exception());
             }
+            if (newLen > 0) {
+                JSHClass::TransitionElementsKind(thread, newArrayHandle, ElementsKind::HOLE);
+            }
         }
         JSArray::Cast(*newArrayHandle)->SetArrayLength(thread, newLen);
 
@@ -1065,12 +1069,16 @@ JSTaggedValue BuiltinsArray::ForEach(EcmaRuntimeCallInfo *argv)
     //   e. Increase k by 1.
     JSMutableHandle<JSTaggedValue> key(thread, JSTaggedValue::Undefined());
     uint32_t k = 0;
+    JSMutableHandle<JSTaggedValue> kValue(thread, JSTaggedValue::Undefined());
     while (k < len) {
-        bool exists = JSTaggedValue::HasProperty(thread, thisObjVal, k);
+        kValue.Update(JSStableArray::GetPackedElement(thread, thisObjVal.GetTaggedValue(), k));
+        bool exists = !kValue->IsHole() || JSTaggedValue::HasProperty(thread, thisObjVal, k);
         RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
         if (exists) {
-            JSHandle<JSTaggedValue> kValue = JSArray::FastGetPropertyByValue(thread, thisObjVal, k);
-            RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+            if (kValue->IsHole()) {
+                kValue.Update(JSArray::FastGetPropertyByValue(thread, thisObjVal, k).GetTaggedValue());
+                RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+            }
             key.Update(JSTaggedValue(k));
             const int32_t argsLength = 3; // 3: «kValue, k, O»
             JSHandle<JSTaggedValue> undefined = thread->GlobalConstants()->GetHandledUndefined();
@@ -1139,6 +1147,30 @@ JSTaggedValue BuiltinsArray::IndexOf(EcmaRuntimeCallInfo *argv)
     //   b. If k < 0, let k be 0.
     double from = (fromIndex >= 0) ? fromIndex : ((len + fromIndex) >= 0 ? len + fromIndex : 0);
 
+    // A packed stable array has every index below its length as a data property, and the strict equality has no
+    // side effect, so its elements are compared directly. Getting fromIndex may have changed the array, so the
+    // array is checked here and the current length bounds the search.
+    if (thisHandle->IsStableJSArray(thread)) {
+        ElementsKind kind = thisHandle->GetTaggedObject()->GetClass()->GetElementsKind();
+        if (Elements::IsPacked(kind)) {
+            if (Elements::IsPackedNumber(kind) && !searchElement->IsNumber()) {
+                return GetTaggedInt(-1);
+            }
+            JSArray *array = JSArray::Cast(thisHandle->GetTaggedObject());
+            JSHandle<TaggedArray> elements(thread, array->GetElements());
+            double end = std::min({len, static_cast<double>(array->GetArrayLength()),
+                                   static_cast<double>(elements->GetLength())});
+            JSMutableHandle<JSTaggedValue> elementHandle(thread, JSTaggedValue::Undefined());
+            for (; from < end; from++) {
+                elementHandle.Update(elements->Get(static_cast<uint32_t>(from)));
+                if (JSTaggedValue::StrictEqual(thread, searchElement, elementHandle)) {
+                    return GetTaggedDouble(from);
+                }
+            }
+            return GetTaggedInt(-1);
+        }
+    }
+
     // 11. Repeat, while k<len
     //   a. Let kPresent be HasProperty(O, ToString(k)).
     //   b. ReturnIfAbrupt(kPresent).
@@ -1402,12 +1434,16 @@ JSTaggedValue BuiltinsArray::Map(EcmaRuntimeCallInfo *argv)
     JSMutableHandle<JSTaggedValue> key(thread, JSTaggedValue::Undefined());
     JSMutableHandle<JSTaggedValue> mapResultHandle(thread, JSTaggedValue::Undefined());
     uint32_t k = 0;
+    JSMutableHandle<JSTaggedValue> kValue(thread, JSTaggedValue::Undefined());
     while (k < len) {
-        bool exists = JSTaggedValue::HasProperty(thread, thisObjVal, k);
+        kValue.Update(JSStableArray::GetPackedElement(thread, thisObjVal.GetTaggedValue(), k));
+        bool exists = !kValue->IsHole() || JSTaggedValue::HasProperty(thread, thisObjVal, k);
         RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
         if (exists) {
-            JSHandle<JSTaggedValue> kValue = JSArray::FastGetPropertyByValue(thread, thisObjVal, k);
-            RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+            if (kValue->IsHole()) {
+                kValue.Update(JSArray::FastGetPropertyByValue(thread, thisObjVal, k).GetTaggedValue());
+                RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+            }
             key.Update(JSTaggedValue(k));
             const int32_t argsLength = 3; // 3: «kValue, k, O»
             JSHandle<JSTaggedValue> undefined = thread->GlobalConstants()->GetHandledUndefined();
@@ -1619,12 +1655,17 @@ JSTaggedValue BuiltinsArray::Reduce(EcmaRuntimeCallInfo *argv)
     //   e. Increase k by 1.
     JSTaggedValue callResult = JSTaggedValue::Undefined();
     JSMutableHandle<JSTaggedValue> key(thread, JSTaggedValue::Undefined());
+    JSMutableHandle<JSTaggedValue> kValue(thread, JSTaggedValue::Undefined());
     while (k < len) {
-        bool exists = (thisHandle->IsTypedArray() || JSTaggedValue::HasProperty(thread, thisObjVal, k));
+        kValue.Update(JSStableArray::GetPackedElement(thread, thisObjVal.GetTaggedValue(), k));
+        bool exists = !kValue->IsHole() || thisHandle->IsTypedArray() ||
+            JSTaggedValue::HasProperty(thread, thisObjVal, k);
         RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
         if (exists) {
-            JSHandle<JSTaggedValue> kValue = JSArray::FastGetPropertyByValue(thread, thisObjVal, k);
-            RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+            if (kValue->IsHole()) {
+                kValue.Update(JSArray::FastGetPropertyByValue(thread, thisObjVal, k).GetTaggedValue());
+                RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+            }
             key.Update(JSTaggedValue(k));
             JSHandle<JSTaggedValue> thisArgHandle = globalConst->GetHandledUndefined();
             const int32_t argsLength = 4; // 4: «accumulator, kValue, k, O»
@@ -2006,6 +2047,7 @@ JSTaggedValue BuiltinsArray::Slice(EcmaRuntimeCallInfo *argv)
     JSHandle<JSObject> newArrayHandle(thread, newArray);
 
     if (thisHandle->IsStableJSArray(thread) && newArray.IsStableJSArray(thread)) {
+        JSHClass::TransitionElementsKind(thread, newArrayHandle, thisObjHandle->GetJSHClass()->GetElementsKind());
         TaggedArray *destElements = *JSObject::GrowElementsCapacity(thread, newArrayHandle, count);
         TaggedArray *srcElements = TaggedArray::Cast(thisObjHandle->GetElements().GetTaggedObject());
 
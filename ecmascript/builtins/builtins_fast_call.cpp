@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/builtins/builtins_fast_call.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include "ecmascript/builtins/builtins_array.h"
+#include "ecmascript/builtins/builtins_map.h"
+#include "ecmascript/builtins/builtins_math.h"
+#include "ecmascript/builtins/builtins_set.h"
+#include "ecmascript/builtins/builtins_string.h"
+#include "ecmascript/ecma_string-inl.h"
+#include "ecmascript/js_array.h"
+#include "ecmascript/js_map.h"
+#include "ecmascript/js_set.h"
+#include "ecmascript/js_stable_array.h"
+#include "ecmascript/js_tagged_value-inl.h"
+#include "ecmascript/linked_hash_table.h"
+
+namespace panda::ecmascript::builtins {
+uint8_t BuiltinsFastCall::GetBuiltinId(const void *entry)
+{
+    static const std::array<const void *, ID_COUNT> ENTRIES = {
+        nullptr,
+#define FAST_CALL_ENTRY(name, entry) reinterpret_cast<const void *>(entry),
+        BUILTINS_WITH_FAST_CALL(FAST_CALL_ENTRY)
+#undef FAST_CALL_ENTRY
+    };
+    for (uint8_t id = NONE + 1; id < ID_COUNT; id++) {
+        if (ENTRIES[id] == entry) {
+            return id;
+        }
+    }
+    return NONE;
+}
+
+JSTaggedValue BuiltinsFastCall::Call(JSThread *thread, uint8_t id, JSTaggedValue thisValue, uint32_t argc,
+                                     JSTaggedValue arg0, JSTaggedValue arg1)
+{
+    using FastCallEntry = JSTaggedValue (*)(JSThread *, JSTaggedValue, uint32_t, JSTaggedValue, JSTaggedValue);
+    static constexpr std::array<FastCallEntry, ID_COUNT> FAST_CALLS = {
+        nullptr,
+#define FAST_CALL(name, entry) &BuiltinsFastCall::name,
+        BUILTINS_WITH_FAST_CALL(FAST_CALL)
+#undef FAST_CALL
+    };
+    ASSERT(id != NONE && id < ID_COUNT && argc <= MAX_ARGS);
+    DISALLOW_GARBAGE_COLLECTION;
+    return FAST_CALLS[id](thread, thisValue, argc, arg0, arg1);
+}
+
+JSTaggedValue BuiltinsFastCall::MathAbs([[maybe_unused]] JSThread *thread, [[maybe_unused]] JSTaggedValue thisValue,
+                                        [[maybe_unused]] uint32_t argc, JSTaggedValue arg0,
+                                        [[maybe_unused]] JSTaggedValue arg1)
+{
+    if (!arg0.IsNumber()) {
+        return JSTaggedValue::Hole();
+    }
+    return BuiltinsMath::AbsNumber(JSTaggedNumber(arg0));
+}
+
+JSTaggedValue BuiltinsFastCall::MathCeil([[maybe_unused]] JSThread *thread, [[maybe_unused]] JSTaggedValue thisValue,
+                                         [[maybe_unused]] uint32_t argc, JSTaggedValue arg0,
+                                         [[maybe_unused]] JSTaggedValue arg1)
+{
+    if (!arg0.IsNumber()) {
+        return JSTaggedValue::Hole();
+    }
+    return BuiltinsMath::CeilNumber(arg0.GetNumber());
+}
+
+JSTaggedValue BuiltinsFastCall::MathFloor([[maybe_unused]] JSThread *thread, [[maybe_unused]] JSTaggedValue thisValue,
+                                          [[maybe_unused]] uint32_t argc, JSTaggedValue arg0,
+                                          [[maybe_unused]] JSTaggedValue arg1)
+{
+    if (!arg0.IsNumber()) {
+        return JSTaggedValue::Hole();
+    }
+    return BuiltinsMath::FloorNumber(arg0.GetNumber());
+}
+
+JSTaggedValue BuiltinsFastCall::MathMax([[maybe_unused]] JSThread *thread, [[maybe_unused]] JSTaggedValue thisValue,
+                                        uint32_t argc, JSTaggedValue arg0, JSTaggedValue arg1)
+{
+    return MathMinMax(argc, arg0, arg1, true);
+}
+
+JSTaggedValue BuiltinsFastCall::MathMin([[maybe_unused]] JSThread *thread, [[maybe_unused]] JSTaggedValue thisValue,
+                                        uint32_t argc, JSTaggedValue arg0, JSTaggedValue arg1)
+{
+    return MathMinMax(argc, arg0, arg1, false);
+}
+
+JSTaggedValue BuiltinsFastCall::MathMinMax(uint32_t argc, JSTaggedValue arg0, JSTaggedValue arg1, bool isMax)
+{
+    std::array<JSTaggedValue, MAX_ARGS> args = {arg0, arg1};
+    for (uint32_t i = 0; i < argc; i++) {
+        if (!args[i].IsNumber()) {
+            return JSTaggedValue::Hole();
+        }
+    }
+    // the same as BuiltinsMath::Max and BuiltinsMath::Min, the numbers need no conversion
+    double bound = isMax ? -base::POSITIVE_INFINITY : base::POSITIVE_INFINITY;
+    JSTaggedValue result(bound);
+    for (uint32_t i = 0; i < argc; i++) {
+        double value = args[i].GetNumber();
+        if (std::isnan(value)) {
+            return args[i];
+        }
+        bool isBeyond = isMax ? value > bound : value < bound;
+        // +0 is greater than -0
+        bool isZeroBeyond = value == 0 && bound == 0 && std::signbit(bound) == isMax && std::signbit(value) != isMax;
+        if (isBeyond || isZeroBeyond) {
+            result = args[i];
+            bound = value;
+        }
+    }
+    return result;
+}
+
+JSTaggedValue BuiltinsFastCall::MathRound([[maybe_unused]] JSThread *thread, [[maybe_unused]] JSTaggedValue thisValue,
+                                          [[maybe_unused]] uint32_t argc, JSTaggedValue arg0,
+                                          [[maybe_unused]] JSTaggedValue arg1)
+{
+    if (!arg0.IsNumber()) {
+        return JSTaggedValue::Hole();
+    }
+    return BuiltinsMath::RoundNumber(arg0.GetNumber());
+}
+
+JSTaggedValue BuiltinsFastCall::MathSqrt([[maybe_unused]] JSThread *thread, [[maybe_unused]] JSTaggedValue thisValue,
+                                         [[maybe_unused]] uint32_t argc, JSTaggedValue arg0,
+                                         [[maybe_unused]] JSTaggedValue arg1)
+{
+    if (!arg0.IsNumber()) {
+        return JSTaggedValue::Hole();
+    }
+    return BuiltinsMath::SqrtNumber(arg0.GetNumber());
+}
+
+JSTaggedValue BuiltinsFastCall::ArrayPop(JSThread *thread, JSTaggedValue thisValue, [[maybe_unused]] uint32_t argc,
+                                         [[maybe_unused]] JSTaggedValue arg0, [[maybe_unused]] JSTaggedValue arg1)
+{
+    if (!thisValue.IsStableJSArray(thread)) {
+        return JSTaggedValue::Hole();
+    }
+    return JSStableArray::Pop(thread, JSArray::Cast(thisValue.GetTaggedObject()));
+}
+
+JSTaggedValue BuiltinsFastCall::ArrayPush(JSThread *thread, JSTaggedValue thisValue, uint32_t argc, JSTaggedValue arg0,
+                                          [[maybe_unused]] JSTaggedValue arg1)
+{
+    if (argc != 1 || !thisValue.IsStableJSArray(thread)) {
+        return JSTaggedValue::Hole();
+    }
+    return JSStableArray::PushInPlace(thread, JSArray::Cast(thisValue.GetTaggedObject()), arg0);
+}
+
+JSTaggedValue BuiltinsFastCall::StringCharCodeAt([[maybe_unused]] JSThread *thread, JSTaggedValue thisValue,
+                                                 [[maybe_unused]] uint32_t argc, JSTaggedValue arg0,
+                                                 [[maybe_unused]] JSTaggedValue arg1)
+{
+    if (!thisValue.IsString() || !(arg0.IsInt() || arg0.IsUndefined())) {
+        return JSTaggedValue::Hole();
+    }
+    EcmaString *thisString = EcmaString::Cast(thisValue.GetTaggedObject());
+    int32_t pos = arg0.IsInt() ? arg0.GetInt() : 0;
+    if (pos < 0 || pos >= static_cast<int32_t>(thisString->GetLength())) {
+        return JSTaggedValue(base::NAN_VALUE);
+    }
+    return JSTaggedValue(static_cast<int32_t>(thisString->At<false>(pos)));
+}
+
+JSTaggedValue BuiltinsFastCall::StringIndexOf([[maybe_unused]] JSThread *thread, JSTaggedValue thisValue,
+                                              [[maybe_unused]] uint32_t argc, JSTaggedValue arg0, JSTaggedValue arg1)
+{
+    if (!thisValue.IsString() || !arg0.IsString() || !(arg1.IsInt() || arg1.IsUndefined())) {
+        return JSTaggedValue::Hole();
+    }
+    EcmaString *thisString = EcmaString::Cast(thisValue.GetTaggedObject());
+    EcmaString *searchString = EcmaString::Cast(arg0.GetTaggedObject());
+    // the builtin doesn't find an empty string at the end of this string, leave empty strings to it
+    if (searchString->GetLength() == 0) {
+        return JSTaggedValue::Hole();
+    }
+    int32_t thisLen = static_cast<int32_t>(thisString->GetLength());
+    int32_t pos = arg1.IsInt() ? std::min(std::max(arg1.GetInt(), 0), thisLen) : 0;
+    return JSTaggedValue(thisString->IndexOf(searchString, pos));
+}
+
+JSTaggedValue BuiltinsFastCall::MapGet([[maybe_unused]] JSThread *thread, JSTaggedValue thisValue,
+                                       [[maybe_unused]] uint32_t argc, JSTaggedValue arg0,
+                                       [[maybe_unused]] JSTaggedValue arg1)
+{
+    if (!thisValue.IsJSMap()) {
+        return JSTaggedValue::Hole();
+    }
+    return JSMap::Cast(thisValue.GetTaggedObject())->Get(arg0);
+}
+
+JSTaggedValue BuiltinsFastCall::MapHas([[maybe_unused]] JSThread *thread, JSTaggedValue thisValue,
+                                       [[maybe_unused]] uint32_t argc, JSTaggedValue arg0,
+                                       [[maybe_unused]] JSTaggedValue arg1)
+{
+    if (!thisValue.IsJSMap()) {
+        return JSTaggedValue::Hole();
+    }
+    return JSTaggedValue(JSMap::Cast(thisValue.GetTaggedObject())->Has(arg0));
+}
+
+JSTaggedValue BuiltinsFastCall::MapSet(JSThread *thread, JSTaggedValue thisValue, [[maybe_unused]] uint32_t argc,
+                                       JSTaggedValue arg0, JSTaggedValue arg1)
+{
+    if (!thisValue.IsJSMap() || !LinkedHashMap::IsKey(arg0)) {
+        return JSTaggedValue::Hole();
+    }
+    // a new key which needs a bigger table is left to the builtin
+    JSMap *map = JSMap::Cast(thisValue.GetTaggedObject());
+    if (!LinkedHashMap::Cast(map->GetLinkedMap().GetTaggedObject())->InsertInPlace(thread, arg0, arg1)) {
+        return JSTaggedValue::Hole();
+    }
+    return thisValue;
+}
+
+JSTaggedValue BuiltinsFastCall::SetAdd(JSThread *thread, JSTaggedValue thisValue, [[maybe_unused]] uint32_t argc,
+                                       JSTaggedValue arg0, [[maybe_unused]] JSTaggedValue arg1)
+{
+    if (!thisValue.IsJSSet() || !LinkedHashSet::IsKey(arg0)) {
+        return JSTaggedValue::Hole();
+    }
+    JSSet *set = JSSet::Cast(thisValue.GetTaggedObject());
+    if (!LinkedHashSet::Cast(set->GetLinkedSet().GetTaggedObject())->InsertInPlace(thread, arg0, arg0)) {
+        return JSTaggedValue::Hole();
+    }
+    return thisValue;
+}
+
+JSTaggedValue BuiltinsFastCall::SetHas([[maybe_unused]] JSThread *thread, JSTaggedValue thisValue,
+                                       [[maybe_unused]] uint32_t argc, JSTaggedValue arg0,
+                                       [[maybe_unused]] JSTaggedValue arg1)
+{
+    if (!thisValue.IsJSSet()) {
+        return JSTaggedValue::Hole();
+    }
+    return JSTaggedValue(JSSet::Cast(thisValue.GetTaggedObject())->Has(arg0));
+}
+}  // namespace panda::ecmascript::builtins
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_BUILTINS_BUILTINS_FAST_CALL_H
+#define ECMASCRIPT_BUILTINS_BUILTINS_FAST_CALL_H
+
+#include "ecmascript/js_tagged_value.h"
+#include "ecmascript/js_thread.h"
+
+namespace panda::ecmascript::builtins {
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define BUILTINS_WITH_FAST_CALL(V)                    \
+    V(MathAbs, BuiltinsMath::Abs)                     \
+    V(MathCeil, BuiltinsMath::Ceil)                   \
+    V(MathFloor, BuiltinsMath::Floor)                 \
+    V(MathMax, BuiltinsMath::Max)                     \
+    V(MathMin, BuiltinsMath::Min)                     \
+    V(MathRound, BuiltinsMath::Round)                 \
+    V(MathSqrt, BuiltinsMath::Sqrt)                   \
+    V(ArrayPop, BuiltinsArray::Pop)                   \
+    V(ArrayPush, BuiltinsArray::Push)                 \
+    V(StringCharCodeAt, BuiltinsString::CharCodeAt)   \
+    V(StringIndexOf, BuiltinsString::IndexOf)         \
+    V(MapGet, BuiltinsMap::Get)                       \
+    V(MapHas, BuiltinsMap::Has)                       \
+    V(MapSet, BuiltinsMap::Set)                       \
+    V(SetAdd, BuiltinsSet::Add)                       \
+    V(SetHas, BuiltinsSet::Has)
+
+// BuiltinsFastCall calls the most common builtins with the tagged values of their arguments, without the frame, the
+// EcmaRuntimeCallInfo and the handles of a call of a native function. A fast call covers the common case of its
+// builtin, e.g. a number for Math.floor or a stable array for Array.prototype.push, and returns hole for the others,
+// then the caller calls the builtin as usual. It never allocates on the heap nor throws, so the values need no
+// handles, and the asm interpreter calls it as a runtime stub without gc.
+// The id of the fast call of a builtin is stored in its method when the method is created.
+class BuiltinsFastCall {
+public:
+    enum Id : uint8_t {
+        NONE = 0,
+#define DEF_FAST_CALL_ID(name, entry) name,
+        BUILTINS_WITH_FAST_CALL(DEF_FAST_CALL_ID)
+#undef DEF_FAST_CALL_ID
+        ID_COUNT
+    };
+
+    // the callers call the builtin as usual when it gets more arguments
+    static constexpr uint32_t MAX_ARGS = 2;
+
+    static uint8_t GetBuiltinId(const void *entry);
+
+    // The arguments beyond argc are undefined.
+    static JSTaggedValue Call(JSThread *thread, uint8_t id, JSTaggedValue thisValue, uint32_t argc,
+                              JSTaggedValue arg0, JSTaggedValue arg1);
+
+private:
+#define DECL_FAST_CALL(name, entry)                                                                     \
+    static JSTaggedValue name(JSThread *thread, JSTaggedValue thisValue, uint32_t argc, JSTaggedValue arg0, \
+                              JSTaggedValue arg1);
+    BUILTINS_WITH_FAST_CALL(DECL_FAST_CALL)
+#undef DECL_FAST_CALL
+
+    static JSTaggedValue MathMinMax(uint32_t argc, JSTaggedValue arg0, JSTaggedValue arg1, bool isMax);
+};
+}  // namespace panda::ecmascript::builtins
+#endif  // ECMASCRIPT_BUILTINS_BUILTINS_FAST_CALL_H
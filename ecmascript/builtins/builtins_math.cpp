@@ -15,6 +15,7 @@
 
 #include "builtins_math.h"
 #include <cmath>
+#include <limits>
 #include <random>
 #include "ecmascript/ecma_runtime_call_info.h"
 #include "ecmascript/js_tagged_number.h"
@@ -32,13 +33,23 @@ JSTaggedValue BuiltinsMath::Abs(EcmaRuntimeCallInfo *argv)
     [[maybe_unused]] EcmaHandleScope handleScope(thread);
     JSHandle<JSTaggedValue> msg = GetCallArg(argv, 0);
     JSTaggedNumber numberValue = JSTaggedValue::ToNumber(thread, msg);
+    return AbsNumber(numberValue);
+}
+
+JSTaggedValue BuiltinsMath::AbsNumber(JSTaggedNumber numberValue)
+{
     if (numberValue.IsDouble()) {
         // if number_value is double,NaN,Undefine, deal in this case
         // if number_value is a String ,which can change to double. e.g."100",deal in this case
         return GetTaggedDouble(std::fabs(numberValue.GetDouble()));
     }
     // if number_value is int,boolean,null, deal in this case
-    return GetTaggedInt(std::abs(numberValue.GetInt()));
+    int32_t value = numberValue.GetInt();
+    if (value == std::numeric_limits<int32_t>::min()) {
+        // the absolute value is out of the int range
+        return GetTaggedDouble(-static_cast<double>(value));
+    }
+    return GetTaggedInt(std::abs(value));
 }
 
 // 20.2.2.2
@@ -202,7 +213,11 @@ JSTaggedValue BuiltinsMath::Ceil(EcmaRuntimeCallInfo *argv)
     [[maybe_unused]] EcmaHandleScope handleScope(thread);
     JSHandle<JSTaggedValue> msg = GetCallArg(argv, 0);
     JSTaggedNumber numberValue = JSTaggedValue::ToNumber(thread, msg);
-    double value = numberValue.GetNumber();
+    return CeilNumber(numberValue.GetNumber());
+}
+
+JSTaggedValue BuiltinsMath::CeilNumber(double value)
+{
     double result = base::NAN_VALUE;
     // If value is NaN or -NaN, +infinite, -infinite,return value
     if (!std::isfinite(value)) {
@@ -317,7 +332,11 @@ JSTaggedValue BuiltinsMath::Floor(EcmaRuntimeCallInfo *argv)
     [[maybe_unused]] EcmaHandleScope handleScope(thread);
     JSHandle<JSTaggedValue> msg = GetCallArg(argv, 0);
     JSTaggedNumber numberValue = JSTaggedValue::ToNumber(thread, msg);
-    double value = numberValue.GetNumber();
+    return FloorNumber(numberValue.GetNumber());
+}
+
+JSTaggedValue BuiltinsMath::FloorNumber(double value)
+{
     double result = base::NAN_VALUE;
     // If value is NaN or -NaN, +infinite, -infinite, +0, -0, return value
     if (!std::isfinite(value) || value == 0) {
@@ -601,7 +620,11 @@ JSTaggedValue BuiltinsMath::Round(EcmaRuntimeCallInfo *argv)
     [[maybe_unused]] EcmaHandleScope handleScope(thread);
     JSHandle<JSTaggedValue> msg = GetCallArg(argv, 0);
     JSTaggedNumber numberValue = JSTaggedValue::ToNumber(thread, msg);
-    double value = numberValue.GetNumber();
+    return RoundNumber(numberValue.GetNumber());
+}
+
+JSTaggedValue BuiltinsMath::RoundNumber(double value)
+{
     auto result = base::NAN_VALUE;
     const double diff = 0.5;
     double absValue = std::abs(value);
@@ -696,7 +719,11 @@ JSTaggedValue BuiltinsMath::Sqrt(EcmaRuntimeCallInfo *argv)
     [[maybe_unused]] EcmaHandleScope handleScope(thread);
     JSHandle<JSTaggedValue> msg = GetCallArg(argv, 0);
     JSTaggedNumber numberValue = JSTaggedValue::ToNumber(thread, msg);
-    double value = numberValue.GetNumber();
+    return SqrtNumber(numberValue.GetNumber());
+}
+
+JSTaggedValue BuiltinsMath::SqrtNumber(double value)
+{
     double result = base::NAN_VALUE;
     // If value is negative, include -NaN and -Infinity but not -0.0, the result is NaN
     if (std::signbit(value) && value != 0) {
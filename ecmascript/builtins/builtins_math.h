@@ -17,6 +17,7 @@
 #define ECMASCRIPT_BUILTINS_BUILTINS_MATH_H
 
 #include "ecmascript/base/builtins_base.h"
+#include "ecmascript/js_tagged_number.h"
 
 namespace panda::ecmascript::builtins {
 class BuiltinsMath : public base::BuiltinsBase {
@@ -107,6 +108,13 @@ public:
     static JSTaggedValue Tanh(EcmaRuntimeCallInfo *argv);
     // 20.2.2.35
     static JSTaggedValue Trunc(EcmaRuntimeCallInfo *argv);
+
+    // The results of the builtins above for an argument which is already a number, shared with BuiltinsFastCall.
+    static JSTaggedValue AbsNumber(JSTaggedNumber numberValue);
+    static JSTaggedValue CeilNumber(double value);
+    static JSTaggedValue FloorNumber(double value);
+    static JSTaggedValue RoundNumber(double value);
+    static JSTaggedValue SqrtNumber(double value);
 };
 }  // namespace panda::ecmascript::builtins
 #endif  // ECMASCRIPT_BUILTINS_BUILTINS_MATH_H
@@ -386,7 +386,6 @@ JSTaggedValue BuiltinsPromise::PerformPromiseThen(JSThread *thread, const JSHand
 {
     auto ecmaVm = thread->GetEcmaVM();
     JSHandle<job::MicroJobQueue> job = ecmaVm->GetMicroJobQueue();
-    JSHandle<GlobalEnv> env = ecmaVm->GetGlobalEnv();
     ObjectFactory *factory = ecmaVm->GetFactory();
     JSMutableHandle<JSTaggedValue> fulfilled(thread, onFulfilled.GetTaggedValue());
     auto globalConst = thread->GlobalConstants();
@@ -416,26 +415,23 @@ JSTaggedValue BuiltinsPromise::PerformPromiseThen(JSThread *thread, const JSHand
         newQueue = TaggedQueue::Push(thread, rejectReactions, JSHandle<JSTaggedValue>::Cast(rejectReaction));
         promise->SetPromiseRejectReactions(thread, JSTaggedValue(newQueue));
     } else if (state == PromiseState::FULFILLED) {
-        JSHandle<TaggedArray> argv = factory->NewTaggedArray(2);  // 2: 2 means two args stored in array
-        argv->Set(thread, 0, fulfillReaction.GetTaggedValue());
-        argv->Set(thread, 1, promise->GetPromiseResult());
-
-        JSHandle<JSFunction> promiseReactionsJob(env->GetPromiseReactionJob());
-        job::MicroJobQueue::EnqueueJob(thread, job, job::QueueType::QUEUE_PROMISE, promiseReactionsJob, argv);
+        JSHandle<JSTaggedValue> result(thread, promise->GetPromiseResult());
+        job::MicroJobQueue::EnqueuePromiseReactionJob(thread, job, fulfillReaction, result);
     } else if (state == PromiseState::REJECTED) {
-        JSHandle<TaggedArray> argv = factory->NewTaggedArray(2);  // 2: 2 means two args stored in array
-        argv->Set(thread, 0, rejectReaction.GetTaggedValue());
-        argv->Set(thread, 1, promise->GetPromiseResult());
+        JSHandle<JSTaggedValue> result(thread, promise->GetPromiseResult());
         // When a handler is added to a rejected promise for the first time, it is called with its operation
         // argument set to "handle".
         if (!promise->GetPromiseIsHandled()) {
             JSHandle<JSTaggedValue> reason(thread, JSTaggedValue::Null());
             thread->GetEcmaVM()->PromiseRejectionTracker(promise, reason, PromiseRejectionEvent::HANDLE);
         }
-        JSHandle<JSFunction> promiseReactionsJob(env->GetPromiseReactionJob());
-        job::MicroJobQueue::EnqueueJob(thread, job, job::QueueType::QUEUE_PROMISE, promiseReactionsJob, argv);
+        job::MicroJobQueue::EnqueuePromiseReactionJob(thread, job, rejectReaction, result);
     }
     promise->SetPromiseIsHandled(true);
+    // the capability is undefined when the caller does not use the result, as for an await
+    if (capability.GetTaggedValue().IsUndefined()) {
+        return JSTaggedValue::Undefined();
+    }
     return capability->GetPromise();
 }
 
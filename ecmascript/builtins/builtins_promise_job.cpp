@@ -33,14 +33,33 @@ JSTaggedValue BuiltinsPromiseJob::PromiseReactionJob(EcmaRuntimeCallInfo *argv)
     // 1. Assert: reaction is a PromiseReaction Record.
     JSHandle<JSTaggedValue> value = GetCallArg(argv, 0);
     ASSERT(value->IsPromiseReaction());
-    JSHandle<PromiseReaction> reaction = JSHandle<PromiseReaction>::Cast(value);
-    JSMutableHandle<JSTaggedValue> argument(GetCallArg(argv, 1));
+    return ExecutePromiseReaction(thread, JSHandle<PromiseReaction>::Cast(value), GetCallArg(argv, 1));
+}
 
+JSTaggedValue BuiltinsPromiseJob::ExecutePromiseReaction(JSThread *thread, const JSHandle<PromiseReaction> &reaction,
+                                                         const JSHandle<JSTaggedValue> &value)
+{
+    [[maybe_unused]] EcmaHandleScope handleScope(thread);
+    JSMutableHandle<JSTaggedValue> argument(thread, value.GetTaggedValue());
     const GlobalEnvConstants *globalConst = thread->GlobalConstants();
     // 2. Let promiseCapability be reaction.[[Capabilities]].
     JSHandle<PromiseCapability> capability(thread, reaction->GetPromiseCapability());
     // 3. Let handler be reaction.[[Handler]].
     JSHandle<JSTaggedValue> handler(thread, reaction->GetHandler());
+    // A reaction without a capability only runs its handler, its result is not used.
+    if (capability.GetTaggedValue().IsUndefined()) {
+        if (!handler->IsString()) {
+            EcmaRuntimeCallInfo *info =
+                EcmaInterpreter::NewRuntimeCallInfo(thread, handler, globalConst->GetHandledUndefined(),
+                                                    globalConst->GetHandledUndefined(), 1);
+            RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+            info->SetCallArg(argument.GetTaggedValue());
+            [[maybe_unused]] JSTaggedValue result = JSFunction::Call(info);
+            // as a throwaway promise would, the reaction drops an abrupt completion of the handler
+            thread->ClearException();
+        }
+        return JSTaggedValue::Undefined();
+    }
     JSMutableHandle<JSTaggedValue> call(thread, capability->GetResolve());
     const int32_t argsLength = 1;
     JSHandle<JSTaggedValue> undefined = globalConst->GetHandledUndefined();
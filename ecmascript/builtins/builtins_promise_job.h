@@ -23,6 +23,10 @@ class BuiltinsPromiseJob : base::BuiltinsBase {
 public:
     static JSTaggedValue PromiseReactionJob(EcmaRuntimeCallInfo *argv);
     static JSTaggedValue PromiseResolveThenableJob(EcmaRuntimeCallInfo *argv);
+
+    // The steps of PromiseReactionJob, which the job queue runs without a call of the job function.
+    static JSTaggedValue ExecutePromiseReaction(JSThread *thread, const JSHandle<PromiseReaction> &reaction,
+                                                const JSHandle<JSTaggedValue> &value);
 };
 }  // namespace panda::ecmascript::builtins
 #endif  // ECMASCRIPT_JS_PROMISE_JOB_H
@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+#include "ecmascript/base/builtins_base.h"
+#include "ecmascript/builtins/builtins_array.h"
+#include "ecmascript/builtins/builtins_fast_call.h"
+#include "ecmascript/builtins/builtins_map.h"
+#include "ecmascript/builtins/builtins_math.h"
+#include "ecmascript/ecma_runtime_call_info.h"
+#include "ecmascript/ecma_vm.h"
+#include "ecmascript/global_env.h"
+#include "ecmascript/js_array.h"
+#include "ecmascript/js_function.h"
+#include "ecmascript/js_map.h"
+#include "ecmascript/js_set.h"
+#include "ecmascript/js_tagged_value-inl.h"
+#include "ecmascript/js_thread.h"
+#include "ecmascript/object_factory.h"
+#include "ecmascript/tests/test_helper.h"
+
+using namespace panda::ecmascript;
+using namespace panda::ecmascript::builtins;
+
+namespace panda::test {
+class BuiltinsFastCallTest : public testing::Test {
+public:
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "SetUpTestCase";
+    }
+
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "TearDownCase";
+    }
+
+    void SetUp() override
+    {
+        TestHelper::CreateEcmaVMWithScope(instance, thread, scope);
+    }
+
+    void TearDown() override
+    {
+        TestHelper::DestroyEcmaVMWithScope(instance, scope);
+    }
+
+    JSTaggedValue Call(uint8_t id, JSTaggedValue thisValue, uint32_t argc,
+                       JSTaggedValue arg0 = JSTaggedValue::Undefined(), JSTaggedValue arg1 = JSTaggedValue::Undefined())
+    {
+        return BuiltinsFastCall::Call(thread, id, thisValue, argc, arg0, arg1);
+    }
+
+    EcmaVM *instance {nullptr};
+    EcmaHandleScope *scope {nullptr};
+    JSThread *thread {nullptr};
+};
+
+HWTEST_F_L0(BuiltinsFastCallTest, BuiltinId)
+{
+    EXPECT_EQ(BuiltinsFastCall::GetBuiltinId(reinterpret_cast<void *>(BuiltinsMath::Floor)),
+              BuiltinsFastCall::MathFloor);
+    EXPECT_EQ(BuiltinsFastCall::GetBuiltinId(reinterpret_cast<void *>(BuiltinsMath::Sin)), BuiltinsFastCall::NONE);
+
+    // the methods of the builtins get the id when they are created
+    JSHandle<GlobalEnv> env = instance->GetGlobalEnv();
+    JSHandle<JSTaggedValue> math = env->GetMathFunction();
+    JSHandle<JSTaggedValue> floorKey(instance->GetFactory()->NewFromASCII("floor"));
+    JSHandle<JSTaggedValue> floor = JSObject::GetProperty(thread, math, floorKey).GetValue();
+    EXPECT_EQ(JSFunction::Cast(floor->GetTaggedObject())->GetMethod()->GetBuiltinId(),
+              BuiltinsFastCall::MathFloor);
+}
+
+HWTEST_F_L0(BuiltinsFastCallTest, Math)
+{
+    JSTaggedValue undefined = JSTaggedValue::Undefined();
+    EXPECT_EQ(Call(BuiltinsFastCall::MathFloor, undefined, 1, JSTaggedValue(1.5)).GetDouble(), 1.0);
+    EXPECT_EQ(Call(BuiltinsFastCall::MathAbs, undefined, 1, JSTaggedValue(-3)).GetInt(), 3);
+    JSTaggedValue absMin = Call(BuiltinsFastCall::MathAbs, undefined, 1,
+                                JSTaggedValue(std::numeric_limits<int32_t>::min()));
+    EXPECT_EQ(absMin.GetDouble(), -static_cast<double>(std::numeric_limits<int32_t>::min()));
+
+    // +0 is greater than -0, NaN wins
+    JSTaggedValue max = Call(BuiltinsFastCall::MathMax, undefined, 2, JSTaggedValue(-0.0), JSTaggedValue(0));
+    EXPECT_EQ(max.GetRawData(), JSTaggedValue(0).GetRawData());
+    JSTaggedValue min = Call(BuiltinsFastCall::MathMin, undefined, 2, JSTaggedValue(0), JSTaggedValue(-0.0));
+    EXPECT_TRUE(std::signbit(min.GetDouble()));
+    EXPECT_TRUE(std::isnan(Call(BuiltinsFastCall::MathMin, undefined, 2, JSTaggedValue(1),
+                                JSTaggedValue(base::NAN_VALUE)).GetDouble()));
+    EXPECT_EQ(Call(BuiltinsFastCall::MathMax, undefined, 0).GetDouble(), -base::POSITIVE_INFINITY);
+
+    // other values than numbers need a conversion by the builtin
+    JSTaggedValue str = instance->GetFactory()->NewFromASCII("1").GetTaggedValue();
+    EXPECT_TRUE(Call(BuiltinsFastCall::MathFloor, undefined, 1, str).IsHole());
+    EXPECT_TRUE(Call(BuiltinsFastCall::MathMax, undefined, 2, JSTaggedValue(1), str).IsHole());
+}
+
+HWTEST_F_L0(BuiltinsFastCallTest, MathCeilRoundSqrt)
+{
+    JSTaggedValue undefined = JSTaggedValue::Undefined();
+    EXPECT_EQ(Call(BuiltinsFastCall::MathCeil, undefined, 1, JSTaggedValue(1.2)).GetDouble(), 2.0);
+    JSTaggedValue ceil = Call(BuiltinsFastCall::MathCeil, undefined, 1, JSTaggedValue(-0.5));
+    EXPECT_TRUE(ceil.GetDouble() == 0 && std::signbit(ceil.GetDouble()));
+
+    // halves round up, and -0.5 gives -0
+    EXPECT_EQ(Call(BuiltinsFastCall::MathRound, undefined, 1, JSTaggedValue(2.5)).GetNumber(), 3.0);
+    EXPECT_EQ(Call(BuiltinsFastCall::MathRound, undefined, 1, JSTaggedValue(-2.5)).GetNumber(), -2.0);
+    JSTaggedValue round = Call(BuiltinsFastCall::MathRound, undefined, 1, JSTaggedValue(-0.5));
+    EXPECT_TRUE(round.IsDouble() && round.GetDouble() == 0 && std::signbit(round.GetDouble()));
+
+    EXPECT_EQ(Call(BuiltinsFastCall::MathSqrt, undefined, 1, JSTaggedValue(9)).GetDouble(), 3.0);
+    JSTaggedValue sqrt = Call(BuiltinsFastCall::MathSqrt, undefined, 1, JSTaggedValue(-0.0));
+    EXPECT_TRUE(sqrt.GetDouble() == 0 && std::signbit(sqrt.GetDouble()));
+    EXPECT_TRUE(std::isnan(Call(BuiltinsFastCall::MathSqrt, undefined, 1, JSTaggedValue(-1)).GetDouble()));
+
+    JSTaggedValue str = instance->GetFactory()->NewFromASCII("4").GetTaggedValue();
+    EXPECT_TRUE(Call(BuiltinsFastCall::MathCeil, undefined, 1, str).IsHole());
+    EXPECT_TRUE(Call(BuiltinsFastCall::MathRound, undefined, 1, str).IsHole());
+    EXPECT_TRUE(Call(BuiltinsFastCall::MathSqrt, undefined, 1, str).IsHole());
+}
+
+HWTEST_F_L0(BuiltinsFastCallTest, ArrayPushPop)
+{
+    JSHandle<JSTaggedValue> array(JSArray::ArrayCreate(thread, JSTaggedNumber(0)));
+    // the empty array has no room for the element
+    EXPECT_TRUE(Call(BuiltinsFastCall::ArrayPush, array.GetTaggedValue(), 1, JSTaggedValue(1)).IsHole());
+
+    auto ecmaRuntimeCallInfo = TestHelper::CreateEcmaRuntimeCallInfo(thread, JSTaggedValue::Undefined(), 6);
+    ecmaRuntimeCallInfo->SetFunction(JSTaggedValue::Undefined());
+    ecmaRuntimeCallInfo->SetThis(array.GetTaggedValue());
+    ecmaRuntimeCallInfo->SetCallArg(0, JSTaggedValue(1));
+    [[maybe_unused]] auto prev = TestHelper::SetupFrame(thread, ecmaRuntimeCallInfo);
+    EXPECT_EQ(BuiltinsArray::Push(ecmaRuntimeCallInfo).GetInt(), 1);
+    TestHelper::TearDownFrame(thread, prev);
+
+    EXPECT_EQ(Call(BuiltinsFastCall::ArrayPush, array.GetTaggedValue(), 1, JSTaggedValue(2)).GetInt(), 2);
+    EXPECT_EQ(JSArray::Cast(array->GetTaggedObject())->GetArrayLength(), 2U);
+    // an object needs a transition of the elements kind
+    JSTaggedValue obj = instance->GetFactory()->NewEmptyJSObject().GetTaggedValue();
+    EXPECT_TRUE(Call(BuiltinsFastCall::ArrayPush, array.GetTaggedValue(), 1, obj).IsHole());
+
+    EXPECT_EQ(Call(BuiltinsFastCall::ArrayPop, array.GetTaggedValue(), 0).GetInt(), 2);
+    EXPECT_EQ(Call(BuiltinsFastCall::ArrayPop, array.GetTaggedValue(), 0).GetInt(), 1);
+    EXPECT_TRUE(Call(BuiltinsFastCall::ArrayPop, array.GetTaggedValue(), 0).IsUndefined());
+}
+
+HWTEST_F_L0(BuiltinsFastCallTest, String)
+{
+    ObjectFactory *factory = instance->GetFactory();
+    JSTaggedValue str = factory->NewFromASCII("abcabc").GetTaggedValue();
+    JSTaggedValue search = factory->NewFromASCII("ca").GetTaggedValue();
+    EXPECT_EQ(Call(BuiltinsFastCall::StringCharCodeAt, str, 1, JSTaggedValue(1)).GetInt(), 'b');
+    EXPECT_EQ(Call(BuiltinsFastCall::StringCharCodeAt, str, 0).GetInt(), 'a');
+    EXPECT_TRUE(std::isnan(Call(BuiltinsFastCall::StringCharCodeAt, str, 1, JSTaggedValue(6)).GetDouble()));
+    EXPECT_EQ(Call(BuiltinsFastCall::StringIndexOf, str, 1, search).GetInt(), 2);
+    EXPECT_EQ(Call(BuiltinsFastCall::StringIndexOf, str, 2, search, JSTaggedValue(3)).GetInt(), -1);
+    EXPECT_EQ(Call(BuiltinsFastCall::StringIndexOf, str, 2, search, JSTaggedValue(-1)).GetInt(), 2);
+    EXPECT_TRUE(Call(BuiltinsFastCall::StringIndexOf, str, 1, JSTaggedValue(1)).IsHole());
+}
+
+HWTEST_F_L0(BuiltinsFastCallTest, MapSetGetHas)
+{
+    JSHandle<GlobalEnv> env = instance->GetGlobalEnv();
+    JSHandle<JSTaggedValue> constructor = env->GetBuiltinsMapFunction();
+    JSHandle<JSMap> map = JSHandle<JSMap>::Cast(
+        instance->GetFactory()->NewJSObjectByConstructor(JSHandle<JSFunction>(constructor), constructor));
+    JSHandle<LinkedHashMap> table(LinkedHashMap::Create(thread));
+    map->SetLinkedMap(thread, table);
+
+    JSTaggedValue key(1);
+    EXPECT_FALSE(Call(BuiltinsFastCall::MapHas, map.GetTaggedValue(), 1, key).ToBoolean());
+    EXPECT_EQ(Call(BuiltinsFastCall::MapSet, map.GetTaggedValue(), 2, key, JSTaggedValue(10)).GetRawData(),
+              map.GetTaggedValue().GetRawData());
+    EXPECT_TRUE(Call(BuiltinsFastCall::MapHas, map.GetTaggedValue(), 1, key).ToBoolean());
+    EXPECT_EQ(Call(BuiltinsFastCall::MapGet, map.GetTaggedValue(), 1, key).GetInt(), 10);
+    EXPECT_TRUE(Call(BuiltinsFastCall::MapGet, map.GetTaggedValue(), 1, JSTaggedValue(2)).IsUndefined());
+    // the map is not the receiver
+    EXPECT_TRUE(Call(BuiltinsFastCall::MapGet, JSTaggedValue::Undefined(), 1, key).IsHole());
+
+    // new keys are left to the builtin once the table is full
+    int32_t count = 0;
+    while (!Call(BuiltinsFastCall::MapSet, map.GetTaggedValue(), 2, JSTaggedValue(count), key).IsHole()) {
+        count++;
+    }
+    EXPECT_EQ(map->GetSize(), count);
+    EXPECT_FALSE(Call(BuiltinsFastCall::MapSet, map.GetTaggedValue(), 2, key, key).IsHole());
+}
+
+HWTEST_F_L0(BuiltinsFastCallTest, SetAddHas)
+{
+    JSHandle<GlobalEnv> env = instance->GetGlobalEnv();
+    JSHandle<JSTaggedValue> constructor = env->GetBuiltinsSetFunction();
+    JSHandle<JSSet> set = JSHandle<JSSet>::Cast(
+        instance->GetFactory()->NewJSObjectByConstructor(JSHandle<JSFunction>(constructor), constructor));
+    JSHandle<LinkedHashSet> table(LinkedHashSet::Create(thread));
+    set->SetLinkedSet(thread, table);
+
+    JSTaggedValue key(1);
+    EXPECT_FALSE(Call(BuiltinsFastCall::SetHas, set.GetTaggedValue(), 1, key).ToBoolean());
+    EXPECT_EQ(Call(BuiltinsFastCall::SetAdd, set.GetTaggedValue(), 1, key).GetRawData(),
+              set.GetTaggedValue().GetRawData());
+    EXPECT_TRUE(Call(BuiltinsFastCall::SetHas, set.GetTaggedValue(), 1, key).ToBoolean());
+    EXPECT_FALSE(Call(BuiltinsFastCall::SetHas, set.GetTaggedValue(), 1, JSTaggedValue(2)).ToBoolean());
+    // the set is not the receiver
+    EXPECT_TRUE(Call(BuiltinsFastCall::SetHas, JSTaggedValue::Undefined(), 1, key).IsHole());
+    EXPECT_TRUE(Call(BuiltinsFastCall::SetAdd, JSTaggedValue::Undefined(), 1, key).IsHole());
+
+    // new keys are left to the builtin once the table is full, the keys already in the set are not
+    int32_t count = 1;
+    while (!Call(BuiltinsFastCall::SetAdd, set.GetTaggedValue(), 1, JSTaggedValue(count + 1)).IsHole()) {
+        count++;
+    }
+    EXPECT_EQ(set->GetSize(), count);
+    EXPECT_FALSE(Call(BuiltinsFastCall::SetHas, set.GetTaggedValue(), 1, JSTaggedValue(count + 1)).ToBoolean());
+    EXPECT_FALSE(Call(BuiltinsFastCall::SetAdd, set.GetTaggedValue(), 1, key).IsHole());
+    EXPECT_EQ(set->GetSize(), count);
+}
+
+// The overhead of a call of Math.floor through an EcmaRuntimeCallInfo and a frame, against the fast call.
+HWTEST_F_L0(BuiltinsFastCallTest, CallOverhead)
+{
+    static constexpr int32_t CALLS = 1000000;
+    JSTaggedValue arg(1.5);
+    auto start = std::chrono::steady_clock::now();
+    for (int32_t i = 0; i < CALLS; i++) {
+        auto ecmaRuntimeCallInfo = TestHelper::CreateEcmaRuntimeCallInfo(thread, JSTaggedValue::Undefined(), 6);
+        ecmaRuntimeCallInfo->SetFunction(JSTaggedValue::Undefined());
+        ecmaRuntimeCallInfo->SetThis(JSTaggedValue::Undefined());
+        ecmaRuntimeCallInfo->SetCallArg(0, arg);
+        [[maybe_unused]] auto prev = TestHelper::SetupFrame(thread, ecmaRuntimeCallInfo);
+        JSTaggedValue result = BuiltinsMath::Floor(ecmaRuntimeCallInfo);
+        TestHelper::TearDownFrame(thread, prev);
+        ASSERT_EQ(result.GetDouble(), 1.0);
+    }
+    auto builtinTime = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int32_t i = 0; i < CALLS; i++) {
+        JSTaggedValue result = Call(BuiltinsFastCall::MathFloor, JSTaggedValue::Undefined(), 1, arg);
+        ASSERT_EQ(result.GetDouble(), 1.0);
+    }
+    auto fastCallTime = std::chrono::steady_clock::now() - start;
+    GTEST_LOG_(INFO) << "Math.floor x" << CALLS << ", builtin: "
+                     << std::chrono::duration_cast<std::chrono::microseconds>(builtinTime).count()
+                     << "us, fast call: "
+                     << std::chrono::duration_cast<std::chrono::microseconds>(fastCallTime).count() << "us";
+}
+}  // namespace panda::test
@@ -174,7 +174,11 @@ namespace panda::ecmascript::kungfu {
     T(HandleMovV4V4)                                     \
     T(HandleJnezImm8)                                    \
     T(HandleJnezImm16)                                   \
-    T(ExceptionHandler)
+    T(ExceptionHandler)                                  \
+    T(HandleLdaDynV8StaDynV8)                            \
+    T(HandleStaDynV8LdaDynV8)                            \
+    T(HandleStaDynV8CallIThisRangeDynPrefImm16V8)        \
+    T(HandleLessDynPrefV8JeqzImm8)
 
 #define ASM_INTERPRETER_BC_HELPER_STUB_LIST(V)           \
     V(SingleStepDebugging)                               \
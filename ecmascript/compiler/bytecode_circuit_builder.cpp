@@ -18,6 +18,7 @@
 #include "ecmascript/base/number_helper.h"
 #include "ecmascript/compiler/gate_accessor.h"
 #include "ecmascript/ts_types/ts_loader.h"
+#include "libpandafile/bytecode_instruction-inl.h"
 
 namespace panda::ecmascript::kungfu {
 void BytecodeCircuitBuilder::BytecodeToCircuit()
@@ -2503,6 +2504,160 @@ void BytecodeCircuitBuilder::BuildCircuit()
     }
 }
 
+// Resuming a generator in the interpreter is left to its own paths, and a frame with extra arguments can't be
+// rebuilt from the declared registers.
+bool BytecodeCircuitBuilder::CanDeoptimize()
+{
+    if (!suspendAndResumeGates_.empty() || method_->HaveExtraWithCallField()) {
+        return false;
+    }
+    if (liveIns_.empty()) {
+        ComputeLiveness();
+    }
+    // the locals and the acc have no def-site before they are written, they are undefined in the interpreter
+    const auto &entryLive = liveIns_.front();
+    auto localsEnd = entryLive.begin() + method_->GetNumVregs();
+    return std::none_of(entryLive.begin(), localsEnd, [](bool live) { return live; }) && !entryLive.back();
+}
+
+void BytecodeCircuitBuilder::UpdateLiveness(const BytecodeInfo &info, std::vector<bool> &live) const
+{
+    for (const auto &vreg : info.vregOut) {
+        live[vreg] = false;
+    }
+    if (info.accOut) {
+        live.back() = false;
+    }
+    for (const auto &input : info.inputs) {
+        if (std::holds_alternative<VirtualRegister>(input)) {
+            live[std::get<VirtualRegister>(input).GetId()] = true;
+        }
+    }
+    if (info.accIn) {
+        live.back() = true;
+    }
+}
+
+std::vector<bool> BytecodeCircuitBuilder::ComputeLiveBefore(const BytecodeRegion &bb, const uint8_t *pc)
+{
+    size_t numValues = method_->GetNumVregs() + method_->GetNumArgs() + 1;  // 1: acc
+    std::vector<bool> live(numValues, false);
+    std::vector<bool> catchLive(numValues, false);
+    for (const auto *succ : bb.succs) {
+        const auto &succLive = liveIns_[succ->id];
+        std::transform(live.begin(), live.end(), succLive.begin(), live.begin(), std::logical_or<bool>());
+    }
+    for (const auto *catchBlock : bb.catchs) {
+        const auto &handlerLive = liveIns_[catchBlock->id];
+        std::transform(catchLive.begin(), catchLive.end(), handlerLive.begin(), catchLive.begin(),
+                       std::logical_or<bool>());
+    }
+    // the acc of a catch block is the exception thrown
+    catchLive.back() = false;
+    std::transform(live.begin(), live.end(), catchLive.begin(), live.begin(), std::logical_or<bool>());
+
+    std::vector<uint8_t *> instList;
+    for (auto pcIter = bb.start; pcIter <= bb.end; pcIter += GetBytecodeInfo(pcIter).offset) {
+        instList.push_back(pcIter);
+    }
+    for (auto iter = instList.rbegin(); iter != instList.rend() && *iter >= pc; iter++) {
+        UpdateLiveness(GetBytecodeInfo(*iter), live);
+        // each bytecode of a try block may throw to its catch blocks
+        std::transform(live.begin(), live.end(), catchLive.begin(), live.begin(), std::logical_or<bool>());
+    }
+    return live;
+}
+
+void BytecodeCircuitBuilder::ComputeLiveness()
+{
+    size_t numValues = method_->GetNumVregs() + method_->GetNumArgs() + 1;  // 1: acc
+    liveIns_.assign(graph_.size(), std::vector<bool>(numValues, false));
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (auto bb = graph_.rbegin(); bb != graph_.rend(); bb++) {
+            if (bb->isDead) {
+                continue;
+            }
+            auto live = ComputeLiveBefore(*bb, bb->start);
+            if (live != liveIns_[bb->id]) {
+                liveIns_[bb->id] = std::move(live);
+                changed = true;
+            }
+        }
+    }
+}
+
+// The values follow FrameStateIndex. The dead registers are not kept alive by the deopt call, the interpreter
+// never reads them before it writes them again.
+GateRef BytecodeCircuitBuilder::NewFrameState(GateRef gate)
+{
+    const auto &[bbId, pc] = jsgateToBytecode_.at(gate);
+    auto iter = frameStates_.find(pc);
+    if (iter != frameStates_.end()) {
+        return iter->second;
+    }
+    // the context is resumed after a suspendgenerator, so one has to fit before the bytecode
+    auto pcOffset = static_cast<uint64_t>(pc - method_->GetBytecodeArray());
+    if (pcOffset < BytecodeInstruction::Size(BytecodeInstruction::Format::PREF_V8_V8) || !CanDeoptimize()) {
+        return Circuit::NullGate();
+    }
+    auto newConst = [this](uint64_t value, GateType type) {
+        return circuit_.NewGate(OpCode(OpCode::CONSTANT), MachineType::I64, value,
+                                {Circuit::GetCircuitRoot(OpCode(OpCode::CONSTANT_LIST))}, type);
+    };
+    auto live = ComputeLiveBefore(graph_[bbId], pc);
+    auto numVregs = method_->GetNumVregs();
+    auto numRegs = numVregs + method_->GetNumArgs();
+    std::vector<GateRef> values;
+    values.emplace_back(newConst(pcToBCOffset_.at(const_cast<uint8_t *>(pc)), GateType::NJSValue()));
+    values.emplace_back(newConst(pcOffset, GateType::NJSValue()));
+    values.emplace_back(argAcc_.GetCommonArgGate(CommonArgIdx::FUNC));
+    values.emplace_back(live.back() ? RenameVariable(bbId, pc - 1, 0, true) :
+                                      newConst(JSTaggedValue::VALUE_HOLE, GateType::TaggedValue()));
+    for (uint32_t reg = 0; reg < numRegs; reg++) {
+        if (reg >= numVregs || live[reg]) {
+            values.emplace_back(RenameVariable(bbId, pc - 1, reg, false));
+        } else {
+            values.emplace_back(newConst(JSTaggedValue::VALUE_UNDEFINED, GateType::TaggedValue()));
+        }
+    }
+    auto frameState = circuit_.NewGate(OpCode(OpCode::FRAME_STATE), values.size(), values, GateType::Empty());
+    frameStates_[pc] = frameState;
+    return frameState;
+}
+
+bool BytecodeCircuitBuilder::IsInLoop(const uint8_t *pc) const
+{
+    for (const auto &bb : graph_) {
+        if (bb.isDead || pc < bb.start) {
+            continue;
+        }
+        for (auto loopbackId : bb.loopbackBlocks) {
+            if (pc <= graph_[loopbackId].end) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool BytecodeCircuitBuilder::IsLexEnvFixed() const
+{
+    // the last pc is the end of the method
+    for (size_t i = 0; i < pcArray_.size() - 1; i++) {
+        switch (static_cast<EcmaOpcode>(*pcArray_[i])) {
+            case EcmaOpcode::NEWLEXENVDYN_PREF_IMM16:
+            case EcmaOpcode::NEWLEXENVWITHNAMEDYN_PREF_IMM16_IMM16:
+            case EcmaOpcode::POPLEXENVDYN_PREF:
+                return false;
+            default:
+                break;
+        }
+    }
+    return true;
+}
+
 void BytecodeCircuitBuilder::AddBytecodeOffsetInfo(GateRef &gate, const BytecodeInfo &info, size_t bcOffsetIndex,
                                                    uint8_t *pc)
 {
@@ -16,6 +16,8 @@
 #ifndef ECMASCRIPT_CLASS_LINKER_BYTECODE_CIRCUIT_IR_BUILDER_H
 #define ECMASCRIPT_CLASS_LINKER_BYTECODE_CIRCUIT_IR_BUILDER_H
 
+#include <algorithm>
+#include <functional>
 #include <numeric>
 #include <tuple>
 #include <utility>
@@ -392,6 +394,21 @@ enum BytecodeOffset {
     TEN
 };
 
+// An element access whose receiver has an array type in ts.
+struct TypedElementAccess {
+    // the elements are numbers, they are stored without a write barrier
+    bool isNumberElement {false};
+    // the key is proved at least 0 and below the length of the receiver when it is an array
+    bool isInBounds {false};
+};
+
+// An arguments object or a rest array which does not escape its method is not created, see EscapeAnalysis. The
+// accesses to it read the actual arguments of the frame, from the rest index on for a rest array.
+struct FrameArgs {
+    bool isRest {false};
+    uint32_t restIndex {0};
+};
+
 class BytecodeCircuitBuilder {
 public:
     explicit BytecodeCircuitBuilder(const BytecodeTranslationInfo &translationInfo, size_t index,
@@ -414,6 +431,11 @@ public:
         return &circuit_;
     }
 
+    [[nodiscard]] const JSMethod *GetMethod() const
+    {
+        return method_;
+    }
+
     [[nodiscard]] const std::map<kungfu::GateRef, std::pair<size_t, const uint8_t *>>& GetGateToBytecode() const
     {
         return jsgateToBytecode_;
@@ -441,6 +463,75 @@ public:
         return jsgateToBytecode_.at(gate).second;
     }
 
+    // The type lowering records the layout entry of the property a monomorphic named load saw in the pgo profile,
+    // and the slowpath lowering checks the layout of the receiver against it before the generic load.
+    void SetProfiledLayoutEntry(const uint8_t *pc, uint32_t entry)
+    {
+        profiledLayoutEntries_[pc] = entry;
+    }
+
+    bool GetProfiledLayoutEntry(const uint8_t *pc, uint32_t *entry) const
+    {
+        auto iter = profiledLayoutEntries_.find(pc);
+        if (iter == profiledLayoutEntries_.end()) {
+            return false;
+        }
+        *entry = iter->second;
+        return true;
+    }
+
+    // The type lowering records the element accesses on receivers of an array type, and the slowpath lowering reads
+    // the elements of an array directly before the generic access.
+    void SetTypedElementAccess(const uint8_t *pc, const TypedElementAccess &access)
+    {
+        typedElementAccesses_[pc] = access;
+    }
+
+    bool GetTypedElementAccess(const uint8_t *pc, TypedElementAccess *access) const
+    {
+        auto iter = typedElementAccesses_.find(pc);
+        if (iter == typedElementAccesses_.end()) {
+            return false;
+        }
+        *access = iter->second;
+        return true;
+    }
+
+    // The escape analysis records the creation of an arguments object or a rest array which is not created and
+    // the accesses to it, and the slowpath lowering reads the frame for them.
+    void SetFrameArgs(const uint8_t *pc, const FrameArgs &args)
+    {
+        frameArgs_[pc] = args;
+    }
+
+    bool GetFrameArgs(const uint8_t *pc, FrameArgs *args) const
+    {
+        auto iter = frameArgs_.find(pc);
+        if (iter == frameArgs_.end()) {
+            return false;
+        }
+        *args = iter->second;
+        return true;
+    }
+
+    // The frame state of a bytecode holds the values the interpreter resumes with when the speculative code
+    // deoptimizes at it. NullGate is returned if the method can't be resumed there, then no speculation is made.
+    GateRef NewFrameState(GateRef gate);
+
+    GateRef GetFrameState(const uint8_t *pc) const
+    {
+        auto iter = frameStates_.find(pc);
+        return iter == frameStates_.end() ? Circuit::NullGate() : iter->second;
+    }
+
+    // A bytecode is taken to be in a loop when it lies between a loop header and the end of one of its loopback
+    // blocks, which holds for the reducible loops the frontend emits.
+    bool IsInLoop(const uint8_t *pc) const;
+
+    // A method which neither creates nor pops a lexical env keeps the env it is called with, so its accesses to the
+    // env chain can start from the env argument instead of the env slot of its frame.
+    bool IsLexEnvFixed() const;
+
     BytecodeInfo GetBytecodeInfo(const uint8_t *pc);
     // for external users, circuit must be built
     BytecodeInfo GetByteCodeInfo(const GateRef gate)
@@ -496,6 +587,10 @@ private:
     GateRef RenameVariable(const size_t bbId, const uint8_t *end,
         const uint16_t reg, const bool acc, GateType gateType = GateType::AnyType());
     void BuildCircuit();
+    bool CanDeoptimize();
+    void ComputeLiveness();
+    std::vector<bool> ComputeLiveBefore(const BytecodeRegion &bb, const uint8_t *pc);
+    void UpdateLiveness(const BytecodeInfo &info, std::vector<bool> &live) const;
     void PrintCollectBlockInfo(std::vector<CfgInfo> &bytecodeBlockInfos);
     void PrintGraph();
     void PrintBytecodeInfo();
@@ -521,6 +616,12 @@ private:
     bool enableLog_ {false};
     std::map<uint8_t *, int32_t> pcToBCOffset_;
     std::vector<kungfu::GateRef> suspendAndResumeGates_ {};
+    std::map<const uint8_t *, uint32_t> profiledLayoutEntries_ {};
+    std::map<const uint8_t *, TypedElementAccess> typedElementAccesses_ {};
+    std::map<const uint8_t *, FrameArgs> frameArgs_ {};
+    std::map<const uint8_t *, GateRef> frameStates_ {};
+    // live registers at the start of each block, the last one is the acc
+    std::vector<std::vector<bool>> liveIns_ {};
 };
 }  // namespace panda::ecmascript::kungfu
 #endif  // ECMASCRIPT_CLASS_LINKER_BYTECODE_CIRCUIT_IR_BUILDER_H
@@ -0,0 +1,511 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/compiler/call_inlining.h"
+
+#include "ecmascript/compiler/slowpath_lowering.h"
+#include "ecmascript/ic/invoke_cache.h"
+#include "ecmascript/js_function.h"
+#include "ecmascript/jspandafile/program_object.h"
+
+namespace panda::ecmascript::kungfu {
+namespace {
+bool IsInlinableCall(EcmaOpcode op)
+{
+    switch (op) {
+        case EcmaOpcode::CALLARG0DYN_PREF_V8:
+        case EcmaOpcode::CALLARG1DYN_PREF_V8_V8:
+        case EcmaOpcode::CALLARGS2DYN_PREF_V8_V8_V8:
+        case EcmaOpcode::CALLARGS3DYN_PREF_V8_V8_V8_V8:
+        case EcmaOpcode::CALLIRANGEDYN_PREF_IMM16_V8:
+        case EcmaOpcode::CALLITHISRANGEDYN_PREF_IMM16_V8:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// The lowerings of these bytecodes change the lexical env, read the arguments or the module of the optimized frame
+// of the method, or suspend it, so they need a frame of their own. The env of a method which doesn't change it is
+// its env argument, see SlowPathLowering::GetCurrentLexEnv, so the callee reads and writes its captured variables
+// through the env of the function it is called with.
+bool IsFrameDependent(EcmaOpcode op)
+{
+    switch (op) {
+        case EcmaOpcode::NEWLEXENVDYN_PREF_IMM16:
+        case EcmaOpcode::NEWLEXENVWITHNAMEDYN_PREF_IMM16_IMM16:
+        case EcmaOpcode::POPLEXENVDYN_PREF:
+        case EcmaOpcode::GETUNMAPPEDARGS_PREF:
+        case EcmaOpcode::COPYRESTARGS_PREF_IMM16:
+        case EcmaOpcode::SUPERCALL_PREF_IMM16_V8:
+        case EcmaOpcode::SUPERCALLSPREAD_PREF_V8:
+        case EcmaOpcode::LDMODULEVAR_PREF_ID32_IMM8:
+        case EcmaOpcode::STMODULEVAR_PREF_ID32:
+        case EcmaOpcode::GETMODULENAMESPACE_PREF_ID32:
+        case EcmaOpcode::CREATEGENERATOROBJ_PREF_V8:
+        case EcmaOpcode::SUSPENDGENERATOR_PREF_V8_V8:
+        case EcmaOpcode::RESUMEGENERATOR_PREF_V8:
+        case EcmaOpcode::ASYNCFUNCTIONENTER_PREF:
+        case EcmaOpcode::ASYNCFUNCTIONAWAITUNCAUGHT_PREF_V8_V8:
+        case EcmaOpcode::ASYNCFUNCTIONRESOLVE_PREF_V8_V8_V8:
+        case EcmaOpcode::ASYNCFUNCTIONREJECT_PREF_V8_V8_V8:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// The callee is copied when the slowpath lowering has lowered all its bytecodes, it only leaves the method by
+// returning, and it has no data in its circuit.
+bool CanCopy(OpCode op)
+{
+    switch (op) {
+        case OpCode::JS_BYTECODE:
+        case OpCode::IF_SUCCESS:
+        case OpCode::IF_EXCEPTION:
+        case OpCode::GET_EXCEPTION:
+        case OpCode::RETURN_VOID:
+        case OpCode::THROW:
+        case OpCode::DEOPT:
+        case OpCode::FRAME_STATE:
+        case OpCode::MUTABLE_DATA:
+        case OpCode::CONST_DATA:
+            return false;
+        default:
+            return true;
+    }
+}
+
+bool IsExceptionReturn(const GateAccessor &acc, GateRef gate)
+{
+    GateRef value = acc.GetIn(gate, 2);  // 2: the value of a return
+    return acc.GetOpCode(value) == OpCode::CONSTANT && acc.GetBitField(value) == JSTaggedValue::VALUE_EXCEPTION;
+}
+}  // namespace
+
+void CallInlining::RunCallInlining()
+{
+    std::vector<GateRef> calls;
+    for (auto gate : circuit_->GetAllGates()) {
+        if (acc_.GetOpCode(gate) == OpCode::JS_BYTECODE && IsInlinableCall(bcBuilder_->GetByteCodeOpcode(gate))) {
+            calls.emplace_back(gate);
+        }
+    }
+    size_t inlinedCalls = 0;
+    for (auto gate : calls) {
+        if (TryInline(gate)) {
+            inlinedCalls++;
+        }
+    }
+
+    if (IsLogEnabled()) {
+        LOG_COMPILER(INFO) << "inlined " << inlinedCalls << " of " << calls.size() << " calls, " << inlinedSize_
+                           << " bytecodes";
+        LOG_COMPILER(INFO) << "=========================================================";
+        circuit_->PrintAllGates(*bcBuilder_);
+    }
+}
+
+bool CallInlining::TryInline(GateRef gate)
+{
+    CallSite site = GetCallSite(gate);
+    uint32_t constpoolIndex = 0;
+    if (!ResolveTarget(site.func, &constpoolIndex)) {
+        return false;
+    }
+    const JSMethod *callee = GetMethodFromConstpool(constpoolIndex);
+    if (callee == nullptr) {
+        return false;
+    }
+    auto iter = methodIndexes_->find(callee);
+    if (iter == methodIndexes_->end()) {
+        return false;
+    }
+    bool isHotSite = isHotMethod_ || bcBuilder_->IsInLoop(bcBuilder_->GetJSBytecode(gate));
+    if (!CanInline(callee, iter->second, isHotSite)) {
+        return false;
+    }
+    BytecodeCircuitBuilder *calleeBuilder = GetLoweredCallee(iter->second);
+    if (calleeBuilder == nullptr) {
+        return false;
+    }
+
+    InlineEntry entry = BuildTargetCheck(site, constpoolIndex);
+    std::vector<CalleeExit> exits;
+    std::vector<CalleeExit> exceptionExits;
+    CopyCallee(calleeBuilder, site, entry, &exits, &exceptionExits);
+    ReplaceCall(gate, exits, exceptionExits);
+    inlinedSize_ += callee->GetBytecodeArraySize();
+    if (IsLogEnabled()) {
+        LOG_COMPILER(INFO) << "inline " << callee->GetMethodName() << " at " << bcBuilder_->GetBytecodeStr(gate)
+                           << " gate " << acc_.GetId(gate);
+    }
+    return true;
+}
+
+CallInlining::CallSite CallInlining::GetCallSite(GateRef gate)
+{
+    CallSite site {gate, acc_.GetValueIn(gate, 0), builder_.UndefineConstant(), {}};
+    size_t firstArg = 1;  // 1: skip the call target
+    if (bcBuilder_->GetByteCodeOpcode(gate) == EcmaOpcode::CALLITHISRANGEDYN_PREF_IMM16_V8) {
+        site.thisObj = acc_.GetValueIn(gate, firstArg++);
+    }
+    // the last value is the bytecode offset of the call
+    size_t numValueIn = acc_.GetNumValueIn(gate);
+    for (size_t i = firstArg; i + 1 < numValueIn; i++) {
+        site.args.emplace_back(acc_.GetValueIn(gate, i));
+    }
+    return site;
+}
+
+bool CallInlining::GetDefinedFunction(GateRef gate, uint32_t *constpoolIndex) const
+{
+    if (acc_.GetOpCode(gate) != OpCode::JS_BYTECODE) {
+        return false;
+    }
+    auto op = bcBuilder_->GetByteCodeOpcode(gate);
+    if (op != EcmaOpcode::DEFINEFUNCDYN_PREF_ID16_IMM16_V8 && op != EcmaOpcode::DEFINENCFUNCDYN_PREF_ID16_IMM16_V8) {
+        return false;
+    }
+    // the method id of a definefunc is translated to the index of the function in the constpool
+    *constpoolIndex = static_cast<uint32_t>(acc_.GetBitField(acc_.GetValueIn(gate, 0)));
+    return true;
+}
+
+bool CallInlining::ResolveTarget(GateRef func, uint32_t *constpoolIndex) const
+{
+    if (GetDefinedFunction(func, constpoolIndex)) {
+        return true;
+    }
+    if (acc_.GetOpCode(func) != OpCode::JS_BYTECODE) {
+        return false;
+    }
+    auto op = bcBuilder_->GetByteCodeOpcode(func);
+    if (op != EcmaOpcode::TRYLDGLOBALBYNAME_PREF_ID32 && op != EcmaOpcode::LDGLOBALVAR_PREF_ID32) {
+        return false;
+    }
+    BitField stringId = acc_.GetBitField(acc_.GetValueIn(func, 0));
+    GateRef stored = Circuit::NullGate();
+    for (const auto &[gate, bytecode] : bcBuilder_->GetGateToBytecode()) {
+        if (acc_.GetOpCode(gate) != OpCode::JS_BYTECODE) {
+            continue;
+        }
+        switch (static_cast<EcmaOpcode>(*bytecode.second)) {
+            case EcmaOpcode::STGLOBALVAR_PREF_ID32:
+            case EcmaOpcode::TRYSTGLOBALBYNAME_PREF_ID32:
+            case EcmaOpcode::STLETTOGLOBALRECORD_PREF_ID32:
+            case EcmaOpcode::STCONSTTOGLOBALRECORD_PREF_ID32:
+                if (acc_.GetBitField(acc_.GetValueIn(gate, 0)) != stringId) {
+                    break;
+                }
+                if (stored != Circuit::NullGate()) {
+                    return false;
+                }
+                stored = acc_.GetValueIn(gate, 1);
+                break;
+            default:
+                break;
+        }
+    }
+    return stored != Circuit::NullGate() && GetDefinedFunction(stored, constpoolIndex);
+}
+
+const JSMethod *CallInlining::GetMethodFromConstpool(uint32_t constpoolIndex) const
+{
+    ConstantPool *constpool = ConstantPool::Cast(translationInfo_->constantPool->GetTaggedObject());
+    if (constpoolIndex >= constpool->GetLength()) {
+        return nullptr;
+    }
+    JSTaggedValue func = constpool->GetObjectFromCache(constpoolIndex);
+    if (!func.IsJSFunction()) {
+        return nullptr;
+    }
+    return JSFunction::Cast(func.GetTaggedObject())->GetMethod();
+}
+
+bool CallInlining::CanInline(const JSMethod *callee, size_t calleeIndex, bool isHotSite) const
+{
+    if (callee == bcBuilder_->GetMethod() || callee->IsNativeWithCallField() || callee->HaveExtraWithCallField()) {
+        return false;
+    }
+    uint32_t size = callee->GetBytecodeArraySize();
+    if (isHotSite ? !InvokeCache::DecideCanBeInlined(callee) : (size == 0 || size >= MAX_CALLEE_SIZE)) {
+        return false;
+    }
+    if (inlinedSize_ + size > MAX_INLINED_SIZE) {
+        return false;
+    }
+    // the last pc marks the end of the bytecodes
+    const auto &pcArray = translationInfo_->methodPcInfos[calleeIndex].pcArray;
+    for (size_t i = 0; i + 1 < pcArray.size(); i++) {
+        if (IsFrameDependent(static_cast<EcmaOpcode>(*pcArray[i]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+BytecodeCircuitBuilder *CallInlining::GetLoweredCallee(size_t calleeIndex)
+{
+    auto iter = callees_.find(calleeIndex);
+    if (iter != callees_.end()) {
+        return iter->second.get();
+    }
+    auto callee = std::make_unique<BytecodeCircuitBuilder>(*translationInfo_, calleeIndex, tsLoader_, false);
+    callee->BytecodeToCircuit();
+    Circuit *calleeCircuit = callee->GetCircuit();
+    SlowPathLowering lowering(callee.get(), calleeCircuit, cmpCfg_, false);
+    lowering.CallRuntimeLowering();
+
+    GateAccessor acc(calleeCircuit);
+    bool hasReturn = false;
+    for (auto gate : calleeCircuit->GetAllGates()) {
+        auto op = acc.GetOpCode(gate);
+        if (!CanCopy(op)) {
+            callee.reset();
+            break;
+        }
+        if (op == OpCode::RETURN && !IsExceptionReturn(acc, gate)) {
+            hasReturn = true;
+        }
+    }
+    if (!hasReturn) {
+        callee.reset();
+    }
+    auto &result = callees_[calleeIndex];
+    result = std::move(callee);
+    return result.get();
+}
+
+/*
+ * check the call target like this pattern:
+ * if (IsHeapObject(func) && IsJsType(func, JS_FUNCTION) &&
+ *     func->GetMethod() == constpool[constpoolIndex]->GetMethod()) {
+ *     goto inlined_callee;
+ * }
+ * call(func, ...);
+ */
+CallInlining::InlineEntry CallInlining::BuildTargetCheck(const CallSite &site, uint32_t constpoolIndex)
+{
+    Environment env(site.gate, circuit_, &builder_);
+    Label isHeapObject(&builder_);
+    Label isFunction(&builder_);
+    Label isTarget(&builder_);
+    Label notTarget(&builder_);
+    GateRef func = site.func;
+    builder_.Branch(builder_.TaggedIsHeapObject(func), &isHeapObject, &notTarget);
+    builder_.Bind(&isHeapObject);
+    builder_.Branch(builder_.IsJsType(func, JSType::JS_FUNCTION), &isFunction, &notTarget);
+    builder_.Bind(&isFunction);
+    {
+        GateRef jsFunc = argAcc_.GetCommonArgGate(CommonArgIdx::FUNC);
+        GateRef constPool = builder_.Load(VariableType::JS_ANY(), jsFunc,
+                                          builder_.IntPtr(JSFunction::CONSTANT_POOL_OFFSET));
+        GateRef target = builder_.GetValueFromTaggedArray(VariableType::JS_ANY(), constPool,
+                                                          builder_.Int32(constpoolIndex));
+        GateRef methodOffset = builder_.IntPtr(JSFunctionBase::METHOD_OFFSET);
+        GateRef method = builder_.Load(VariableType::NATIVE_POINTER(), func, methodOffset);
+        GateRef targetMethod = builder_.Load(VariableType::NATIVE_POINTER(), target, methodOffset);
+        builder_.Branch(builder_.Equal(method, targetMethod), &isTarget, &notTarget);
+    }
+    builder_.Bind(&notTarget);
+    acc_.ReplaceStateIn(site.gate, builder_.GetState());
+    acc_.ReplaceDependIn(site.gate, builder_.GetDepend());
+    builder_.Bind(&isTarget);
+    GateRef lexEnv = builder_.GetLexicalEnv(func);
+    return {builder_.GetState(), builder_.GetDepend(), lexEnv};
+}
+
+// The args of the callee are the values the call passes to it, see SlowPathLowering::LowerCallArg0Dyn.
+GateRef CallInlining::MapArg(BitField argIndex, const CallSite &site, GateRef lexEnv)
+{
+    auto numCommonArgs = static_cast<BitField>(CommonArgIdx::NUM_OF_ARGS);
+    if (argIndex >= numCommonArgs) {
+        size_t index = argIndex - numCommonArgs;
+        return index < site.args.size() ? site.args[index] : builder_.UndefineConstant();
+    }
+    switch (static_cast<CommonArgIdx>(argIndex)) {
+        case CommonArgIdx::GLUE:
+            return argAcc_.GetCommonArgGate(CommonArgIdx::GLUE);
+        case CommonArgIdx::LEXENV:
+            return lexEnv;
+        case CommonArgIdx::ACTUAL_ARGC:
+            return builder_.Int32(static_cast<int32_t>(site.args.size()) + NUM_MANDATORY_JSFUNC_ARGS);
+        case CommonArgIdx::FUNC:
+            return site.func;
+        case CommonArgIdx::THIS:
+            return site.thisObj;
+        default:
+            return builder_.UndefineConstant();
+    }
+}
+
+// The gates of the callee are created before their ins are set, since the loops of its circuit use the gates
+// which come after them.
+void CallInlining::CopyCallee(BytecodeCircuitBuilder *callee, const CallSite &site, const InlineEntry &entry,
+                              std::vector<CalleeExit> *exits, std::vector<CalleeExit> *exceptionExits)
+{
+    Circuit *calleeCircuit = callee->GetCircuit();
+    GateAccessor calleeAcc(calleeCircuit);
+    std::unordered_map<GateRef, GateRef> gateMap;
+    std::vector<GateRef> copiedGates;
+    std::vector<GateRef> returns;
+    for (auto gate : calleeCircuit->GetAllGates()) {
+        auto op = calleeAcc.GetOpCode(gate);
+        if (op == OpCode::NOP) {
+            continue;
+        }
+        if (op == OpCode::STATE_ENTRY) {
+            gateMap[gate] = entry.state;
+        } else if (op == OpCode::DEPEND_ENTRY) {
+            gateMap[gate] = entry.depend;
+        } else if (op.IsRoot()) {
+            // the roots are the same gates in every circuit
+            gateMap[gate] = gate;
+        } else if (op == OpCode::ARG) {
+            gateMap[gate] = MapArg(calleeAcc.GetBitField(gate), site, entry.lexEnv);
+        } else if (op == OpCode::CONSTANT) {
+            gateMap[gate] = circuit_->GetConstantGate(calleeAcc.GetMachineType(gate), calleeAcc.GetBitField(gate),
+                                                      calleeAcc.GetGateType(gate));
+        } else if (op == OpCode::RETURN) {
+            returns.emplace_back(gate);
+        } else {
+            std::vector<GateRef> ins(calleeAcc.GetNumIns(gate), Circuit::NullGate());
+            GateRef newGate = op.GetMachineType() == MachineType::FLEX ?
+                circuit_->NewGate(op, calleeAcc.GetMachineType(gate), calleeAcc.GetBitField(gate), ins,
+                                  calleeAcc.GetGateType(gate)) :
+                circuit_->NewGate(op, calleeAcc.GetBitField(gate), ins, calleeAcc.GetGateType(gate));
+            gateMap[gate] = newGate;
+            copiedGates.emplace_back(gate);
+        }
+    }
+    for (auto gate : copiedGates) {
+        GateRef newGate = gateMap.at(gate);
+        for (size_t i = 0; i < calleeAcc.GetNumIns(gate); i++) {
+            if (!calleeCircuit->IsInGateNull(gate, i)) {
+                acc_.NewIn(newGate, i, gateMap.at(calleeAcc.GetIn(gate, i)));
+            }
+        }
+    }
+    for (auto gate : returns) {
+        CalleeExit exit {gateMap.at(calleeAcc.GetState(gate)), gateMap.at(calleeAcc.GetDep(gate)),
+                         gateMap.at(calleeAcc.GetIn(gate, 2))};  // 2: the value of a return
+        if (IsExceptionReturn(calleeAcc, gate)) {
+            exceptionExits->emplace_back(exit);
+        } else {
+            exits->emplace_back(exit);
+        }
+    }
+}
+
+/*
+ * The exits of the callee are merged with the ones of the call: its successful returns with the IF_SUCCESS of the
+ * call, and the ones with an exception pending with the IF_EXCEPTION of the call. The call is lowered later and
+ * keeps the state ins of the merges, see SlowPathLowering::ReplaceHirToCall.
+ */
+void CallInlining::ReplaceCall(GateRef gate, const std::vector<CalleeExit> &exits,
+                               const std::vector<CalleeExit> &exceptionExits)
+{
+    GateRef ifSuccess = Circuit::NullGate();
+    GateRef ifException = Circuit::NullGate();
+    auto uses = acc_.Uses(gate);
+    for (auto it = uses.begin(); it != uses.end(); it++) {
+        if (acc_.GetOpCode(*it) == OpCode::IF_SUCCESS) {
+            ifSuccess = *it;
+        } else if (acc_.GetOpCode(*it) == OpCode::IF_EXCEPTION) {
+            ifException = *it;
+        }
+    }
+    ASSERT(ifSuccess != Circuit::NullGate() && ifException != Circuit::NullGate());
+    // a depend use of the call is on the exception path when its state is the IF_EXCEPTION
+    std::vector<std::pair<GateRef, size_t>> successDepends;
+    std::vector<std::pair<GateRef, size_t>> exceptionDepends;
+    std::vector<std::pair<GateRef, size_t>> values;
+    for (auto it = uses.begin(); it != uses.end(); it++) {
+        GateRef use = *it;
+        size_t index = it.GetIndex();
+        auto op = acc_.GetOpCode(use);
+        if (op == OpCode::IF_SUCCESS || op == OpCode::IF_EXCEPTION) {
+            continue;
+        }
+        if (!acc_.IsDependIn(it)) {
+            values.emplace_back(use, index);
+            continue;
+        }
+        GateRef state = op == OpCode::DEPEND_SELECTOR ? acc_.GetIn(acc_.GetIn(use, 0), index - 1) :
+                                                        acc_.GetIn(use, 0);
+        if (state == ifException) {
+            exceptionDepends.emplace_back(use, index);
+        } else {
+            successDepends.emplace_back(use, index);
+        }
+    }
+    std::vector<std::pair<GateRef, size_t>> successControls;
+    auto successUses = acc_.Uses(ifSuccess);
+    for (auto it = successUses.begin(); it != successUses.end(); it++) {
+        successControls.emplace_back(*it, it.GetIndex());
+    }
+    std::vector<std::pair<GateRef, size_t>> exceptionControls;
+    auto exceptionUses = acc_.Uses(ifException);
+    for (auto it = exceptionUses.begin(); it != exceptionUses.end(); it++) {
+        exceptionControls.emplace_back(*it, it.GetIndex());
+    }
+
+    auto newMerge = [this, gate](GateRef control, const std::vector<CalleeExit> &calleeExits,
+                                 GateRef *merge, GateRef *dependSelector) {
+        size_t numIns = calleeExits.size() + 1;  // 1: the control of the call
+        std::vector<GateRef> states {control};
+        std::vector<GateRef> depends {Circuit::NullGate(), gate};
+        for (const auto &exit : calleeExits) {
+            states.emplace_back(exit.state);
+            depends.emplace_back(exit.depend);
+        }
+        *merge = circuit_->NewGate(OpCode(OpCode::MERGE), numIns, states, GateType::Empty());
+        depends[0] = *merge;
+        *dependSelector = circuit_->NewGate(OpCode(OpCode::DEPEND_SELECTOR), numIns, depends, GateType::Empty());
+    };
+    GateRef successMerge = Circuit::NullGate();
+    GateRef successDepend = Circuit::NullGate();
+    newMerge(ifSuccess, exits, &successMerge, &successDepend);
+    std::vector<GateRef> results {successMerge, gate};
+    for (const auto &exit : exits) {
+        results.emplace_back(exit.value);
+    }
+    GateRef result = circuit_->NewGate(OpCode(OpCode::VALUE_SELECTOR), MachineType::I64, exits.size() + 1, results,
+                                       acc_.GetGateType(gate));
+    for (const auto &[use, index] : successControls) {
+        circuit_->ModifyIn(use, index, successMerge);
+    }
+    for (const auto &[use, index] : successDepends) {
+        circuit_->ModifyIn(use, index, successDepend);
+    }
+    for (const auto &[use, index] : values) {
+        circuit_->ModifyIn(use, index, result);
+    }
+
+    if (exceptionExits.empty()) {
+        return;
+    }
+    GateRef exceptionMerge = Circuit::NullGate();
+    GateRef exceptionDepend = Circuit::NullGate();
+    newMerge(ifException, exceptionExits, &exceptionMerge, &exceptionDepend);
+    for (const auto &[use, index] : exceptionControls) {
+        circuit_->ModifyIn(use, index, exceptionMerge);
+    }
+    for (const auto &[use, index] : exceptionDepends) {
+        circuit_->ModifyIn(use, index, exceptionDepend);
+    }
+}
+}  // namespace panda::ecmascript::kungfu
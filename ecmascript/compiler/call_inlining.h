@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_COMPILER_CALL_INLINING_H
+#define ECMASCRIPT_COMPILER_CALL_INLINING_H
+
+#include <memory>
+#include <unordered_map>
+
+#include "ecmascript/compiler/argument_accessor.h"
+#include "ecmascript/compiler/bytecode_circuit_builder.h"
+#include "ecmascript/compiler/circuit.h"
+#include "ecmascript/compiler/circuit_builder.h"
+#include "ecmascript/compiler/circuit_builder-inl.h"
+#include "ecmascript/compiler/gate_accessor.h"
+#include "ecmascript/ts_types/ts_loader.h"
+
+namespace panda::ecmascript::kungfu {
+// CallInlining replaces the calls of a method to small functions of the same panda file by the circuits of the
+// callees. The call bytecodes have no inline cache, so the callee is the function a definefunc of the method
+// creates, directly or through a global variable the method stores it to only once. The inlined circuit runs
+// behind a check of the method of the call target, the call stays on the other path.
+class CallInlining {
+public:
+    using MethodIndexMap = std::unordered_map<const JSMethod *, size_t>;
+
+    CallInlining(BytecodeCircuitBuilder *bcBuilder, Circuit *circuit, CompilationConfig *cmpCfg, TSLoader *tsLoader,
+                 const BytecodeTranslationInfo *translationInfo, const MethodIndexMap *methodIndexes,
+                 bool isHotMethod, bool enableLog)
+        : bcBuilder_(bcBuilder), circuit_(circuit), acc_(circuit), builder_(circuit, cmpCfg),
+          argAcc_(circuit), cmpCfg_(cmpCfg), tsLoader_(tsLoader), translationInfo_(translationInfo),
+          methodIndexes_(methodIndexes), isHotMethod_(isHotMethod), enableLog_(enableLog) {}
+    ~CallInlining() = default;
+    NO_COPY_SEMANTIC(CallInlining);
+    NO_MOVE_SEMANTIC(CallInlining);
+
+    void RunCallInlining();
+
+    // the calls in loops or in hot methods inline the callees the invoke cache would, the others smaller ones
+    static constexpr uint32_t MAX_CALLEE_SIZE = 32;
+    // the bytecodes inlined into one method
+    static constexpr uint32_t MAX_INLINED_SIZE = 512;
+
+private:
+    struct CallSite {
+        GateRef gate;
+        GateRef func;
+        GateRef thisObj;
+        std::vector<GateRef> args;
+    };
+
+    struct InlineEntry {
+        GateRef state;
+        GateRef depend;
+        GateRef lexEnv;
+    };
+
+    struct CalleeExit {
+        GateRef state;
+        GateRef depend;
+        GateRef value;
+    };
+
+    bool IsLogEnabled() const
+    {
+        return enableLog_;
+    }
+
+    bool TryInline(GateRef gate);
+    CallSite GetCallSite(GateRef gate);
+    bool ResolveTarget(GateRef func, uint32_t *constpoolIndex) const;
+    bool GetDefinedFunction(GateRef gate, uint32_t *constpoolIndex) const;
+    const JSMethod *GetMethodFromConstpool(uint32_t constpoolIndex) const;
+    bool CanInline(const JSMethod *callee, size_t calleeIndex, bool isHotSite) const;
+    BytecodeCircuitBuilder *GetLoweredCallee(size_t calleeIndex);
+    InlineEntry BuildTargetCheck(const CallSite &site, uint32_t constpoolIndex);
+    void CopyCallee(BytecodeCircuitBuilder *callee, const CallSite &site, const InlineEntry &entry,
+                    std::vector<CalleeExit> *exits, std::vector<CalleeExit> *exceptionExits);
+    GateRef MapArg(BitField argIndex, const CallSite &site, GateRef lexEnv);
+    void ReplaceCall(GateRef gate, const std::vector<CalleeExit> &exits,
+                     const std::vector<CalleeExit> &exceptionExits);
+
+    BytecodeCircuitBuilder *bcBuilder_;
+    Circuit *circuit_;
+    GateAccessor acc_;
+    CircuitBuilder builder_;
+    ArgumentAccessor argAcc_;
+    CompilationConfig *cmpCfg_ {nullptr};
+    TSLoader *tsLoader_ {nullptr};
+    const BytecodeTranslationInfo *translationInfo_ {nullptr};
+    const MethodIndexMap *methodIndexes_ {nullptr};
+    bool isHotMethod_ {false};
+    bool enableLog_ {false};
+    uint32_t inlinedSize_ {0};
+    // a callee is lowered once for all its calls, nullptr when it can't be inlined after all
+    std::unordered_map<size_t, std::unique_ptr<BytecodeCircuitBuilder>> callees_ {};
+};
+}  // panda::ecmascript::kungfu
+#endif  // ECMASCRIPT_COMPILER_CALL_INLINING_H
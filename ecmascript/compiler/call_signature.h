@@ -335,6 +335,7 @@ private:
     V(ResumeUncaughtFrameAndReturn)         \
     V(StringsAreEquals)                     \
     V(BigIntEquals)                         \
+    V(CallFastBuiltin)                      \
     V(DebugPrint)                           \
     V(FatalPrint)                           \
     V(InsertOldToNewRSet)                   \
@@ -340,6 +340,22 @@ GateRef CircuitBuilder::IsDictionaryElement(GateRef hClass)
         Int32(0));
 }
 
+GateRef CircuitBuilder::GetElementsKindFromHClass(GateRef hClass)
+{
+    GateRef bitfieldOffset = Int32(JSHClass::BIT_FIELD_OFFSET);
+    GateRef bitfield = Load(VariableType::INT32(), hClass, bitfieldOffset);
+    return Int32And(Int32LSR(bitfield,
+        Int32(JSHClass::ElementsKindBits::START_BIT)),
+        Int32((1LU << JSHClass::ElementsKindBits::SIZE) - 1));
+}
+
+// Elements kinds are bit sets, so the hclass contains the kind if or-ing it in changes nothing.
+GateRef CircuitBuilder::ContainsElementsKind(GateRef hClass, ElementsKind kind)
+{
+    GateRef hClassKind = GetElementsKindFromHClass(hClass);
+    return Equal(Int32Or(hClassKind, Int32(static_cast<int32_t>(kind))), hClassKind);
+}
+
 GateRef CircuitBuilder::IsClassConstructor(GateRef object)
 {
     GateRef hClass = LoadHClass(object);
@@ -335,6 +335,17 @@ GateRef CircuitBuilder::Call(const CallSignature* cs, GateRef glue, GateRef targ
     return result;
 }
 
+GateRef CircuitBuilder::Deoptimize(GateRef glue, GateRef frameState)
+{
+    GateRef target = IntPtr(RTSTUB_ID(DeoptHandler));
+    auto label = GetCurrentLabel();
+    auto depend = label->GetDepend();
+    GateRef result = GetCircuit()->NewGate(OpCode(OpCode::DEOPT), 0, {depend, target, glue, frameState},
+                                           GateType::AnyType());
+    label->SetDepend(result);
+    return result;
+}
+
 // memory
 void CircuitBuilder::Store(VariableType type, GateRef glue, GateRef base, GateRef offset, GateRef value)
 {
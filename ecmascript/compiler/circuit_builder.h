@@ -250,6 +250,8 @@ public:
     GateRef CallStub(GateRef glue, int index, const std::vector<GateRef> &args);
     GateRef Call(const CallSignature* cs, GateRef glue, GateRef target, GateRef depend,
                  const std::vector<GateRef> &args);
+    // Leave the compiled code for the interpreter, resuming at the bytecode the frame state describes.
+    GateRef Deoptimize(GateRef glue, GateRef frameState);
 
     // memory
     inline GateRef Load(VariableType type, GateRef base, GateRef offset);
@@ -341,6 +343,8 @@ public:
     inline GateRef GetObjectType(GateRef hClass);
     inline GateRef IsDictionaryModeByHClass(GateRef hClass);
     inline GateRef IsDictionaryElement(GateRef hClass);
+    inline GateRef GetElementsKindFromHClass(GateRef hClass);
+    inline GateRef ContainsElementsKind(GateRef hClass, ElementsKind kind);
     inline GateRef IsClassConstructor(GateRef object);
     inline GateRef IsClassPrototype(GateRef object);
     inline GateRef IsExtensible(GateRef object);
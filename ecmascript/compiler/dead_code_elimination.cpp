@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/compiler/dead_code_elimination.h"
+
+#include <deque>
+
+namespace panda::ecmascript::kungfu {
+void DeadCodeElimination::Run()
+{
+    std::vector<GateRef> gateList = circuit_->GetAllGates();
+    std::deque<GateRef> pendingList(gateList.begin(), gateList.end());
+    size_t removedGates = 0;
+    while (!pendingList.empty()) {
+        GateRef gate = pendingList.front();
+        pendingList.pop_front();
+        if (!IsDead(gate)) {
+            continue;
+        }
+        std::vector<GateRef> ins = circuit_->GetInVector(gate);
+        RemoveGate(gate);
+        removedGates++;
+        pendingList.insert(pendingList.end(), ins.begin(), ins.end());
+    }
+    if (IsLogEnabled()) {
+        LOG_COMPILER(INFO) << "DeadCodeElimination removed " << removedGates << " gates";
+    }
+}
+
+bool DeadCodeElimination::IsDead(GateRef gate)
+{
+    OpCode op = acc_.GetOpCode(gate);
+    auto uses = acc_.Uses(gate);
+    if (op.IsPure() || op == OpCode::VALUE_SELECTOR || op == OpCode::FRAME_STATE) {
+        return uses.begin() == uses.end();
+    }
+    if (op == OpCode::LOAD) {
+        for (auto useIt = uses.begin(); useIt != uses.end(); useIt++) {
+            if (!acc_.IsDependIn(useIt)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+void DeadCodeElimination::RemoveGate(GateRef gate)
+{
+    // only a load has depend uses here, they depend on its depend input instead
+    auto uses = acc_.Uses(gate);
+    for (auto useIt = uses.begin(); useIt != uses.end(); useIt++) {
+        acc_.ReplaceIn(useIt, acc_.GetDep(gate));
+    }
+    acc_.DeleteGate(gate);
+}
+}  // namespace panda::ecmascript::kungfu
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_COMPILER_DEAD_CODE_ELIMINATION_H
+#define ECMASCRIPT_COMPILER_DEAD_CODE_ELIMINATION_H
+
+#include "ecmascript/compiler/circuit.h"
+#include "ecmascript/compiler/gate_accessor.h"
+
+namespace panda::ecmascript::kungfu {
+// DeadCodeElimination deletes the gates whose values are not used: the pure gates, the value selectors and the
+// frame states without uses, and the loads without value uses, which are taken out of their depend chains.
+// The inputs of a deleted gate are checked again, so whole unused expressions go.
+class DeadCodeElimination {
+public:
+    DeadCodeElimination(Circuit *circuit, bool enableLog)
+        : circuit_(circuit), acc_(circuit), enableLog_(enableLog) {}
+    ~DeadCodeElimination() = default;
+    NO_COPY_SEMANTIC(DeadCodeElimination);
+    NO_MOVE_SEMANTIC(DeadCodeElimination);
+
+    void Run();
+
+private:
+    bool IsLogEnabled() const
+    {
+        return enableLog_;
+    }
+
+    bool IsDead(GateRef gate);
+    void RemoveGate(GateRef gate);
+
+    Circuit *circuit_;
+    GateAccessor acc_;
+    bool enableLog_ {false};
+};
+}  // panda::ecmascript::kungfu
+#endif  // ECMASCRIPT_COMPILER_DEAD_CODE_ELIMINATION_H
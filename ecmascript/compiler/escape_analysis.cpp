@@ -0,0 +1,333 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/compiler/escape_analysis.h"
+
+#include <unordered_set>
+
+#include "ecmascript/mem/c_string.h"
+
+namespace panda::ecmascript::kungfu {
+void EscapeAnalysis::Run()
+{
+    std::vector<GateRef> gateList = circuit_->GetAllGates();
+    size_t replacedObjects = 0;
+    size_t frameArgs = 0;
+    for (const auto &gate : gateList) {
+        if (IsAllocation(gate) && TryReplace(gate)) {
+            replacedObjects++;
+        } else if (IsFrameArgs(gate) && TryReadFromFrame(gate)) {
+            frameArgs++;
+        }
+    }
+    if (IsLogEnabled()) {
+        LOG_COMPILER(INFO) << "EscapeAnalysis replaced " << replacedObjects << " objects, read " << frameArgs
+                           << " arguments objects or rest arrays from the frame";
+    }
+}
+
+bool EscapeAnalysis::IsAllocation(GateRef gate) const
+{
+    if (acc_.GetOpCode(gate) != OpCode::JS_BYTECODE) {
+        return false;
+    }
+    switch (bcBuilder_->GetByteCodeOpcode(gate)) {
+        case CREATEEMPTYOBJECT_PREF:
+        case CREATEEMPTYARRAY_PREF:
+        case CREATEITERRESULTOBJ_PREF_V8_V8:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool EscapeAnalysis::IsFrameArgs(GateRef gate) const
+{
+    if (acc_.GetOpCode(gate) != OpCode::JS_BYTECODE) {
+        return false;
+    }
+    switch (bcBuilder_->GetByteCodeOpcode(gate)) {
+        case GETUNMAPPEDARGS_PREF:
+        case COPYRESTARGS_PREF_IMM16:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool EscapeAnalysis::IsFrameArgsAccess(GateRef gate, size_t index) const
+{
+    if (acc_.GetOpCode(gate) != OpCode::JS_BYTECODE) {
+        return false;
+    }
+    size_t valueStart = acc_.GetStateCount(gate) + acc_.GetDependCount(gate);
+    switch (bcBuilder_->GetByteCodeOpcode(gate)) {
+        case LDOBJBYNAME_PREF_ID32_V8:
+            return index == valueStart + 1 && GetPropertyName(gate) == "length";  // 1: the receiver
+        case LDOBJBYINDEX_PREF_V8_IMM32:
+        case LDOBJBYVALUE_PREF_V8_V8:
+            // an element is read by a runtime call, which costs more than creating the object once in a loop
+            return index == valueStart && !bcBuilder_->IsInLoop(bcBuilder_->GetJSBytecode(gate));
+        case CALLITHISRANGEDYN_PREF_IMM16_V8:
+            // f.apply(thisArg, object), whose inputs are apply, f, thisArg, the object and the bytecode offset
+            return acc_.GetNumValueIn(gate) == 5 && index == valueStart + 3;  // 5: value inputs, 3: the object
+        default:
+            return false;
+    }
+}
+
+bool EscapeAnalysis::IsAccess(GateRef gate, size_t index, bool isArray) const
+{
+    if (acc_.GetOpCode(gate) != OpCode::JS_BYTECODE) {
+        return false;
+    }
+    // the object must be the receiver, a stored object escapes
+    size_t valueStart = acc_.GetStateCount(gate) + acc_.GetDependCount(gate);
+    switch (bcBuilder_->GetByteCodeOpcode(gate)) {
+        case LDOBJBYNAME_PREF_ID32_V8:
+            return index == valueStart + 1;  // 1: the receiver follows the string id
+        case STOWNBYNAME_PREF_ID32_V8:
+            return !isArray && index == valueStart + 1;  // 1: the receiver follows the string id
+        case LDOBJBYINDEX_PREF_V8_IMM32:
+        case STOWNBYINDEX_PREF_V8_IMM32:
+            return isArray && index == valueStart;
+        default:
+            return false;
+    }
+}
+
+bool EscapeAnalysis::IsExceptionDepend(GateRef gate, size_t index) const
+{
+    switch (acc_.GetOpCode(gate)) {
+        case OpCode::RETURN:
+        case OpCode::DEPEND_RELAY:
+            return acc_.GetOpCode(acc_.GetState(gate)) == OpCode::IF_EXCEPTION;
+        case OpCode::DEPEND_SELECTOR:
+            return acc_.GetOpCode(acc_.GetIn(acc_.GetState(gate), index - 1)) == OpCode::IF_EXCEPTION;
+        default:
+            return false;
+    }
+}
+
+GateRef EscapeAnalysis::GetNextGate(GateRef gate)
+{
+    GateRef next = Circuit::NullGate();
+    size_t normalDepends = 0;
+    auto uses = acc_.Uses(gate);
+    for (auto useIt = uses.begin(); useIt != uses.end(); useIt++) {
+        if (!acc_.IsDependIn(useIt) || IsExceptionDepend(*useIt, useIt.GetIndex())) {
+            continue;
+        }
+        next = *useIt;
+        normalDepends++;
+    }
+    if (normalDepends != 1) {
+        return Circuit::NullGate();
+    }
+    OpCode op = acc_.GetOpCode(next);
+    if (op == OpCode::JS_BYTECODE) {
+        return next;
+    }
+    // the depend goes on through a block with a single predecessor, and stops at a branch or a merge
+    if ((op == OpCode::DEPEND_SELECTOR || op == OpCode::DEPEND_RELAY) && acc_.GetDependCount(next) == 1) {
+        return next;
+    }
+    return Circuit::NullGate();
+}
+
+std::string EscapeAnalysis::GetPropertyName(GateRef gate) const
+{
+    size_t stringIndex = acc_.GetBitField(acc_.GetValueIn(gate, 0));
+    JSHandle<EcmaString> name = tsLoader_->GetStringById(stringIndex);
+    return CstringConvertToStdString(ConvertToString(*name, StringConvertedUsage::LOGICOPERATION));
+}
+
+bool EscapeAnalysis::InitObject(GateRef allocation, VirtualObject *object) const
+{
+    switch (bcBuilder_->GetByteCodeOpcode(allocation)) {
+        case CREATEEMPTYARRAY_PREF:
+            object->isArray = true;
+            return true;
+        case CREATEITERRESULTOBJ_PREF_V8_V8: {
+            // the done property is the boolean value of the flag, which is known for a constant flag only
+            GateRef flag = acc_.GetValueIn(allocation, 1);
+            if (acc_.GetOpCode(flag) != OpCode::CONSTANT ||
+                (acc_.GetBitField(flag) != JSTaggedValue::VALUE_TRUE &&
+                 acc_.GetBitField(flag) != JSTaggedValue::VALUE_FALSE)) {
+                return false;
+            }
+            object->properties["value"] = acc_.GetValueIn(allocation, 0);
+            object->properties["done"] = flag;
+            return true;
+        }
+        default:
+            return true;
+    }
+}
+
+bool EscapeAnalysis::TryReplace(GateRef allocation)
+{
+    VirtualObject object;
+    if (!InitObject(allocation, &object)) {
+        return false;
+    }
+    std::unordered_set<GateRef> accesses;
+    auto uses = acc_.Uses(allocation);
+    for (auto useIt = uses.begin(); useIt != uses.end(); useIt++) {
+        OpCode op = acc_.GetOpCode(*useIt);
+        if (op == OpCode::IF_SUCCESS || op == OpCode::IF_EXCEPTION || acc_.IsDependIn(useIt)) {
+            continue;
+        }
+        if (!IsAccess(*useIt, useIt.GetIndex(), object.isArray)) {
+            return false;
+        }
+        accesses.insert(*useIt);
+    }
+    // the accesses are replayed in the order they run, each load gets the value stored last to its key
+    std::vector<std::pair<GateRef, GateRef>> loads;
+    std::vector<GateRef> stores;
+    // a stored value may be a load of the object, which is removed
+    std::unordered_map<GateRef, GateRef> loadValues;
+    auto resolve = [&loadValues](GateRef value) {
+        auto iter = loadValues.find(value);
+        return iter == loadValues.end() ? value : iter->second;
+    };
+    for (GateRef cur = GetNextGate(allocation); cur != Circuit::NullGate() &&
+         loads.size() + stores.size() < accesses.size(); cur = GetNextGate(cur)) {
+        if (accesses.count(cur) == 0) {
+            continue;
+        }
+        switch (bcBuilder_->GetByteCodeOpcode(cur)) {
+            case STOWNBYNAME_PREF_ID32_V8: {
+                std::string name = GetPropertyName(cur);
+                if (name == "__proto__") {
+                    return false;
+                }
+                object.properties[name] = resolve(acc_.GetValueIn(cur, 2));  // 2: the stored value
+                stores.emplace_back(cur);
+                break;
+            }
+            case STOWNBYINDEX_PREF_V8_IMM32: {
+                uint64_t index = acc_.GetBitField(acc_.GetValueIn(cur, 1));
+                object.elements[index] = resolve(acc_.GetValueIn(cur, 2));  // 2: the stored value
+                stores.emplace_back(cur);
+                break;
+            }
+            default: {
+                GateRef value = LoadFromObject(cur, object);
+                if (value == Circuit::NullGate()) {
+                    return false;
+                }
+                loads.emplace_back(cur, value);
+                loadValues[cur] = value;
+                break;
+            }
+        }
+    }
+    if (loads.size() + stores.size() != accesses.size()) {
+        return false;
+    }
+    if (IsLogEnabled()) {
+        LOG_COMPILER(INFO) << "replace the object of gate " << acc_.GetId(allocation) << " with "
+                           << loads.size() << " loads and " << stores.size() << " stores";
+    }
+    for (const auto &[load, value] : loads) {
+        RemoveHirGate(load, value);
+    }
+    for (const auto &store : stores) {
+        RemoveHirGate(store, Circuit::NullGate());
+    }
+    RemoveHirGate(allocation, Circuit::NullGate());
+    return true;
+}
+
+bool EscapeAnalysis::TryReadFromFrame(GateRef allocation)
+{
+    // a suspended method resumes in another frame
+    if (!bcBuilder_->GetAsyncRelatedGates().empty()) {
+        return false;
+    }
+    std::vector<GateRef> accesses;
+    auto uses = acc_.Uses(allocation);
+    for (auto useIt = uses.begin(); useIt != uses.end(); useIt++) {
+        OpCode op = acc_.GetOpCode(*useIt);
+        if (op == OpCode::IF_SUCCESS || op == OpCode::IF_EXCEPTION || acc_.IsDependIn(useIt)) {
+            continue;
+        }
+        if (!IsFrameArgsAccess(*useIt, useIt.GetIndex())) {
+            return false;
+        }
+        accesses.emplace_back(*useIt);
+    }
+    FrameArgs args;
+    if (bcBuilder_->GetByteCodeOpcode(allocation) == COPYRESTARGS_PREF_IMM16) {
+        args.isRest = true;
+        args.restIndex = static_cast<uint32_t>(acc_.GetBitField(acc_.GetValueIn(allocation, 0)));
+    }
+    if (IsLogEnabled()) {
+        LOG_COMPILER(INFO) << "read the object of gate " << acc_.GetId(allocation) << " from the frame for "
+                           << accesses.size() << " accesses";
+    }
+    bcBuilder_->SetFrameArgs(bcBuilder_->GetJSBytecode(allocation), args);
+    for (const auto &access : accesses) {
+        bcBuilder_->SetFrameArgs(bcBuilder_->GetJSBytecode(access), args);
+    }
+    return true;
+}
+
+GateRef EscapeAnalysis::LoadFromObject(GateRef gate, const VirtualObject &object) const
+{
+    if (bcBuilder_->GetByteCodeOpcode(gate) == LDOBJBYINDEX_PREF_V8_IMM32) {
+        auto iter = object.elements.find(acc_.GetBitField(acc_.GetValueIn(gate, 1)));
+        return iter == object.elements.end() ? Circuit::NullGate() : iter->second;
+    }
+    std::string name = GetPropertyName(gate);
+    if (!object.isArray) {
+        auto iter = object.properties.find(name);
+        return iter == object.properties.end() ? Circuit::NullGate() : iter->second;
+    }
+    // the length of an array whose elements were stored from index 0 without a hole
+    size_t length = object.elements.size();
+    if (name != "length" || (length > 0 && object.elements.rbegin()->first != length - 1)) {
+        return Circuit::NullGate();
+    }
+    JSTaggedValue taggedLength(static_cast<int32_t>(length));
+    return circuit_->GetConstantGate(MachineType::I64, taggedLength.GetRawData(), GateType::TaggedValue());
+}
+
+void EscapeAnalysis::RemoveHirGate(GateRef gate, GateRef value)
+{
+    // the gate cannot throw any more, its exception path stays behind a branch that is never taken
+    GateRef ifBranch = builder_.Branch(acc_.GetState(gate), builder_.Boolean(false));
+    GateRef dep = acc_.GetDep(gate);
+    auto uses = acc_.Uses(gate);
+    for (auto useIt = uses.begin(); useIt != uses.end(); useIt++) {
+        OpCode op = acc_.GetOpCode(*useIt);
+        if (op == OpCode::IF_SUCCESS) {
+            acc_.SetOpCode(*useIt, OpCode::IF_FALSE);
+            acc_.ReplaceIn(useIt, ifBranch);
+        } else if (op == OpCode::IF_EXCEPTION) {
+            acc_.SetOpCode(*useIt, OpCode::IF_TRUE);
+            acc_.ReplaceIn(useIt, ifBranch);
+        } else if (acc_.IsDependIn(useIt)) {
+            acc_.ReplaceIn(useIt, dep);
+        } else {
+            ASSERT(value != Circuit::NullGate());
+            acc_.ReplaceIn(useIt, value);
+        }
+    }
+    acc_.DeleteGate(gate);
+}
+}  // namespace panda::ecmascript::kungfu
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_COMPILER_ESCAPE_ANALYSIS_H
+#define ECMASCRIPT_COMPILER_ESCAPE_ANALYSIS_H
+
+#include <map>
+#include <unordered_map>
+
+#include "ecmascript/compiler/bytecode_circuit_builder.h"
+#include "ecmascript/compiler/circuit.h"
+#include "ecmascript/compiler/circuit_builder.h"
+#include "ecmascript/compiler/circuit_builder-inl.h"
+#include "ecmascript/compiler/gate_accessor.h"
+#include "ecmascript/ts_types/ts_loader.h"
+
+namespace panda::ecmascript::kungfu {
+// EscapeAnalysis replaces the objects created by createemptyobject, createemptyarray and createiterresultobj that
+// do not escape the method by the values of their properties. An object does not escape when it is only the
+// receiver of stownbyname and ldobjbyname, or of stownbyindex and ldobjbyindex for an array, and all of them
+// follow its creation on the normal path without a branch or a merge in between. A load then takes the value of
+// the last store to its key, and the creation, the stores and the loads are removed. A load of a key that was not
+// stored would look up the prototype chain, so the object is kept then.
+// An arguments object or a rest array which is only read for its length and elements, or passed on by
+// f.apply(thisArg, object), is not created either, the slowpath lowering reads the actual arguments from the frame
+// for its accesses.
+class EscapeAnalysis {
+public:
+    EscapeAnalysis(BytecodeCircuitBuilder *bcBuilder, Circuit *circuit, CompilationConfig *cmpCfg,
+                   TSLoader *tsLoader, bool enableLog)
+        : bcBuilder_(bcBuilder), circuit_(circuit), acc_(circuit), builder_(circuit, cmpCfg),
+          tsLoader_(tsLoader), enableLog_(enableLog) {}
+    ~EscapeAnalysis() = default;
+    NO_COPY_SEMANTIC(EscapeAnalysis);
+    NO_MOVE_SEMANTIC(EscapeAnalysis);
+
+    void Run();
+
+private:
+    struct VirtualObject {
+        bool isArray {false};
+        std::unordered_map<std::string, GateRef> properties {};
+        std::map<uint64_t, GateRef> elements {};
+    };
+
+    bool IsLogEnabled() const
+    {
+        return enableLog_;
+    }
+
+    bool IsAllocation(GateRef gate) const;
+    bool IsFrameArgs(GateRef gate) const;
+    bool IsFrameArgsAccess(GateRef gate, size_t index) const;
+    bool IsAccess(GateRef gate, size_t index, bool isArray) const;
+    bool IsExceptionDepend(GateRef gate, size_t index) const;
+    GateRef GetNextGate(GateRef gate);
+    std::string GetPropertyName(GateRef gate) const;
+    bool InitObject(GateRef allocation, VirtualObject *object) const;
+    bool TryReplace(GateRef allocation);
+    bool TryReadFromFrame(GateRef allocation);
+    GateRef LoadFromObject(GateRef gate, const VirtualObject &object) const;
+    void RemoveHirGate(GateRef gate, GateRef value);
+
+    BytecodeCircuitBuilder *bcBuilder_;
+    Circuit *circuit_;
+    GateAccessor acc_;
+    CircuitBuilder builder_;
+    TSLoader *tsLoader_ {nullptr};
+    bool enableLog_ {false};
+};
+}  // panda::ecmascript::kungfu
+#endif  // ECMASCRIPT_COMPILER_ESCAPE_ANALYSIS_H
@@ -102,7 +102,6 @@ void StubFileGenerator::SaveStubFile(const std::string &filename)
 
 void AOTFileGenerator::SaveAOTFile(const std::string &filename)
 {
-    RunLLVMAssembler();
     CollectCodeInfo();
     aotInfo_.Save(filename);
     DestoryModule();
@@ -144,14 +144,15 @@ public:
 
     void DestoryModule()
     {
-        if (llvmModule_ != nullptr) {
-            delete llvmModule_;
-            llvmModule_ = nullptr;
-        }
+        // The assembler gives the module back to its owner when destroyed, so it goes first.
         if (assembler_ != nullptr) {
             delete assembler_;
             assembler_ = nullptr;
         }
+        if (llvmModule_ != nullptr) {
+            delete llvmModule_;
+            llvmModule_ = nullptr;
+        }
     }
 private:
     LLVMModule *llvmModule_ {nullptr};
@@ -198,6 +199,7 @@ public:
     explicit AOTFileGenerator(const CompilerLog *log, EcmaVM* vm) : FileGenerator(log), vm_(vm) {};
     ~AOTFileGenerator() override = default;
 
+    // The assembler of the module must have run, see PassManager::Compile.
     void AddModule(LLVMModule *llvmModule, LLVMAssembler *assembler, const JSPandaFile *jsPandaFile)
     {
         modulePackage_.emplace_back(Module(llvmModule, assembler));
@@ -205,7 +207,8 @@ public:
         aotfileHashs_.emplace_back(hash);
     }
 
-    // save function for aot files containing normal func translated from JS/TS
+    // save function for aot files containing normal func translated from JS/TS, the modules are linked into one
+    // file in the order they were added
     void SaveAOTFile(const std::string &filename);
     void GenerateSnapshotFile();
 private:
@@ -103,6 +103,10 @@ Properties OpCode::GetProperties() const
         case CALL:
         case RUNTIME_CALL_WITH_ARGV:
             return {FLEX, NO_STATE, ONE_DEPEND, MANY_VALUE(ANYVALUE, ANYVALUE), NO_ROOT};
+        case DEOPT:
+            return {I64, NO_STATE, ONE_DEPEND, VALUE(ANYVALUE, ANYVALUE, NOVALUE), NO_ROOT};
+        case FRAME_STATE:
+            return {NOVALUE, NO_STATE, NO_DEPEND, MANY_VALUE(ANYVALUE), NO_ROOT};
         case ALLOCA:
             return {ARCH, NO_STATE, NO_DEPEND, NO_VALUE, OpCode(ALLOCA_LIST)};
         case ARG:
@@ -242,6 +246,8 @@ std::string OpCode::Str() const
         {CALL, "CALL"},
         {BYTECODE_CALL, "BYTECODE_CALL"},
         {DEBUGGER_BYTECODE_CALL, "DEBUGGER_BYTECODE_CALL"},
+        {DEOPT, "DEOPT"},
+        {FRAME_STATE, "FRAME_STATE"},
         {ALLOCA, "ALLOCA"},
         {ARG, "ARG"},
         {MUTABLE_DATA, "MUTABLE_DATA"},
@@ -1182,6 +1188,12 @@ bool OpCode::IsSchedulable() const
     return (op_ != OpCode::NOP) && (!IsProlog()) && (!IsRoot()) && (!IsFixed()) && (GetStateCount(1) == 0);
 }
 
+bool OpCode::IsPure() const
+{
+    return IsSchedulable() && (GetDependCount(1) == 0) && (!GetProperties().root.has_value()) &&
+           (op_ != OpCode::FRAME_STATE);
+}
+
 bool OpCode::IsState() const
 {
     return (op_ != OpCode::NOP) && (!IsProlog()) && (!IsRoot()) && (!IsFixed()) && (GetStateCount(1) > 0);
@@ -101,6 +101,8 @@ public:
         CALL,
         BYTECODE_CALL,
         DEBUGGER_BYTECODE_CALL,
+        DEOPT,
+        FRAME_STATE,
         ALLOCA,
         ARG,
         MUTABLE_DATA,
@@ -182,6 +184,8 @@ public:
     [[nodiscard]] bool IsProlog() const;
     [[nodiscard]] bool IsFixed() const;
     [[nodiscard]] bool IsSchedulable() const;
+    // no state, no depend and no root, so equal gates compute the same value anywhere
+    [[nodiscard]] bool IsPure() const;
     [[nodiscard]] bool IsState() const;  // note: IsState(STATE_ENTRY) == false
     [[nodiscard]] bool IsGeneralState() const;
     [[nodiscard]] bool IsTerminalState() const;
@@ -382,6 +382,7 @@ DECLARE_ASM_HANDLER(HandleNewObjDynRangePrefImm16V8)
         {
             Label isHeapObject(env);
             Label checkJSObject(env);
+            Label checkSlackTracking(env);
             auto protoOrHclass = Load(VariableType::JS_ANY(), ctor,
                 IntPtr(JSFunction::PROTO_OR_DYNCLASS_OFFSET));
             Branch(TaggedIsHeapObject(protoOrHclass), &isHeapObject, &callRuntime);
@@ -390,7 +391,10 @@ DECLARE_ASM_HANDLER(HandleNewObjDynRangePrefImm16V8)
             Bind(&checkJSObject);
             auto objectType = GetObjectType(protoOrHclass);
             Branch(Int32Equal(objectType, Int32(static_cast<int32_t>(JSType::JS_OBJECT))),
-                &newObject, &callRuntime);
+                &checkSlackTracking, &callRuntime);
+            Bind(&checkSlackTracking);
+            // the runtime counts the instances constructed while the initial hclass is in slack tracking.
+            Branch(IsInSlackTracking(protoOrHclass), &callRuntime, &newObject);
             Bind(&newObject);
             {
                 thisObj = NewJSObject(glue, protoOrHclass);
@@ -3700,7 +3704,25 @@ DECLARE_ASM_HANDLER(HandleLdObjByNamePrefId32V8)
             }
             Bind(&notHeapObject);
             {
-                Branch(TaggedIsUndefined(firstValue), &slowPath, &tryFastPath);
+                Label tryMega(env);
+                Branch(TaggedIsUndefined(firstValue), &slowPath, &tryMega);
+                // the slot is megamorphic
+                Bind(&tryMega);
+                {
+                    Label megaHit(env);
+                    Label megaMiss(env);
+                    GateRef stringId = ReadInst32_1(pc);
+                    GateRef propKey = GetValueFromTaggedArray(VariableType::JS_ANY(), constpool, stringId);
+                    GateRef megaHandler = TryGetMegaICHandler(glue, LoadHClass(receiver), propKey, false);
+                    Branch(TaggedIsHole(megaHandler), &megaMiss, &megaHit);
+                    Bind(&megaHit);
+                    {
+                        result = LoadICWithHandler(glue, receiver, receiver, megaHandler);
+                        Branch(TaggedIsHole(*result), &slowPath, &notHole);
+                    }
+                    Bind(&megaMiss);
+                    Branch(CanUseMegaICCache(receiver), &slowPath, &tryFastPath);
+                }
             }
         }
         Bind(&notHole);
@@ -3789,7 +3811,25 @@ DECLARE_ASM_HANDLER(HandleStObjByNamePrefId32V8)
             }
             Bind(&notHeapObject);
             {
-                Branch(TaggedIsUndefined(firstValue), &slowPath, &tryFastPath);
+                Label tryMega(env);
+                Branch(TaggedIsUndefined(firstValue), &slowPath, &tryMega);
+                // the slot is megamorphic
+                Bind(&tryMega);
+                {
+                    Label megaHit(env);
+                    Label megaMiss(env);
+                    GateRef stringId = ReadInst32_1(pc);
+                    GateRef propKey = GetValueFromTaggedArray(VariableType::JS_ANY(), constpool, stringId);
+                    GateRef megaHandler = TryGetMegaICHandler(glue, LoadHClass(receiver), propKey, true);
+                    Branch(TaggedIsHole(megaHandler), &megaMiss, &megaHit);
+                    Bind(&megaHit);
+                    {
+                        result = StoreICWithHandler(glue, receiver, receiver, acc, megaHandler);
+                        Branch(TaggedIsHole(*result), &slowPath, &checkResult);
+                    }
+                    Bind(&megaMiss);
+                    Branch(CanUseMegaICCache(receiver), &slowPath, &tryFastPath);
+                }
             }
         }
         Bind(&tryFastPath);
@@ -5149,6 +5189,65 @@ DECLARE_ASM_HANDLER(NewObjectDynRangeThrowException)
     CallRuntime(glue, RTSTUB_ID(ThrowDerivedMustReturnException), {});
     DISPATCH_LAST();
 }
+
+DECLARE_ASM_HANDLER(HandleLdaDynV8StaDynV8)
+{
+    GateRef value = GetVregValue(sp, ZExtInt8ToPtr(ReadInst8_0(pc)));
+    GateRef staPc = PtrAdd(pc, IntPtr(BytecodeInstruction::Size(BytecodeInstruction::Format::V8)));
+    SetVregValue(glue, sp, ZExtInt8ToPtr(ReadInst8_0(staPc)), value);
+    Dispatch(glue, sp, staPc, constpool, profileTypeInfo, value, hotnessCounter,
+             IntPtr(BytecodeInstruction::Size(BytecodeInstruction::Format::V8)));
+}
+
+DECLARE_ASM_HANDLER(HandleStaDynV8LdaDynV8)
+{
+    SetVregValue(glue, sp, ZExtInt8ToPtr(ReadInst8_0(pc)), acc);
+    GateRef ldaPc = PtrAdd(pc, IntPtr(BytecodeInstruction::Size(BytecodeInstruction::Format::V8)));
+    GateRef value = GetVregValue(sp, ZExtInt8ToPtr(ReadInst8_0(ldaPc)));
+    Dispatch(glue, sp, ldaPc, constpool, profileTypeInfo, value, hotnessCounter,
+             IntPtr(BytecodeInstruction::Size(BytecodeInstruction::Format::V8)));
+}
+
+DECLARE_ASM_HANDLER(HandleStaDynV8CallIThisRangeDynPrefImm16V8)
+{
+    SetVregValue(glue, sp, ZExtInt8ToPtr(ReadInst8_0(pc)), acc);
+    // the call runs at its own pc, which the frame of the callee returns to
+    GateRef callPc = PtrAdd(pc, IntPtr(BytecodeInstruction::Size(BytecodeInstruction::Format::V8)));
+    DispatchWithId(glue, sp, callPc, constpool, profileTypeInfo, acc, hotnessCounter,
+        BCSTUB_ID(HandleCallIThisRangeDynPrefImm16V8));
+}
+
+DECLARE_ASM_HANDLER(HandleLessDynPrefV8JeqzImm8)
+{
+    auto env = GetEnvironment();
+    GateRef left = GetVregValue(sp, ZExtInt8ToPtr(ReadInst8_1(pc)));
+    GateRef right = acc;
+    GateRef jeqzPc = PtrAdd(pc, IntPtr(BytecodeInstruction::Size(BytecodeInstruction::Format::PREF_V8)));
+    Label leftIsInt(env);
+    Label bothInt(env);
+    Label slowPath(env);
+    Label leftLessRight(env);
+    Label leftNotLessRight(env);
+    Branch(TaggedIsInt(left), &leftIsInt, &slowPath);
+    Bind(&leftIsInt);
+    Branch(TaggedIsInt(right), &bothInt, &slowPath);
+    Bind(&bothInt);
+    Branch(Int32LessThan(TaggedGetInt(left), TaggedGetInt(right)), &leftLessRight, &leftNotLessRight);
+    Bind(&leftLessRight);
+    {
+        // the jeqz falls through
+        Dispatch(glue, sp, jeqzPc, constpool, profileTypeInfo, ChangeInt64ToTagged(TaggedTrue()), hotnessCounter,
+                 IntPtr(BytecodeInstruction::Size(BytecodeInstruction::Format::IMM8)));
+    }
+    Bind(&leftNotLessRight);
+    {
+        // the jeqz jumps, it updates the hotness counter of a back edge
+        DispatchWithId(glue, sp, jeqzPc, constpool, profileTypeInfo, ChangeInt64ToTagged(TaggedFalse()),
+            hotnessCounter, BCSTUB_ID(HandleJeqzImm8));
+    }
+    Bind(&slowPath);
+    DispatchWithId(glue, sp, pc, constpool, profileTypeInfo, acc, hotnessCounter, BCSTUB_ID(HandleLessDynPrefV8));
+}
 #undef DECLARE_ASM_HANDLER
 #undef DISPATCH
 #undef DISPATCH_WITH_ACC
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/compiler/jit_compiler.h"
+
+#include "ecmascript/compiler/llvm_ir_builder.h"
+#include "ecmascript/compiler/pass.h"
+#include "ecmascript/ecma_vm.h"
+#include "ecmascript/jspandafile/panda_file_translator.h"
+
+namespace panda::ecmascript::kungfu {
+JitCompilationImpl::JitCompilationImpl(EcmaVM *vm, const JSMethod *method)
+    : vm_(vm), method_(method), triple_(GetHostTriple()), optLevel_(vm->GetJSOptions().GetOptLevel()),
+      log_(vm->GetJSOptions().GetlogCompiledMethods())
+{
+}
+
+std::string JitCompilationImpl::GetHostTriple()
+{
+#if defined(PANDA_TARGET_ARM64)
+    return "aarch64-unknown-linux-gnu";
+#elif defined(PANDA_TARGET_ARM32)
+    return "arm-unknown-linux-gnu";
+#else
+    return "x86_64-unknown-linux-gnu";
+#endif
+}
+
+bool JitCompilationImpl::CollectPcs(std::vector<uint8_t *> *pcArray) const
+{
+    BytecodeTranslationInfo scanInfo;
+    scanInfo.jsPandaFile = method_->GetJSPandaFile();
+    scanInfo.methodPcInfos.emplace_back(MethodPcInfo {method_, {}});
+    BytecodeCircuitBuilder scanner(scanInfo, 0, vm_->GetTSLoader(), false);
+
+    auto pc = const_cast<uint8_t *>(method_->GetBytecodeArray());
+    auto end = pc + method_->GetCodeSize();
+    while (pc < end) {
+        pcArray->emplace_back(pc);
+        auto offset = scanner.GetBytecodeInfo(pc).offset;
+        if (offset == 0) {
+            return false;
+        }
+        pc += offset;
+    }
+    pcArray->emplace_back(end);
+    return pc == end;
+}
+
+bool JitCompilationImpl::BuildCircuit(const JSHandle<JSTaggedValue> &constpool)
+{
+    if (method_->GetJSPandaFile() == nullptr) {
+        return false;
+    }
+    BytecodeTranslationInfo translationInfo;
+    translationInfo.jsPandaFile = method_->GetJSPandaFile();
+    translationInfo.constantPool = constpool;
+    translationInfo.methodPcInfos.emplace_back(MethodPcInfo {method_, {}});
+    if (!CollectPcs(&translationInfo.methodPcInfos.back().pcArray)) {
+        return false;
+    }
+
+    bool enableLog = log_.IsAlwaysEnabled();
+    if (enableLog) {
+        LOG_COMPILER(INFO) << "\033[34m" << "jit method [" << method_->GetMethodName() << "] log:" << "\033[0m";
+    }
+    builder_ = std::make_unique<BytecodeCircuitBuilder>(translationInfo, 0, vm_->GetTSLoader(), enableLog);
+    builder_->BytecodeToCircuit();
+    return true;
+}
+
+bool JitCompilationImpl::Compile(JitCode *code)
+{
+    ASSERT(builder_ != nullptr);
+    bool enableLog = log_.IsAlwaysEnabled();
+    CompilationConfig cmpCfg(triple_);
+    PassData data(builder_->GetCircuit());
+    PassRunner<PassData> pipeline(&data, enableLog);
+    pipeline.RunPass<SlowPathLoweringPass>(builder_.get(), &cmpCfg);
+    pipeline.RunPass<VerifierPass>();
+    pipeline.RunPass<SchedulingPass>();
+
+    // The assembler removes the module from its engine when destroyed, so it must go before the module.
+    LLVMModule module("jit_" + std::string(method_->GetMethodName()), triple_);
+    pipeline.RunPass<LLVMIRGenPass>(&module, method_);
+    LLVMAssembler assembler(module.GetModule(), LOptions(optLevel_, true));
+    assembler.Run();
+
+    LLVMValueRef func = nullptr;
+    module.IteratefuncIndexMap([&func]([[maybe_unused]] size_t idx, LLVMValueRef function) {
+        func = function;
+    });
+    uintptr_t codeBuff = assembler.GetCodeBuffer();
+    uint32_t codeSize = assembler.GetCodeSize();
+    if (func == nullptr || codeSize == 0) {
+        return false;
+    }
+    auto entry = reinterpret_cast<uintptr_t>(assembler.GetFuncPtrFromCompiledModule(func));
+    ASSERT(entry >= codeBuff && entry < codeBuff + codeSize);
+    code->hostCodeAddr = codeBuff;
+    code->funcOffset = static_cast<uint32_t>(entry - codeBuff);
+    code->funcSize = codeSize - code->funcOffset;
+    code->fpDelta = LLVMAssembler::GetFpDeltaPrevFramSp(func, log_);
+    auto codeBegin = reinterpret_cast<const uint8_t *>(codeBuff);
+    code->code.assign(codeBegin, codeBegin + codeSize);
+    auto stackMapsBegin = reinterpret_cast<const uint8_t *>(assembler.GetStackMapsSection());
+    code->stackMaps.assign(stackMapsBegin, stackMapsBegin + assembler.GetStackMapsSize());
+    return true;
+}
+}  // namespace panda::ecmascript::kungfu
+
+panda::ecmascript::JitCompilation *CreateJitCompilation(panda::ecmascript::EcmaVM *vm,
+    const panda::ecmascript::JSMethod *method)
+{
+    return new panda::ecmascript::kungfu::JitCompilationImpl(vm, method);
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_COMPILER_JIT_COMPILER_H
+#define ECMASCRIPT_COMPILER_JIT_COMPILER_H
+
+#include "ecmascript/compiler/bytecode_circuit_builder.h"
+#include "ecmascript/compiler/compiler_log.h"
+#include "ecmascript/jit/jit.h"
+
+namespace panda::ecmascript::kungfu {
+// JitCompilationImpl compiles one method with the baseline pipeline of the aot compiler, without the type passes:
+// the circuit is lowered to runtime calls, scheduled and generated by llvm in a module of its own.
+class JitCompilationImpl : public JitCompilation {
+public:
+    JitCompilationImpl(EcmaVM *vm, const JSMethod *method);
+    ~JitCompilationImpl() override = default;
+    NO_COPY_SEMANTIC(JitCompilationImpl);
+    NO_MOVE_SEMANTIC(JitCompilationImpl);
+
+    bool BuildCircuit(const JSHandle<JSTaggedValue> &constpool) override;
+    bool Compile(JitCode *code) override;
+
+private:
+    // The bytecode of a loaded method has been translated in place, so its pcs are collected again here.
+    bool CollectPcs(std::vector<uint8_t *> *pcArray) const;
+    static std::string GetHostTriple();
+
+    EcmaVM *vm_ {nullptr};
+    const JSMethod *method_ {nullptr};
+    std::string triple_;
+    size_t optLevel_ {0};
+    CompilerLog log_;
+    std::unique_ptr<BytecodeCircuitBuilder> builder_ {nullptr};
+};
+}  // namespace panda::ecmascript::kungfu
+
+extern "C" PUBLIC_API panda::ecmascript::JitCompilation *CreateJitCompilation(panda::ecmascript::EcmaVM *vm,
+    const panda::ecmascript::JSMethod *method);
+#endif  // ECMASCRIPT_COMPILER_JIT_COMPILER_H
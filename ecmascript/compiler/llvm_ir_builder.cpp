@@ -58,8 +58,8 @@ LLVMIRBuilder::LLVMIRBuilder(const std::vector<std::vector<GateRef>> *schedule,
     : compCfg_(cfg), scheduledGates_(schedule), circuit_(circuit), module_(module->GetModule()),
       function_(function), llvmModule_(module), callConv_(callConv), enableLog_(enableLog)
 {
-    builder_ = LLVMCreateBuilder();
-    context_ = LLVMGetGlobalContext();
+    context_ = module->GetContext();
+    builder_ = LLVMCreateBuilderInContext(context_);
     bbID2BB_.clear();
     SetFunctionCallConv();
     InitializeHandlers();
@@ -67,10 +67,10 @@ LLVMIRBuilder::LLVMIRBuilder(const std::vector<std::vector<GateRef>> *schedule,
     LLVMSetGC(function_, "statepoint-example");
     if (compCfg_->Is32Bit()) {
         slotSize_ = sizeof(uint32_t);
-        slotType_ = LLVMInt32Type();
+        slotType_ = LLVMInt32TypeInContext(context_);
     } else {
         slotSize_ = sizeof(uint64_t);
-        slotType_ = LLVMInt64Type();
+        slotType_ = LLVMInt64TypeInContext(context_);
     }
     if (compCfg_->Is32Bit()) {
         // hard float instruction
@@ -144,6 +144,7 @@ void LLVMIRBuilder::InitializeHandlers()
         {OpCode::CALL, &LLVMIRBuilder::HandleCall},
         {OpCode::BYTECODE_CALL, &LLVMIRBuilder::HandleBytecodeCall},
         {OpCode::DEBUGGER_BYTECODE_CALL, &LLVMIRBuilder::HandleDebuggerBytecodeCall},
+        {OpCode::DEOPT, &LLVMIRBuilder::HandleDeopt},
         {OpCode::ALLOCA, &LLVMIRBuilder::HandleAlloca},
         {OpCode::ARG, &LLVMIRBuilder::HandleParameter},
         {OpCode::CONSTANT, &LLVMIRBuilder::HandleConstant},
@@ -196,7 +197,8 @@ void LLVMIRBuilder::InitializeHandlers()
         OpCode::NOP, OpCode::CIRCUIT_ROOT, OpCode::DEPEND_ENTRY,
         OpCode::FRAMESTATE_ENTRY, OpCode::RETURN_LIST, OpCode::THROW_LIST,
         OpCode::CONSTANT_LIST, OpCode::ARG_LIST, OpCode::THROW,
-        OpCode::DEPEND_SELECTOR, OpCode::DEPEND_RELAY, OpCode::DEPEND_AND
+        OpCode::DEPEND_SELECTOR, OpCode::DEPEND_RELAY, OpCode::DEPEND_AND,
+        OpCode::FRAME_STATE
     };
 }
 
@@ -394,14 +396,14 @@ LLVMValueRef LLVMIRBuilder::CallingFp(LLVMModuleRef &module, LLVMBuilderRef &bui
         return LLVMGetParam(function_, static_cast<unsigned>(InterpreterHandlerInputs::SP));
     }
     /* 0:calling 1:its caller */
-    std::vector<LLVMValueRef> args = {LLVMConstInt(LLVMInt32Type(), 0, isCaller)};
+    std::vector<LLVMValueRef> args = {LLVMConstInt(LLVMInt32TypeInContext(context_), 0, isCaller)};
     auto fn = LLVMGetNamedFunction(module, "llvm.frameaddress.p0i8");
     if (!fn) {
         /* init instrinsic function declare */
         LLVMTypeRef paramTys1[] = {
-            LLVMInt32Type(),
+            LLVMInt32TypeInContext(context_),
         };
-        auto fnTy = LLVMFunctionType(LLVMPointerType(LLVMInt8Type(), 0), paramTys1, 1, 0);
+        auto fnTy = LLVMFunctionType(LLVMPointerType(LLVMInt8TypeInContext(context_), 0), paramTys1, 1, 0);
         fn = LLVMAddFunction(module, "llvm.frameaddress.p0i8", fnTy);
     }
     LLVMValueRef fAddrRet = LLVMBuildCall(builder, fn, args.data(), 1, "");
@@ -418,7 +420,7 @@ LLVMValueRef LLVMIRBuilder::ReadRegister(LLVMModuleRef &module, [[maybe_unused]]
         LLVMTypeRef paramTys1[] = {
             GetMachineRepType(MachineRep::K_META),
         };
-        auto fnTy = LLVMFunctionType(LLVMInt64Type(), paramTys1, 1, 0);
+        auto fnTy = LLVMFunctionType(LLVMInt64TypeInContext(context_), paramTys1, 1, 0);
         fn = LLVMAddFunction(module, "llvm.read_register.i64", fnTy);
     }
     LLVMValueRef fAddrRet = LLVMBuildCall(builder_, fn, args.data(), 1, "");
@@ -433,7 +435,7 @@ LLVMBasicBlockRef LLVMIRBuilder::EnsureLBB(BasicBlock *bb) const
     }
 
     std::string buf = "B" + std::to_string(bb->GetId());
-    LLVMBasicBlockRef llvmBB = LLVMAppendBasicBlock(function_, buf.c_str());
+    LLVMBasicBlockRef llvmBB = LLVMAppendBasicBlockInContext(context_, function_, buf.c_str());
     impl->lBB_ = llvmBB;
     impl->continuation = llvmBB;
     bb->SetImpl(impl);
@@ -464,7 +466,8 @@ LLVMTypeRef LLVMIRBuilder::GetMachineRepType(MachineRep rep) const
             break;
         case MachineRep::K_PTR_1:
             if (compCfg_->Is32Bit()) {
-                dstType = LLVMVectorType(LLVMPointerType(LLVMInt8Type(), 1), 2); // 2: packed vector type
+                // 2: packed vector type
+                dstType = LLVMVectorType(LLVMPointerType(LLVMInt8TypeInContext(context_), 1), 2);
             } else {
                 dstType = LLVMPointerType(LLVMInt64TypeInContext(context_), 1);
             }
@@ -544,8 +547,8 @@ void LLVMIRBuilder::VisitRuntimeCall(GateRef gate, const std::vector<GateRef> &i
     std::vector<LLVMValueRef> params;
     params.push_back(glue); // glue
     int index = static_cast<int>(circuit_->GetBitField(inList[static_cast<int>(CallInputs::TARGET)]));
-    params.push_back(LLVMConstInt(LLVMInt64Type(), index, 0)); // target
-    params.push_back(LLVMConstInt(LLVMInt64Type(),
+    params.push_back(LLVMConstInt(LLVMInt64TypeInContext(context_), index, 0)); // target
+    params.push_back(LLVMConstInt(LLVMInt64TypeInContext(context_),
         inList.size() - static_cast<size_t>(CallInputs::FIRST_PARAMETER), 0)); // argc
     for (size_t paraIdx = static_cast<size_t>(CallInputs::FIRST_PARAMETER); paraIdx < inList.size(); ++paraIdx) {
         GateRef gateTmp = inList[paraIdx];
@@ -558,6 +561,44 @@ void LLVMIRBuilder::VisitRuntimeCall(GateRef gate, const std::vector<GateRef> &i
     gate2LValue_[gate] = runtimeCall;
 }
 
+void LLVMIRBuilder::HandleDeopt(GateRef gate)
+{
+    std::vector<GateRef> ins = circuit_->GetInVector(gate);
+    VisitDeopt(gate, ins);
+}
+
+void LLVMIRBuilder::VisitDeopt(GateRef gate, const std::vector<GateRef> &inList)
+{
+    ASSERT(llvmModule_ != nullptr);
+    StubIdType stubId = RTSTUB_ID(CallRuntime);
+    LLVMValueRef glue = GetGlue(inList);
+    int stubIndex = static_cast<int>(std::get<RuntimeStubCSigns::ID>(stubId));
+    LLVMValueRef rtoffset = GetRTStubOffset(glue, stubIndex);
+    LLVMValueRef rtbaseoffset = LLVMBuildAdd(builder_, glue, rtoffset, "");
+    const CallSignature *signature = RuntimeStubCSigns::Get(std::get<RuntimeStubCSigns::ID>(stubId));
+    LLVMValueRef callee = GetFunction(glue, signature, rtbaseoffset);
+
+    std::vector<LLVMValueRef> params;
+    params.push_back(glue); // glue
+    int index = static_cast<int>(circuit_->GetBitField(inList[static_cast<int>(CallInputs::TARGET)]));
+    params.push_back(LLVMConstInt(LLVMInt64TypeInContext(context_), index, 0)); // target
+    params.push_back(LLVMConstInt(LLVMInt64TypeInContext(context_), 0, 0)); // argc
+
+    // the deoptimizer reads the frame state from the stackmap of the call, so its values go to the deopt bundle
+    GateRef frameState = inList[static_cast<size_t>(CallInputs::FIRST_PARAMETER)];
+    std::vector<LLVMValueRef> values;
+    for (GateRef value : circuit_->GetInVector(frameState)) {
+        values.push_back(gate2LValue_[value]);
+    }
+    LLVMTypeRef funcType = llvmModule_->GetFuncType(signature);
+    LLVMValueRef call = LLVMBuildCall3(builder_, funcType, callee, params.data(), params.size(), "", values.data(),
+                                       values.size());
+    if (!compCfg_->Is32Bit()) {  // Arm32 not support webkit jscc calling convention
+        LLVMSetInstructionCallConv(call, LLVMWebKitJSCallConv);
+    }
+    gate2LValue_[gate] = call;
+}
+
 void LLVMIRBuilder::HandleRuntimeCallWithArgv(GateRef gate)
 {
     std::vector<GateRef> ins = circuit_->GetInVector(gate);
@@ -579,7 +620,7 @@ void LLVMIRBuilder::VisitRuntimeCallWithArgv(GateRef gate, const std::vector<Gat
     params.push_back(glue); // glue
 
     BitField index = circuit_->GetBitField(inList[static_cast<size_t>(CallInputs::TARGET)]);
-    auto targetId = LLVMConstInt(LLVMInt64Type(), index, 0);
+    auto targetId = LLVMConstInt(LLVMInt64TypeInContext(context_), index, 0);
     params.push_back(targetId); // target
     for (size_t paraIdx = static_cast<size_t>(CallInputs::FIRST_PARAMETER); paraIdx < inList.size(); ++paraIdx) {
         GateRef gateTmp = inList[paraIdx];
@@ -605,7 +646,8 @@ LLVMValueRef LLVMIRBuilder::GetCurrentSP()
 LLVMValueRef LLVMIRBuilder::GetCurrentFrameType(LLVMValueRef currentSpFrameAddr)
 {
     LLVMValueRef tmp = LLVMBuildSub(builder_, currentSpFrameAddr, LLVMConstInt(slotType_, slotSize_, 1), "");
-    LLVMValueRef frameTypeAddr = LLVMBuildIntToPtr(builder_, tmp, LLVMPointerType(LLVMInt64Type(), 0), "");
+    LLVMValueRef frameTypeAddr =
+        LLVMBuildIntToPtr(builder_, tmp, LLVMPointerType(LLVMInt64TypeInContext(context_), 0), "");
     LLVMValueRef frameType = LLVMBuildLoad(builder_, frameTypeAddr, "");
     return frameType;
 }
@@ -730,7 +772,7 @@ void LLVMIRBuilder::VisitCall(GateRef gate, const std::vector<GateRef> &inList,
         }
     }
     size_t actualNumArgs = 0;
-    LLVMValueRef bcOffset = LLVMConstInt(LLVMInt32Type(), 0, 0);
+    LLVMValueRef bcOffset = LLVMConstInt(LLVMInt32TypeInContext(context_), 0, 0);
     ComputeArgCountAndBCOffset(actualNumArgs, bcOffset, inList, op);
 
     // then push the actual parameter for js function call
@@ -741,9 +783,9 @@ void LLVMIRBuilder::VisitCall(GateRef gate, const std::vector<GateRef> &inList,
             const auto paramType = paramTypes.at(params.size());
             // match parameter types and function signature types
             if (IsHeapPointerType(paramType) && !IsHeapPointerType(gateTmpType)) {
-                params.push_back(
-                    LLVMBuildIntToPtr(builder_, LLVMBuildBitCast(builder_, gate2LValue_[gateTmp], LLVMInt64Type(), ""),
-                                      paramType, ""));
+                LLVMValueRef intValue =
+                    LLVMBuildBitCast(builder_, gate2LValue_[gateTmp], LLVMInt64TypeInContext(context_), "");
+                params.push_back(LLVMBuildIntToPtr(builder_, intValue, paramType, ""));
             } else {
                 params.push_back(LLVMBuildBitCast(builder_, gate2LValue_[gateTmp], paramType, ""));
             }
@@ -993,22 +1035,23 @@ void LLVMIRBuilder::VisitConstant(GateRef gate, std::bitset<64> value) // 64: bi
         }
     }
     if (machineType == MachineType::I32) {
-        llvmValue = LLVMConstInt(LLVMInt32Type(), value.to_ulong(), 0);
+        llvmValue = LLVMConstInt(LLVMInt32TypeInContext(context_), value.to_ulong(), 0);
     } else if (machineType == MachineType::I64) {
-        llvmValue = LLVMConstInt(LLVMInt64Type(), value.to_ullong(), 0);
+        llvmValue = LLVMConstInt(LLVMInt64TypeInContext(context_), value.to_ullong(), 0);
         LLVMTypeRef type = ConvertLLVMTypeFromGate(gate);
         if (LLVMGetTypeKind(type) == LLVMPointerTypeKind) {
             llvmValue = LLVMBuildIntToPtr(builder_, llvmValue, type, "");
         } else if (LLVMGetTypeKind(type) == LLVMVectorTypeKind) {
-            LLVMValueRef tmp1Value =
-                    LLVMBuildLShr(builder_, llvmValue, LLVMConstInt(LLVMInt64Type(), 32, 0), ""); // 32: offset
-            LLVMValueRef tmp2Value = LLVMBuildIntCast(builder_, llvmValue, LLVMInt32Type(), ""); // low
+            LLVMValueRef tmp1Value = LLVMBuildLShr(
+                builder_, llvmValue, LLVMConstInt(LLVMInt64TypeInContext(context_), 32, 0), ""); // 32: offset
+            LLVMValueRef tmp2Value = LLVMBuildIntCast(builder_, llvmValue, LLVMInt32TypeInContext(context_), ""); // low
             LLVMValueRef emptyValue = LLVMGetUndef(type);
-            tmp1Value = LLVMBuildIntToPtr(builder_, tmp1Value, LLVMPointerType(LLVMInt8Type(), 1), "");
-            tmp2Value = LLVMBuildIntToPtr(builder_, tmp2Value, LLVMPointerType(LLVMInt8Type(), 1), "");
+            tmp1Value = LLVMBuildIntToPtr(builder_, tmp1Value, LLVMPointerType(LLVMInt8TypeInContext(context_), 1), "");
+            tmp2Value = LLVMBuildIntToPtr(builder_, tmp2Value, LLVMPointerType(LLVMInt8TypeInContext(context_), 1), "");
             llvmValue = LLVMBuildInsertElement(
-                builder_, emptyValue, tmp2Value, LLVMConstInt(LLVMInt32Type(), 0, 0), "");
-            llvmValue = LLVMBuildInsertElement(builder_, llvmValue, tmp1Value, LLVMConstInt(LLVMInt32Type(), 1, 0), "");
+                builder_, emptyValue, tmp2Value, LLVMConstInt(LLVMInt32TypeInContext(context_), 0, 0), "");
+            llvmValue = LLVMBuildInsertElement(
+                builder_, llvmValue, tmp1Value, LLVMConstInt(LLVMInt32TypeInContext(context_), 1, 0), "");
         } else if (LLVMGetTypeKind(type) == LLVMIntegerTypeKind) {
             // do nothing
         } else {
@@ -1016,13 +1059,13 @@ void LLVMIRBuilder::VisitConstant(GateRef gate, std::bitset<64> value) // 64: bi
         }
     } else if (machineType == MachineType::F64) {
         auto doubleValue = bit_cast<double>(value.to_ullong()); // actual double value
-        llvmValue = LLVMConstReal(LLVMDoubleType(), doubleValue);
+        llvmValue = LLVMConstReal(LLVMDoubleTypeInContext(context_), doubleValue);
     } else if (machineType == MachineType::I8) {
-        llvmValue = LLVMConstInt(LLVMInt8Type(), value.to_ulong(), 0);
+        llvmValue = LLVMConstInt(LLVMInt8TypeInContext(context_), value.to_ulong(), 0);
     } else if (machineType == MachineType::I16) {
-        llvmValue = LLVMConstInt(LLVMInt16Type(), value.to_ulong(), 0);
+        llvmValue = LLVMConstInt(LLVMInt16TypeInContext(context_), value.to_ulong(), 0);
     } else if (machineType == MachineType::I1) {
-        llvmValue = LLVMConstInt(LLVMInt1Type(), value.to_ulong(), 0);
+        llvmValue = LLVMConstInt(LLVMInt1TypeInContext(context_), value.to_ulong(), 0);
     } else {
         UNREACHABLE();
     }
@@ -1037,8 +1080,8 @@ void LLVMIRBuilder::HandleRelocatableData(GateRef gate)
 
 void LLVMIRBuilder::VisitRelocatableData(GateRef gate, uint64_t value)
 {
-    LLVMValueRef globalValue = LLVMAddGlobal(module_, LLVMInt64Type(), "G");
-    LLVMSetInitializer(globalValue, LLVMConstInt(LLVMInt64Type(), value, 0));
+    LLVMValueRef globalValue = LLVMAddGlobal(module_, LLVMInt64TypeInContext(context_), "G");
+    LLVMSetInitializer(globalValue, LLVMConstInt(LLVMInt64TypeInContext(context_), value, 0));
     gate2LValue_[gate] = globalValue;
 }
 
@@ -1211,16 +1254,18 @@ void LLVMIRBuilder::VisitStore(GateRef gate, GateRef base, GateRef dataToStore)
 LLVMValueRef LLVMIRBuilder::CanonicalizeToInt(LLVMValueRef value)
 {
     if (LLVMGetTypeKind(LLVMTypeOf(value)) == LLVMVectorTypeKind) {
-        LLVMValueRef e1Value0 = LLVMBuildExtractElement(builder_, value, LLVMConstInt(LLVMInt32Type(), 0, 1), "");
-        LLVMValueRef e1Value1 = LLVMBuildExtractElement(builder_, value, LLVMConstInt(LLVMInt32Type(), 1, 1), "");
-        LLVMValueRef tmp1 = LLVMBuildPtrToInt(builder_, e1Value1, LLVMInt64Type(), "");
-        LLVMValueRef constValue = LLVMConstInt(LLVMInt64Type(), 32, 0); // 32: offset
+        LLVMValueRef e1Value0 =
+            LLVMBuildExtractElement(builder_, value, LLVMConstInt(LLVMInt32TypeInContext(context_), 0, 1), "");
+        LLVMValueRef e1Value1 =
+            LLVMBuildExtractElement(builder_, value, LLVMConstInt(LLVMInt32TypeInContext(context_), 1, 1), "");
+        LLVMValueRef tmp1 = LLVMBuildPtrToInt(builder_, e1Value1, LLVMInt64TypeInContext(context_), "");
+        LLVMValueRef constValue = LLVMConstInt(LLVMInt64TypeInContext(context_), 32, 0); // 32: offset
         LLVMValueRef tmp1Value = LLVMBuildShl(builder_, tmp1, constValue, "");
-        LLVMValueRef tmp2Value = LLVMBuildPtrToInt(builder_, e1Value0, LLVMInt64Type(), "");
+        LLVMValueRef tmp2Value = LLVMBuildPtrToInt(builder_, e1Value0, LLVMInt64TypeInContext(context_), "");
         LLVMValueRef resultValue = LLVMBuildAdd(builder_, tmp1Value, tmp2Value, "");
         return resultValue;
     } else if (LLVMGetTypeKind(LLVMTypeOf(value)) == LLVMPointerTypeKind) {
-        return LLVMBuildPtrToInt(builder_, value, LLVMInt64Type(), "");
+        return LLVMBuildPtrToInt(builder_, value, LLVMInt64TypeInContext(context_), "");
     } else if (LLVMGetTypeKind(LLVMTypeOf(value)) == LLVMIntegerTypeKind) {
         return value;
     } else {
@@ -1232,14 +1277,15 @@ LLVMValueRef LLVMIRBuilder::CanonicalizeToInt(LLVMValueRef value)
 LLVMValueRef LLVMIRBuilder::CanonicalizeToPtr(LLVMValueRef value)
 {
     if (LLVMGetTypeKind(LLVMTypeOf(value)) == LLVMVectorTypeKind) {
-        LLVMValueRef tmp = LLVMBuildExtractElement(builder_, value, LLVMConstInt(LLVMInt32Type(), 0, 1), "");
-        return LLVMBuildPointerCast(builder_, tmp, LLVMPointerType(LLVMInt8Type(), 1), "");
+        LLVMValueRef tmp =
+            LLVMBuildExtractElement(builder_, value, LLVMConstInt(LLVMInt32TypeInContext(context_), 0, 1), "");
+        return LLVMBuildPointerCast(builder_, tmp, LLVMPointerType(LLVMInt8TypeInContext(context_), 1), "");
     } else if (LLVMGetTypeKind(LLVMTypeOf(value)) == LLVMPointerTypeKind) {
         return LLVMBuildPointerCast(builder_, value,
-            LLVMPointerType(LLVMInt8Type(), LLVMGetPointerAddressSpace(LLVMTypeOf(value))), "");
+            LLVMPointerType(LLVMInt8TypeInContext(context_), LLVMGetPointerAddressSpace(LLVMTypeOf(value))), "");
     } else if (LLVMGetTypeKind(LLVMTypeOf(value)) == LLVMIntegerTypeKind) {
-        LLVMValueRef tmp = LLVMBuildIntToPtr(builder_, value, LLVMPointerType(LLVMInt64Type(), 0), "");
-        return LLVMBuildPointerCast(builder_, tmp, LLVMPointerType(LLVMInt8Type(), 0), "");
+        LLVMValueRef tmp = LLVMBuildIntToPtr(builder_, value, LLVMPointerType(LLVMInt64TypeInContext(context_), 0), "");
+        return LLVMBuildPointerCast(builder_, tmp, LLVMPointerType(LLVMInt8TypeInContext(context_), 0), "");
     } else {
         LOG_COMPILER(ERROR) << "can't Canonicalize to Ptr: ";
         UNREACHABLE();
@@ -1278,7 +1324,8 @@ LLVMValueRef LLVMIRBuilder::VectorAdd(LLVMValueRef baseAddr, LLVMValueRef offset
 {
     LLVMValueRef ptr = CanonicalizeToPtr(baseAddr);
     LLVMValueRef dstRef8 = LLVMBuildGEP(builder_, ptr, &offset, 1, "");
-    LLVMValueRef result = LLVMBuildInsertElement(builder_, baseAddr, dstRef8, LLVMConstInt(LLVMInt32Type(), 0, 0), "");
+    LLVMValueRef result = LLVMBuildInsertElement(
+        builder_, baseAddr, dstRef8, LLVMConstInt(LLVMInt32TypeInContext(context_), 0, 0), "");
     return result;
 }
 
@@ -1294,33 +1341,33 @@ LLVMTypeRef LLVMIRBuilder::ConvertLLVMTypeFromGate(GateRef gate) const
 {
     if (IsGCRelated(circuit_->GetGateType(gate))) {
         if (compCfg_->Is32Bit()) {
-            return LLVMVectorType(LLVMPointerType(LLVMInt8Type(), 1), 2);
+            return LLVMVectorType(LLVMPointerType(LLVMInt8TypeInContext(context_), 1), 2);
         } else {
-            return LLVMPointerType(LLVMInt64Type(), 1);
+            return LLVMPointerType(LLVMInt64TypeInContext(context_), 1);
         }
     }
     switch (circuit_->LoadGatePtrConst(gate)->GetMachineType()) {
         case MachineType::NOVALUE:
-            return LLVMVoidType();
+            return LLVMVoidTypeInContext(context_);
         case MachineType::I1:
-            return LLVMInt1Type();
+            return LLVMInt1TypeInContext(context_);
         case MachineType::I8:
-            return LLVMInt8Type();
+            return LLVMInt8TypeInContext(context_);
         case MachineType::I16:
-            return LLVMInt16Type();
+            return LLVMInt16TypeInContext(context_);
         case MachineType::I32:
-            return LLVMInt32Type();
+            return LLVMInt32TypeInContext(context_);
         case MachineType::I64:
-            return LLVMInt64Type();
+            return LLVMInt64TypeInContext(context_);
         case MachineType::F32:
-            return LLVMFloatType();
+            return LLVMFloatTypeInContext(context_);
         case MachineType::F64:
-            return LLVMDoubleType();
+            return LLVMDoubleTypeInContext(context_);
         case MachineType::ARCH: {
             if (compCfg_->Is32Bit()) {
-                return LLVMInt32Type();
+                return LLVMInt32TypeInContext(context_);
             } else {
-                return LLVMInt64Type();
+                return LLVMInt64TypeInContext(context_);
             }
         }
         default:
@@ -1787,21 +1834,21 @@ void LLVMIRBuilder::VisitCastIntXToIntY(GateRef gate, GateRef e1)
 void LLVMIRBuilder::VisitChangeInt32ToDouble(GateRef gate, GateRef e1)
 {
     LLVMValueRef e1Value = gate2LValue_[e1];
-    LLVMValueRef result = LLVMBuildSIToFP(builder_, e1Value, LLVMDoubleType(), "");
+    LLVMValueRef result = LLVMBuildSIToFP(builder_, e1Value, LLVMDoubleTypeInContext(context_), "");
     gate2LValue_[gate] = result;
 }
 
 void LLVMIRBuilder::VisitChangeUInt32ToDouble(GateRef gate, GateRef e1)
 {
     LLVMValueRef e1Value = gate2LValue_[e1];
-    LLVMValueRef result = LLVMBuildUIToFP(builder_, e1Value, LLVMDoubleType(), "");
+    LLVMValueRef result = LLVMBuildUIToFP(builder_, e1Value, LLVMDoubleTypeInContext(context_), "");
     gate2LValue_[gate] = result;
 }
 
 void LLVMIRBuilder::VisitChangeDoubleToInt32(GateRef gate, GateRef e1)
 {
     LLVMValueRef e1Value = gate2LValue_[e1];
-    LLVMValueRef result = LLVMBuildFPToSI(builder_, e1Value, LLVMInt32Type(), "");
+    LLVMValueRef result = LLVMBuildFPToSI(builder_, e1Value, LLVMInt32TypeInContext(context_), "");
     gate2LValue_[gate] = result;
 }
 
@@ -1819,16 +1866,19 @@ void LLVMIRBuilder::VisitChangeInt64ToTagged(GateRef gate, GateRef e1)
     LLVMValueRef result;
     if (compCfg_->Is32Bit()) {
         LLVMValueRef tmp1Value =
-            LLVMBuildLShr(builder_, e1Value, LLVMConstInt(LLVMInt64Type(), 32, 0), ""); // 32: offset
-        LLVMValueRef tmp2Value = LLVMBuildIntCast(builder_, e1Value, LLVMInt32Type(), ""); // low
-        LLVMTypeRef vectorType = LLVMVectorType(LLVMPointerType(LLVMInt8Type(), 1), 2);  // 2: packed vector type
+            LLVMBuildLShr(builder_, e1Value, LLVMConstInt(LLVMInt64TypeInContext(context_), 32, 0), ""); // 32: offset
+        LLVMValueRef tmp2Value = LLVMBuildIntCast(builder_, e1Value, LLVMInt32TypeInContext(context_), ""); // low
+        // 2: packed vector type
+        LLVMTypeRef vectorType = LLVMVectorType(LLVMPointerType(LLVMInt8TypeInContext(context_), 1), 2);
         LLVMValueRef emptyValue = LLVMGetUndef(vectorType);
-        tmp1Value = LLVMBuildIntToPtr(builder_, tmp1Value, LLVMPointerType(LLVMInt8Type(), 1), "");
-        tmp2Value = LLVMBuildIntToPtr(builder_, tmp2Value, LLVMPointerType(LLVMInt8Type(), 1), "");
-        result = LLVMBuildInsertElement(builder_, emptyValue, tmp2Value, LLVMConstInt(LLVMInt32Type(), 0, 0), "");
-        result = LLVMBuildInsertElement(builder_, result, tmp1Value, LLVMConstInt(LLVMInt32Type(), 1, 0), "");
+        tmp1Value = LLVMBuildIntToPtr(builder_, tmp1Value, LLVMPointerType(LLVMInt8TypeInContext(context_), 1), "");
+        tmp2Value = LLVMBuildIntToPtr(builder_, tmp2Value, LLVMPointerType(LLVMInt8TypeInContext(context_), 1), "");
+        result = LLVMBuildInsertElement(
+            builder_, emptyValue, tmp2Value, LLVMConstInt(LLVMInt32TypeInContext(context_), 0, 0), "");
+        result = LLVMBuildInsertElement(
+            builder_, result, tmp1Value, LLVMConstInt(LLVMInt32TypeInContext(context_), 1, 0), "");
     } else {
-        result = LLVMBuildIntToPtr(builder_, e1Value, LLVMPointerType(LLVMInt64Type(), 1), "");
+        result = LLVMBuildIntToPtr(builder_, e1Value, LLVMPointerType(LLVMInt64TypeInContext(context_), 1), "");
     }
     gate2LValue_[gate] = result;
 }
@@ -1853,7 +1903,8 @@ void LLVMIRBuilder::VisitBitCast(GateRef gate, GateRef e1)
 LLVMModule::LLVMModule(const std::string &name, const std::string &triple)
     : cfg_(triple)
 {
-    module_ = LLVMModuleCreateWithName(name.c_str());
+    context_ = LLVMContextCreate();
+    module_ = LLVMModuleCreateWithNameInContext(name.c_str(), context_);
     LLVMSetTarget(module_, triple.c_str());
 }
 
@@ -1863,6 +1914,10 @@ LLVMModule::~LLVMModule()
         LLVMDisposeModule(module_);
         module_ = nullptr;
     }
+    if (context_ != nullptr) {
+        LLVMContextDispose(context_);
+        context_ = nullptr;
+    }
 }
 
 void LLVMModule::InitialLLVMFuncTypeAndFuncByModuleCSigns()
@@ -1924,30 +1979,29 @@ LLVMTypeRef LLVMModule::GetFuncType(const CallSignature *stubDescriptor)
 
 LLVMTypeRef LLVMModule::ConvertLLVMTypeFromVariableType(VariableType type)
 {
-    static std::map<VariableType, LLVMTypeRef> machineTypeMap = {
-        {VariableType::VOID(), LLVMVoidType()},
-        {VariableType::BOOL(), LLVMInt1Type()},
-        {VariableType::INT8(), LLVMInt8Type()},
-        {VariableType::INT16(), LLVMInt16Type()},
-        {VariableType::INT32(), LLVMInt32Type()},
-        {VariableType::INT64(), LLVMInt64Type()},
-        {VariableType::INT8(), LLVMInt8Type()},
-        {VariableType::INT16(), LLVMInt16Type()},
-        {VariableType::INT32(), LLVMInt32Type()},
-        {VariableType::INT64(), LLVMInt64Type()},
-        {VariableType::FLOAT32(), LLVMFloatType()},
-        {VariableType::FLOAT64(), LLVMDoubleType()},
-        {VariableType::NATIVE_POINTER(), LLVMInt64Type()},
-        {VariableType::JS_POINTER(), LLVMPointerType(LLVMInt64Type(), 1)},
-        {VariableType::JS_ANY(), LLVMPointerType(LLVMInt64Type(), 1)},
-    };
-    if (cfg_.Is32Bit()) {
-        machineTypeMap[VariableType::NATIVE_POINTER()] = LLVMInt32Type();
-        LLVMTypeRef vectorType = LLVMVectorType(LLVMPointerType(LLVMInt8Type(), 1), 2);  // 2: packed vector type
-        machineTypeMap[VariableType::JS_POINTER()] = vectorType;
-        machineTypeMap[VariableType::JS_ANY()] = vectorType;
+    if (machineTypeMap_.empty()) {
+        machineTypeMap_ = {
+            {VariableType::VOID(), LLVMVoidTypeInContext(context_)},
+            {VariableType::BOOL(), LLVMInt1TypeInContext(context_)},
+            {VariableType::INT8(), LLVMInt8TypeInContext(context_)},
+            {VariableType::INT16(), LLVMInt16TypeInContext(context_)},
+            {VariableType::INT32(), LLVMInt32TypeInContext(context_)},
+            {VariableType::INT64(), LLVMInt64TypeInContext(context_)},
+            {VariableType::FLOAT32(), LLVMFloatTypeInContext(context_)},
+            {VariableType::FLOAT64(), LLVMDoubleTypeInContext(context_)},
+            {VariableType::NATIVE_POINTER(), LLVMInt64TypeInContext(context_)},
+            {VariableType::JS_POINTER(), LLVMPointerType(LLVMInt64TypeInContext(context_), 1)},
+            {VariableType::JS_ANY(), LLVMPointerType(LLVMInt64TypeInContext(context_), 1)},
+        };
+        if (cfg_.Is32Bit()) {
+            machineTypeMap_[VariableType::NATIVE_POINTER()] = LLVMInt32TypeInContext(context_);
+            // 2: packed vector type
+            LLVMTypeRef vectorType = LLVMVectorType(LLVMPointerType(LLVMInt8TypeInContext(context_), 1), 2);
+            machineTypeMap_[VariableType::JS_POINTER()] = vectorType;
+            machineTypeMap_[VariableType::JS_ANY()] = vectorType;
+        }
     }
-    return machineTypeMap[type];
+    return machineTypeMap_[type];
 }
 
 LLVMValueRef LLVMModule::AddFunc(const panda::ecmascript::JSMethod *method)
@@ -120,6 +120,11 @@ public:
     {
         return module_;
     }
+
+    LLVMContextRef GetContext() const
+    {
+        return context_;
+    }
     LLVMTypeRef GetFuncType(const CallSignature *stubDescriptor);
 
     void SetFunction(size_t index, LLVMValueRef func)
@@ -175,8 +180,11 @@ private:
     //     aot scenario - method Id of function generated by panda files
     std::vector<std::pair<size_t, LLVMValueRef>> funcIndexMap_;
     std::vector<const CallSignature *> callSigns_;
-    LLVMModuleRef module_;
+    // Each module has a context of its own, so modules can be generated and compiled on different threads.
+    LLVMContextRef context_ {nullptr};
+    LLVMModuleRef module_ {nullptr};
     CompilationConfig cfg_;
+    std::map<VariableType, LLVMTypeRef> machineTypeMap_ {};
 };
 
 
@@ -187,6 +195,7 @@ private:
     V(NoGcRuntimeCall, (GateRef gate, const std::vector<GateRef> &inList))                \
     V(BytecodeCall, (GateRef gate, const std::vector<GateRef> &inList))                   \
     V(DebuggerBytecodeCall, (GateRef gate, const std::vector<GateRef> &inList))           \
+    V(Deopt, (GateRef gate, const std::vector<GateRef> &inList))                          \
     V(Alloca, (GateRef gate))                                                             \
     V(Block, (int id, const OperandsVector &predecessors))                                \
     V(Goto, (int block, int bbout))                                                       \
@@ -272,9 +281,9 @@ private:
     LLVMTypeRef GetIntPtr() const
     {
         if (compCfg_->Is32Bit()) {
-            return LLVMInt32Type();
+            return LLVMInt32TypeInContext(context_);
         }
-        return LLVMInt64Type();
+        return LLVMInt64TypeInContext(context_);
     }
     LLVMTypeRef ConvertLLVMTypeFromGate(GateRef gate) const;
     int64_t GetBitWidthFromMachineType(MachineType machineType) const;
@@ -314,7 +323,7 @@ private:
     int lineNumber_ {0};
 
     LLVMModuleRef module_ {nullptr};
-    LLVMContextRef context_;
+    LLVMContextRef context_ {nullptr};
     LLVMValueRef function_ {nullptr};
     LLVMBuilderRef builder_ {nullptr};
     std::map<GateId, int> instID2bbID_;
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/compiler/loop_invariant_code_motion.h"
+
+#include <deque>
+
+namespace panda::ecmascript::kungfu {
+void LoopInvariantCodeMotion::Run()
+{
+    std::vector<GateRef> gateList = circuit_->GetAllGates();
+    for (const auto &gate : gateList) {
+        if (acc_.GetOpCode(gate) == OpCode::DEPEND_SELECTOR &&
+            acc_.GetOpCode(acc_.GetState(gate)) == OpCode::LOOP_BEGIN) {
+            VisitLoop(gate);
+        }
+    }
+    if (IsLogEnabled()) {
+        LOG_COMPILER(INFO) << "LoopInvariantCodeMotion hoisted " << hoistedLoads_ << " loads";
+    }
+}
+
+void LoopInvariantCodeMotion::VisitLoop(GateRef dependSelector)
+{
+    LoopInfo loop;
+    if (!CollectDepends(dependSelector, &loop)) {
+        return;
+    }
+    CollectStates(acc_.GetState(dependSelector), &loop);
+    GateRef prev = dependSelector;
+    GateRef load = GetNextLoad(prev);
+    while (load != Circuit::NullGate()) {
+        if (IsInvariant(acc_.GetValueIn(load, 0), &loop)) {
+            HoistLoad(load, dependSelector);
+            // a load of the address loaded here may be invariant now
+            loop.depends.erase(load);
+            loop.invariants.clear();
+        } else {
+            prev = load;
+        }
+        load = GetNextLoad(prev);
+    }
+}
+
+void LoopInvariantCodeMotion::CollectStates(GateRef loopBegin, LoopInfo *loop) const
+{
+    std::deque<GateRef> pendingList {acc_.GetState(loopBegin, 1)};  // 1: the loop back
+    loop->states.insert(loopBegin);
+    while (!pendingList.empty()) {
+        GateRef state = pendingList.front();
+        pendingList.pop_front();
+        if (!loop->states.insert(state).second) {
+            continue;
+        }
+        for (size_t i = 0; i < acc_.GetStateCount(state); i++) {
+            pendingList.push_back(acc_.GetState(state, i));
+        }
+    }
+}
+
+bool LoopInvariantCodeMotion::CollectDepends(GateRef dependSelector, LoopInfo *loop) const
+{
+    // the depend chain from the loop back to the head of the loop has every memory access of the loop
+    std::deque<GateRef> pendingList {acc_.GetDep(dependSelector, 1)};  // 1: the depend of the loop back
+    loop->depends.insert(dependSelector);
+    while (!pendingList.empty()) {
+        GateRef gate = pendingList.front();
+        pendingList.pop_front();
+        if (!loop->depends.insert(gate).second) {
+            continue;
+        }
+        switch (acc_.GetOpCode(gate)) {
+            case OpCode::LOAD:
+            case OpCode::DEPEND_RELAY:
+            case OpCode::DEPEND_SELECTOR:
+            case OpCode::DEPEND_AND:
+                break;
+            default:
+                return false;
+        }
+        for (size_t i = 0; i < acc_.GetDependCount(gate); i++) {
+            pendingList.push_back(acc_.GetDep(gate, i));
+        }
+    }
+    return true;
+}
+
+bool LoopInvariantCodeMotion::IsInvariant(GateRef gate, LoopInfo *loop) const
+{
+    auto iter = loop->invariants.find(gate);
+    if (iter != loop->invariants.end()) {
+        return iter->second;
+    }
+    OpCode op = acc_.GetOpCode(gate);
+    bool result = true;
+    if (op == OpCode::VALUE_SELECTOR) {
+        result = loop->states.count(acc_.GetState(gate)) == 0;
+    } else if (op.IsPure()) {
+        for (size_t i = 0; i < acc_.GetNumValueIn(gate) && result; i++) {
+            result = IsInvariant(acc_.GetValueIn(gate, i), loop);
+        }
+    } else if (op.IsSchedulable() && acc_.GetDependCount(gate) > 0) {
+        result = loop->depends.count(gate) == 0;
+    } else {
+        // constants and arguments
+        result = op.GetProperties().root.has_value();
+    }
+    loop->invariants[gate] = result;
+    return result;
+}
+
+GateRef LoopInvariantCodeMotion::GetNextLoad(GateRef gate)
+{
+    GateRef next = Circuit::NullGate();
+    size_t dependUses = 0;
+    auto uses = acc_.Uses(gate);
+    for (auto useIt = uses.begin(); useIt != uses.end(); useIt++) {
+        if (acc_.IsDependIn(useIt)) {
+            next = *useIt;
+            dependUses++;
+        }
+    }
+    if (dependUses != 1 || acc_.GetOpCode(next) != OpCode::LOAD) {
+        return Circuit::NullGate();
+    }
+    return next;
+}
+
+void LoopInvariantCodeMotion::HoistLoad(GateRef load, GateRef dependSelector)
+{
+    GateRef dep = acc_.GetDep(load);
+    auto uses = acc_.Uses(load);
+    for (auto useIt = uses.begin(); useIt != uses.end(); useIt++) {
+        if (acc_.IsDependIn(useIt)) {
+            acc_.ReplaceIn(useIt, dep);
+        }
+    }
+    // the load goes last on the entry depend, after the loads hoisted before it
+    acc_.SetDep(load, acc_.GetDep(dependSelector, 0));
+    acc_.SetDep(dependSelector, load, 0);
+    hoistedLoads_++;
+}
+}  // namespace panda::ecmascript::kungfu
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_COMPILER_LOOP_INVARIANT_CODE_MOTION_H
+#define ECMASCRIPT_COMPILER_LOOP_INVARIANT_CODE_MOTION_H
+
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ecmascript/compiler/circuit.h"
+#include "ecmascript/compiler/gate_accessor.h"
+
+namespace panda::ecmascript::kungfu {
+// LoopInvariantCodeMotion moves the loads of a loop out of it when nothing in the loop writes memory or calls, and
+// their addresses do not change in the loop. Only the loads at the head of the loop body, before its first branch,
+// are moved: they run on every iteration, so loading them once on the entry edge of the loop reads nothing the
+// loop would not. They go on the entry depend of the loop, and the scheduler places them before the loop.
+// The pure gates of the loop are moved by the scheduler.
+class LoopInvariantCodeMotion {
+public:
+    LoopInvariantCodeMotion(Circuit *circuit, bool enableLog)
+        : circuit_(circuit), acc_(circuit), enableLog_(enableLog) {}
+    ~LoopInvariantCodeMotion() = default;
+    NO_COPY_SEMANTIC(LoopInvariantCodeMotion);
+    NO_MOVE_SEMANTIC(LoopInvariantCodeMotion);
+
+    void Run();
+
+private:
+    struct LoopInfo {
+        std::unordered_set<GateRef> states;
+        std::unordered_set<GateRef> depends;
+        std::unordered_map<GateRef, bool> invariants;
+    };
+
+    bool IsLogEnabled() const
+    {
+        return enableLog_;
+    }
+
+    void VisitLoop(GateRef dependSelector);
+    void CollectStates(GateRef loopBegin, LoopInfo *loop) const;
+    bool CollectDepends(GateRef dependSelector, LoopInfo *loop) const;
+    bool IsInvariant(GateRef gate, LoopInfo *loop) const;
+    GateRef GetNextLoad(GateRef gate);
+    void HoistLoad(GateRef load, GateRef dependSelector);
+
+    Circuit *circuit_;
+    GateAccessor acc_;
+    bool enableLog_ {false};
+    size_t hoistedLoads_ {0};
+};
+}  // panda::ecmascript::kungfu
+#endif  // ECMASCRIPT_COMPILER_LOOP_INVARIANT_CODE_MOTION_H
@@ -18,12 +18,17 @@
 
 #include "ecmascript/compiler/async_function_lowering.h"
 #include "ecmascript/compiler/bytecode_circuit_builder.h"
+#include "ecmascript/compiler/call_inlining.h"
 #include "ecmascript/compiler/common_stubs.h"
+#include "ecmascript/compiler/dead_code_elimination.h"
+#include "ecmascript/compiler/escape_analysis.h"
 #include "ecmascript/compiler/llvm_codegen.h"
+#include "ecmascript/compiler/loop_invariant_code_motion.h"
 #include "ecmascript/compiler/scheduler.h"
 #include "ecmascript/compiler/slowpath_lowering.h"
 #include "ecmascript/compiler/type_inference/type_infer.h"
 #include "ecmascript/compiler/type_lowering.h"
+#include "ecmascript/compiler/value_numbering.h"
 #include "ecmascript/compiler/verifier.h"
 
 namespace panda::ecmascript::kungfu {
@@ -82,14 +87,39 @@ public:
 class TypeLoweringPass {
 public:
     bool Run(PassData *data, bool enableLog, BytecodeCircuitBuilder *builder, CompilationConfig *cmpCfg,
-             TSLoader *tsLoader)
+             TSLoader *tsLoader, const PGOMethodProfile *methodProfile = nullptr, bool enableSpeculation = false)
     {
-        TypeLowering lowering(builder, data->GetCircuit(), cmpCfg, tsLoader, enableLog);
+        TypeLowering lowering(builder, data->GetCircuit(), cmpCfg, tsLoader, enableLog, methodProfile,
+                              enableSpeculation);
         lowering.RunTypeLowering();
         return true;
     }
 };
 
+class CallInliningPass {
+public:
+    bool Run(PassData *data, bool enableLog, BytecodeCircuitBuilder *builder, CompilationConfig *cmpCfg,
+             TSLoader *tsLoader, const BytecodeTranslationInfo *translationInfo,
+             const CallInlining::MethodIndexMap *methodIndexes, bool isHotMethod)
+    {
+        CallInlining inlining(builder, data->GetCircuit(), cmpCfg, tsLoader, translationInfo, methodIndexes,
+                              isHotMethod, enableLog);
+        inlining.RunCallInlining();
+        return true;
+    }
+};
+
+class EscapeAnalysisPass {
+public:
+    bool Run(PassData *data, bool enableLog, BytecodeCircuitBuilder *builder, CompilationConfig *cmpCfg,
+             TSLoader *tsLoader)
+    {
+        EscapeAnalysis escapeAnalysis(builder, data->GetCircuit(), cmpCfg, tsLoader, enableLog);
+        escapeAnalysis.Run();
+        return true;
+    }
+};
+
 class SlowPathLoweringPass {
 public:
     bool Run(PassData* data, bool enableLog, BytecodeCircuitBuilder *builder, CompilationConfig *cmpCfg)
@@ -100,6 +130,36 @@ public:
     }
 };
 
+class ValueNumberingPass {
+public:
+    bool Run(PassData* data, bool enableLog)
+    {
+        ValueNumbering valueNumbering(data->GetCircuit(), enableLog);
+        valueNumbering.Run();
+        return true;
+    }
+};
+
+class LoopInvariantCodeMotionPass {
+public:
+    bool Run(PassData* data, bool enableLog)
+    {
+        LoopInvariantCodeMotion codeMotion(data->GetCircuit(), enableLog);
+        codeMotion.Run();
+        return true;
+    }
+};
+
+class DeadCodeEliminationPass {
+public:
+    bool Run(PassData* data, bool enableLog)
+    {
+        DeadCodeElimination elimination(data->GetCircuit(), enableLog);
+        elimination.Run();
+        return true;
+    }
+};
+
 class VerifierPass {
 public:
     bool Run(PassData* data, bool enableLog)
@@ -111,9 +171,9 @@ public:
 
 class SchedulingPass {
 public:
-    bool Run(PassData* data, bool enableLog)
+    bool Run(PassData* data, bool enableLog, bool enableGlobalCodeMotion = false)
     {
-        data->SetScheduleResult(Scheduler::Run(data->GetCircuit(), enableLog));
+        data->SetScheduleResult(Scheduler::Run(data->GetCircuit(), enableLog, enableGlobalCodeMotion));
         return true;
     }
 };
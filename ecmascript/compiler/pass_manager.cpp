@@ -14,6 +14,8 @@
  */
 #include "ecmascript/compiler/pass_manager.h"
 
+#include <algorithm>
+
 #include "ecmascript/compiler/file_generators.h"
 #include "ecmascript/compiler/pass.h"
 #include "ecmascript/ecma_handle_scope.h"
@@ -21,11 +23,183 @@
 #include "ecmascript/jspandafile/js_pandafile_manager.h"
 #include "ecmascript/jspandafile/panda_file_translator.h"
 #include "ecmascript/snapshot/mem/snapshot.h"
+#include "ecmascript/taskpool/taskpool.h"
 #include "ecmascript/ts_types/ts_loader.h"
 
 namespace panda::ecmascript::kungfu {
+CompileShard::CompileShard(const std::string &name, const std::string &triple, size_t optLevel,
+                           uint32_t compilerOptLevel) : cmpCfg_(triple), compilerOptLevel_(compilerOptLevel)
+{
+    module_ = new LLVMModule(name, triple);
+    assembler_ = new LLVMAssembler(module_->GetModule(), LOptions(optLevel, true));
+}
+
+CompileShard::~CompileShard()
+{
+    // The assembler gives the module back to its owner when destroyed, so it goes first.
+    if (assembler_ != nullptr) {
+        delete assembler_;
+        assembler_ = nullptr;
+    }
+    if (module_ != nullptr) {
+        delete module_;
+        module_ = nullptr;
+    }
+}
+
+void CompileShard::AddMethod(std::unique_ptr<BytecodeCircuitBuilder> builder, const JSMethod *method,
+                             bool enableLog)
+{
+    methods_.emplace_back(ShardMethod {std::move(builder), method, enableLog});
+}
+
+void CompileShard::Compile()
+{
+    for (auto &shardMethod : methods_) {
+        BytecodeCircuitBuilder *builder = shardMethod.builder.get();
+        PassData data(builder->GetCircuit());
+        PassRunner<PassData> pipeline(&data, shardMethod.enableLog);
+        pipeline.RunPass<SlowPathLoweringPass>(builder, &cmpCfg_);
+        bool enableCodeMotion = compilerOptLevel_ >= CODE_MOTION_OPT_LEVEL;
+        if (compilerOptLevel_ >= BASIC_OPT_LEVEL) {
+            pipeline.RunPass<ValueNumberingPass>();
+            if (enableCodeMotion) {
+                pipeline.RunPass<LoopInvariantCodeMotionPass>();
+            }
+            pipeline.RunPass<DeadCodeEliminationPass>();
+        }
+        pipeline.RunPass<VerifierPass>();
+        pipeline.RunPass<SchedulingPass>(enableCodeMotion);
+        pipeline.RunPass<LLVMIRGenPass>(module_, shardMethod.method);
+        // the circuit is not needed after the ir is generated
+        shardMethod.builder.reset();
+    }
+    assembler_->Run();
+}
+
+void CompileShard::AddToGenerator(AOTFileGenerator &generator, const JSPandaFile *jsPandaFile)
+{
+    generator.AddModule(module_, assembler_, jsPandaFile);
+    module_ = nullptr;
+    assembler_ = nullptr;
+}
+
+CompileShardRunner::CompileShardRunner(uint32_t threadNum) : threadNum_(std::max(threadNum, 1U)) {}
+
+void CompileShardRunner::Post(std::unique_ptr<CompileShard> shard)
+{
+    os::memory::LockHolder holder(mutex_);
+    // 2: keep one shard ready for each thread while the main thread builds the next ones
+    while (unfinishedShards_ >= 2 * threadNum_) {
+        shardFinishedCV_.Wait(&mutex_);
+    }
+    pending_.emplace_back(shard.get());
+    shards_.emplace_back(std::move(shard));
+    unfinishedShards_++;
+    if (runningTasks_ < threadNum_) {
+        runningTasks_++;
+        Taskpool::GetCurrentTaskpool()->PostTask(std::make_unique<CompileTask>(this));
+    }
+}
+
+void CompileShardRunner::WaitAllFinished()
+{
+    os::memory::LockHolder holder(mutex_);
+    while (unfinishedShards_ != 0 || runningTasks_ != 0) {
+        shardFinishedCV_.Wait(&mutex_);
+    }
+}
+
+CompileShard *CompileShardRunner::PopShard()
+{
+    os::memory::LockHolder holder(mutex_);
+    if (pending_.empty()) {
+        runningTasks_--;
+        shardFinishedCV_.SignalAll();
+        return nullptr;
+    }
+    CompileShard *shard = pending_.front();
+    pending_.pop_front();
+    return shard;
+}
+
+void CompileShardRunner::FinishShard()
+{
+    os::memory::LockHolder holder(mutex_);
+    unfinishedShards_--;
+    shardFinishedCV_.SignalAll();
+}
+
+bool CompileShardRunner::CompileTask::Run([[maybe_unused]] uint32_t threadIndex)
+{
+    for (CompileShard *shard = runner_->PopShard(); shard != nullptr; shard = runner_->PopShard()) {
+        shard->Compile();
+        runner_->FinishShard();
+    }
+    return true;
+}
+
+uint32_t PassManager::GetCompilerThreads() const
+{
+    uint32_t taskpoolThreads = Taskpool::GetCurrentTaskpool()->GetTotalThreadNum();
+    if (compilerThreads_ == 0 || compilerThreads_ > taskpoolThreads) {
+        return taskpoolThreads;
+    }
+    return compilerThreads_;
+}
+
+bool PassManager::LoadProfile()
+{
+    std::string profileName = vm_->GetJSOptions().GetPGOProfile();
+    if (profileName.empty() || profile_ != nullptr) {
+        return true;
+    }
+    auto profile = std::make_unique<PGOProfile>();
+    if (!profile->Load(profileName)) {
+        return false;
+    }
+    LOG_COMPILER(INFO) << "Loaded the pgo profile of " << profile->GetMethodCount() << " methods from " << profileName;
+    profile_ = std::move(profile);
+    return true;
+}
+
+std::vector<size_t> PassManager::SelectMethods(const BytecodeTranslationInfo &translationInfo) const
+{
+    size_t methodCount = translationInfo.methodPcInfos.size();
+    std::vector<size_t> methodIndexes;
+    methodIndexes.reserve(methodCount);
+    if (profile_ == nullptr) {
+        for (size_t i = 0; i < methodCount; i++) {
+            methodIndexes.emplace_back(i);
+        }
+        return methodIndexes;
+    }
+
+    const JSPandaFile *jsPandaFile = translationInfo.jsPandaFile;
+    uint32_t fileHash = jsPandaFile->GetFileUniqId();
+    uint32_t mainMethodId = jsPandaFile->GetMainMethodIndex();
+    uint32_t threshold = vm_->GetJSOptions().GetPGOHotnessThreshold();
+    std::vector<uint32_t> hotness(methodCount, 0);
+    for (size_t i = 0; i < methodCount; i++) {
+        uint32_t methodId = translationInfo.methodPcInfos[i].method->GetMethodId().GetOffset();
+        hotness[i] = profile_->GetHotness(fileHash, methodId);
+        // the loader always enters the main method through its aot code
+        if (hotness[i] >= threshold || methodId == mainMethodId) {
+            methodIndexes.emplace_back(i);
+        }
+    }
+    // the hot methods are compiled first and laid out together, the order of the file breaks the ties
+    std::stable_sort(methodIndexes.begin(), methodIndexes.end(),
+        [&hotness](size_t a, size_t b) { return hotness[a] > hotness[b]; });
+    LOG_COMPILER(INFO) << "pgo selects " << methodIndexes.size() << " of " << methodCount << " methods";
+    return methodIndexes;
+}
+
 bool PassManager::Compile(const std::string &fileName, AOTFileGenerator &generator)
 {
+    if (!LoadProfile()) {
+        return false;
+    }
     BytecodeTranslationInfo translationInfo;
     [[maybe_unused]] EcmaHandleScope handleScope(vm_->GetJSThread());
     bool res = CollectInfoOfPandaFile(fileName, entry_, &translationInfo);
@@ -33,39 +207,65 @@ bool PassManager::Compile(const std::string &fileName, AOTFileGenerator &generat
         LOG_COMPILER(ERROR) << "Cannot execute panda file '" << fileName << "'";
         return false;
     }
-    auto aotModule = new LLVMModule("aot_" + fileName, triple_);
-    auto aotModuleAssembler = new LLVMAssembler(aotModule->GetModule(), LOptions(optLevel_, true));
     CompilationConfig cmpCfg(triple_);
     TSLoader *tsLoader = vm_->GetTSLoader();
 
     bool enableLog = log_->IsAlwaysEnabled();
-
+    bool enableSpeculation = vm_->GetJSOptions().EnableAotSpeculation();
+    bool enableInlining = vm_->GetJSOptions().EnableAotInlining();
+    uint32_t compilerOptLevel = vm_->GetJSOptions().GetCompilerOptLevel();
+    uint32_t hotnessThreshold = vm_->GetJSOptions().GetPGOHotnessThreshold();
+    CallInlining::MethodIndexMap methodIndexMap;
     for (size_t i = 0; i < translationInfo.methodPcInfos.size(); i++) {
-        const JSMethod *method = translationInfo.methodPcInfos[i].method;
-        const std::string methodName(method->GetMethodName());
-        if (!log_->IsAlwaysEnabled() && !log_->IsAlwaysDisabled()) {  // neither "all" nor "none"
-            enableLog = log_->IncludesMethod(fileName, methodName);
-        }
+        methodIndexMap.emplace(translationInfo.methodPcInfos[i].method, i);
+    }
+    CompileShardRunner runner(GetCompilerThreads());
+    std::vector<size_t> methodIndexes = SelectMethods(translationInfo);
+    uint32_t fileHash = translationInfo.jsPandaFile->GetFileUniqId();
+    size_t methodCount = methodIndexes.size();
+    for (size_t begin = 0; begin < methodCount; begin += CompileShard::METHODS_PER_SHARD) {
+        size_t end = std::min(begin + CompileShard::METHODS_PER_SHARD, methodCount);
+        std::string shardName = "aot_" + fileName + "_" + std::to_string(begin / CompileShard::METHODS_PER_SHARD);
+        auto shard = std::make_unique<CompileShard>(shardName, triple_, optLevel_, compilerOptLevel);
+        for (size_t k = begin; k < end; k++) {
+            size_t i = methodIndexes[k];
+            const JSMethod *method = translationInfo.methodPcInfos[i].method;
+            const std::string methodName(method->GetMethodName());
+            if (!log_->IsAlwaysEnabled() && !log_->IsAlwaysDisabled()) {  // neither "all" nor "none"
+                enableLog = log_->IncludesMethod(fileName, methodName);
+            }
 
-        if (enableLog) {
-            LOG_COMPILER(INFO) << "\033[34m" << "aot method [" << fileName << ":"
-                               << methodName << "] log:" << "\033[0m";
-        }
+            if (enableLog) {
+                LOG_COMPILER(INFO) << "\033[34m" << "aot method [" << fileName << ":"
+                                   << methodName << "] log:" << "\033[0m";
+            }
 
-        BytecodeCircuitBuilder builder(translationInfo, i, tsLoader, enableLog);
-        builder.BytecodeToCircuit();
-        PassData data(builder.GetCircuit());
-        PassRunner<PassData> pipeline(&data, enableLog);
-        pipeline.RunPass<AsyncFunctionLoweringPass>(&builder, &cmpCfg);
-        pipeline.RunPass<TypeInferPass>(&builder, tsLoader);
-        pipeline.RunPass<TypeLoweringPass>(&builder, &cmpCfg, tsLoader);
-        pipeline.RunPass<SlowPathLoweringPass>(&builder, &cmpCfg);
-        pipeline.RunPass<VerifierPass>();
-        pipeline.RunPass<SchedulingPass>();
-        pipeline.RunPass<LLVMIRGenPass>(aotModule, method);
+            auto builder = std::make_unique<BytecodeCircuitBuilder>(translationInfo, i, tsLoader, enableLog);
+            builder->BytecodeToCircuit();
+            PassData data(builder->GetCircuit());
+            PassRunner<PassData> pipeline(&data, enableLog);
+            pipeline.RunPass<AsyncFunctionLoweringPass>(builder.get(), &cmpCfg);
+            pipeline.RunPass<TypeInferPass>(builder.get(), tsLoader);
+            const PGOMethodProfile *methodProfile = profile_ == nullptr ? nullptr :
+                profile_->FindMethod(fileHash, method->GetMethodId().GetOffset());
+            pipeline.RunPass<TypeLoweringPass>(builder.get(), &cmpCfg, tsLoader, methodProfile, enableSpeculation);
+            if (enableInlining) {
+                bool isHotMethod = methodProfile != nullptr && methodProfile->hotness >= hotnessThreshold;
+                pipeline.RunPass<CallInliningPass>(builder.get(), &cmpCfg, tsLoader, &translationInfo,
+                                                   &methodIndexMap, isHotMethod);
+            }
+            if (compilerOptLevel >= CompileShard::BASIC_OPT_LEVEL) {
+                pipeline.RunPass<EscapeAnalysisPass>(builder.get(), &cmpCfg, tsLoader);
+            }
+            shard->AddMethod(std::move(builder), method, enableLog);
+        }
+        runner.Post(std::move(shard));
     }
+    runner.WaitAllFinished();
 
-    generator.AddModule(aotModule, aotModuleAssembler, translationInfo.jsPandaFile);
+    runner.IterateShards([&generator, &translationInfo](CompileShard *shard) {
+        shard->AddToGenerator(generator, translationInfo.jsPandaFile);
+    });
     return true;
 }
 
@@ -16,17 +16,105 @@
 #ifndef ECMASCRIPT_COMPILER_PASS_MANAGER_H
 #define ECMASCRIPT_COMPILER_PASS_MANAGER_H
 
+#include <deque>
+
 #include "ecmascript/compiler/bytecode_circuit_builder.h"
 #include "ecmascript/compiler/compiler_log.h"
 #include "ecmascript/compiler/file_generators.h"
 #include "ecmascript/ecma_vm.h"
+#include "ecmascript/pgo/pgo_profile.h"
+#include "ecmascript/taskpool/task.h"
+#include "os/mutex.h"
 
 namespace panda::ecmascript::kungfu {
+// A shard is a fixed range of methods of a panda file compiled into one llvm module. Its circuits are built on the
+// main thread, since they resolve strings and types through the vm; the lowering, the scheduling and the code
+// generation run on a taskpool thread. The ranges do not depend on the number of threads, and the modules are
+// added to the file in the order of the ranges, so the output is the same for any number of threads.
+class CompileShard {
+public:
+    CompileShard(const std::string &name, const std::string &triple, size_t optLevel, uint32_t compilerOptLevel);
+    ~CompileShard();
+    NO_COPY_SEMANTIC(CompileShard);
+    NO_MOVE_SEMANTIC(CompileShard);
+
+    void AddMethod(std::unique_ptr<BytecodeCircuitBuilder> builder, const JSMethod *method, bool enableLog);
+    void Compile();
+    // Transfer the module and its assembler to the generator.
+    void AddToGenerator(AOTFileGenerator &generator, const JSPandaFile *jsPandaFile);
+
+    static constexpr size_t METHODS_PER_SHARD = 256;
+    // the "compiler-opt-level" running escape analysis, value numbering and dead code elimination, and the one
+    // moving loop invariant code too
+    static constexpr uint32_t BASIC_OPT_LEVEL = 1;
+    static constexpr uint32_t CODE_MOTION_OPT_LEVEL = 2;
+
+private:
+    struct ShardMethod {
+        std::unique_ptr<BytecodeCircuitBuilder> builder;
+        const JSMethod *method;
+        bool enableLog;
+    };
+
+    std::vector<ShardMethod> methods_ {};
+    CompilationConfig cmpCfg_;
+    uint32_t compilerOptLevel_ {0};
+    LLVMModule *module_ {nullptr};
+    LLVMAssembler *assembler_ {nullptr};
+};
+
+// CompileShardRunner compiles the posted shards on at most threadNum taskpool threads.
+class CompileShardRunner {
+public:
+    explicit CompileShardRunner(uint32_t threadNum);
+    ~CompileShardRunner() = default;
+    NO_COPY_SEMANTIC(CompileShardRunner);
+    NO_MOVE_SEMANTIC(CompileShardRunner);
+
+    // The circuits of the pending shards take memory, so this blocks while too many shards are pending.
+    void Post(std::unique_ptr<CompileShard> shard);
+    void WaitAllFinished();
+
+    // Iterate over the shards in the order they were posted, after all of them have finished.
+    template<class Callback>
+    void IterateShards(const Callback &cb) const
+    {
+        for (auto &shard : shards_) {
+            cb(shard.get());
+        }
+    }
+
+private:
+    class CompileTask : public Task {
+    public:
+        explicit CompileTask(CompileShardRunner *runner) : runner_(runner) {}
+        ~CompileTask() override = default;
+        bool Run(uint32_t threadIndex) override;
+
+        NO_COPY_SEMANTIC(CompileTask);
+        NO_MOVE_SEMANTIC(CompileTask);
+
+    private:
+        CompileShardRunner *runner_;
+    };
+
+    CompileShard *PopShard();
+    void FinishShard();
+
+    uint32_t threadNum_ {1};
+    std::vector<std::unique_ptr<CompileShard>> shards_ {};
+    std::deque<CompileShard *> pending_ {};
+    size_t unfinishedShards_ {0};
+    uint32_t runningTasks_ {0};
+    os::memory::Mutex mutex_;
+    os::memory::ConditionVariable shardFinishedCV_;
+};
+
 class PassManager {
 public:
-    PassManager(EcmaVM* vm, std::string entry, std::string &triple,
-        size_t optLevel, AotLog *log) : vm_(vm), entry_(entry),
-                                        triple_(triple), optLevel_(optLevel), log_(log) {};
+    PassManager(EcmaVM* vm, std::string entry, std::string &triple, size_t optLevel, AotLog *log,
+        uint32_t compilerThreads) : vm_(vm), entry_(entry), triple_(triple), optLevel_(optLevel), log_(log),
+                                    compilerThreads_(compilerThreads) {};
     PassManager() = default;
     bool CollectInfoOfPandaFile(const std::string &filename, std::string_view entryPoint,
                                 BytecodeTranslationInfo *translateInfo);
@@ -34,11 +122,18 @@ public:
     void GenerateSnapshotFile();
 
 private:
+    uint32_t GetCompilerThreads() const;
+    bool LoadProfile();
+    // The indexes of the methods to compile, hottest first when there is a profile.
+    std::vector<size_t> SelectMethods(const BytecodeTranslationInfo &translationInfo) const;
+
     EcmaVM* vm_ {nullptr};
     std::string entry_ {};
     std::string triple_ {};
     size_t optLevel_ {3}; // 3 : default backend optimization level
     AotLog *log_ {nullptr};
+    uint32_t compilerThreads_ {0}; // 0 : all the taskpool threads
+    std::unique_ptr<PGOProfile> profile_ {nullptr};
 };
 }
-#endif
\ No newline at end of file
+#endif
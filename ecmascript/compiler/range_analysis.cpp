@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/compiler/range_analysis.h"
+
+#include "ecmascript/mem/c_string.h"
+
+namespace panda::ecmascript::kungfu {
+bool RangeAnalysis::IsKeyInBounds(GateRef gate)
+{
+    GateRef receiver = acc_.GetValueIn(gate, 0);
+    GateRef key = acc_.GetValueIn(gate, 1);
+    if (!IsNonNegative(key)) {
+        return false;
+    }
+    // walk back from the access on its only path, through the branch that compared the key, to the length
+    GateRef comparison = Circuit::NullGate();
+    GateRef state = acc_.GetState(gate);
+    while (true) {
+        OpCode op = acc_.GetOpCode(state);
+        if (op == OpCode::ORDINARY_BLOCK) {
+            state = acc_.GetState(state);
+            continue;
+        }
+        if (op != OpCode::IF_SUCCESS && op != OpCode::IF_TRUE && op != OpCode::IF_FALSE) {
+            return false;
+        }
+        GateRef prev = acc_.GetState(state);
+        if (acc_.GetOpCode(prev) != OpCode::JS_BYTECODE) {
+            return false;
+        }
+        if (op != OpCode::IF_SUCCESS) {
+            if (comparison != Circuit::NullGate()) {
+                return false;
+            }
+            comparison = GetComparison(prev, key, op == OpCode::IF_TRUE);
+            if (comparison == Circuit::NullGate() || !IsLengthOf(acc_.GetValueIn(comparison, 1), receiver)) {
+                return false;
+            }
+        } else if (comparison != Circuit::NullGate() && prev == acc_.GetValueIn(comparison, 1)) {
+            return true;
+        } else if (prev != comparison && !IsNonNegative(prev)) {
+            // only the comparison and the numbers of the key run after the length, none of them calls into js code
+            return false;
+        }
+        state = acc_.GetState(prev);
+    }
+}
+
+bool RangeAnalysis::IsBytecode(GateRef gate, EcmaOpcode opcode) const
+{
+    return acc_.GetOpCode(gate) == OpCode::JS_BYTECODE && bcBuilder_->GetByteCodeOpcode(gate) == opcode;
+}
+
+bool RangeAnalysis::IsNonNegative(GateRef gate)
+{
+    std::unordered_set<GateRef> visited;
+    if (!VisitNonNegative(gate, &visited)) {
+        return false;
+    }
+    // the result of a gate is a conjunction of the ones of its inputs, so all of the visited gates are non-negative
+    nonNegatives_.insert(visited.begin(), visited.end());
+    return true;
+}
+
+bool RangeAnalysis::VisitNonNegative(GateRef gate, std::unordered_set<GateRef> *visited)
+{
+    // a loop phi is assumed non-negative while its inputs are visited, adding non-negative numbers keeps it so
+    if (nonNegatives_.count(gate) > 0 || !visited->insert(gate).second) {
+        return true;
+    }
+    OpCode op = acc_.GetOpCode(gate);
+    if (op == OpCode::CONSTANT) {
+        JSTaggedValue value(acc_.GetBitField(gate));
+        return value.IsInt() && value.GetInt() >= 0;
+    }
+    if (op == OpCode::VALUE_SELECTOR) {
+        for (size_t i = 0; i < acc_.GetNumValueIn(gate); i++) {
+            if (!VisitNonNegative(acc_.GetValueIn(gate, i), visited)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    if (op != OpCode::JS_BYTECODE) {
+        return false;
+    }
+    switch (bcBuilder_->GetByteCodeOpcode(gate)) {
+        case TONUMBER_PREF_V8:
+        case INCDYN_PREF_V8:
+            return VisitNonNegative(acc_.GetValueIn(gate, 0), visited);
+        case ADD2DYN_PREF_V8:
+            return VisitNonNegative(acc_.GetValueIn(gate, 0), visited) &&
+                VisitNonNegative(acc_.GetValueIn(gate, 1), visited);
+        default:
+            return false;
+    }
+}
+
+bool RangeAnalysis::IsLengthOf(GateRef gate, GateRef receiver) const
+{
+    if (!IsBytecode(gate, LDOBJBYNAME_PREF_ID32_V8) || acc_.GetValueIn(gate, 1) != receiver) {
+        return false;
+    }
+    size_t stringIndex = acc_.GetBitField(acc_.GetValueIn(gate, 0));
+    JSHandle<EcmaString> name = tsLoader_->GetStringById(stringIndex);
+    return CstringConvertToStdString(ConvertToString(*name, StringConvertedUsage::LOGICOPERATION)) == "length";
+}
+
+GateRef RangeAnalysis::GetComparison(GateRef branch, GateRef key, bool isTrueBranch) const
+{
+    // jeqz jumps when the condition is false, jnez when it is true, the other branch falls through
+    bool conditionHolds = false;
+    if (IsBytecode(branch, JEQZ_IMM8) || IsBytecode(branch, JEQZ_IMM16)) {
+        conditionHolds = !isTrueBranch;
+    } else if (IsBytecode(branch, JNEZ_IMM8) || IsBytecode(branch, JNEZ_IMM16)) {
+        conditionHolds = isTrueBranch;
+    }
+    if (!conditionHolds) {
+        return Circuit::NullGate();
+    }
+    // lessdyn compares its register with the acc, which holds the length
+    GateRef condition = acc_.GetValueIn(branch, 0);
+    if (!IsBytecode(condition, LESSDYN_PREF_V8) || acc_.GetValueIn(condition, 0) != key) {
+        return Circuit::NullGate();
+    }
+    return condition;
+}
+}  // namespace panda::ecmascript::kungfu
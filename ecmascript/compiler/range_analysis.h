@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_COMPILER_RANGE_ANALYSIS_H
+#define ECMASCRIPT_COMPILER_RANGE_ANALYSIS_H
+
+#include <unordered_set>
+
+#include "ecmascript/compiler/bytecode_circuit_builder.h"
+#include "ecmascript/compiler/circuit.h"
+#include "ecmascript/compiler/gate_accessor.h"
+#include "ecmascript/ts_types/ts_loader.h"
+
+namespace panda::ecmascript::kungfu {
+// RangeAnalysis proves the key of an element access at least 0 and below the length of its receiver.
+// The lower bound holds for a key built from non-negative int constants by incdyn, add2dyn and tonumber, and for
+// a loop phi of such keys, e.g. the induction variable i of "for (let i = 0; ...; i++)". The upper bound holds when
+// the access runs on the true branch of "i < arr.length" and nothing runs between the load of the length and the
+// access but the comparison and the computation of the key, which can't call into js code as they only see
+// numbers. The length is the one of an array only if the receiver is an array, which the lowering checks.
+class RangeAnalysis {
+public:
+    RangeAnalysis(BytecodeCircuitBuilder *bcBuilder, Circuit *circuit, TSLoader *tsLoader)
+        : bcBuilder_(bcBuilder), acc_(circuit), tsLoader_(tsLoader) {}
+    ~RangeAnalysis() = default;
+    NO_COPY_SEMANTIC(RangeAnalysis);
+    NO_MOVE_SEMANTIC(RangeAnalysis);
+
+    // the gate is a ldobjbyvalue or a stobjbyvalue, the receiver is its value 0 and the key its value 1
+    bool IsKeyInBounds(GateRef gate);
+
+private:
+    bool IsBytecode(GateRef gate, EcmaOpcode opcode) const;
+    bool IsNonNegative(GateRef gate);
+    bool VisitNonNegative(GateRef gate, std::unordered_set<GateRef> *visited);
+    bool IsLengthOf(GateRef gate, GateRef receiver) const;
+    GateRef GetComparison(GateRef branch, GateRef key, bool isTrueBranch) const;
+
+    BytecodeCircuitBuilder *bcBuilder_;
+    GateAccessor acc_;
+    TSLoader *tsLoader_ {nullptr};
+    std::unordered_set<GateRef> nonNegatives_ {};
+};
+}  // panda::ecmascript::kungfu
+#endif  // ECMASCRIPT_COMPILER_RANGE_ANALYSIS_H
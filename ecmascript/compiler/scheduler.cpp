@@ -102,7 +102,8 @@ DominatorTreeInfo Scheduler::CalculateDominatorTree(const Circuit *circuit)
     return {bbGatesList, bbGatesAddrToIdx, immDom};
 }
 
-std::vector<std::vector<GateRef>> Scheduler::Run(const Circuit *circuit, [[maybe_unused]] bool enableLog)
+std::vector<std::vector<GateRef>> Scheduler::Run(const Circuit *circuit, [[maybe_unused]] bool enableLog,
+                                                 bool enableGlobalCodeMotion)
 {
 #ifndef NDEBUG
     if (!Verifier::Run(circuit, enableLog)) {
@@ -166,6 +167,10 @@ std::vector<std::vector<GateRef>> Scheduler::Run(const Circuit *circuit, [[maybe
         std::vector<GateRef> order;
         auto lowerBound =
             Scheduler::CalculateSchedulingLowerBound(circuit, bbGatesAddrToIdx, lowestCommonAncestor, &order).value();
+        if (enableGlobalCodeMotion) {
+            lowerBound = Scheduler::CalculateLoopInvariantPositions(circuit, bbGatesList, bbGatesAddrToIdx, immDom,
+                isAncestor, lowestCommonAncestor, order, lowerBound);
+        }
         for (const auto &schedulableGate : order) {
             result[lowerBound.at(schedulableGate)].push_back(schedulableGate);
         }
@@ -298,6 +303,124 @@ std::optional<std::unordered_map<GateRef, size_t>> Scheduler::CalculateSchedulin
     return lowerBound;
 }
 
+std::unordered_map<GateRef, size_t> Scheduler::CalculateLoopInvariantPositions(const Circuit *circuit,
+    const std::vector<GateRef> &bbGatesList, const std::unordered_map<GateRef, size_t> &bbGatesAddrToIdx,
+    const std::vector<size_t> &immDom, const std::function<bool(size_t, size_t)> &isAncestor,
+    const std::function<size_t(size_t, size_t)> &lowestCommonAncestor, const std::vector<GateRef> &order,
+    const std::unordered_map<GateRef, size_t> &lowerBound)
+{
+    std::unordered_map<GateRef, size_t> position = lowerBound;
+    auto upperBound = Scheduler::CalculateSchedulingUpperBound(circuit, bbGatesAddrToIdx, isAncestor, order);
+    if (!upperBound.has_value()) {
+        return position;
+    }
+    // the blocks of a loop are found backwards from its loop back
+    std::vector<std::vector<bool>> loops;
+    std::vector<bool> loopHasGC;
+    std::vector<size_t> loopDepth(bbGatesList.size(), 0);
+    for (size_t idx = 0; idx < bbGatesList.size(); idx++) {
+        if (circuit->GetOpCode(bbGatesList[idx]) != OpCode::LOOP_BEGIN) {
+            continue;
+        }
+        std::vector<bool> body(bbGatesList.size(), false);
+        body[idx] = true;
+        std::deque<GateRef> pendingList {circuit->GetIn(bbGatesList[idx], 1)};  // 1: the loop back
+        while (!pendingList.empty()) {
+            auto curGate = pendingList.front();
+            pendingList.pop_front();
+            if (bbGatesAddrToIdx.count(curGate) == 0 || body[bbGatesAddrToIdx.at(curGate)]) {
+                continue;
+            }
+            body[bbGatesAddrToIdx.at(curGate)] = true;
+            for (const auto &predGate : circuit->GetInVector(curGate)) {
+                if (circuit->GetOpCode(predGate).IsState()) {
+                    pendingList.push_back(predGate);
+                }
+            }
+        }
+        for (size_t bbIdx = 0; bbIdx < body.size(); bbIdx++) {
+            loopDepth[bbIdx] += body[bbIdx] ? 1 : 0;
+        }
+        loops.emplace_back(std::move(body));
+        loopHasGC.push_back(false);
+    }
+    if (loops.empty()) {
+        return position;
+    }
+    for (const auto &gate : order) {
+        switch (circuit->GetOpCode(gate)) {
+            case OpCode::CALL:
+            case OpCode::RUNTIME_CALL:
+            case OpCode::RUNTIME_CALL_WITH_ARGV:
+            case OpCode::BYTECODE_CALL:
+            case OpCode::DEBUGGER_BYTECODE_CALL:
+            case OpCode::DEOPT:
+                for (size_t loopIdx = 0; loopIdx < loops.size(); loopIdx++) {
+                    loopHasGC[loopIdx] = loopHasGC[loopIdx] || loops[loopIdx][lowerBound.at(gate)];
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    auto canLeave = [&](size_t from, size_t to) -> bool {
+        for (size_t loopIdx = 0; loopIdx < loops.size(); loopIdx++) {
+            if (loops[loopIdx][from] && !loops[loopIdx][to] && loopHasGC[loopIdx]) {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto canHoist = [&](GateRef gate) -> bool {
+        OpCode op = circuit->GetOpCode(gate);
+        // a division by zero would trap on paths that never divided
+        return op.IsPure() && op != OpCode::SDIV && op != OpCode::SMOD && op != OpCode::UDIV && op != OpCode::UMOD;
+    };
+    // the users come first in the order, so the latest position of a gate is known from the final positions of
+    // its users
+    for (const auto &gate : order) {
+        if (!canHoist(gate)) {
+            continue;
+        }
+        std::optional<size_t> latest;
+        for (const auto &succGate : circuit->GetOutVector(gate)) {
+            std::vector<size_t> succPositions;
+            OpCode succOp = circuit->GetOpCode(succGate);
+            if (succOp.IsState()) {
+                if (bbGatesAddrToIdx.count(succGate) > 0) {
+                    succPositions.push_back(bbGatesAddrToIdx.at(succGate));
+                }
+            } else if (succOp.IsFixed()) {
+                auto ins = circuit->GetInVector(succGate);
+                for (size_t cnt = 1; cnt < ins.size(); cnt++) {
+                    if (ins[cnt] == gate) {
+                        succPositions.push_back(bbGatesAddrToIdx.at(circuit->GetIn(ins[0], cnt - 1)));
+                    }
+                }
+            } else if (position.count(succGate) > 0) {
+                succPositions.push_back(position.at(succGate));
+            }
+            for (auto succPosition : succPositions) {
+                latest = latest.has_value() ? lowestCommonAncestor(latest.value(), succPosition) : succPosition;
+            }
+        }
+        if (!latest.has_value()) {
+            continue;
+        }
+        size_t upper = upperBound.value().at(gate);
+        size_t best = latest.value();
+        size_t cur = best;
+        while (cur != upper && loopDepth[best] > 0 && isAncestor(upper, cur)) {
+            cur = immDom[cur];
+            if (loopDepth[cur] < loopDepth[best] && canLeave(latest.value(), cur)) {
+                best = cur;
+            }
+        }
+        position[gate] = best;
+    }
+    return position;
+}
+
 void Scheduler::Print(const std::vector<std::vector<GateRef>> *cfg, const Circuit *circuit)
 {
     std::vector<GateRef> bbGatesList;
@@ -30,13 +30,22 @@ class Scheduler {
 public:
     static std::tuple<std::vector<GateRef>, std::unordered_map<GateRef, size_t>, std::vector<size_t>>
     CalculateDominatorTree(const Circuit *circuit);
-    static ControlFlowGraph Run(const Circuit *circuit, bool enableLog = false);
+    // With enableGlobalCodeMotion the pure gates leave the loops free of calls, else they go as late as possible.
+    static ControlFlowGraph Run(const Circuit *circuit, bool enableLog = false, bool enableGlobalCodeMotion = false);
     static std::optional<std::unordered_map<GateRef, size_t>> CalculateSchedulingUpperBound(const Circuit *circuit,
         const std::unordered_map<GateRef, size_t> &bbGatesAddrToIdx,
         const std::function<bool(size_t, size_t)> &isAncestor, const std::vector<GateRef> &schedulableGatesList);
     static std::optional<std::unordered_map<GateRef, size_t>> CalculateSchedulingLowerBound(const Circuit *circuit,
         const std::unordered_map<GateRef, size_t> &bbGatesAddrToIdx,
         const std::function<size_t(size_t, size_t)> &lowestCommonAncestor, std::vector<GateRef> *order = nullptr);
+    // Move the pure gates from their lower bounds up the dominator tree to the block of the least loop depth
+    // before their upper bounds. A gate does not leave a loop with a gc, which would not relocate the raw pointers
+    // computed before it.
+    static std::unordered_map<GateRef, size_t> CalculateLoopInvariantPositions(const Circuit *circuit,
+        const std::vector<GateRef> &bbGatesList, const std::unordered_map<GateRef, size_t> &bbGatesAddrToIdx,
+        const std::vector<size_t> &immDom, const std::function<bool(size_t, size_t)> &isAncestor,
+        const std::function<size_t(size_t, size_t)> &lowestCommonAncestor, const std::vector<GateRef> &order,
+        const std::unordered_map<GateRef, size_t> &lowerBound);
     static void Print(const ControlFlowGraph *cfg, const Circuit *circuit);
 };
 };  // namespace panda::ecmascript::kungfu
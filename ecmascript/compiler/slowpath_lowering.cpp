@@ -15,6 +15,9 @@
 
 #include "ecmascript/compiler/slowpath_lowering.h"
 
+#include "ecmascript/js_object.h"
+#include "ecmascript/layout_info.h"
+
 namespace panda::ecmascript::kungfu {
 #define CREATE_DOUBLE_EXIT(SuccessLabel, FailLabel)               \
     std::vector<GateRef> successControl;                          \
@@ -240,6 +243,11 @@ void SlowPathLowering::Lower(GateRef gate)
     EcmaOpcode op = static_cast<EcmaOpcode>(*pc);
     // initialize label manager
     Environment env(gate, circuit_, &builder_);
+    FrameArgs frameArgs;
+    if (bcBuilder_->GetFrameArgs(pc, &frameArgs)) {
+        LowerFrameArgs(gate, glue, actualArgc, frameArgs);
+        return;
+    }
     switch (op) {
         case LDA_STR_ID32:
             LowerLoadStr(gate, glue);
@@ -664,20 +672,22 @@ void SlowPathLowering::SaveFrameToContext(GateRef gate, GateRef glue, GateRef js
     GateRef saveRegister = acc_.GetDep(gate);
     ASSERT(acc_.GetOpCode(saveRegister) == OpCode::SAVE_REGISTER);
     std::vector<GateRef> saveRegisterGates {};
+    // only the registers read after the resume are saved, the array needs to hold the highest of them
+    uint32_t numRegs = 0;
     while (acc_.GetOpCode(saveRegister) == OpCode::SAVE_REGISTER) {
         saveRegisterGates.emplace_back(saveRegister);
+        numRegs = std::max(numRegs, static_cast<uint32_t>(acc_.GetBitField(saveRegister)) + 1);
         saveRegister = acc_.GetDep(saveRegister);
     }
     acc_.SetDep(gate, saveRegister);
     builder_.SetDepend(saveRegister);
     GateRef context =
         builder_.Load(VariableType::JS_POINTER(), genObj, builder_.IntPtr(JSGeneratorObject::GENERATOR_CONTEXT_OFFSET));
-    // new tagged array
-    const size_t arrLength = 65536; // 65536: Maximum number of virtual registers
-    GateRef length = builder_.Int32((arrLength));
+    // the array of the previous suspend is reused when it is long enough
+    GateRef length = builder_.Int32(numRegs);
     GateRef taggedLength = builder_.TaggedTypeNGC(builder_.ZExtInt32ToInt64(length));
-    const int arrayId = RTSTUB_ID(NewTaggedArray);
-    GateRef taggedArray = LowerCallRuntime(glue, arrayId, {taggedLength});
+    const int arrayId = RTSTUB_ID(GetAotGeneratorRegsArray);
+    GateRef taggedArray = LowerCallRuntime(glue, arrayId, {genObj, taggedLength});
     // setRegsArrays
     for (auto item : saveRegisterGates) {
         auto index = acc_.GetBitField(item);
@@ -775,9 +785,20 @@ void SlowPathLowering::LowerLoadStr(GateRef gate, GateRef glue)
 
 void SlowPathLowering::LowerLexicalEnv(GateRef gate, GateRef glue)
 {
-    const int id = RTSTUB_ID(GetAotLexicalEnv);
-    GateRef newGate = LowerCallRuntime(glue, id, {});
-    ReplaceHirToCall(gate, newGate, true);
+    if (!lexEnvFixed_) {
+        const int id = RTSTUB_ID(GetAotLexicalEnv);
+        GateRef newGate = LowerCallRuntime(glue, id, {});
+        ReplaceHirToCall(gate, newGate, true);
+        return;
+    }
+    GateRef lexEnv = GetCurrentLexEnv(glue);
+    std::vector<GateRef> successControl;
+    std::vector<GateRef> exceptionControl;
+    successControl.emplace_back(builder_.GetState());
+    successControl.emplace_back(builder_.GetDepend());
+    exceptionControl.emplace_back(Circuit::NullGate());
+    exceptionControl.emplace_back(Circuit::NullGate());
+    ReplaceHirToSubCfg(gate, lexEnv, successControl, exceptionControl, true);
 }
 
 void SlowPathLowering::LowerTryLdGlobalByName(GateRef gate, GateRef glue)
@@ -2282,13 +2303,27 @@ void SlowPathLowering::LowerLdObjByName(GateRef gate, GateRef glue)
     builder_.Branch(builder_.TaggedIsHeapObject(receiver), &receiverIsHeapObject, &slowPath);
     builder_.Bind(&receiverIsHeapObject);
     {
-        varAcc = builder_.CallStub(glue, CommonStubCSigns::GetPropertyByName,
-            {glue, receiver, prop});
-        Label notHole(&builder_);
-        builder_.Branch(builder_.IsSpecial(*varAcc, JSTaggedValue::VALUE_HOLE), &slowPath, &notHole);
-        builder_.Bind(&notHole);
-        builder_.Branch(builder_.IsSpecial(*varAcc, JSTaggedValue::VALUE_EXCEPTION),
-            &exceptionExit, &successExit);
+        uint32_t profiledEntry = 0;
+        const uint8_t *pc = bcBuilder_->GetJSBytecode(gate);
+        GateRef frameState = bcBuilder_->GetFrameState(pc);
+        bool isProfiled = bcBuilder_->GetProfiledLayoutEntry(pc, &profiledEntry);
+        if (isProfiled) {
+            Label layoutMismatch(&builder_);
+            LowerLoadFromProfiledLayout(receiver, prop, profiledEntry, &varAcc, &successExit, &layoutMismatch);
+            builder_.Bind(&layoutMismatch);
+        }
+        if (isProfiled && frameState != Circuit::NullGate()) {
+            // the interpreter runs the rest of the method from this load, and its result is the one of the method
+            builder_.Return(builder_.Deoptimize(glue, frameState));
+        } else {
+            varAcc = builder_.CallStub(glue, CommonStubCSigns::GetPropertyByName,
+                {glue, receiver, prop});
+            Label notHole(&builder_);
+            builder_.Branch(builder_.IsSpecial(*varAcc, JSTaggedValue::VALUE_HOLE), &slowPath, &notHole);
+            builder_.Bind(&notHole);
+            builder_.Branch(builder_.IsSpecial(*varAcc, JSTaggedValue::VALUE_EXCEPTION),
+                &exceptionExit, &successExit);
+        }
     }
     builder_.Bind(&slowPath);
     {
@@ -2312,6 +2347,57 @@ void SlowPathLowering::LowerLdObjByName(GateRef gate, GateRef glue)
     ReplaceHirToSubCfg(gate, result, successControl, failControl);
 }
 
+// The profile saw the property at this entry of the layout of the receiver, as an inlined data property. The
+// layout of the receiver is checked for the same key and attributes before the field is read, so a receiver of any
+// other layout takes the generic load.
+void SlowPathLowering::LowerLoadFromProfiledLayout(GateRef receiver, GateRef prop, uint32_t entry, Variable *result,
+                                                   Label *success, Label *mismatch)
+{
+    Label notDictionary(&builder_);
+    Label hasEntry(&builder_);
+    Label keyMatched(&builder_);
+    Label isInlined(&builder_);
+    Label isField(&builder_);
+    GateRef hclass = builder_.LoadHClass(receiver);
+    builder_.Branch(builder_.IsDictionaryModeByHClass(hclass), mismatch, &notDictionary);
+    builder_.Bind(&notDictionary);
+    GateRef bitfield1 = builder_.Load(VariableType::INT32(), hclass, builder_.IntPtr(JSHClass::BIT_FIELD1_OFFSET));
+    GateRef propNums = builder_.Int32And(builder_.Int32LSR(bitfield1,
+        builder_.Int32(JSHClass::NumberOfPropsBits::START_BIT)),
+        builder_.Int32((1LLU << JSHClass::NumberOfPropsBits::SIZE) - 1));
+    builder_.Branch(builder_.Int32UnsignedLessThan(builder_.Int32(entry), propNums), &hasEntry, mismatch);
+    builder_.Bind(&hasEntry);
+    GateRef layout = builder_.Load(VariableType::JS_POINTER(), hclass, builder_.IntPtr(JSHClass::LAYOUT_OFFSET));
+    // a layout entry is a pair of the key and its attributes
+    size_t keyIndex = LayoutInfo::ELEMENTS_START_INDEX + (entry << 1U);
+    GateRef key = builder_.Load(VariableType::JS_ANY(), layout,
+        builder_.IntPtr(TaggedArray::DATA_OFFSET + keyIndex * JSTaggedValue::TaggedTypeSize()));
+    builder_.Branch(builder_.Equal(key, prop), &keyMatched, mismatch);
+    builder_.Bind(&keyMatched);
+    GateRef attr = builder_.TaggedCastToInt32(builder_.Load(VariableType::INT64(), layout,
+        builder_.IntPtr(TaggedArray::DATA_OFFSET + (keyIndex + 1) * JSTaggedValue::TaggedTypeSize())));
+    GateRef inlinedBit = builder_.Int32And(builder_.Int32LSR(attr,
+        builder_.Int32(PropertyAttributes::IsInlinedPropsField::START_BIT)),
+        builder_.Int32((1LLU << PropertyAttributes::IsInlinedPropsField::SIZE) - 1));
+    builder_.Branch(builder_.NotEqual(inlinedBit, builder_.Int32(0)), &isInlined, mismatch);
+    builder_.Bind(&isInlined);
+    GateRef accessorBit = builder_.Int32And(builder_.Int32LSR(attr,
+        builder_.Int32(PropertyAttributes::IsAccessorField::START_BIT)),
+        builder_.Int32((1LLU << PropertyAttributes::IsAccessorField::SIZE) - 1));
+    builder_.Branch(builder_.NotEqual(accessorBit, builder_.Int32(0)), mismatch, &isField);
+    builder_.Bind(&isField);
+    GateRef inlinedPropsStart = builder_.Int32And(builder_.Int32LSR(bitfield1,
+        builder_.Int32(JSHClass::InlinedPropsStartBits::START_BIT)),
+        builder_.Int32((1LLU << JSHClass::InlinedPropsStartBits::SIZE) - 1));
+    GateRef index = builder_.Int32Add(inlinedPropsStart, builder_.Int32And(builder_.Int32LSR(attr,
+        builder_.Int32(PropertyAttributes::OffsetField::START_BIT)),
+        builder_.Int32((1LLU << PropertyAttributes::OffsetField::SIZE) - 1)));
+    GateRef offset = builder_.PtrMul(builder_.ChangeInt32ToIntPtr(index),
+        builder_.IntPtr(JSTaggedValue::TaggedTypeSize()));
+    *result = builder_.Load(VariableType::JS_ANY(), receiver, offset);
+    builder_.Jump(success);
+}
+
 void SlowPathLowering::LowerStObjByName(GateRef gate, GateRef glue)
 {
     Label receiverIsHeapObject(&builder_);
@@ -2463,6 +2549,12 @@ void SlowPathLowering::LowerLdObjByValue(GateRef gate, GateRef glue)
     builder_.Branch(builder_.TaggedIsHeapObject(receiver), &isHeapObject, &slowPath);
     builder_.Bind(&isHeapObject);
     {
+        TypedElementAccess access;
+        if (bcBuilder_->GetTypedElementAccess(bcBuilder_->GetJSBytecode(gate), &access)) {
+            Label notFastElement(&builder_);
+            LowerLoadTypedElement(receiver, propKey, access.isInBounds, &varAcc, &successExit, &notFastElement);
+            builder_.Bind(&notFastElement);
+        }
         varAcc = builder_.CallStub(glue, CommonStubCSigns::GetPropertyByValue,
             {glue, receiver, propKey});
         Label notHole(&builder_);
@@ -2493,6 +2585,51 @@ void SlowPathLowering::LowerLdObjByValue(GateRef gate, GateRef glue)
     ReplaceHirToSubCfg(gate, result, successControl, failControl);
 }
 
+// The receiver has an array type in ts. The element of a JSArray with fast elements is read directly when the key
+// is an int below the length of the elements and the element is not a hole. When the range analysis proved the key
+// below the length of the array, the elements of a packed array hold no hole up to there, so the element is read
+// without the bounds check and the hole check.
+void SlowPathLowering::LowerLoadTypedElement(GateRef receiver, GateRef key, bool isInBounds, Variable *result,
+                                             Label *success, Label *fallback)
+{
+    Label isArray(&builder_);
+    Label notDictionary(&builder_);
+    Label isIntKey(&builder_);
+    Label inRange(&builder_);
+    Label notHole(&builder_);
+    GateRef hclass = builder_.LoadHClass(receiver);
+    builder_.Branch(builder_.Equal(builder_.GetObjectType(hclass),
+        builder_.Int32(static_cast<int32_t>(JSType::JS_ARRAY))), &isArray, fallback);
+    builder_.Bind(&isArray);
+    builder_.Branch(builder_.IsDictionaryElement(hclass), fallback, &notDictionary);
+    builder_.Bind(&notDictionary);
+    builder_.Branch(builder_.TaggedIsInt(key), &isIntKey, fallback);
+    builder_.Bind(&isIntKey);
+    GateRef index = builder_.TaggedCastToInt32(key);
+    GateRef elements = builder_.Load(VariableType::JS_POINTER(), receiver, builder_.IntPtr(JSObject::ELEMENTS_OFFSET));
+    GateRef offset = builder_.PtrAdd(builder_.PtrMul(builder_.ChangeInt32ToIntPtr(index),
+        builder_.IntPtr(JSTaggedValue::TaggedTypeSize())), builder_.IntPtr(TaggedArray::DATA_OFFSET));
+    if (isInBounds) {
+        Label isPacked(&builder_);
+        Label notPacked(&builder_);
+        GateRef holeBit = builder_.Int32And(builder_.GetElementsKindFromHClass(hclass),
+            builder_.Int32(static_cast<int32_t>(ElementsKind::HOLE)));
+        builder_.Branch(builder_.Equal(holeBit, builder_.Int32(0)), &isPacked, &notPacked);
+        builder_.Bind(&isPacked);
+        *result = builder_.Load(VariableType::JS_ANY(), elements, offset);
+        builder_.Jump(success);
+        builder_.Bind(&notPacked);
+    }
+    GateRef length = builder_.Load(VariableType::INT32(), elements, builder_.IntPtr(TaggedArray::LENGTH_OFFSET));
+    builder_.Branch(builder_.Int32UnsignedLessThan(index, length), &inRange, fallback);
+    builder_.Bind(&inRange);
+    GateRef value = builder_.Load(VariableType::JS_ANY(), elements, offset);
+    builder_.Branch(builder_.IsSpecial(value, JSTaggedValue::VALUE_HOLE), fallback, &notHole);
+    builder_.Bind(&notHole);
+    *result = value;
+    builder_.Jump(success);
+}
+
 void SlowPathLowering::LowerStObjByValue(GateRef gate, GateRef glue)
 {
     // 3: number of value inputs
@@ -2509,6 +2646,13 @@ void SlowPathLowering::LowerStObjByValue(GateRef gate, GateRef glue)
     builder_.Branch(builder_.TaggedIsHeapObject(receiver), &isHeapObject, &slowPath);
     builder_.Bind(&isHeapObject);
     {
+        TypedElementAccess access;
+        if (bcBuilder_->GetTypedElementAccess(bcBuilder_->GetJSBytecode(gate), &access) && access.isNumberElement) {
+            Label notFastElement(&builder_);
+            LowerStoreTypedElement(glue, receiver, propKey, accValue, access.isInBounds, &successExit,
+                                   &notFastElement);
+            builder_.Bind(&notFastElement);
+        }
         result = builder_.CallStub(glue, CommonStubCSigns::SetPropertyByValue, {glue, receiver, propKey, accValue});
         Label notHole(&builder_);
         builder_.Branch(builder_.IsSpecial(result, JSTaggedValue::VALUE_HOLE), &slowPath, &notHole);
@@ -2529,6 +2673,64 @@ void SlowPathLowering::LowerStObjByValue(GateRef gate, GateRef glue)
     ReplaceHirToSubCfg(gate, Circuit::NullGate(), successControl, failControl);
 }
 
+// The elements of the receiver are numbers in ts. A number is stored directly over an element of a JSArray with
+// fast elements when the elements kind of the array has the kind of the number, so no transition is needed, and
+// without a write barrier, as a number is not a heap object. The element must be below the length of the elements
+// and not a hole, which is proved like for a load.
+void SlowPathLowering::LowerStoreTypedElement(GateRef glue, GateRef receiver, GateRef key, GateRef value,
+                                              bool isInBounds, Label *success, Label *fallback)
+{
+    Label isArray(&builder_);
+    Label notDictionary(&builder_);
+    Label isIntKey(&builder_);
+    Label isInt(&builder_);
+    Label notInt(&builder_);
+    Label isDouble(&builder_);
+    Label kindContained(&builder_);
+    Label inRange(&builder_);
+    Label notHole(&builder_);
+    GateRef hclass = builder_.LoadHClass(receiver);
+    builder_.Branch(builder_.Equal(builder_.GetObjectType(hclass),
+        builder_.Int32(static_cast<int32_t>(JSType::JS_ARRAY))), &isArray, fallback);
+    builder_.Bind(&isArray);
+    builder_.Branch(builder_.IsDictionaryElement(hclass), fallback, &notDictionary);
+    builder_.Bind(&notDictionary);
+    builder_.Branch(builder_.TaggedIsInt(key), &isIntKey, fallback);
+    builder_.Bind(&isIntKey);
+    builder_.Branch(builder_.TaggedIsInt(value), &isInt, &notInt);
+    builder_.Bind(&isInt);
+    builder_.Branch(builder_.ContainsElementsKind(hclass, ElementsKind::PACKED_SMI), &kindContained, fallback);
+    builder_.Bind(&notInt);
+    builder_.Branch(builder_.TaggedIsDouble(value), &isDouble, fallback);
+    builder_.Bind(&isDouble);
+    builder_.Branch(builder_.ContainsElementsKind(hclass, ElementsKind::PACKED_DOUBLE), &kindContained, fallback);
+    builder_.Bind(&kindContained);
+    GateRef index = builder_.TaggedCastToInt32(key);
+    GateRef elements = builder_.Load(VariableType::JS_POINTER(), receiver, builder_.IntPtr(JSObject::ELEMENTS_OFFSET));
+    GateRef offset = builder_.PtrAdd(builder_.PtrMul(builder_.ChangeInt32ToIntPtr(index),
+        builder_.IntPtr(JSTaggedValue::TaggedTypeSize())), builder_.IntPtr(TaggedArray::DATA_OFFSET));
+    if (isInBounds) {
+        Label isPacked(&builder_);
+        Label notPacked(&builder_);
+        GateRef holeBit = builder_.Int32And(builder_.GetElementsKindFromHClass(hclass),
+            builder_.Int32(static_cast<int32_t>(ElementsKind::HOLE)));
+        builder_.Branch(builder_.Equal(holeBit, builder_.Int32(0)), &isPacked, &notPacked);
+        builder_.Bind(&isPacked);
+        builder_.Store(VariableType::INT64(), glue, elements, offset, value);
+        builder_.Jump(success);
+        builder_.Bind(&notPacked);
+    }
+    GateRef length = builder_.Load(VariableType::INT32(), elements, builder_.IntPtr(TaggedArray::LENGTH_OFFSET));
+    builder_.Branch(builder_.Int32UnsignedLessThan(index, length), &inRange, fallback);
+    builder_.Bind(&inRange);
+    // storing over a hole would add the element, which may need a transition or meet a setter on the prototypes
+    GateRef oldValue = builder_.Load(VariableType::JS_ANY(), elements, offset);
+    builder_.Branch(builder_.IsSpecial(oldValue, JSTaggedValue::VALUE_HOLE), fallback, &notHole);
+    builder_.Bind(&notHole);
+    builder_.Store(VariableType::INT64(), glue, elements, offset, value);
+    builder_.Jump(success);
+}
+
 void SlowPathLowering::LowerLdSuperByName(GateRef gate, GateRef glue)
 {
     Label successExit(&builder_);
@@ -2579,32 +2781,41 @@ void SlowPathLowering::LowerStArraySpread(GateRef gate, GateRef glue)
     ReplaceHirToCall(gate, newGate);
 }
 
+// The lexical env stays the argument of the method when it is fixed, and the env slot of the frame holds it
+// otherwise.
+GateRef SlowPathLowering::GetCurrentLexEnv(GateRef glue)
+{
+    if (lexEnvFixed_) {
+        return argAcc_.GetCommonArgGate(CommonArgIdx::LEXENV);
+    }
+    return LowerCallRuntime(glue, RTSTUB_ID(GetAotLexicalEnv), {}, true);
+}
+
+// The level of an access to the env chain is an immediate of the bytecode, so the parent envs are loaded one after
+// another instead of in a loop.
+GateRef SlowPathLowering::GetLexEnvAtLevel(GateRef glue, GateRef level)
+{
+    ASSERT(acc_.GetOpCode(level) == OpCode::CONSTANT);
+    BitField depth = acc_.GetBitField(level);
+    GateRef env = GetCurrentLexEnv(glue);
+    GateRef index = builder_.Int32(LexicalEnv::PARENT_ENV_INDEX);
+    for (BitField i = 0; i < depth; i++) {
+        env = builder_.GetValueFromTaggedArray(VariableType::JS_ANY(), env, index);
+    }
+    return env;
+}
+
 void SlowPathLowering::LowerLdLexVarDyn(GateRef gate, GateRef glue)
 {
     // 2: number of value inputs
     ASSERT(acc_.GetNumValueIn(gate) == 2);
-    GateRef level = builder_.TruncInt64ToInt32(acc_.GetValueIn(gate, 0));
-    GateRef slot = builder_.TruncInt64ToInt32(acc_.GetValueIn(gate, 1));
-    DEFVAlUE(currentEnv, (&builder_), VariableType::JS_ANY(),
-        LowerCallRuntime(glue, RTSTUB_ID(GetAotLexicalEnv), {}, true));
-    DEFVAlUE(i, (&builder_), VariableType::INT32(), builder_.Int32(0));
+    GateRef slot = acc_.GetValueIn(gate, 1);
+    ASSERT(acc_.GetOpCode(slot) == OpCode::CONSTANT);
+    GateRef env = GetLexEnvAtLevel(glue, acc_.GetValueIn(gate, 0));
+    GateRef valueIndex = builder_.Int32(static_cast<int32_t>(acc_.GetBitField(slot) + LexicalEnv::RESERVED_ENV_LENGTH));
+    GateRef result = builder_.GetValueFromTaggedArray(VariableType::JS_ANY(), env, valueIndex);
     std::vector<GateRef> successControl;
     std::vector<GateRef> exceptionControl;
-
-    Label loopHead(&builder_);
-    Label loopEnd(&builder_);
-    Label afterLoop(&builder_);
-    builder_.Branch(builder_.Int32LessThan(*i, level), &loopHead, &afterLoop);
-    builder_.LoopBegin(&loopHead);
-    GateRef index = builder_.Int32(LexicalEnv::PARENT_ENV_INDEX);
-    currentEnv = builder_.GetValueFromTaggedArray(VariableType::JS_ANY(), *currentEnv, index);
-    i = builder_.Int32Add(*i, builder_.Int32(1));
-    builder_.Branch(builder_.Int32LessThan(*i, level), &loopEnd, &afterLoop);
-    builder_.Bind(&loopEnd);
-    builder_.LoopEnd(&loopHead);
-    builder_.Bind(&afterLoop);
-    GateRef valueIndex = builder_.Int32Add(slot, builder_.Int32(LexicalEnv::RESERVED_ENV_LENGTH));
-    GateRef result = builder_.GetValueFromTaggedArray(VariableType::JS_ANY(), *currentEnv, valueIndex);
     successControl.emplace_back(builder_.GetState());
     successControl.emplace_back(builder_.GetDepend());
     exceptionControl.emplace_back(Circuit::NullGate());
@@ -2616,28 +2827,14 @@ void SlowPathLowering::LowerStLexVarDyn(GateRef gate, GateRef glue)
 {
     // 3: number of value inputs
     ASSERT(acc_.GetNumValueIn(gate) == 3);
-    GateRef level = builder_.TruncInt64ToInt32(acc_.GetValueIn(gate, 0));
-    GateRef slot = builder_.TruncInt64ToInt32(acc_.GetValueIn(gate, 1));
+    GateRef slot = acc_.GetValueIn(gate, 1);
+    ASSERT(acc_.GetOpCode(slot) == OpCode::CONSTANT);
     GateRef value = acc_.GetValueIn(gate, 2);
-    DEFVAlUE(currentEnv, (&builder_), VariableType::JS_ANY(),
-             LowerCallRuntime(glue, RTSTUB_ID(GetAotLexicalEnv), {}, true));
-    DEFVAlUE(i, (&builder_), VariableType::INT32(), builder_.Int32(0));
+    GateRef env = GetLexEnvAtLevel(glue, acc_.GetValueIn(gate, 0));
+    GateRef valueIndex = builder_.Int32(static_cast<int32_t>(acc_.GetBitField(slot) + LexicalEnv::RESERVED_ENV_LENGTH));
+    builder_.SetValueToTaggedArray(VariableType::JS_ANY(), glue, env, valueIndex, value);
     std::vector<GateRef> successControl;
     std::vector<GateRef> exceptionControl;
-    Label loopHead(&builder_);
-    Label loopEnd(&builder_);
-    Label afterLoop(&builder_);
-    builder_.Branch(builder_.Int32LessThan(*i, level), &loopHead, &afterLoop);
-    builder_.LoopBegin(&loopHead);
-    GateRef index = builder_.Int32(LexicalEnv::PARENT_ENV_INDEX);
-    currentEnv = builder_.GetValueFromTaggedArray(VariableType::JS_ANY(), *currentEnv, index);
-    i = builder_.Int32Add(*i, builder_.Int32(1));
-    builder_.Branch(builder_.Int32LessThan(*i, level), &loopEnd, &afterLoop);
-    builder_.Bind(&loopEnd);
-    builder_.LoopEnd(&loopHead);
-    builder_.Bind(&afterLoop);
-    GateRef valueIndex = builder_.Int32Add(slot, builder_.Int32(LexicalEnv::RESERVED_ENV_LENGTH));
-    builder_.SetValueToTaggedArray(VariableType::JS_ANY(), glue, *currentEnv, valueIndex, value);
     successControl.emplace_back(builder_.GetState());
     successControl.emplace_back(builder_.GetDepend());
     exceptionControl.emplace_back(Circuit::NullGate());
@@ -3124,4 +3321,66 @@ void SlowPathLowering::LowerCopyRestArgs(GateRef gate, GateRef glue, GateRef act
     GateRef newGate = LowerCallRuntime(glue, id, {taggedArgc, taggedRestIdx});
     ReplaceHirToCall(gate, newGate);
 }
+
+void SlowPathLowering::LowerFrameArgs(GateRef gate, GateRef glue, GateRef actualArgc, const FrameArgs &args)
+{
+    EcmaOpcode op = bcBuilder_->GetByteCodeOpcode(gate);
+    if (op == LDOBJBYNAME_PREF_ID32_V8) {
+        LowerFrameArgsLength(gate, actualArgc, args);
+        return;
+    }
+    if (op == GETUNMAPPEDARGS_PREF || op == COPYRESTARGS_PREF_IMM16) {
+        // none of the accesses reads the value of the creation
+        std::vector<GateRef> successControl;
+        std::vector<GateRef> exceptionControl;
+        successControl.emplace_back(builder_.GetState());
+        successControl.emplace_back(builder_.GetDepend());
+        exceptionControl.emplace_back(Circuit::NullGate());
+        exceptionControl.emplace_back(Circuit::NullGate());
+        ReplaceHirToSubCfg(gate, builder_.UndefineConstant(), successControl, exceptionControl, true);
+        return;
+    }
+    GateRef taggedArgc = builder_.TaggedTypeNGC(builder_.ZExtInt32ToInt64(actualArgc));
+    GateRef taggedRestIdx = builder_.TaggedTypeNGC(builder_.Int64(args.restIndex));
+    GateRef isRest = args.isRest ? builder_.TaggedTrue() : builder_.TaggedFalse();
+    GateRef newGate;
+    if (op == CALLITHISRANGEDYN_PREF_IMM16_V8) {
+        // 0: apply, 1: the function, 2: thisArg
+        newGate = LowerCallRuntime(glue, RTSTUB_ID(CallAotApplyFrameArgs),
+            {acc_.GetValueIn(gate, 0), acc_.GetValueIn(gate, 1), acc_.GetValueIn(gate, 2),
+             taggedArgc, taggedRestIdx, isRest});
+    } else {
+        // the key of ldobjbyindex is an immediate
+        GateRef key = acc_.GetValueIn(gate, 1);
+        if (op == LDOBJBYINDEX_PREF_V8_IMM32) {
+            key = builder_.TaggedTypeNGC(key);
+        }
+        newGate = LowerCallRuntime(glue, RTSTUB_ID(LdAotFrameArgByValue), {taggedArgc, taggedRestIdx, isRest, key});
+    }
+    ReplaceHirToCall(gate, newGate);
+}
+
+void SlowPathLowering::LowerFrameArgsLength(GateRef gate, GateRef actualArgc, const FrameArgs &args)
+{
+    // the actual arguments follow the function, new target and this, a rest array may get none of them
+    GateRef first = builder_.Int32(NUM_MANDATORY_JSFUNC_ARGS + static_cast<int32_t>(args.restIndex));
+    DEFVAlUE(length, (&builder_), VariableType::INT32(), builder_.Int32(0));
+    Label hasArgs(&builder_);
+    Label exit(&builder_);
+    builder_.Branch(builder_.Int32GreaterThan(actualArgc, first), &hasArgs, &exit);
+    builder_.Bind(&hasArgs);
+    {
+        length = builder_.Int32Sub(actualArgc, first);
+        builder_.Jump(&exit);
+    }
+    builder_.Bind(&exit);
+    GateRef result = builder_.TaggedNGC(builder_.ZExtInt32ToInt64(*length));
+    std::vector<GateRef> successControl;
+    std::vector<GateRef> exceptionControl;
+    successControl.emplace_back(builder_.GetState());
+    successControl.emplace_back(builder_.GetDepend());
+    exceptionControl.emplace_back(Circuit::NullGate());
+    exceptionControl.emplace_back(Circuit::NullGate());
+    ReplaceHirToSubCfg(gate, result, successControl, exceptionControl, true);
+}
 }  // namespace panda::ecmascript
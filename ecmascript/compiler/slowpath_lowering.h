@@ -115,7 +115,7 @@ public:
         : bcBuilder_(bcBuilder), circuit_(circuit), acc_(circuit),
           argAcc_(circuit), builder_(circuit, cmpCfg),
           dependEntry_(Circuit::GetCircuitRoot(OpCode(OpCode::DEPEND_ENTRY))),
-          enableLog_(enableLog) {}
+          lexEnvFixed_(bcBuilder->IsLexEnvFixed()), enableLog_(enableLog) {}
     ~SlowPathLowering() = default;
     void CallRuntimeLowering();
 
@@ -140,6 +140,10 @@ private:
     // environment must be initialized
     GateRef GetHomeObjectFromJSFunction(GateRef jsFunc);
     GateRef GetValueFromConstStringTable(GateRef glue, GateRef gate, uint32_t inIndex);
+    // environment must be initialized
+    GateRef GetCurrentLexEnv(GateRef glue);
+    // environment must be initialized
+    GateRef GetLexEnvAtLevel(GateRef glue, GateRef level);
     void Lower(GateRef gate);
     void LowerAdd2Dyn(GateRef gate, GateRef glue);
     void LowerCreateIterResultObj(GateRef gate, GateRef glue);
@@ -241,6 +245,8 @@ private:
     void LowerStOwnByNameWithNameSet(GateRef gate, GateRef glue);
     void LowerLdGlobalVar(GateRef gate, GateRef glue);
     void LowerLdObjByName(GateRef gate, GateRef glue);
+    void LowerLoadFromProfiledLayout(GateRef receiver, GateRef prop, uint32_t entry, Variable *result,
+                                     Label *success, Label *mismatch);
     void LowerStObjByName(GateRef gate, GateRef glue);
     void LowerLdSuperByName(GateRef gate, GateRef glue);
     void LowerStSuperByName(GateRef gate, GateRef glue);
@@ -248,7 +254,11 @@ private:
     void LowerLdObjByIndex(GateRef gate, GateRef glue);
     void LowerStObjByIndex(GateRef gate, GateRef glue);
     void LowerLdObjByValue(GateRef gate, GateRef glue);
+    void LowerLoadTypedElement(GateRef receiver, GateRef key, bool isInBounds, Variable *result, Label *success,
+                               Label *fallback);
     void LowerStObjByValue(GateRef gate, GateRef glue);
+    void LowerStoreTypedElement(GateRef glue, GateRef receiver, GateRef key, GateRef value, bool isInBounds,
+                                Label *success, Label *fallback);
     void LowerCreateGeneratorObj(GateRef gate, GateRef glue);
     void LowerStArraySpread(GateRef gate, GateRef glue);
     void LowerLdLexVarDyn(GateRef gate, GateRef glue);
@@ -264,6 +274,8 @@ private:
     void LowerDefineMethod(GateRef gate, GateRef glue, GateRef jsFunc);
     void LowerGetUnmappedArgs(GateRef gate, GateRef glue, GateRef actualArgc);
     void LowerCopyRestArgs(GateRef gate, GateRef glue, GateRef actualArgc);
+    void LowerFrameArgs(GateRef gate, GateRef glue, GateRef actualArgc, const FrameArgs &args);
+    void LowerFrameArgsLength(GateRef gate, GateRef actualArgc, const FrameArgs &args);
     GateRef LowerCallRuntime(GateRef glue, int index, const std::vector<GateRef> &args, bool useLabel = false);
     int32_t ComputeCallArgc(GateRef gate, EcmaOpcode op);
     GateRef GetValueFromTaggedArray(GateRef arrayGate, GateRef indexOffset);
@@ -274,6 +286,7 @@ private:
     ArgumentAccessor argAcc_;
     CircuitBuilder builder_;
     GateRef dependEntry_;
+    bool lexEnvFixed_ {false};
     bool enableLog_ {false};
 };
 }  // panda::ecmascript::kungfu
@@ -1001,6 +1001,33 @@ inline GateRef Stub::IsDictionaryModeByHClass(GateRef hClass)
         Int32(0));
 }
 
+inline GateRef Stub::IsInSlackTracking(GateRef hClass)
+{
+    GateRef bitfieldOffset = IntPtr(JSHClass::BIT_FIELD_OFFSET);
+    GateRef bitfield = Load(VariableType::INT32(), hClass, bitfieldOffset);
+    return Int32NotEqual(
+        Int32And(
+            Int32LSR(bitfield, Int32(JSHClass::ConstructionCounterBits::START_BIT)),
+            Int32((1LU << JSHClass::ConstructionCounterBits::SIZE) - 1)),
+        Int32(0));
+}
+
+inline GateRef Stub::GetElementsKindFromHClass(GateRef hClass)
+{
+    GateRef bitfieldOffset = IntPtr(JSHClass::BIT_FIELD_OFFSET);
+    GateRef bitfield = Load(VariableType::INT32(), hClass, bitfieldOffset);
+    return Int32And(
+        Int32LSR(bitfield, Int32(JSHClass::ElementsKindBits::START_BIT)),
+        Int32((1LU << JSHClass::ElementsKindBits::SIZE) - 1));
+}
+
+// Elements kinds are bit sets, so the hclass contains the kind if or-ing it in changes nothing.
+inline GateRef Stub::ContainsElementsKind(GateRef hClass, GateRef kind)
+{
+    GateRef hClassKind = GetElementsKindFromHClass(hClass);
+    return Int32Equal(Int32Or(hClassKind, kind), hClassKind);
+}
+
 inline GateRef Stub::IsDictionaryElement(GateRef hClass)
 {
     GateRef bitfieldOffset = IntPtr(JSHClass::BIT_FIELD_OFFSET);
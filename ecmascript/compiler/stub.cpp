@@ -14,8 +14,10 @@
  */
 
 #include "ecmascript/compiler/stub.h"
+#include "ecmascript/builtins/builtins_fast_call.h"
 #include "ecmascript/compiler/llvm_ir_builder.h"
 #include "ecmascript/compiler/stub-inl.h"
+#include "ecmascript/ic/mega_ic_cache.h"
 #include "ecmascript/js_api_arraylist.h"
 #include "ecmascript/js_api_vector.h"
 #include "ecmascript/js_object.h"
@@ -1368,6 +1370,94 @@ GateRef Stub::CheckPolyHClass(GateRef cachedValue, GateRef hclass)
     return ret;
 }
 
+// Same probe as MegaICCache::Get, return hole if neither the primary nor the secondary entry matches.
+GateRef Stub::TryGetMegaICHandler(GateRef glue, GateRef hclass, GateRef key, bool isStore)
+{
+    auto env = GetEnvironment();
+    Label entry(env);
+    env->SubCfgEntry(&entry);
+    Label exit(env);
+    Label primaryHClassMatch(env);
+    Label primaryHit(env);
+    Label primaryMiss(env);
+    Label secondaryHClassMatch(env);
+    Label secondaryHit(env);
+    DEFVARIABLE(result, VariableType::JS_ANY(), Hole());
+    size_t cacheOffset = isStore ? JSThread::GlueData::GetStoreMegaICCacheOffset(env->Is32Bit()) :
+                                   JSThread::GlueData::GetLoadMegaICCacheOffset(env->Is32Bit());
+    GateRef cache = Load(VariableType::NATIVE_POINTER(), glue, IntPtr(cacheOffset));
+    GateRef hclassValue = ChangeTaggedPointerToInt64(hclass);
+    GateRef keyValue = ChangeTaggedPointerToInt64(key);
+    GateRef hclassHash = Int32LSR(TruncInt64ToInt32(hclassValue), Int32(MegaICCache::HASH_SHIFT));
+    GateRef keyHash = Int32LSR(TruncInt64ToInt32(keyValue), Int32(MegaICCache::HASH_SHIFT));
+    GateRef primaryHash = Int32Xor(hclassHash, keyHash);
+    GateRef primaryIndex = Int32And(primaryHash, Int32(MegaICCache::PRIMARY_LENGTH_MASK));
+    GateRef primaryEntry = PtrAdd(cache, PtrAdd(IntPtr(MegaICCache::PRIMARY_OFFSET),
+        PtrMul(ChangeInt32ToIntPtr(primaryIndex), IntPtr(MegaICCache::ENTRY_SIZE))));
+    GateRef primaryHClass = Load(VariableType::INT64(), primaryEntry, IntPtr(MegaICCache::ENTRY_HCLASS_OFFSET));
+    Branch(Int64Equal(primaryHClass, hclassValue), &primaryHClassMatch, &primaryMiss);
+    Bind(&primaryHClassMatch);
+    {
+        GateRef primaryKey = Load(VariableType::INT64(), primaryEntry, IntPtr(MegaICCache::ENTRY_KEY_OFFSET));
+        Branch(Int64Equal(primaryKey, keyValue), &primaryHit, &primaryMiss);
+        Bind(&primaryHit);
+        result = Load(VariableType::JS_ANY(), primaryEntry, IntPtr(MegaICCache::ENTRY_HANDLER_OFFSET));
+        Jump(&exit);
+    }
+    Bind(&primaryMiss);
+    {
+        GateRef secondaryHash = Int32Add(Int32Sub(primaryHash, keyHash),
+            Int32(static_cast<int32_t>(MegaICCache::SECONDARY_SEED)));
+        GateRef secondaryIndex = Int32And(secondaryHash, Int32(MegaICCache::SECONDARY_LENGTH_MASK));
+        GateRef secondaryEntry = PtrAdd(cache, PtrAdd(IntPtr(MegaICCache::SECONDARY_OFFSET),
+            PtrMul(ChangeInt32ToIntPtr(secondaryIndex), IntPtr(MegaICCache::ENTRY_SIZE))));
+        GateRef secondaryHClass = Load(VariableType::INT64(), secondaryEntry,
+            IntPtr(MegaICCache::ENTRY_HCLASS_OFFSET));
+        Branch(Int64Equal(secondaryHClass, hclassValue), &secondaryHClassMatch, &exit);
+        Bind(&secondaryHClassMatch);
+        GateRef secondaryKey = Load(VariableType::INT64(), secondaryEntry, IntPtr(MegaICCache::ENTRY_KEY_OFFSET));
+        Branch(Int64Equal(secondaryKey, keyValue), &secondaryHit, &exit);
+        Bind(&secondaryHit);
+        result = Load(VariableType::JS_ANY(), secondaryEntry, IntPtr(MegaICCache::ENTRY_HANDLER_OFFSET));
+        Jump(&exit);
+    }
+    Bind(&exit);
+    auto ret = *result;
+    env->SubCfgExit();
+    return ret;
+}
+
+// Same as ICRuntimeStub::CanUseMegaICCache, the receiver must be a heap object.
+GateRef Stub::CanUseMegaICCache(GateRef receiver)
+{
+    auto env = GetEnvironment();
+    Label entry(env);
+    env->SubCfgEntry(&entry);
+    Label exit(env);
+    Label isJSObject(env);
+    Label notDictionary(env);
+    Label notTypedArray(env);
+    DEFVARIABLE(result, VariableType::BOOL(), False());
+    Branch(IsJSObject(receiver), &isJSObject, &exit);
+    Bind(&isJSObject);
+    GateRef hclass = LoadHClass(receiver);
+    Branch(IsDictionaryModeByHClass(hclass), &exit, &notDictionary);
+    Bind(&notDictionary);
+    GateRef jsType = GetObjectType(hclass);
+    Branch(BoolAnd(Int32GreaterThan(jsType, Int32(static_cast<int32_t>(JSType::JS_TYPED_ARRAY_BEGIN))),
+                   Int32LessThanOrEqual(jsType, Int32(static_cast<int32_t>(JSType::JS_TYPED_ARRAY_END)))),
+           &exit, &notTypedArray);
+    Bind(&notTypedArray);
+    result = BoolNot(BoolAnd(
+        Int32GreaterThanOrEqual(jsType, Int32(static_cast<int32_t>(JSType::JS_API_ARRAY_LIST))),
+        Int32LessThanOrEqual(jsType, Int32(static_cast<int32_t>(JSType::JS_API_QUEUE)))));
+    Jump(&exit);
+    Bind(&exit);
+    auto ret = *result;
+    env->SubCfgExit();
+    return ret;
+}
+
 GateRef Stub::LoadICWithHandler(GateRef glue, GateRef receiver, GateRef argHolder, GateRef argHandler)
 {
     auto env = GetEnvironment();
@@ -1512,7 +1602,14 @@ GateRef Stub::ICStoreElement(GateRef glue, GateRef receiver, GateRef key, GateRe
             Branch(HandlerBaseIsJSArray(handlerInfo), &handerInfoIsJSArray, &handerInfoNotJSArray);
             Bind(&handerInfoIsJSArray);
             {
+                Label kindContained(env);
                 GateRef oldLength = GetArrayLength(receiver);
+                // storing beyond the length leaves holes, and ElementsKind::HOLE is 1
+                GateRef kind = Int32Or(GetElementsKindOfValue(value),
+                    ZExtInt1ToInt32(Int32GreaterThan(index, oldLength)));
+                // the store needs an elements kind transition, leave it to the runtime
+                Branch(ContainsElementsKind(LoadHClass(receiver), kind), &kindContained, &exit);
+                Bind(&kindContained);
                 Branch(Int32GreaterThanOrEqual(index, oldLength), &indexGreaterLength, &handerInfoNotJSArray);
                 Bind(&indexGreaterLength);
                 Store(VariableType::INT64(), glue, receiver,
@@ -1562,6 +1659,35 @@ GateRef Stub::ICStoreElement(GateRef glue, GateRef receiver, GateRef key, GateRe
     return ret;
 }
 
+GateRef Stub::GetElementsKindOfValue(GateRef value)
+{
+    auto env = GetEnvironment();
+    Label entry(env);
+    env->SubCfgEntry(&entry);
+    Label exit(env);
+    Label isInt(env);
+    Label notInt(env);
+    Label isDouble(env);
+    DEFVARIABLE(result, VariableType::INT32(), Int32(static_cast<int32_t>(ElementsKind::PACKED)));
+    Branch(TaggedIsInt(value), &isInt, &notInt);
+    Bind(&isInt);
+    {
+        result = Int32(static_cast<int32_t>(ElementsKind::PACKED_SMI));
+        Jump(&exit);
+    }
+    Bind(&notInt);
+    Branch(TaggedIsDouble(value), &isDouble, &exit);
+    Bind(&isDouble);
+    {
+        result = Int32(static_cast<int32_t>(ElementsKind::PACKED_DOUBLE));
+        Jump(&exit);
+    }
+    Bind(&exit);
+    auto ret = *result;
+    env->SubCfgExit();
+    return ret;
+}
+
 GateRef Stub::GetArrayLength(GateRef object)
 {
     auto env = GetEnvironment();
@@ -2376,6 +2502,10 @@ GateRef Stub::SetPropertyByIndex(GateRef glue, GateRef receiver, GateRef index,
                     }
                     Bind(&notHole);
                     {
+                        Label kindContained(env);
+                        // the store needs an elements kind transition, leave it to the runtime
+                        Branch(ContainsElementsKind(hclass, GetElementsKindOfValue(value)), &kindContained, &exit);
+                        Bind(&kindContained);
                         SetValueToTaggedArray(VariableType::JS_ANY(), glue, elements, index, value);
                         returnValue = Undefined(VariableType::INT64());
                         Jump(&exit);
@@ -3945,6 +4075,19 @@ GateRef Stub::JSCallDispatch(GateRef glue, GateRef func, GateRef actualNumArgs,
     // 3. call native
     Bind(&methodIsNative);
     {
+        if (mode == JSCallMode::CALL_ARG0 || mode == JSCallMode::CALL_ARG1 || mode == JSCallMode::CALL_ARG2 ||
+            mode == JSCallMode::CALL_WITH_ARGV || mode == JSCallMode::CALL_THIS_WITH_ARGV) {
+            Label isFastCall(env);
+            Label notFastCall(env);
+            GateRef fastValue = CallFastBuiltin(glue, method, actualNumArgs, mode, args);
+            Branch(TaggedIsHole(fastValue), &notFastCall, &isFastCall);
+            Bind(&isFastCall);
+            {
+                result = fastValue;
+                Jump(&exit);
+            }
+            Bind(&notFastCall);
+        }
         GateRef nativeCode = Load(VariableType::NATIVE_POINTER(), method,
             IntPtr(JSMethod::GetBytecodeArrayOffset(env->IsArch32Bit())));
         GateRef newTarget = Undefined();
@@ -4127,6 +4270,73 @@ GateRef Stub::JSCallDispatch(GateRef glue, GateRef func, GateRef actualNumArgs,
     return ret;
 }
 
+// Call the fast call of a native builtin with its tagged arguments, return hole if it has none or it leaves the
+// arguments to the builtin, see BuiltinsFastCall.
+GateRef Stub::CallFastBuiltin(GateRef glue, GateRef method, GateRef actualNumArgs,
+                              JSCallMode mode, std::initializer_list<GateRef> args)
+{
+    auto env = GetEnvironment();
+    Label entryPass(env);
+    env->SubCfgEntry(&entryPass);
+    Label exit(env);
+    DEFVARIABLE(result, VariableType::JS_ANY(), Hole());
+    GateRef literalInfo = Load(VariableType::INT64(), method,
+        IntPtr(JSMethod::GetLiteralInfoOffset(env->IsArch32Bit())));
+    GateRef builtinId = TruncInt64ToInt32(Int64And(Int64LSR(literalInfo, Int64(JSMethod::BuiltinIdBits::START_BIT)),
+        Int64((1LLU << JSMethod::BuiltinIdBits::SIZE) - 1)));
+    Label hasFastCall(env);
+    Branch(Int32Equal(builtinId, Int32(builtins::BuiltinsFastCall::NONE)), &exit, &hasFastCall);
+    Bind(&hasFastCall);
+    auto data = std::begin(args);
+    DEFVARIABLE(thisValue, VariableType::JS_ANY(), Undefined());
+    DEFVARIABLE(arg0, VariableType::JS_ANY(), Undefined());
+    DEFVARIABLE(arg1, VariableType::JS_ANY(), Undefined());
+    Label callFastBuiltin(env);
+    switch (mode) {
+        case JSCallMode::CALL_ARG0:
+            Jump(&callFastBuiltin);
+            break;
+        case JSCallMode::CALL_ARG1:
+            arg0 = data[0];
+            Jump(&callFastBuiltin);
+            break;
+        case JSCallMode::CALL_ARG2:
+            arg0 = data[0];
+            arg1 = data[1];
+            Jump(&callFastBuiltin);
+            break;
+        case JSCallMode::CALL_THIS_WITH_ARGV:
+            thisValue = data[2]; // 2: this input
+            [[fallthrough]];
+        case JSCallMode::CALL_WITH_ARGV: {
+            // the args are read from the registers of the caller, which hold at most MAX_ARGS of them
+            Label fewArgs(env);
+            Label hasArg0(env);
+            Label hasArg1(env);
+            Branch(Int32GreaterThan(actualNumArgs, Int32(builtins::BuiltinsFastCall::MAX_ARGS)), &exit, &fewArgs);
+            Bind(&fewArgs);
+            Branch(Int32GreaterThan(actualNumArgs, Int32(0)), &hasArg0, &callFastBuiltin);
+            Bind(&hasArg0);
+            arg0 = Load(VariableType::JS_ANY(), data[1], IntPtr(0));
+            Branch(Int32GreaterThan(actualNumArgs, Int32(1)), &hasArg1, &callFastBuiltin);
+            Bind(&hasArg1);
+            arg1 = Load(VariableType::JS_ANY(), data[1], IntPtr(JSTaggedValue::TaggedTypeSize()));
+            Jump(&callFastBuiltin);
+            break;
+        }
+        default:
+            UNREACHABLE();
+    }
+    Bind(&callFastBuiltin);
+    result = UpdateLeaveFrameAndCallNGCRuntime(glue, RTSTUB_ID(CallFastBuiltin),
+        { glue, builtinId, *thisValue, actualNumArgs, *arg0, *arg1 });
+    Jump(&exit);
+    Bind(&exit);
+    auto ret = *result;
+    env->SubCfgExit();
+    return ret;
+}
+
 GateRef Stub::TryStringOrSymbelToElementIndex(GateRef key)
 {
     auto env = GetEnvironment();
@@ -240,6 +240,9 @@ public:
     GateRef GetObjectType(GateRef hClass);
     GateRef IsDictionaryMode(GateRef object);
     GateRef IsDictionaryModeByHClass(GateRef hClass);
+    GateRef IsInSlackTracking(GateRef hClass);
+    GateRef GetElementsKindFromHClass(GateRef hClass);
+    GateRef ContainsElementsKind(GateRef hClass, GateRef kind);
     GateRef IsDictionaryElement(GateRef hClass);
     GateRef IsClassConstructorFromBitField(GateRef bitfield);
     GateRef IsClassConstructor(GateRef object);
@@ -347,12 +350,15 @@ public:
     GateRef LoadElement(GateRef receiver, GateRef key);
     GateRef TryToElementsIndex(GateRef glue, GateRef key);
     GateRef CheckPolyHClass(GateRef cachedValue, GateRef hclass);
+    GateRef TryGetMegaICHandler(GateRef glue, GateRef hclass, GateRef key, bool isStore);
+    GateRef CanUseMegaICCache(GateRef receiver);
     GateRef LoadICWithHandler(GateRef glue, GateRef receiver, GateRef holder, GateRef handler);
     GateRef StoreICWithHandler(GateRef glue, GateRef receiver, GateRef holder,
                                  GateRef value, GateRef handler);
     GateRef ICStoreElement(GateRef glue, GateRef receiver, GateRef key,
                              GateRef value, GateRef handlerInfo);
     GateRef GetArrayLength(GateRef object);
+    GateRef GetElementsKindOfValue(GateRef value);
     GateRef DoubleToInt(GateRef glue, GateRef x);
     void StoreField(GateRef glue, GateRef receiver, GateRef value, GateRef handler);
     void StoreWithTransition(GateRef glue, GateRef receiver, GateRef value, GateRef handler);
@@ -467,6 +473,8 @@ public:
     GateRef CallGetterHelper(GateRef glue, GateRef receiver, GateRef holder, GateRef accessor);
     GateRef JSCallDispatch(GateRef glue, GateRef func, GateRef actualNumArgs,
                            JSCallMode mode, std::initializer_list<GateRef> args);
+    GateRef CallFastBuiltin(GateRef glue, GateRef method, GateRef actualNumArgs,
+                            JSCallMode mode, std::initializer_list<GateRef> args);
     GateRef IsFastTypeArray(GateRef jsType);
     GateRef GetTypeArrayPropertyByName(GateRef glue, GateRef receiver, GateRef holder, GateRef key, GateRef jsType);
     GateRef SetTypeArrayPropertyByName(GateRef glue, GateRef receiver, GateRef holder, GateRef key, GateRef value,
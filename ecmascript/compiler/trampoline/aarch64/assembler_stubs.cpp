@@ -1723,7 +1723,10 @@ void AssemblerStubs::CallBCStub(ExtendedAssembler *assembler, Register &newSp, R
     __ Mov(Register(X20), pc);      // X20 - pc
     __ Ldr(Register(X21), MemoryOperand(callTarget, JSFunction::CONSTANT_POOL_OFFSET));     // X21 - constantpool
     __ Ldr(Register(X22), MemoryOperand(callTarget, JSFunction::PROFILE_TYPE_INFO_OFFSET)); // X22 - profileTypeInfo
-    __ Mov(Register(X23), Immediate(JSTaggedValue::Hole().GetRawData()));                   // X23 - acc
+    // the resumed frame holds the acc of the suspended generator or the deoptimized method
+    int64_t accOffset = static_cast<int64_t>(AsmInterpretedFrame::GetAccOffset(false))
+        - static_cast<int64_t>(AsmInterpretedFrame::GetSize(false));
+    __ Ldur(Register(X23), MemoryOperand(newSp, accOffset));                                // X23 - acc
     __ Ldr(Register(X24), MemoryOperand(method, JSMethod::GetHotnessCounterOffset(false))); // X24 - hotnessCounter
 
     // call the first bytecode handler
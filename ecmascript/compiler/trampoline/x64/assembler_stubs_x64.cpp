@@ -1144,7 +1144,10 @@ void AssemblerStubsX64::CallBCStub(ExtendedAssembler *assembler, Register newSpR
                                      // %r12 - pc
         __ Movq(Operand(callTargetRegister, JSFunction::CONSTANT_POOL_OFFSET), rbx);       // rbx - constantpool
         __ Movq(Operand(callTargetRegister, JSFunction::PROFILE_TYPE_INFO_OFFSET), r14);   // r14 - profileTypeInfo
-        __ Movq(JSTaggedValue::Hole().GetRawData(), rsi);                                  // rsi - acc
+        // the resumed frame holds the acc of the suspended generator or the deoptimized method
+        int32_t accOffset = static_cast<int32_t>(AsmInterpretedFrame::GetAccOffset(false))
+            - static_cast<int32_t>(AsmInterpretedFrame::GetSize(false));
+        __ Movq(Operand(newSpRegister, accOffset), rsi);                                   // rsi - acc
         __ Movzwq(Operand(methodRegister, JSMethod::GetHotnessCounterOffset(false)), rdi); // rdi - hotnessCounter
 
         // call the first bytecode handler
@@ -15,10 +15,19 @@
 
 #include "ecmascript/compiler/type_lowering.h"
 
+#include "ecmascript/mem/c_string.h"
+
 namespace panda::ecmascript::kungfu {
 void TypeLowering::RunTypeLowering()
 {
     const auto &gateList = circuit_->GetAllGates();
+    // the frame states are renamed from the bytecodes, so they are built before any bytecode gate is replaced
+    for (const auto &gate : gateList) {
+        auto op = circuit_->GetOpCode(gate);
+        if (op == OpCode::JS_BYTECODE && bcBuilder_->GetByteCodeOpcode(gate) == LDOBJBYNAME_PREF_ID32_V8) {
+            LowerProfiledLdObjByName(gate, bcBuilder_->GetJSBytecode(gate));
+        }
+    }
     for (const auto &gate : gateList) {
         auto op = circuit_->GetOpCode(gate);
         if (op == OpCode::JS_BYTECODE) {
@@ -45,6 +54,10 @@ void TypeLowering::Lower(GateRef gate)
         case NEWOBJDYNRANGE_PREF_IMM16_V8:
             LowerTypeNewObjDynRange(gate, glue);
             break;
+        case LDOBJBYVALUE_PREF_V8_V8:
+        case STOBJBYVALUE_PREF_V8_V8:
+            LowerTypedElementAccess(gate, pc);
+            break;
         default:
             break;
     }
@@ -126,4 +139,54 @@ void TypeLowering::LowerTypeNewObjDynRange(GateRef gate, GateRef glue)
     GateRef newGate = LowerCallRuntime(glue, id, args);
     ReplaceHirToCall(gate, newGate);
 }
+
+void TypeLowering::LowerProfiledLdObjByName(GateRef gate, const uint8_t *pc)
+{
+    if (methodProfile_ == nullptr) {
+        return;
+    }
+    // the translator replaced the prefix of the bytecode with its ic slot
+    uint32_t slotId = pc[1];
+    const PGOSiteProfile *site = methodProfile_->FindSite(slotId);
+    if (site == nullptr || site->state != ProfileTypeAccessor::ICState::MONO || site->layouts.size() != 1 ||
+        site->layouts[0].isDictionary) {
+        return;
+    }
+    size_t stringIndex = acc_.GetBitField(acc_.GetValueIn(gate, 0));
+    JSHandle<EcmaString> name = tsLoader_->GetStringById(stringIndex);
+    std::string key = CstringConvertToStdString(ConvertToString(*name, StringConvertedUsage::LOGICOPERATION));
+    int32_t entry = site->layouts[0].FindEntry(key);
+    if (entry < 0) {
+        return;
+    }
+    const PGOLayoutEntry &layoutEntry = site->layouts[0].entries[entry];
+    if (!layoutEntry.isInlined || layoutEntry.isAccessor) {
+        return;
+    }
+    bcBuilder_->SetProfiledLayoutEntry(pc, static_cast<uint32_t>(entry));
+    // with a frame state the layout check deopts instead of falling back to the generic load
+    bool speculative = enableSpeculation_ && bcBuilder_->NewFrameState(gate) != Circuit::NullGate();
+    if (IsLogEnabled()) {
+        LOG_COMPILER(INFO) << "load of " << key << " is profiled at layout entry " << entry
+                           << (speculative ? ", speculatively" : "");
+    }
+}
+
+void TypeLowering::LowerTypedElementAccess(GateRef gate, const uint8_t *pc)
+{
+    GateType receiverType = acc_.GetGateType(acc_.GetValueIn(gate, 0));
+    if (!receiverType.IsTSType() || !receiverType.IsArrayTypeKind()) {
+        return;
+    }
+    TypedElementAccess access;
+    GateType elementType(tsLoader_->GetArrayParameterTypeGT(receiverType));
+    access.isNumberElement = elementType.IsNumberType();
+    access.isInBounds = rangeAnalysis_.IsKeyInBounds(gate);
+    bcBuilder_->SetTypedElementAccess(pc, access);
+    if (IsLogEnabled()) {
+        LOG_COMPILER(INFO) << "element access of gate " << acc_.GetId(gate)
+                           << (access.isNumberElement ? " on numbers" : "")
+                           << (access.isInBounds ? " is in bounds" : " is checked");
+    }
+}
 }  // namespace panda::ecmascript
@@ -22,16 +22,19 @@
 #include "ecmascript/compiler/circuit_builder.h"
 #include "ecmascript/compiler/circuit_builder-inl.h"
 #include "ecmascript/compiler/gate_accessor.h"
+#include "ecmascript/compiler/range_analysis.h"
+#include "ecmascript/pgo/pgo_profile.h"
 #include "ecmascript/ts_types/ts_loader.h"
 
 namespace panda::ecmascript::kungfu {
 class TypeLowering {
 public:
     TypeLowering(BytecodeCircuitBuilder *bcBuilder, Circuit *circuit, CompilationConfig *cmpCfg, TSLoader *tsLoader,
-                 bool enableLog)
+                 bool enableLog, const PGOMethodProfile *methodProfile = nullptr, bool enableSpeculation = false)
         : bcBuilder_(bcBuilder), circuit_(circuit), acc_(circuit), builder_(circuit, cmpCfg),
           dependEntry_(Circuit::GetCircuitRoot(OpCode(OpCode::DEPEND_ENTRY))), tsLoader_(tsLoader),
-          enableLog_(enableLog) {}
+          rangeAnalysis_(bcBuilder, circuit, tsLoader), methodProfile_(methodProfile), enableLog_(enableLog),
+          enableSpeculation_(enableSpeculation) {}
     ~TypeLowering() = default;
 
     void RunTypeLowering();
@@ -50,13 +53,20 @@ private:
 
     void LowerTypeNewObjDynRange(GateRef gate, GateRef glue);
 
+    void LowerProfiledLdObjByName(GateRef gate, const uint8_t *pc);
+
+    void LowerTypedElementAccess(GateRef gate, const uint8_t *pc);
+
     BytecodeCircuitBuilder *bcBuilder_;
     Circuit *circuit_;
     GateAccessor acc_;
     CircuitBuilder builder_;
     GateRef dependEntry_;
     TSLoader *tsLoader_ {nullptr};
+    RangeAnalysis rangeAnalysis_;
+    const PGOMethodProfile *methodProfile_ {nullptr};
     bool enableLog_ {false};
+    bool enableSpeculation_ {false};
 };
 }  // panda::ecmascript::kungfu
 #endif  // ECMASCRIPT_COMPILER_TYPE_LOWERING_H
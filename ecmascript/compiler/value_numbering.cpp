@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/compiler/value_numbering.h"
+
+namespace panda::ecmascript::kungfu {
+void ValueNumbering::Run()
+{
+    std::vector<GateRef> gateList = circuit_->GetAllGates();
+    for (const auto &gate : gateList) {
+        if (acc_.GetOpCode(gate).IsPure()) {
+            VisitGate(gate);
+        }
+    }
+    for (const auto &gate : gateList) {
+        if (acc_.GetOpCode(gate) == OpCode::LOAD) {
+            EliminateLoad(gate);
+        }
+    }
+    if (IsLogEnabled()) {
+        LOG_COMPILER(INFO) << "ValueNumbering merged " << mergedGates_ << " gates and eliminated "
+                           << eliminatedLoads_ << " loads";
+    }
+}
+
+void ValueNumbering::VisitGate(GateRef gate)
+{
+    if (!visited_.insert(gate).second) {
+        return;
+    }
+    // the inputs are numbered first, so the key of the gate has the merged inputs
+    for (const auto &in : circuit_->GetInVector(gate)) {
+        if (acc_.GetOpCode(in).IsPure()) {
+            VisitGate(in);
+        }
+    }
+    if (IsDerivedPointer(gate)) {
+        return;
+    }
+    auto result = table_.emplace(GetKey(gate), gate);
+    if (!result.second) {
+        ReplaceGate(gate, result.first->second);
+        mergedGates_++;
+    }
+}
+
+void ValueNumbering::EliminateLoad(GateRef gate)
+{
+    GateRef addr = acc_.GetValueIn(gate, 0);
+    GateRef dep = acc_.GetDep(gate);
+    for (size_t distance = 0; distance < MAX_LOAD_DISTANCE; distance++) {
+        if (acc_.GetOpCode(dep) != OpCode::LOAD) {
+            return;
+        }
+        if (acc_.GetMachineType(dep) == acc_.GetMachineType(gate) &&
+            acc_.GetGateType(dep).GetType() == acc_.GetGateType(gate).GetType() &&
+            IsSameValue(acc_.GetValueIn(dep, 0), addr)) {
+            ReplaceGate(gate, dep);
+            eliminatedLoads_++;
+            return;
+        }
+        dep = acc_.GetDep(dep);
+    }
+}
+
+ValueNumbering::GateKey ValueNumbering::GetKey(GateRef gate) const
+{
+    return GateKey {acc_.GetOpCode(gate), acc_.GetMachineType(gate), acc_.GetBitField(gate),
+                    acc_.GetGateType(gate).GetType(), circuit_->GetInVector(gate)};
+}
+
+bool ValueNumbering::IsSameValue(GateRef lhs, GateRef rhs) const
+{
+    if (lhs == rhs) {
+        return true;
+    }
+    // the addresses of loads are derived pointers, which are compared by their keys instead of being merged
+    OpCode op = acc_.GetOpCode(lhs);
+    if (op != acc_.GetOpCode(rhs) || !(op.IsPure() || op == OpCode::CONSTANT)) {
+        return false;
+    }
+    return GetKey(lhs) == GetKey(rhs);
+}
+
+bool ValueNumbering::IsDerivedPointer(GateRef gate) const
+{
+    // a raw address computed from a tagged pointer is not relocated by the gc, so a merged one must not live
+    // across the calls between its uses
+    switch (acc_.GetOpCode(gate)) {
+        case OpCode::ADD:
+        case OpCode::SUB:
+        case OpCode::BITCAST:
+        case OpCode::TAGGED_TO_INT64:
+            break;
+        default:
+            return false;
+    }
+    auto mayBePointer = [](GateType type) {
+        return type.GetType() != GateType::NJSValue().GetType() &&
+               type.GetType() != GateType::TaggedNPointer().GetType() &&
+               type.GetType() != GateType::Empty().GetType();
+    };
+    if (mayBePointer(acc_.GetGateType(gate))) {
+        return false;
+    }
+    for (const auto &in : circuit_->GetInVector(gate)) {
+        if (mayBePointer(acc_.GetGateType(in))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ValueNumbering::ReplaceGate(GateRef gate, GateRef replacement)
+{
+    auto uses = acc_.Uses(gate);
+    for (auto useIt = uses.begin(); useIt != uses.end(); useIt++) {
+        if (acc_.IsDependIn(useIt)) {
+            acc_.ReplaceIn(useIt, acc_.GetDep(gate));
+        } else {
+            acc_.ReplaceIn(useIt, replacement);
+        }
+    }
+    acc_.DeleteGate(gate);
+}
+}  // namespace panda::ecmascript::kungfu
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_COMPILER_VALUE_NUMBERING_H
+#define ECMASCRIPT_COMPILER_VALUE_NUMBERING_H
+
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ecmascript/compiler/circuit.h"
+#include "ecmascript/compiler/gate_accessor.h"
+
+namespace panda::ecmascript::kungfu {
+// ValueNumbering merges the pure gates computing the same value from the same inputs, which the scheduler then
+// places at the common dominator of their uses, and replaces a load by an earlier load of the same address when
+// only loads are between them on the depend chain.
+class ValueNumbering {
+public:
+    ValueNumbering(Circuit *circuit, bool enableLog)
+        : circuit_(circuit), acc_(circuit), enableLog_(enableLog) {}
+    ~ValueNumbering() = default;
+    NO_COPY_SEMANTIC(ValueNumbering);
+    NO_MOVE_SEMANTIC(ValueNumbering);
+
+    void Run();
+
+    // the loads walked back from a load to find an earlier one
+    static constexpr size_t MAX_LOAD_DISTANCE = 16;
+
+private:
+    struct GateKey {
+        OpCode::Op op;
+        MachineType machineType;
+        BitField bitField;
+        uint32_t type;
+        std::vector<GateRef> ins;
+
+        bool operator==(const GateKey &other) const
+        {
+            return op == other.op && machineType == other.machineType && bitField == other.bitField &&
+                   type == other.type && ins == other.ins;
+        }
+    };
+
+    struct GateKeyHash {
+        size_t operator()(const GateKey &key) const
+        {
+            size_t hash = std::hash<uint64_t>()(key.bitField);
+            auto combine = [&hash](size_t value) {
+                hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);  // 6, 2: the shifts of boost hash_combine
+            };
+            combine(static_cast<size_t>(key.op));
+            combine(static_cast<size_t>(key.machineType));
+            combine(key.type);
+            for (auto in : key.ins) {
+                combine(std::hash<GateRef>()(in));
+            }
+            return hash;
+        }
+    };
+
+    bool IsLogEnabled() const
+    {
+        return enableLog_;
+    }
+
+    void VisitGate(GateRef gate);
+    void EliminateLoad(GateRef gate);
+    GateKey GetKey(GateRef gate) const;
+    bool IsSameValue(GateRef lhs, GateRef rhs) const;
+    bool IsDerivedPointer(GateRef gate) const;
+    void ReplaceGate(GateRef gate, GateRef replacement);
+
+    Circuit *circuit_;
+    GateAccessor acc_;
+    bool enableLog_ {false};
+    size_t mergedGates_ {0};
+    size_t eliminatedLoads_ {0};
+    std::unordered_set<GateRef> visited_ {};
+    std::unordered_map<GateKey, GateRef, GateKeyHash> table_ {};
+};
+}  // panda::ecmascript::kungfu
+#endif  // ECMASCRIPT_COMPILER_VALUE_NUMBERING_H
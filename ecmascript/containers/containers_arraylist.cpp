@@ -483,6 +483,8 @@ JSTaggedValue ContainersArrayList::ConvertToArray(EcmaRuntimeCallInfo *argv)
     JSHandle<TaggedArray> newElements =
         thread->GetEcmaVM()->GetFactory()->CopyArray(arrayListElements, arrayListCapacity, arrayListCapacity);
     array->SetElements(thread, newElements);
+    JSHClass::TransitionElementsKind(thread, JSHandle<JSObject>(array),
+                                     Elements::ComputeElementsKind(*newElements, length));
     return array.GetTaggedValue();
 }
 
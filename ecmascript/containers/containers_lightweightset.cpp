@@ -348,6 +348,8 @@ JSTaggedValue ContainersLightWeightSet::ToArray(EcmaRuntimeCallInfo *argv)
     JSHandle<TaggedArray> newElements =
         thread->GetEcmaVM()->GetFactory()->CopyArray(valueArray, capacity, capacity);
     array->SetElements(thread, newElements);
+    JSHClass::TransitionElementsKind(thread, JSHandle<JSObject>(array),
+                                     Elements::ComputeElementsKind(*newElements, length));
     return array.GetTaggedValue();
 }
 
@@ -566,6 +566,8 @@ JSTaggedValue ContainersVector::CopyToArray(EcmaRuntimeCallInfo *argv)
     uint32_t sumLength = static_cast<uint32_t>(vector->GetSize()) + jsArray->GetArrayLength();
     jsArray->SetArrayLength(thread, sumLength);
     jsArray->SetElements(thread, resultArray);
+    JSHClass::TransitionElementsKind(thread, JSHandle<JSObject>(jsArray),
+                                     Elements::ComputeElementsKind(*resultArray, sumLength));
     
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
     return JSTaggedValue::True();
@@ -594,6 +596,8 @@ JSTaggedValue ContainersVector::ConvertToArray(EcmaRuntimeCallInfo *argv)
         thread->GetEcmaVM()->GetFactory()->CopyArray(vectorElements, vectorCapacity, vectorCapacity);
 
     array->SetElements(thread, newElements);
+    JSHClass::TransitionElementsKind(thread, JSHandle<JSObject>(array),
+                                     Elements::ComputeElementsKind(*newElements, length));
     return array.GetTaggedValue();
 }
 
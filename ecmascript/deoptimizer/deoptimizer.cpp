@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/deoptimizer/deoptimizer.h"
+
+#include "ecmascript/ecma_vm.h"
+#include "ecmascript/frames.h"
+#include "ecmascript/interpreter/interpreter-inl.h"
+#include "ecmascript/js_function.h"
+#include "ecmascript/js_generator_object.h"
+#include "ecmascript/object_factory.h"
+#include "libpandafile/bytecode_instruction-inl.h"
+
+namespace panda::ecmascript {
+Deoptimizer::Deoptimizer(EcmaVM *vm) : threshold_(vm->GetJSOptions().GetDeoptThreshold()) {}
+
+JSTaggedValue Deoptimizer::Deoptimize(JSThread *thread)
+{
+    [[maybe_unused]] EcmaHandleScope handleScope(thread);
+    JSTaggedType *current = const_cast<JSTaggedType *>(thread->GetLastLeaveFrame());
+    FrameIterator it(current, thread);
+    ASSERT(it.GetFrameType() == FrameType::LEAVE_FRAME);
+    it.Advance();
+    ASSERT(it.GetFrameType() == FrameType::OPTIMIZED_JS_FUNCTION_FRAME);
+    std::vector<JSTaggedType> values;
+    if (!it.CollectDeoptValues(values) || values.size() < static_cast<size_t>(FrameStateIndex::FIRST_REGISTER)) {
+        LOG_ECMA(FATAL) << "No frame state is recorded for the deopt call returning to " << std::hex
+                        << it.GetOptimizedReturnAddr();
+        UNREACHABLE();
+    }
+    JSTaggedValue env = it.GetFrame<OptimizedJSFunctionFrame>()->GetEnv();
+    JSHandle<GeneratorContext> context = NewContext(thread, values, env);
+    JSMethod *method = JSFunction::Cast(context->GetMethod().GetTaggedObject())->GetCallTarget();
+    RecordDeopt(method);
+    return EcmaInterpreter::ReEnterInterpreter(thread, context);
+}
+
+bool Deoptimizer::RecordDeopt(JSMethod *method)
+{
+    uint32_t count = ++deoptCounts_[method];
+    if (count < threshold_ || !method->IsAotWithCallField()) {
+        return false;
+    }
+    // the closures keep their code entry, the calls check the method before they enter it
+    method->SetAotCodeBit(false);
+    LOG_ECMA(INFO) << "Invalidate the aot code of " << method->GetMethodName() << " after " << count << " deopts";
+    return true;
+}
+
+JSHandle<GeneratorContext> Deoptimizer::NewContext(JSThread *thread, const std::vector<JSTaggedType> &values,
+                                                   JSTaggedValue env)
+{
+    JSHandle<JSTaggedValue> func(thread, JSTaggedValue(values[static_cast<size_t>(FrameStateIndex::FUNC)]));
+    JSHandle<JSTaggedValue> acc(thread, JSTaggedValue(values[static_cast<size_t>(FrameStateIndex::ACC)]));
+    JSHandle<JSTaggedValue> lexicalEnv(thread, env);
+    size_t firstRegister = static_cast<size_t>(FrameStateIndex::FIRST_REGISTER);
+    uint32_t nregs = static_cast<uint32_t>(values.size() - firstRegister);
+    std::vector<JSHandle<JSTaggedValue>> regs;
+    regs.reserve(nregs);
+    for (uint32_t i = 0; i < nregs; i++) {
+        regs.emplace_back(thread, JSTaggedValue(values[firstRegister + i]));
+    }
+
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<TaggedArray> regsArray = factory->NewTaggedArray(nregs);
+    for (uint32_t i = 0; i < nregs; i++) {
+        regsArray->Set(thread, i, regs[i].GetTaggedValue());
+    }
+    JSHandle<GeneratorContext> context = factory->NewGeneratorContext();
+    context->SetRegsArray(thread, regsArray.GetTaggedValue());
+    context->SetMethod(thread, func.GetTaggedValue());
+    context->SetAcc(thread, acc.GetTaggedValue());
+    context->SetLexicalEnv(thread, lexicalEnv.GetTaggedValue());
+    context->SetNRegs(nregs);
+    // the interpreters resume a context after the suspending bytecode, which is skipped here
+    uint32_t pcOffset = static_cast<uint32_t>(values[static_cast<size_t>(FrameStateIndex::PC_OFFSET)]);
+    uint32_t skippedSize = BytecodeInstruction::Size(BytecodeInstruction::Format::PREF_V8_V8);
+    ASSERT(pcOffset >= skippedSize);
+    context->SetBCOffset(pcOffset - skippedSize);
+    return context;
+}
+}  // namespace panda::ecmascript
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_DEOPTIMIZER_DEOPTIMIZER_H
+#define ECMASCRIPT_DEOPTIMIZER_DEOPTIMIZER_H
+
+#include <vector>
+
+#include "ecmascript/js_handle.h"
+#include "ecmascript/js_tagged_value.h"
+#include "ecmascript/mem/c_containers.h"
+
+namespace panda::ecmascript {
+class EcmaVM;
+class GeneratorContext;
+class JSMethod;
+class JSThread;
+
+// The values of the frame state of a deopt call, in the order of its deopt bundle: the index of the bytecode,
+// which is the first constant of every call like the other calls of the compiled code, the offset of the bytecode
+// to resume at, the function, the acc and the registers of the interpreted frame, locals first.
+enum class FrameStateIndex : size_t {
+    BC_INDEX = 0,
+    PC_OFFSET,
+    FUNC,
+    ACC,
+    FIRST_REGISTER,
+};
+
+// Deoptimizer leaves the speculative code of an aot compiled method when one of its speculations fails. The frame
+// state of the failing bytecode is read from the stackmap of the deopt call and turned into a generator context,
+// which resumes the method in the interpreter at that bytecode. A method that deoptimizes "deopt-threshold" times
+// loses its aot code, so its later calls run in the interpreter.
+class Deoptimizer {
+public:
+    explicit Deoptimizer(EcmaVM *vm);
+    ~Deoptimizer() = default;
+    NO_COPY_SEMANTIC(Deoptimizer);
+    NO_MOVE_SEMANTIC(Deoptimizer);
+
+    // Called by the DeoptHandler runtime stub, the optimized frame of the method is the caller of the stub.
+    JSTaggedValue Deoptimize(JSThread *thread);
+
+    // Count a deopt of the method, and return true if its aot code has been invalidated by it.
+    bool RecordDeopt(JSMethod *method);
+
+    uint32_t GetDeoptCount(JSMethod *method) const
+    {
+        auto iter = deoptCounts_.find(method);
+        return iter == deoptCounts_.end() ? 0 : iter->second;
+    }
+
+    // The values are raw and are not visited by the gc, so they are put in handles before anything is allocated.
+    static JSHandle<GeneratorContext> NewContext(JSThread *thread, const std::vector<JSTaggedType> &values,
+                                                 JSTaggedValue env);
+
+private:
+    uint32_t threshold_ {0};
+    CUnorderedMap<JSMethod *, uint32_t> deoptCounts_ {};
+};
+}  // namespace panda::ecmascript
+#endif  // ECMASCRIPT_DEOPTIMIZER_DEOPTIMIZER_H
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/dfx/vmstat/bytecode_profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#include "ecmascript/interpreter/interpreter-inl.h"
+#include "ecmascript/js_method.h"
+#include "ecmascript/jspandafile/js_pandafile.h"
+
+namespace panda::ecmascript {
+void BytecodeProfiler::CountBytecode(uint8_t opcode, const JSMethod *method, DispatchState *state)
+{
+    uint64_t now = GetCurrentTimeInNs();
+    if (state->opcode < OPCODE_COUNT) {
+        opcodeTimes_[state->opcode] += now - state->startTime;
+    }
+    state->opcode = opcode;
+    state->startTime = now;
+    currentOpcode_ = opcode;
+    opcodeCounts_[opcode]++;
+
+    if (method != lastMethod_) {
+        MethodStat &stat = methodStats_[method];
+        if (stat.name.empty()) {
+            stat.name = GetMethodName(method);
+        }
+        lastMethod_ = method;
+        lastMethodStat_ = &stat;
+    }
+    lastMethodStat_->bytecodes++;
+}
+
+void BytecodeProfiler::CountICMiss(const JSMethod *method, uint32_t slotId, ICKind kind)
+{
+    ICMissStat &stat = icMissStats_[std::make_pair(method, slotId)];
+    if (stat.name.empty()) {
+        stat.name = GetMethodName(method);
+        stat.kind = kind;
+    }
+    stat.misses++;
+}
+
+void BytecodeProfiler::Clear()
+{
+    currentOpcode_ = OPCODE_COUNT;
+    opcodeCounts_.fill(0);
+    opcodeTimes_.fill(0);
+    slowPathCounts_.fill(0);
+    lastMethod_ = nullptr;
+    lastMethodStat_ = nullptr;
+    methodStats_.clear();
+    icMissStats_.clear();
+}
+
+uint64_t BytecodeProfiler::GetICMissCount() const
+{
+    uint64_t misses = 0;
+    for (const auto &iter : icMissStats_) {
+        misses += iter.second.misses;
+    }
+    return misses;
+}
+
+std::string BytecodeProfiler::Dump() const
+{
+    std::ostringstream out;
+    uint64_t total = 0;
+    std::vector<uint32_t> opcodes;
+    for (uint32_t opcode = 0; opcode < OPCODE_COUNT; opcode++) {
+        if (opcodeCounts_[opcode] != 0) {
+            total += opcodeCounts_[opcode];
+            opcodes.emplace_back(opcode);
+        }
+    }
+    std::stable_sort(opcodes.begin(), opcodes.end(), [this](uint32_t a, uint32_t b) {
+        return opcodeCounts_[a] > opcodeCounts_[b];
+    });
+    static constexpr int NAME_WIDTH = 50;
+    static constexpr int COUNT_WIDTH = 14;
+    out << "Bytecodes: " << total << "\n";
+    out << std::left << std::setw(NAME_WIDTH) << "Opcode" << std::right << std::setw(COUNT_WIDTH) << "Count"
+        << std::setw(COUNT_WIDTH) << "Time(us)" << std::setw(COUNT_WIDTH) << "SlowPaths" << "\n";
+    for (uint32_t opcode : opcodes) {
+        out << std::left << std::setw(NAME_WIDTH) << GetEcmaOpcodeStr(static_cast<EcmaOpcode>(opcode))
+            << std::right << std::setw(COUNT_WIDTH) << opcodeCounts_[opcode]
+            << std::setw(COUNT_WIDTH) << opcodeTimes_[opcode] / 1000  // 1000: ns to us
+            << std::setw(COUNT_WIDTH) << slowPathCounts_[opcode] << "\n";
+    }
+
+    std::vector<const MethodStat *> methods;
+    for (const auto &iter : methodStats_) {
+        methods.emplace_back(&iter.second);
+    }
+    std::stable_sort(methods.begin(), methods.end(), [](const MethodStat *a, const MethodStat *b) {
+        return a->bytecodes > b->bytecodes;
+    });
+    out << "\n" << std::left << std::setw(NAME_WIDTH) << "Method" << std::right << std::setw(COUNT_WIDTH)
+        << "Bytecodes" << "\n";
+    for (const MethodStat *stat : methods) {
+        out << std::left << std::setw(NAME_WIDTH) << stat->name << std::right << std::setw(COUNT_WIDTH)
+            << stat->bytecodes << "\n";
+    }
+
+    std::vector<std::pair<uint32_t, const ICMissStat *>> sites;
+    for (const auto &iter : icMissStats_) {
+        sites.emplace_back(iter.first.second, &iter.second);
+    }
+    std::stable_sort(sites.begin(), sites.end(), [](const auto &a, const auto &b) {
+        return a.second->misses > b.second->misses;
+    });
+    out << "\n" << std::left << std::setw(NAME_WIDTH) << "IC site" << std::setw(COUNT_WIDTH) << "Kind"
+        << std::right << std::setw(COUNT_WIDTH) << "Misses" << "\n";
+    for (const auto &[slotId, stat] : sites) {
+        out << std::left << std::setw(NAME_WIDTH) << stat->name + " slot " + std::to_string(slotId)
+            << std::setw(COUNT_WIDTH) << ICKindToString(stat->kind) << std::right << std::setw(COUNT_WIDTH)
+            << stat->misses << "\n";
+    }
+    return out.str();
+}
+
+std::string BytecodeProfiler::GetMethodName(const JSMethod *method)
+{
+    std::string name = method->ParseFunctionName();
+    if (name.empty()) {
+        name = "anonymous";
+    }
+    const JSPandaFile *jsPandaFile = method->GetJSPandaFile();
+    if (jsPandaFile != nullptr) {
+        name += "@" + std::string(jsPandaFile->GetJSPandaFileDesc().c_str());
+    }
+    return name;
+}
+
+uint64_t BytecodeProfiler::GetCurrentTimeInNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+}  // namespace panda::ecmascript
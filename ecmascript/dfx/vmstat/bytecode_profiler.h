@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_DFX_VMSTAT_BYTECODE_PROFILER_H
+#define ECMASCRIPT_DFX_VMSTAT_BYTECODE_PROFILER_H
+
+#include <array>
+#include <map>
+#include <string>
+#include <unordered_map>
+
+#include "ecmascript/ic/profile_type_info.h"
+#include "libpandabase/macros.h"
+
+namespace panda::ecmascript {
+class JSMethod;
+
+// BytecodeProfiler counts the bytecodes the interpreter runs, by opcode and by method, the time spent in each
+// opcode, the calls into SlowRuntimeStub by the opcode which made them and the ic misses by site.
+// The interpreter switches to a dispatch table which counts each bytecode before it runs when the profiler is
+// enabled on its entry, the same way it switches to the table of the debugger, so a disabled profiler costs nothing
+// but the check at the entry and an inlined check on each entry of SlowRuntimeStub. It is only used from the js thread.
+class BytecodeProfiler {
+public:
+    static constexpr uint32_t OPCODE_COUNT = 0x100;
+
+    // The state of one run of the interpreter loop. The time of a bytecode ends when the next one of the same run
+    // starts, so the time spent in a call into native code is counted for the bytecode which called it.
+    struct DispatchState {
+        uint32_t opcode {OPCODE_COUNT};
+        uint64_t startTime {0};
+    };
+
+    BytecodeProfiler() = default;
+    ~BytecodeProfiler() = default;
+    NO_COPY_SEMANTIC(BytecodeProfiler);
+    NO_MOVE_SEMANTIC(BytecodeProfiler);
+
+    void Enable()
+    {
+        enabled_ = true;
+    }
+
+    void Disable()
+    {
+        enabled_ = false;
+        currentOpcode_ = OPCODE_COUNT;
+    }
+
+    bool IsEnabled() const
+    {
+        return enabled_;
+    }
+
+    void CountBytecode(uint8_t opcode, const JSMethod *method, DispatchState *state);
+
+    // Called on the entry of a SlowRuntimeStub, it is counted for the bytecode the interpreter runs.
+    void CountSlowPath()
+    {
+        if (enabled_ && currentOpcode_ < OPCODE_COUNT) {
+            slowPathCounts_[currentOpcode_]++;
+        }
+    }
+
+    void CountICMiss(const JSMethod *method, uint32_t slotId, ICKind kind);
+    void Clear();
+
+    uint64_t GetOpcodeCount(uint8_t opcode) const
+    {
+        return opcodeCounts_[opcode];
+    }
+
+    uint64_t GetSlowPathCount(uint8_t opcode) const
+    {
+        return slowPathCounts_[opcode];
+    }
+
+    uint64_t GetICMissCount() const;
+
+    // The counts as text, each table sorted by the counts from the highest.
+    std::string Dump() const;
+
+private:
+    struct MethodStat {
+        std::string name;
+        uint64_t bytecodes {0};
+    };
+
+    struct ICMissStat {
+        std::string name;
+        ICKind kind {ICKind::NamedLoadIC};
+        uint64_t misses {0};
+    };
+
+    static std::string GetMethodName(const JSMethod *method);
+    static uint64_t GetCurrentTimeInNs();
+
+    bool enabled_ {false};
+    uint32_t currentOpcode_ {OPCODE_COUNT};
+    std::array<uint64_t, OPCODE_COUNT> opcodeCounts_ {};
+    std::array<uint64_t, OPCODE_COUNT> opcodeTimes_ {};
+    std::array<uint64_t, OPCODE_COUNT> slowPathCounts_ {};
+    // consecutive bytecodes mostly belong to the same method, whose stat is cached
+    const JSMethod *lastMethod_ {nullptr};
+    MethodStat *lastMethodStat_ {nullptr};
+    std::unordered_map<const JSMethod *, MethodStat> methodStats_ {};
+    std::map<std::pair<const JSMethod *, uint32_t>, ICMissStat> icMissStats_ {};
+};
+}  // namespace panda::ecmascript
+
+#endif  // ECMASCRIPT_DFX_VMSTAT_BYTECODE_PROFILER_H
@@ -22,9 +22,11 @@
 #include "ecmascript/compiler/common_stubs.h"
 #include "ecmascript/compiler/interpreter_stub.h"
 #include "ecmascript/compiler/rt_call_signature.h"
+#include "ecmascript/deoptimizer/deoptimizer.h"
 #if defined(ECMASCRIPT_SUPPORT_CPUPROFILER)
 #include "ecmascript/dfx/cpu_profiler/cpu_profiler.h"
 #endif
+#include "ecmascript/dfx/vmstat/bytecode_profiler.h"
 #include "ecmascript/dfx/vmstat/runtime_stat.h"
 #include "ecmascript/ecma_string_table.h"
 #include "ecmascript/file_loader.h"
@@ -32,6 +34,7 @@
 #include "ecmascript/global_env_constants-inl.h"
 #include "ecmascript/global_env_constants.h"
 #include "ecmascript/interpreter/interpreter-inl.h"
+#include "ecmascript/jit/jit.h"
 #include "ecmascript/jobs/micro_job_queue.h"
 #include "ecmascript/jspandafile/constpool_value.h"
 #include "ecmascript/jspandafile/js_pandafile.h"
@@ -52,6 +55,7 @@
 #include "ecmascript/taskpool/task.h"
 #include "ecmascript/module/js_module_manager.h"
 #include "ecmascript/object_factory.h"
+#include "ecmascript/pgo/pgo_profiler.h"
 #include "ecmascript/taskpool/taskpool.h"
 #include "ecmascript/regexp/regexp_parser_cache.h"
 #include "ecmascript/runtime_call_id.h"
@@ -192,6 +196,16 @@ bool EcmaVM::Initialize()
     if (options_.GetEnableAsmInterpreter() && options_.WasAOTOutputFileSet()) {
         LoadAOTFiles();
     }
+    jit_ = new Jit(this);
+    if (options_.GetEnableAsmInterpreter() && options_.EnableJit()) {
+        jit_->Initialize();
+    }
+    pgoProfiler_ = new PGOProfiler(this);
+    bytecodeProfiler_ = new BytecodeProfiler();
+    if (options_.EnableBytecodeProfiler()) {
+        bytecodeProfiler_->Enable();
+    }
+    deoptimizer_ = new Deoptimizer(this);
     heap_->GetReadOnlySpace()->SetReadOnly();
     InitializeFinish();
     return true;
@@ -256,6 +270,30 @@ EcmaVM::~EcmaVM()
 {
     LOG_ECMA(INFO) << "Destruct ecma_vm, vm address is: " << this;
     vmInitialized_ = false;
+    if (options_.EnableLazyTranslation() && !options_.GetLazyTranslationList().empty() && !options_.IsWorker()) {
+        PandaFileTranslator::DumpLazyTranslatedMethods(options_.GetLazyTranslationList());
+    }
+    if (pgoProfiler_ != nullptr) {
+        pgoProfiler_->DumpAtExit();
+        delete pgoProfiler_;
+        pgoProfiler_ = nullptr;
+    }
+    if (bytecodeProfiler_ != nullptr) {
+        if (options_.EnableBytecodeProfiler()) {
+            LOG_ECMA(INFO) << "Bytecode profile:\n" << bytecodeProfiler_->Dump();
+        }
+        delete bytecodeProfiler_;
+        bytecodeProfiler_ = nullptr;
+    }
+    if (deoptimizer_ != nullptr) {
+        delete deoptimizer_;
+        deoptimizer_ = nullptr;
+    }
+    // The jit waits for its compile task, which must finish before the taskpool is destroyed.
+    if (jit_ != nullptr) {
+        delete jit_;
+        jit_ = nullptr;
+    }
     Taskpool::GetCurrentTaskpool()->Destroy();
 
     if (runtimeStat_ != nullptr && runtimeStat_->IsRuntimeStatEnabled()) {
@@ -657,14 +695,37 @@ void EcmaVM::Iterate(const RootVisitor &v)
     v(Root::ROOT_VM, ObjectSlot(reinterpret_cast<uintptr_t>(&microJobQueue_)));
     v(Root::ROOT_VM, ObjectSlot(reinterpret_cast<uintptr_t>(&regexpCache_)));
     v(Root::ROOT_VM, ObjectSlot(reinterpret_cast<uintptr_t>(&frameworkProgram_)));
+    for (auto &context : asyncContextPool_) {
+        v(Root::ROOT_VM, ObjectSlot(reinterpret_cast<uintptr_t>(&context)));
+    }
     moduleManager_->Iterate(v);
     tsLoader_->Iterate(v);
     fileLoader_->Iterate(v);
+    if (jit_ != nullptr) {
+        jit_->Iterate(v);
+    }
     if (!WIN_OR_MAC_PLATFORM) {
         snapshotEnv_->Iterate(v);
     }
 }
 
+JSTaggedValue EcmaVM::PopAsyncContext()
+{
+    if (asyncContextPool_.empty()) {
+        return JSTaggedValue::Hole();
+    }
+    JSTaggedValue context = asyncContextPool_.back();
+    asyncContextPool_.pop_back();
+    return context;
+}
+
+void EcmaVM::PushAsyncContext(JSTaggedValue context)
+{
+    if (asyncContextPool_.size() < MAX_ASYNC_CONTEXT_POOL_SIZE) {
+        asyncContextPool_.emplace_back(context);
+    }
+}
+
 void EcmaVM::SetGlobalEnv(GlobalEnv *global)
 {
     ASSERT(global != nullptr);
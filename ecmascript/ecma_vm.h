@@ -67,6 +67,10 @@ class JSFunction;
 class Program;
 class TSLoader;
 class FileLoader;
+class Jit;
+class PGOProfiler;
+class BytecodeProfiler;
+class Deoptimizer;
 class ModuleManager;
 class CjsModule;
 class CjsExports;
@@ -142,6 +146,10 @@ public:
 
     bool ExecutePromisePendingJob();
 
+    // The contexts of completed async functions are kept for the next ones, Hole is returned when there is none.
+    JSTaggedValue PopAsyncContext();
+    void PushAsyncContext(JSTaggedValue context);
+
     static EcmaVM *ConstCast(const EcmaVM *vm)
     {
         return const_cast<EcmaVM *>(vm);
@@ -247,6 +255,26 @@ public:
         return fileLoader_;
     }
 
+    Jit *GetJit() const
+    {
+        return jit_;
+    }
+
+    PGOProfiler *GetPGOProfiler() const
+    {
+        return pgoProfiler_;
+    }
+
+    BytecodeProfiler *GetBytecodeProfiler() const
+    {
+        return bytecodeProfiler_;
+    }
+
+    Deoptimizer *GetDeoptimizer() const
+    {
+        return deoptimizer_;
+    }
+
     SnapshotEnv *GetSnapshotEnv() const
     {
         return snapshotEnv_;
@@ -409,6 +437,8 @@ private:
     JSTaggedValue globalEnv_ {JSTaggedValue::Hole()};
     JSTaggedValue regexpCache_ {JSTaggedValue::Hole()};
     JSTaggedValue microJobQueue_ {JSTaggedValue::Hole()};
+    static constexpr size_t MAX_ASYNC_CONTEXT_POOL_SIZE = 16;
+    CVector<JSTaggedValue> asyncContextPool_ {};
     EcmaRuntimeStat *runtimeStat_ {nullptr};
 
     // For framewrok file snapshot.
@@ -424,6 +454,10 @@ private:
     SnapshotEnv *snapshotEnv_ {nullptr};
     bool optionalLogEnabled_ {false};
     FileLoader *fileLoader_ {nullptr};
+    Jit *jit_ {nullptr};
+    PGOProfiler *pgoProfiler_ {nullptr};
+    BytecodeProfiler *bytecodeProfiler_ {nullptr};
+    Deoptimizer *deoptimizer_ {nullptr};
 
     // Debugger
     tooling::JsDebuggerManager *debuggerManager_ {nullptr};
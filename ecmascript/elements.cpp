@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/elements.h"
+
+#include "ecmascript/tagged_array.h"
+
+namespace panda::ecmascript {
+ElementsKind Elements::ComputeElementsKind(const TaggedArray *elements, uint32_t length)
+{
+    ElementsKind kind = ElementsKind::NONE;
+    uint32_t capacity = elements->GetLength();
+    if (length > capacity) {
+        kind = ElementsKind::HOLE;
+        length = capacity;
+    }
+    for (uint32_t i = 0; i < length && kind != ElementsKind::GENERIC; i++) {
+        kind = MergeElementsKind(kind, ToElementsKind(elements->Get(i)));
+    }
+    return kind;
+}
+
+const char *Elements::GetElementsKindName(ElementsKind kind)
+{
+    switch (kind) {
+        case ElementsKind::NONE:
+            return "NONE";
+        case ElementsKind::HOLE:
+            return "HOLE";
+        case ElementsKind::PACKED_SMI:
+            return "PACKED_SMI";
+        case ElementsKind::HOLEY_SMI:
+            return "HOLEY_SMI";
+        case ElementsKind::PACKED_DOUBLE:
+            return "PACKED_DOUBLE";
+        case ElementsKind::HOLEY_DOUBLE:
+            return "HOLEY_DOUBLE";
+        case ElementsKind::PACKED:
+            return "PACKED";
+        case ElementsKind::HOLEY:
+            return "HOLEY";
+        default:
+            return "UNKNOWN";
+    }
+}
+}  // namespace panda::ecmascript
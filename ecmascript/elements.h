@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_ELEMENTS_H
+#define ECMASCRIPT_ELEMENTS_H
+
+#include "ecmascript/js_tagged_value.h"
+
+namespace panda::ecmascript {
+class TaggedArray;
+
+// The elements kind of an hclass is a superset of what the fast elements of its instances hold below the length.
+// Each kind is a set of bits, so merging two kinds is a bitwise or and transitions only go towards GENERIC:
+//   NONE -> PACKED_SMI -> PACKED_DOUBLE -> PACKED, and each of them to its holey variant.
+enum class ElementsKind : uint8_t {
+    NONE = 0x00UL,
+    HOLE = 0x01UL,
+    PACKED_SMI = 0x02UL,                         // int
+    HOLEY_SMI = PACKED_SMI | HOLE,               // int, hole
+    PACKED_DOUBLE = 0x04UL | PACKED_SMI,         // int, double
+    HOLEY_DOUBLE = PACKED_DOUBLE | HOLE,         // int, double, hole
+    PACKED = 0x08UL | PACKED_DOUBLE,             // any value
+    HOLEY = PACKED | HOLE,                       // any value, hole
+    GENERIC = HOLEY,
+};
+
+class Elements {
+public:
+    static constexpr uint32_t ELEMENTS_KIND_BITS = 4;
+
+    static inline ElementsKind ToElementsKind(JSTaggedValue value)
+    {
+        if (value.IsInt()) {
+            return ElementsKind::PACKED_SMI;
+        }
+        if (value.IsDouble()) {
+            return ElementsKind::PACKED_DOUBLE;
+        }
+        if (value.IsHole()) {
+            return ElementsKind::HOLE;
+        }
+        return ElementsKind::PACKED;
+    }
+
+    static inline ElementsKind MergeElementsKind(ElementsKind kind, ElementsKind other)
+    {
+        return static_cast<ElementsKind>(static_cast<uint8_t>(kind) | static_cast<uint8_t>(other));
+    }
+
+    // Return whether an hclass of the given kind can hold elements of the other kind without a transition.
+    static inline bool ContainsElementsKind(ElementsKind kind, ElementsKind other)
+    {
+        return MergeElementsKind(kind, other) == kind;
+    }
+
+    static inline bool IsHoley(ElementsKind kind)
+    {
+        return (static_cast<uint8_t>(kind) & static_cast<uint8_t>(ElementsKind::HOLE)) != 0;
+    }
+
+    // Every element below the length is an int.
+    static inline bool IsPackedSmi(ElementsKind kind)
+    {
+        return ContainsElementsKind(ElementsKind::PACKED_SMI, kind);
+    }
+
+    // Every element below the length is a number.
+    static inline bool IsPackedNumber(ElementsKind kind)
+    {
+        return ContainsElementsKind(ElementsKind::PACKED_DOUBLE, kind);
+    }
+
+    // There is no hole below the length.
+    static inline bool IsPacked(ElementsKind kind)
+    {
+        return !IsHoley(kind);
+    }
+
+    // Return the kind of the first length elements, a length beyond the capacity counts as holes.
+    static ElementsKind ComputeElementsKind(const TaggedArray *elements, uint32_t length);
+    static const char *GetElementsKindName(ElementsKind kind);
+};
+static_assert(static_cast<uint8_t>(ElementsKind::GENERIC) < (1U << Elements::ELEMENTS_KIND_BITS));
+}  // namespace panda::ecmascript
+#endif  // ECMASCRIPT_ELEMENTS_H
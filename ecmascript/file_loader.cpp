@@ -296,6 +296,10 @@ void FileLoader::UpdateJSMethods(JSHandle<JSFunction> mainFunc, const JSPandaFil
 void FileLoader::SetAOTFuncEntry(const JSPandaFile *jsPandaFile, const JSHandle<JSFunction> &func)
 {
     auto codeEntry = GetAOTFuncEntry(jsPandaFile->GetFileUniqId(), jsPandaFile->GetUniqueMethod(func));
+    // a profile guided aot file has only the hot methods, the others stay in the interpreter
+    if (codeEntry == 0) {
+        return;
+    }
     func->SetCodeEntryAndMarkAOT(codeEntry);
 }
 
@@ -254,6 +254,12 @@ bool FrameIterator::CollectGCSlots(std::set<uintptr_t> &baseSet, ChunkMap<Derive
                                            baseSet, data, isVerifying, optimizedCallSiteSp_);
 }
 
+bool FrameIterator::CollectDeoptValues(std::vector<JSTaggedType> &values) const
+{
+    return stackmapParser_->CollectDeoptValues(optimizedReturnAddr_, reinterpret_cast<uintptr_t>(current_),
+                                               optimizedCallSiteSp_, values);
+}
+
 ARK_INLINE void OptimizedFrame::GCIterate(const FrameIterator &it,
     const RootVisitor &v0,
     [[maybe_unused]] const RootRangeVisitor &v1,
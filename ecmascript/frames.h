@@ -1096,6 +1096,8 @@ public:
     }
     bool CollectGCSlots(std::set<uintptr_t> &baseSet, ChunkMap<DerivedDataKey, uintptr_t> *data,
                         bool isVerifying) const;
+    // Read the frame state recorded for the call the current optimized frame is waiting on.
+    bool CollectDeoptValues(std::vector<JSTaggedType> &values) const;
 private:
     JSTaggedType *current_ {nullptr};
     const JSThread *thread_ {nullptr};
@@ -14,10 +14,13 @@
  */
 
 #include "ecmascript/ic/ic_runtime.h"
+#include "ecmascript/dfx/vmstat/bytecode_profiler.h"
 #include "ecmascript/global_dictionary-inl.h"
 #include "ecmascript/global_env.h"
 #include "ecmascript/ic/ic_handler.h"
+#include "ecmascript/ic/mega_ic_cache.h"
 #include "ecmascript/ic/profile_type_info.h"
+#include "ecmascript/interpreter/frame_handler.h"
 #include "ecmascript/interpreter/slow_runtime_stub.h"
 #include "ecmascript/js_function.h"
 #include "ecmascript/js_hclass-inl.h"
@@ -32,9 +35,11 @@ namespace panda::ecmascript {
 void ICRuntime::UpdateLoadHandler(const ObjectOperator &op, JSHandle<JSTaggedValue> key,
                                   JSHandle<JSTaggedValue> receiver)
 {
-    if (icAccessor_.GetICState() == ProfileTypeAccessor::ICState::MEGA) {
+    bool isMega = icAccessor_.GetICState() == ProfileTypeAccessor::ICState::MEGA;
+    if (isMega && (GetICKind() != ICKind::NamedLoadIC || op.IsElement())) {
         return;
     }
+    JSHandle<JSTaggedValue> name = key;
     if (IsNamedIC(GetICKind())) {
         key = JSHandle<JSTaggedValue>();
     }
@@ -64,6 +69,10 @@ void ICRuntime::UpdateLoadHandler(const ObjectOperator &op, JSHandle<JSTaggedVal
         }
     }
 
+    if (isMega) {
+        thread_->GetLoadMegaICCache()->Set(*hclass, name.GetTaggedValue(), handlerValue.GetTaggedValue());
+        return;
+    }
     if (key.IsEmpty()) {
         icAccessor_.AddHandlerWithoutKey(JSHandle<JSTaggedValue>::Cast(hclass), handlerValue);
     } else if (op.IsElement()) {
@@ -80,9 +89,11 @@ void ICRuntime::UpdateLoadHandler(const ObjectOperator &op, JSHandle<JSTaggedVal
 void ICRuntime::UpdateStoreHandler(const ObjectOperator &op, JSHandle<JSTaggedValue> key,
                                    JSHandle<JSTaggedValue> receiver)
 {
-    if (icAccessor_.GetICState() == ProfileTypeAccessor::ICState::MEGA) {
+    bool isMega = icAccessor_.GetICState() == ProfileTypeAccessor::ICState::MEGA;
+    if (isMega && (GetICKind() != ICKind::NamedStoreIC || op.IsElement())) {
         return;
     }
+    JSHandle<JSTaggedValue> name = key;
     if (IsNamedIC(GetICKind())) {
         key = JSHandle<JSTaggedValue>();
     }
@@ -102,6 +113,11 @@ void ICRuntime::UpdateStoreHandler(const ObjectOperator &op, JSHandle<JSTaggedVa
         handlerValue = StoreHandler::StoreProperty(thread_, op);
     }
 
+    if (isMega) {
+        JSHClass *hclass = JSHClass::Cast(receiverHClass_->GetTaggedObject());
+        thread_->GetStoreMegaICCache()->Set(hclass, name.GetTaggedValue(), handlerValue.GetTaggedValue());
+        return;
+    }
     if (key.IsEmpty()) {
         icAccessor_.AddHandlerWithoutKey(receiverHClass_, handlerValue);
     } else if (op.IsElement()) {
@@ -133,8 +149,29 @@ void ICRuntime::TraceIC([[maybe_unused]] JSHandle<JSTaggedValue> receiver,
 #endif
 }
 
+void ICRuntime::CountMiss() const
+{
+    BytecodeProfiler *profiler = thread_->GetEcmaVM()->GetBytecodeProfiler();
+    if (!profiler->IsEnabled()) {
+        return;
+    }
+    // the site belongs to the innermost interpreted frame only if its function owns the profile type info,
+    // a miss of aot code has no interpreted frame of its own
+    FrameHandler frameHandler(thread_);
+    if (!frameHandler.HasFrame() || frameHandler.IsEntryFrame()) {
+        return;
+    }
+    JSTaggedValue function = frameHandler.GetFunction();
+    if (!function.IsJSFunction() || JSFunction::Cast(function.GetTaggedObject())->GetProfileTypeInfo() !=
+        icAccessor_.GetProfileTypeInfo().GetTaggedValue()) {
+        return;
+    }
+    profiler->CountICMiss(frameHandler.GetMethod(), icAccessor_.GetSlotId(), GetICKind());
+}
+
 JSTaggedValue LoadICRuntime::LoadMiss(JSHandle<JSTaggedValue> receiver, JSHandle<JSTaggedValue> key)
 {
+    CountMiss();
     if (receiver->IsTypedArray() || !receiver->IsJSObject() || receiver->IsSpecialContainer()) {
         icAccessor_.SetAsMega();
         return JSTaggedValue::GetProperty(thread_, receiver, key).GetValue().GetTaggedValue();
@@ -175,6 +212,7 @@ JSTaggedValue LoadICRuntime::LoadMiss(JSHandle<JSTaggedValue> receiver, JSHandle
 JSTaggedValue StoreICRuntime::StoreMiss(JSHandle<JSTaggedValue> receiver, JSHandle<JSTaggedValue> key,
                                         JSHandle<JSTaggedValue> value)
 {
+    CountMiss();
     if (receiver->IsTypedArray() || !receiver->IsJSObject() || receiver->IsSpecialContainer()) {
         icAccessor_.SetAsMega();
         bool success = JSTaggedValue::SetProperty(GetThread(), receiver, key, value, true);
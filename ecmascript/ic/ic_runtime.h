@@ -55,6 +55,8 @@ public:
     }
 
     void TraceIC(JSHandle<JSTaggedValue> receiver, JSHandle<JSTaggedValue> key) const;
+    // count the miss for its site in the bytecode profiler
+    void CountMiss() const;
 
 protected:
     JSThread *thread_;
@@ -30,6 +30,7 @@
 #include "ecmascript/object_factory-inl.h"
 #include "ecmascript/js_handle.h"
 #include "ecmascript/interpreter/fast_runtime_stub-inl.h"
+#include "ecmascript/ic/mega_ic_cache.h"
 #include "ecmascript/ic/proto_change_details.h"
 
 #include "ecmascript/runtime_call_id.h"
@@ -97,10 +98,37 @@ ARK_INLINE JSTaggedValue ICRuntimeStub::TryLoadICByName(JSThread *thread, JSTagg
     return JSTaggedValue::Hole();
 }
 
+ARK_INLINE bool ICRuntimeStub::CanUseMegaICCache(JSTaggedValue receiver)
+{
+    // Handlers are only created for fast mode objects, see LoadMiss and StoreMiss.
+    return receiver.IsJSObject() && !receiver.GetTaggedObject()->GetClass()->IsDictionaryMode() &&
+        !receiver.IsTypedArray() && !receiver.IsSpecialContainer();
+}
+
+ARK_INLINE JSTaggedValue ICRuntimeStub::TryLoadICByMega(JSThread *thread, JSTaggedValue receiver,
+                                                        JSTaggedValue key)
+{
+    INTERPRETER_TRACE(thread, TryLoadICByMega);
+    if (receiver.IsHeapObject()) {
+        auto hclass = receiver.GetTaggedObject()->GetClass();
+        JSTaggedValue cachedHandler = thread->GetLoadMegaICCache()->Get(hclass, key);
+        if (!cachedHandler.IsHole()) {
+            return LoadICWithHandler(thread, receiver, receiver, cachedHandler);
+        }
+    }
+    return JSTaggedValue::Hole();
+}
+
 ARK_NOINLINE JSTaggedValue ICRuntimeStub::LoadICByName(JSThread *thread, ProfileTypeInfo *profileTypeInfo,
                                                        JSTaggedValue receiver, JSTaggedValue key, uint32_t slotId)
 {
     INTERPRETER_TRACE(thread, LoadICByName);
+    if (profileTypeInfo->Get(slotId).IsHole()) {
+        JSTaggedValue res = TryLoadICByMega(thread, receiver, key);
+        if (!res.IsHole()) {
+            return res;
+        }
+    }
     return LoadMiss(thread, profileTypeInfo, receiver, key, slotId, ICKind::NamedLoadIC);
 }
 
@@ -180,11 +208,31 @@ ARK_INLINE JSTaggedValue ICRuntimeStub::TryStoreICByName(JSThread *thread, JSTag
     return JSTaggedValue::Hole();
 }
 
+ARK_INLINE JSTaggedValue ICRuntimeStub::TryStoreICByMega(JSThread *thread, JSTaggedValue receiver,
+                                                         JSTaggedValue key, JSTaggedValue value)
+{
+    INTERPRETER_TRACE(thread, TryStoreICByMega);
+    if (receiver.IsHeapObject()) {
+        auto hclass = receiver.GetTaggedObject()->GetClass();
+        JSTaggedValue cachedHandler = thread->GetStoreMegaICCache()->Get(hclass, key);
+        if (!cachedHandler.IsHole()) {
+            return StoreICWithHandler(thread, receiver, receiver, value, cachedHandler);
+        }
+    }
+    return JSTaggedValue::Hole();
+}
+
 ARK_NOINLINE JSTaggedValue ICRuntimeStub::StoreICByName(JSThread *thread, ProfileTypeInfo *profileTypeInfo,
                                                         JSTaggedValue receiver, JSTaggedValue key,
                                                         JSTaggedValue value, uint32_t slotId)
 {
     INTERPRETER_TRACE(thread, StoreICByName);
+    if (profileTypeInfo->Get(slotId).IsHole()) {
+        JSTaggedValue res = TryStoreICByMega(thread, receiver, key, value);
+        if (!res.IsHole()) {
+            return res;
+        }
+    }
     return StoreMiss(thread, profileTypeInfo, receiver, key, value, slotId, ICKind::NamedStoreIC);
 }
 
@@ -388,6 +436,14 @@ JSTaggedValue ICRuntimeStub::StoreElement(JSThread *thread, JSObject *receiver,
         if (HandlerBase::IsJSArray(handlerInfo)) {
             JSArray *arr = JSArray::Cast(receiver);
             uint32_t oldLength = arr->GetArrayLength();
+            ElementsKind kind = Elements::ToElementsKind(value);
+            if (elementIndex > oldLength) {
+                kind = Elements::MergeElementsKind(kind, ElementsKind::HOLE);
+            }
+            if (!receiver->GetJSHClass()->ContainsElementsKind(kind)) {
+                // the handler is bound to the hclass of this elements kind, the transition happens in the miss
+                return JSTaggedValue::Hole();
+            }
             if (elementIndex >= oldLength) {
                 arr->SetArrayLength(thread, elementIndex + 1);
             }
@@ -38,6 +38,10 @@ public:
     static inline JSTaggedValue StoreICByName(JSThread *thread, ProfileTypeInfo *profileTypeInfo,
                                               JSTaggedValue receiver, JSTaggedValue key,
                                               JSTaggedValue value, uint32_t slotId);
+    static inline bool CanUseMegaICCache(JSTaggedValue receiver);
+    static inline JSTaggedValue TryLoadICByMega(JSThread *thread, JSTaggedValue receiver, JSTaggedValue key);
+    static inline JSTaggedValue TryStoreICByMega(JSThread *thread, JSTaggedValue receiver, JSTaggedValue key,
+                                                 JSTaggedValue value);
     static inline JSTaggedValue CheckPolyHClass(JSTaggedValue cachedValue, JSHClass* hclass);
     static inline JSTaggedValue LoadICWithHandler(JSThread *thread, JSTaggedValue receiver, JSTaggedValue holder,
                                                   JSTaggedValue handler);
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_IC_MEGA_IC_CACHE_H
+#define ECMASCRIPT_IC_MEGA_IC_CACHE_H
+
+#include <array>
+
+#include "ecmascript/js_hclass.h"
+#include "ecmascript/js_tagged_value.h"
+
+namespace panda::ecmascript {
+// MegaICCache maps (hclass, key) to the ic handler of a named property access whose profile slot is megamorphic.
+// It is shared by all the megamorphic sites of a thread, so a site which meets many hclasses still finds the
+// handler without a full property lookup. The cache has a primary and a secondary table: an entry evicted from
+// the primary table is moved to the secondary one, so two hot (hclass, key) pairs colliding in the primary table
+// do not evict each other.
+// Keys are interned strings or symbols and are compared by identity, so the hash only uses the addresses.
+// The cache is cleared at each gc, the same as PropertiesCache, and when the hclass of a prototype changes.
+class MegaICCache {
+public:
+    // Every field is a JSTaggedType so that the layout is the same on 32 and 64 bits for the stubs.
+    struct Entry {
+        JSTaggedType hclass_ {0};
+        JSTaggedType key_ {JSTaggedValue::VALUE_HOLE};
+        JSTaggedType handler_ {JSTaggedValue::VALUE_HOLE};
+    };
+
+    inline JSTaggedValue Get(JSHClass *jsHclass, JSTaggedValue key) const
+    {
+        auto hclass = ToHClassType(jsHclass);
+        uint32_t primaryHash = PrimaryHash(jsHclass, key);
+        const Entry &primary = primary_[primaryHash & PRIMARY_LENGTH_MASK];
+        if (primary.hclass_ == hclass && primary.key_ == key.GetRawData()) {
+            return JSTaggedValue(primary.handler_);
+        }
+        const Entry &secondary = secondary_[SecondaryHash(primaryHash, key) & SECONDARY_LENGTH_MASK];
+        if (secondary.hclass_ == hclass && secondary.key_ == key.GetRawData()) {
+            return JSTaggedValue(secondary.handler_);
+        }
+        return JSTaggedValue::Hole();
+    }
+
+    inline void Set(JSHClass *jsHclass, JSTaggedValue key, JSTaggedValue handler)
+    {
+        uint32_t primaryHash = PrimaryHash(jsHclass, key);
+        Entry &primary = primary_[primaryHash & PRIMARY_LENGTH_MASK];
+        if (primary.hclass_ != 0) {
+            // Move the old entry to the secondary table instead of dropping it.
+            auto oldHclass = reinterpret_cast<JSHClass *>(primary.hclass_);
+            JSTaggedValue oldKey(primary.key_);
+            uint32_t oldHash = PrimaryHash(oldHclass, oldKey);
+            secondary_[SecondaryHash(oldHash, oldKey) & SECONDARY_LENGTH_MASK] = primary;
+        }
+        primary.hclass_ = ToHClassType(jsHclass);
+        primary.key_ = key.GetRawData();
+        primary.handler_ = handler.GetRawData();
+        isEmpty_ = false;
+    }
+
+    inline void Clear()
+    {
+        if (isEmpty_) {
+            return;
+        }
+        for (auto &entry : primary_) {
+            entry.hclass_ = 0;
+        }
+        for (auto &entry : secondary_) {
+            entry.hclass_ = 0;
+        }
+        isEmpty_ = true;
+    }
+
+    inline bool IsEmpty() const
+    {
+        return isEmpty_;
+    }
+
+    static inline uint32_t PrimaryHash(JSHClass *cls, JSTaggedValue key)
+    {
+        uint32_t clsHash = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(cls)) >> HASH_SHIFT;
+        uint32_t keyHash = static_cast<uint32_t>(key.GetRawData()) >> HASH_SHIFT;
+        return clsHash ^ keyHash;
+    }
+
+    static inline uint32_t SecondaryHash(uint32_t primaryHash, JSTaggedValue key)
+    {
+        uint32_t keyHash = static_cast<uint32_t>(key.GetRawData()) >> HASH_SHIFT;
+        return primaryHash - keyHash + SECONDARY_SEED;
+    }
+
+    static constexpr uint32_t HASH_SHIFT = 3;  // skip 8bytes
+    static constexpr uint32_t SECONDARY_SEED = 0x9e3779b9;
+    static constexpr uint32_t PRIMARY_LENGTH_BIT = 11;
+    static constexpr uint32_t PRIMARY_LENGTH = (1U << PRIMARY_LENGTH_BIT);
+    static constexpr uint32_t PRIMARY_LENGTH_MASK = PRIMARY_LENGTH - 1;
+    static constexpr uint32_t SECONDARY_LENGTH_BIT = 9;
+    static constexpr uint32_t SECONDARY_LENGTH = (1U << SECONDARY_LENGTH_BIT);
+    static constexpr uint32_t SECONDARY_LENGTH_MASK = SECONDARY_LENGTH - 1;
+
+    static constexpr size_t ENTRY_SIZE = sizeof(Entry);
+    static constexpr size_t ENTRY_HCLASS_OFFSET = 0;
+    static constexpr size_t ENTRY_KEY_OFFSET = ENTRY_HCLASS_OFFSET + sizeof(JSTaggedType);
+    static constexpr size_t ENTRY_HANDLER_OFFSET = ENTRY_KEY_OFFSET + sizeof(JSTaggedType);
+    static constexpr size_t PRIMARY_OFFSET = 0;
+    static constexpr size_t SECONDARY_OFFSET = PRIMARY_OFFSET + PRIMARY_LENGTH * ENTRY_SIZE;
+
+private:
+    MegaICCache() = default;
+    ~MegaICCache() = default;
+
+    static inline JSTaggedType ToHClassType(JSHClass *jsHclass)
+    {
+        return static_cast<JSTaggedType>(reinterpret_cast<uintptr_t>(jsHclass));
+    }
+
+    std::array<Entry, PRIMARY_LENGTH> primary_ {};
+    std::array<Entry, SECONDARY_LENGTH> secondary_ {};
+    bool isEmpty_ {true};
+
+    friend class JSThread;
+};
+static_assert(MegaICCache::ENTRY_SIZE == MegaICCache::ENTRY_HANDLER_OFFSET + sizeof(JSTaggedType));
+}  // namespace panda::ecmascript
+#endif  // ECMASCRIPT_IC_MEGA_IC_CACHE_H
@@ -135,6 +135,16 @@ public:
         return kind_;
     }
 
+    JSHandle<ProfileTypeInfo> GetProfileTypeInfo() const
+    {
+        return profileTypeInfo_;
+    }
+
+    uint32_t GetSlotId() const
+    {
+        return slotId_;
+    }
+
 private:
     JSThread* thread_;
     JSHandle<ProfileTypeInfo> profileTypeInfo_;
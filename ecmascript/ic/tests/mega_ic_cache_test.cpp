@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/ic/ic_runtime_stub-inl.h"
+#include "ecmascript/ic/mega_ic_cache.h"
+#include "ecmascript/global_env.h"
+#include "ecmascript/js_object.h"
+#include "ecmascript/tests/test_helper.h"
+
+using namespace panda::ecmascript;
+
+namespace panda::test {
+class MegaICCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "SetUpTestCase";
+    }
+
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "TearDownCase";
+    }
+
+    void SetUp() override
+    {
+        TestHelper::CreateEcmaVMWithScope(instance, thread, scope);
+    }
+
+    void TearDown() override
+    {
+        TestHelper::DestroyEcmaVMWithScope(instance, scope);
+    }
+
+    EcmaVM *instance {nullptr};
+    EcmaHandleScope *scope {nullptr};
+    JSThread *thread {nullptr};
+};
+
+/**
+ * @tc.name: SetAndGet
+ * @tc.desc: Set handlers of one key for many hclasses, the handlers evicted from the primary table must still be
+ *           found in the secondary table, and "Clear" function removes all of them.
+ * @tc.type: FUNC
+ * @tc.requre:
+ */
+HWTEST_F_L0(MegaICCacheTest, SetAndGet)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<GlobalEnv> env = thread->GetEcmaVM()->GetGlobalEnv();
+    JSHandle<JSTaggedValue> objFun = env->GetObjectFunction();
+    JSHandle<JSTaggedValue> handleKey(factory->NewFromASCII("key"));
+    JSHandle<JSTaggedValue> handleOtherKey(factory->NewFromASCII("otherKey"));
+
+    JSHandle<JSObject> handleObj = factory->NewJSObjectByConstructor(JSHandle<JSFunction>(objFun), objFun);
+    JSHandle<JSHClass> firstClass(thread, handleObj->GetJSHClass());
+    JSHandle<JSTaggedValue> handleValue(thread, JSTaggedValue(1));
+    JSObject::SetProperty(thread, handleObj, handleOtherKey, handleValue);
+    JSHandle<JSHClass> secondClass(thread, handleObj->GetJSHClass());
+
+    MegaICCache *cache = thread->GetLoadMegaICCache();
+    cache->Clear();
+    EXPECT_TRUE(cache->IsEmpty());
+    cache->Set(*firstClass, handleKey.GetTaggedValue(), JSTaggedValue(1));
+    cache->Set(*secondClass, handleKey.GetTaggedValue(), JSTaggedValue(2));
+    EXPECT_FALSE(cache->IsEmpty());
+    EXPECT_EQ(cache->Get(*firstClass, handleKey.GetTaggedValue()).GetInt(), 1);
+    EXPECT_EQ(cache->Get(*secondClass, handleKey.GetTaggedValue()).GetInt(), 2);
+    EXPECT_TRUE(cache->Get(*firstClass, handleOtherKey.GetTaggedValue()).IsHole());
+
+    // a second entry with the same primary hash moves the first one to the secondary table
+    uint32_t primaryHash = MegaICCache::PrimaryHash(*firstClass, handleKey.GetTaggedValue());
+    JSTaggedValue collidingKey(handleKey.GetTaggedValue().GetRawData() +
+        (static_cast<JSTaggedType>(MegaICCache::PRIMARY_LENGTH) << MegaICCache::HASH_SHIFT));
+    EXPECT_EQ(MegaICCache::PrimaryHash(*firstClass, collidingKey) & MegaICCache::PRIMARY_LENGTH_MASK,
+              primaryHash & MegaICCache::PRIMARY_LENGTH_MASK);
+    cache->Set(*firstClass, collidingKey, JSTaggedValue(3));
+    EXPECT_EQ(cache->Get(*firstClass, collidingKey).GetInt(), 3);
+    EXPECT_EQ(cache->Get(*firstClass, handleKey.GetTaggedValue()).GetInt(), 1);
+
+    cache->Clear();
+    EXPECT_TRUE(cache->IsEmpty());
+    EXPECT_TRUE(cache->Get(*firstClass, handleKey.GetTaggedValue()).IsHole());
+    EXPECT_TRUE(cache->Get(*secondClass, handleKey.GetTaggedValue()).IsHole());
+}
+
+/**
+ * @tc.name: LoadAndStoreByNameInMegaState
+ * @tc.desc: A megamorphic named load and store fill the megamorphic caches through "LoadICByName" and
+ *           "StoreICByName" function, and the caches are cleared when the hclass of a prototype changes.
+ * @tc.type: FUNC
+ * @tc.requre:
+ */
+HWTEST_F_L0(MegaICCacheTest, LoadAndStoreByNameInMegaState)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<GlobalEnv> env = thread->GetEcmaVM()->GetGlobalEnv();
+    JSHandle<JSTaggedValue> objFun = env->GetObjectFunction();
+    JSHandle<JSTaggedValue> handleKey(factory->NewFromASCII("key"));
+    JSHandle<JSTaggedValue> handleProtoKey(factory->NewFromASCII("protoKey"));
+    JSHandle<JSTaggedValue> handleStoreVal(thread, JSTaggedValue(2));
+
+    JSHandle<JSObject> handleProto = factory->NewJSObjectByConstructor(JSHandle<JSFunction>(objFun), objFun);
+    JSHandle<JSObject> handleObj = JSObject::ObjectCreate(thread, handleProto);
+    JSHandle<JSHClass> oldClass(thread, handleObj->GetJSHClass());
+
+    uint32_t arrayLength = 2U; // 2 means ProfileTypeInfo length
+    JSHandle<TaggedArray> handleTaggedArray = factory->NewTaggedArray(arrayLength);
+    JSHandle<ProfileTypeInfo> handleProfileTypeInfo = JSHandle<ProfileTypeInfo>::Cast(handleTaggedArray);
+    // the slot is hole, which means megamorphic
+    ASSERT_TRUE(handleProfileTypeInfo->Get(0).IsHole());
+
+    thread->ClearMegaICCache();
+    ICRuntimeStub::StoreICByName(thread, *handleProfileTypeInfo, handleObj.GetTaggedValue(),
+                                 handleKey.GetTaggedValue(), handleStoreVal.GetTaggedValue(), 0);
+    EXPECT_FALSE(thread->GetStoreMegaICCache()->Get(*oldClass, handleKey.GetTaggedValue()).IsHole());
+
+    JSTaggedValue resultValue = ICRuntimeStub::LoadICByName(thread, *handleProfileTypeInfo,
+        handleObj.GetTaggedValue(), handleKey.GetTaggedValue(), 0);
+    EXPECT_EQ(resultValue.GetInt(), 2);
+    JSHClass *newClass = handleObj->GetJSHClass();
+    EXPECT_FALSE(thread->GetLoadMegaICCache()->Get(newClass, handleKey.GetTaggedValue()).IsHole());
+    EXPECT_EQ(ICRuntimeStub::TryLoadICByMega(thread, handleObj.GetTaggedValue(),
+        handleKey.GetTaggedValue()).GetInt(), 2);
+    // the profile slot stays megamorphic
+    EXPECT_TRUE(handleProfileTypeInfo->Get(0).IsHole());
+
+    // adding a property to the prototype changes its hclass
+    JSObject::SetProperty(thread, handleProto, handleProtoKey, handleStoreVal);
+    EXPECT_TRUE(thread->GetLoadMegaICCache()->IsEmpty());
+    EXPECT_TRUE(thread->GetStoreMegaICCache()->IsEmpty());
+}
+} // namespace panda::test
@@ -572,6 +572,10 @@ JSTaggedValue FastRuntimeStub::SetPropertyByIndex(JSThread *thread, JSTaggedValu
             }
             if (index < elements->GetLength()) {
                 if (!elements->Get(index).IsHole()) {
+                    if (UNLIKELY(!hclass->ContainsElementsKind(Elements::ToElementsKind(value)))) {
+                        // the elements kind transition allocates, leave it to the slow path
+                        return JSTaggedValue::Hole();
+                    }
                     elements->Set(thread, index, value);
                     return JSTaggedValue::Undefined();
                 }
@@ -16,9 +16,11 @@
 #ifndef ECMASCRIPT_INTERPRETER_INTERPRETER_INL_H
 #define ECMASCRIPT_INTERPRETER_INTERPRETER_INL_H
 
+#include "ecmascript/builtins/builtins_fast_call.h"
 #if defined(ECMASCRIPT_SUPPORT_CPUPROFILER)
 #include "ecmascript/dfx/cpu_profiler/cpu_profiler.h"
 #endif
+#include "ecmascript/dfx/vmstat/bytecode_profiler.h"
 #include "ecmascript/ecma_string.h"
 #include "ecmascript/ecma_vm.h"
 #include "ecmascript/global_env.h"
@@ -34,6 +36,7 @@
 #include "ecmascript/js_tagged_value.h"
 #include "ecmascript/mem/concurrent_marker.h"
 #include "ecmascript/module/js_module_manager.h"
+#include "ecmascript/pgo/pgo_profiler.h"
 #include "ecmascript/runtime_call_id.h"
 #include "ecmascript/template_string.h"
 #include "ecmascript/tooling/interface/js_debugger_manager.h"
@@ -119,6 +122,12 @@ using CommonStubCSigns = kungfu::CommonStubCSigns;
         DISPATCH_OFFSET(jumpSize);                                                      \
     } while (false)
 
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define CHECK_SWITCH_TO_PROFILER_TABLE()                                           \
+    if (UNLIKELY(profiler->IsEnabled()) && dispatchTable == &instDispatchTable) { \
+        dispatchTable = &profileDispatchTable;                                     \
+    }
+
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define CHECK_SWITCH_TO_DEBUGGER_TABLE()    \
     if (ecmaVm->GetJsDebuggerManager()->IsDebugMode()) { \
@@ -558,17 +567,22 @@ JSTaggedValue EcmaInterpreter::Execute(EcmaRuntimeCallInfo *info)
 
 JSTaggedValue EcmaInterpreter::GeneratorReEnterInterpreter(JSThread *thread, JSHandle<GeneratorContext> context)
 {
-    [[maybe_unused]] EcmaHandleScope handleScope(thread);
-    JSHandle<JSFunction> func = JSHandle<JSFunction>::Cast(JSHandle<JSTaggedValue>(thread, context->GetMethod()));
-    JSMethod *method = func->GetCallTarget();
+    JSMethod *method = JSFunction::Cast(context->GetMethod().GetTaggedObject())->GetCallTarget();
     if (method->IsAotWithCallField()) {
         return GeneratorReEnterAot(thread, context);
     }
+    return ReEnterInterpreter(thread, context);
+}
 
+JSTaggedValue EcmaInterpreter::ReEnterInterpreter(JSThread *thread, JSHandle<GeneratorContext> context)
+{
     if (thread->IsAsmInterpreter()) {
         return InterpreterAssembly::GeneratorReEnterInterpreter(thread, context);
     }
 
+    [[maybe_unused]] EcmaHandleScope handleScope(thread);
+    JSHandle<JSFunction> func = JSHandle<JSFunction>::Cast(JSHandle<JSTaggedValue>(thread, context->GetMethod()));
+    JSMethod *method = func->GetCallTarget();
     JSTaggedType *currentSp = const_cast<JSTaggedType *>(thread->GetCurrentSPFrame());
 
     // push break frame
@@ -687,7 +701,8 @@ NO_UB_SANITIZE void EcmaInterpreter::RunInternal(JSThread *thread, ConstantPool
 {
     INTERPRETER_TRACE(thread, RunInternal);
     uint8_t opcode = READ_INST_OP();
-    JSTaggedValue acc = JSTaggedValue::Hole();
+    // a resumed frame starts with the acc it was suspended or deoptimized with
+    JSTaggedValue acc = GET_FRAME(sp)->acc;
     EcmaVM *ecmaVm = thread->GetEcmaVM();
     JSHandle<GlobalEnv> globalEnv = ecmaVm->GetGlobalEnv();
     JSTaggedValue globalObj = globalEnv->GetGlobalObject();
@@ -702,7 +717,15 @@ NO_UB_SANITIZE void EcmaInterpreter::RunInternal(JSThread *thread, ConstantPool
 #include "templates/debugger_instruction_dispatch.inl"
     };
 
+    static std::array<const void *, numOps> profileDispatchTable {
+#include "templates/profiler_instruction_dispatch.inl"
+    };
+
+    BytecodeProfiler *profiler = ecmaVm->GetBytecodeProfiler();
+    BytecodeProfiler::DispatchState profileState;
     std::array<const void *, numOps> *dispatchTable = &instDispatchTable;
+    // the debugger needs its own table, it wins over the profiler
+    CHECK_SWITCH_TO_PROFILER_TABLE();
     CHECK_SWITCH_TO_DEBUGGER_TABLE();
     goto *(*dispatchTable)[opcode];
 
@@ -914,6 +937,23 @@ NO_UB_SANITIZE void EcmaInterpreter::RunInternal(JSThread *thread, ConstantPool
             CALL_PUSH_ARGS(I);
         }
         setVregsAndFrameNative: {
+            uint8_t builtinId = method->GetBuiltinId();
+            if (builtinId != builtins::BuiltinsFastCall::NONE &&
+                actualNumArgs <= static_cast<int32_t>(builtins::BuiltinsFastCall::MAX_ARGS)) {
+                // the pushed args start at newSp, the fast call needs no frame
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                JSTaggedValue fastThis(callThis ? sp[funcReg + callThis] : JSTaggedValue::VALUE_UNDEFINED);
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                JSTaggedValue arg0(actualNumArgs > 0 ? newSp[0] : JSTaggedValue::VALUE_UNDEFINED);
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                JSTaggedValue arg1(actualNumArgs > 1 ? newSp[1] : JSTaggedValue::VALUE_UNDEFINED);
+                JSTaggedValue fastValue = builtins::BuiltinsFastCall::Call(
+                    thread, builtinId, fastThis, static_cast<uint32_t>(actualNumArgs), arg0, arg1);
+                if (!fastValue.IsHole()) {
+                    SET_ACC(fastValue);
+                    INTERPRETER_HANDLE_RETURN();
+                }
+            }
             // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
             *(--newSp) = (callThis ? sp[funcReg + callThis] : JSTaggedValue::VALUE_UNDEFINED);  // push this
             *(--newSp) = JSTaggedValue::VALUE_UNDEFINED;  // push new target
@@ -939,6 +979,8 @@ NO_UB_SANITIZE void EcmaInterpreter::RunInternal(JSThread *thread, ConstantPool
             }
             LOG_INST() << "Exit: Runtime Call.";
             SET_ACC(retValue);
+            // the native function may have started the profiler, e.g. ArkTools.startBytecodeProfiler
+            CHECK_SWITCH_TO_PROFILER_TABLE();
             INTERPRETER_HANDLE_RETURN();
         }
         setVregsAndFrameNotNative: {
@@ -3240,7 +3282,8 @@ NO_UB_SANITIZE void EcmaInterpreter::RunInternal(JSThread *thread, ConstantPool
                 INTERPRETER_RETURN_IF_ABRUPT(res);
                 SET_ACC(res);
                 DISPATCH(BytecodeInstruction::Format::PREF_ID32_V8);
-            } else if (!firstValue.IsHole()) { // IC miss and not enter the megamorphic state, store as polymorphic
+            } else if (!firstValue.IsHole() || ICRuntimeStub::CanUseMegaICCache(receiver)) {
+                // IC miss: store as polymorphic, or probe the megamorphic cache in the megamorphic state
                 uint32_t stringId = READ_INST_32_1();
                 JSTaggedValue propKey = constpool->GetObjectFromCache(stringId);
                 res = ICRuntimeStub::LoadICByName(thread,
@@ -3297,7 +3340,8 @@ NO_UB_SANITIZE void EcmaInterpreter::RunInternal(JSThread *thread, ConstantPool
                 INTERPRETER_RETURN_IF_ABRUPT(res);
                 RESTORE_ACC();
                 DISPATCH(BytecodeInstruction::Format::PREF_ID32_V8);
-            } else if (!firstValue.IsHole()) { // IC miss and not enter the megamorphic state, store as polymorphic
+            } else if (!firstValue.IsHole() || ICRuntimeStub::CanUseMegaICCache(receiver)) {
+                // IC miss: store as polymorphic, or probe the megamorphic cache in the megamorphic state
                 uint32_t stringId = READ_INST_32_1();
                 JSTaggedValue propKey = constpool->GetObjectFromCache(stringId);
                 res = ICRuntimeStub::StoreICByName(thread,
@@ -3735,6 +3779,65 @@ NO_UB_SANITIZE void EcmaInterpreter::RunInternal(JSThread *thread, ConstantPool
         thread->SetCurrentSPFrame(sp);
         DISPATCH_OFFSET(0);
     }
+    HANDLE_OPCODE(HANDLE_LDA_DYN_V8_STA_DYN_V8) {
+        uint16_t vsrc = READ_INST_8_0();
+        LOG_INST() << "lda.dyn v" << vsrc;
+        SET_ACC(JSTaggedValue(GET_VREG(vsrc)))
+        ADVANCE_PC(BytecodeInstruction::Size(BytecodeInstruction::Format::V8))
+        uint16_t vdst = READ_INST_8_0();
+        LOG_INST() << "sta.dyn v" << vdst;
+        SET_VREG(vdst, GET_ACC().GetRawData())
+        DISPATCH(BytecodeInstruction::Format::V8);
+    }
+    HANDLE_OPCODE(HANDLE_STA_DYN_V8_LDA_DYN_V8) {
+        uint16_t vdst = READ_INST_8_0();
+        LOG_INST() << "sta.dyn v" << vdst;
+        SET_VREG(vdst, GET_ACC().GetRawData())
+        ADVANCE_PC(BytecodeInstruction::Size(BytecodeInstruction::Format::V8))
+        uint16_t vsrc = READ_INST_8_0();
+        LOG_INST() << "lda.dyn v" << vsrc;
+        SET_ACC(JSTaggedValue(GET_VREG(vsrc)))
+        DISPATCH(BytecodeInstruction::Format::V8);
+    }
+    HANDLE_OPCODE(HANDLE_STA_DYN_V8_CALLITHISRANGEDYN_PREF_IMM16_V8) {
+        uint16_t vdst = READ_INST_8_0();
+        LOG_INST() << "sta.dyn v" << vdst;
+        SET_VREG(vdst, GET_ACC().GetRawData())
+        // the call runs at its own pc, which the frame of the callee returns to
+        ADVANCE_PC(BytecodeInstruction::Size(BytecodeInstruction::Format::V8))
+        goto HANDLE_CALLITHISRANGEDYN_PREF_IMM16_V8;
+    }
+    HANDLE_OPCODE(HANDLE_LESSDYN_PREF_V8_JEQZ_IMM8) {
+        uint16_t v0 = READ_INST_8_1();
+        LOG_INST() << "intrinsics::lessdyn"
+                   << " v" << v0;
+        JSTaggedValue left = GET_VREG_VALUE(v0);
+        JSTaggedValue right = GET_ACC();
+        if (!left.IsNumber() || !right.IsNumber()) {
+            goto HANDLE_LESSDYN_PREF_V8;
+        }
+        double valueA = left.IsInt() ? static_cast<double>(left.GetInt()) : left.GetDouble();
+        double valueB = right.IsInt() ? static_cast<double>(right.GetInt()) : right.GetDouble();
+        bool ret = JSTaggedValue::StrictNumberCompare(valueA, valueB) == ComparisonResult::LESS;
+        SET_ACC(ret ? JSTaggedValue::True() : JSTaggedValue::False())
+        ADVANCE_PC(BytecodeInstruction::Size(BytecodeInstruction::Format::PREF_V8))
+        if (!ret) {
+            // the jeqz jumps, it updates the hotness counter of a back edge
+            goto HANDLE_JEQZ_IMM8;
+        }
+        DISPATCH(BytecodeInstruction::Format::IMM8);
+    }
+    HANDLE_OPCODE(PROFILE_HANDLER) {
+        opcode = READ_INST_OP();
+        if (UNLIKELY(!profiler->IsEnabled())) {
+            // the profiler was stopped while it ran, the next bytecodes are no longer counted
+            dispatchTable = &instDispatchTable;
+        } else {
+            JSTaggedValue func = GET_FRAME(sp)->function;
+            profiler->CountBytecode(opcode, ECMAObject::Cast(func.GetTaggedObject())->GetCallTarget(), &profileState);
+        }
+        REAL_GOTO_DISPATCH_OPCODE(opcode);
+    }
     HANDLE_OPCODE(HANDLE_OVERFLOW) {
         LOG_INTERPRETER(FATAL) << "opcode overflow";
     }
@@ -3877,6 +3980,10 @@ bool EcmaInterpreter::UpdateHotnessCounter(JSThread* thread, JSTaggedType *sp, J
         SAVE_ACC();
         needRestoreAcc = thread->CheckSafepoint();
         RESTORE_ACC();
+        PGOProfiler *profiler = thread->GetEcmaVM()->GetPGOProfiler();
+        if (profiler->IsEnabled()) {
+            profiler->Sample(method);
+        }
         if (state->profileTypeInfo == JSTaggedValue::Undefined()) {
             state->acc = acc;
             // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
@@ -4091,6 +4198,11 @@ std::string GetEcmaOpcodeStr(EcmaOpcode opcode)
         {JNEZ_IMM8, "JNEZ"},
         {JNEZ_IMM16, "JNEZ"},
         {LAST_OPCODE, "LAST_OPCODE"},
+        {LDA_DYN_V8_STA_DYN_V8, "LDA_DYN_STA_DYN"},
+        {STA_DYN_V8_LDA_DYN_V8, "STA_DYN_LDA_DYN"},
+        {STA_DYN_V8_CALLITHISRANGEDYN_PREF_IMM16_V8, "STA_DYN_CALLITHISRANGEDYN"},
+        {LESSDYN_PREF_V8_JEQZ_IMM8, "LESSDYN_JEQZ"},
+        {LAST_SUPER_OPCODE, "LAST_SUPER_OPCODE"},
     };
     if (strMap.count(opcode) > 0) {
         return strMap.at(opcode);
@@ -4110,6 +4222,7 @@ std::string GetEcmaOpcodeStr(EcmaOpcode opcode)
 #undef RESTORE_ACC
 #undef INTERPRETER_GOTO_EXCEPTION_HANDLER
 #undef INTERPRETER_HANDLE_RETURN
+#undef CHECK_SWITCH_TO_PROFILER_TABLE
 #undef CHECK_SWITCH_TO_DEBUGGER_TABLE
 #undef REAL_GOTO_DISPATCH_OPCODE
 #undef REAL_GOTO_EXCEPTION_HANDLER
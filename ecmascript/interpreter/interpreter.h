@@ -41,6 +41,8 @@ public:
         JSHandle<JSTaggedValue> newTarget, int32_t numArgs);
     static inline JSTaggedValue GeneratorReEnterInterpreter(JSThread *thread, JSHandle<GeneratorContext> context);
     static inline JSTaggedValue GeneratorReEnterAot(JSThread *thread, JSHandle<GeneratorContext> context);
+    // Resume the frame saved in the context in the interpreter, even if the method has aot code.
+    static inline JSTaggedValue ReEnterInterpreter(JSThread *thread, JSHandle<GeneratorContext> context);
     static inline void RunInternal(JSThread *thread, ConstantPool *constpool, const uint8_t *pc, JSTaggedType *sp);
     static inline void InitStackFrame(JSThread *thread);
     static inline uint32_t FindCatchBlock(JSMethod *caller, uint32_t pc);
@@ -212,6 +214,13 @@ enum EcmaOpcode {
     JNEZ_IMM8,
     JNEZ_IMM16,
     LAST_OPCODE,
+    // superinstructions, the translator rewrites the opcode of the first instruction of a frequent pair to one of
+    // them and leaves the second instruction as it is, so the offsets of the bytecode do not change
+    LDA_DYN_V8_STA_DYN_V8,
+    STA_DYN_V8_LDA_DYN_V8,
+    STA_DYN_V8_CALLITHISRANGEDYN_PREF_IMM16_V8,
+    LESSDYN_PREF_V8_JEQZ_IMM8,
+    LAST_SUPER_OPCODE,
 };
 
 // if modify EcmaOpcode, please update GetEcmaOpcodeStr()
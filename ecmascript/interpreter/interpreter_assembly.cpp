@@ -16,6 +16,7 @@
 #include "ecmascript/interpreter/interpreter_assembly.h"
 
 #include "ecmascript/dfx/vmstat/runtime_stat.h"
+#include "ecmascript/ecma_handle_scope.h"
 #include "ecmascript/ecma_string.h"
 #include "ecmascript/ecma_vm.h"
 #include "ecmascript/global_env.h"
@@ -23,11 +24,13 @@
 #include "ecmascript/interpreter/fast_runtime_stub-inl.h"
 #include "ecmascript/interpreter/frame_handler.h"
 #include "ecmascript/interpreter/slow_runtime_stub.h"
+#include "ecmascript/jit/jit.h"
 #include "ecmascript/jspandafile/literal_data_extractor.h"
 #include "ecmascript/jspandafile/program_object.h"
 #include "ecmascript/js_generator_object.h"
 #include "ecmascript/js_tagged_value.h"
 #include "ecmascript/mem/concurrent_marker.h"
+#include "ecmascript/pgo/pgo_profiler.h"
 #include "ecmascript/runtime_call_id.h"
 #include "ecmascript/template_string.h"
 #include "libpandafile/code_data_accessor.h"
@@ -3032,8 +3035,8 @@ void InterpreterAssembly::HandleLdObjByNamePrefId32V8(
             JSTaggedValue secondValue = profileTypeArray->Get(slotId + 1);
             res = ICRuntimeStub::TryLoadICByName(thread, receiver, firstValue, secondValue);
         }
-        // IC miss and not enter the megamorphic state, store as polymorphic
-        if (res.IsHole() && !firstValue.IsHole()) {
+        // IC miss: store as polymorphic, or probe the megamorphic cache in the megamorphic state
+        if (res.IsHole() && (!firstValue.IsHole() || ICRuntimeStub::CanUseMegaICCache(receiver))) {
             uint32_t stringId = READ_INST_32_1();
             JSTaggedValue propKey = ConstantPool::Cast(constpool.GetTaggedObject())->GetObjectFromCache(stringId);
             res = ICRuntimeStub::LoadICByName(thread, profileTypeArray, receiver, propKey, slotId);
@@ -3089,8 +3092,8 @@ void InterpreterAssembly::HandleStObjByNamePrefId32V8(
             JSTaggedValue secondValue = profileTypeArray->Get(slotId + 1);
             res = ICRuntimeStub::TryStoreICByName(thread, receiver, firstValue, secondValue, value);
         }
-        // IC miss and not enter the megamorphic state, store as polymorphic
-        if (res.IsHole() && !firstValue.IsHole()) {
+        // IC miss: store as polymorphic, or probe the megamorphic cache in the megamorphic state
+        if (res.IsHole() && (!firstValue.IsHole() || ICRuntimeStub::CanUseMegaICCache(receiver))) {
             uint32_t stringId = READ_INST_32_1();
             JSTaggedValue propKey = ConstantPool::Cast(constpool.GetTaggedObject())->GetObjectFromCache(stringId);
             res = ICRuntimeStub::StoreICByName(thread, profileTypeArray, receiver, propKey, value, slotId);
@@ -3498,6 +3501,36 @@ void InterpreterAssembly::ExceptionHandler(
     thread->ClearException();
     DISPATCH_OFFSET(0);
 }
+
+// a superinstruction steps over its first instruction only, so the debugger stops at the second one
+void InterpreterAssembly::HandleLdaDynV8StaDynV8(
+    JSThread *thread, const uint8_t *pc, JSTaggedType *sp, JSTaggedValue constpool, JSTaggedValue profileTypeInfo,
+    JSTaggedValue acc, int32_t hotnessCounter)
+{
+    HandleLdaDynV8(thread, pc, sp, constpool, profileTypeInfo, acc, hotnessCounter);
+}
+
+void InterpreterAssembly::HandleStaDynV8LdaDynV8(
+    JSThread *thread, const uint8_t *pc, JSTaggedType *sp, JSTaggedValue constpool, JSTaggedValue profileTypeInfo,
+    JSTaggedValue acc, int32_t hotnessCounter)
+{
+    HandleStaDynV8(thread, pc, sp, constpool, profileTypeInfo, acc, hotnessCounter);
+}
+
+void InterpreterAssembly::HandleStaDynV8CallIThisRangeDynPrefImm16V8(
+    JSThread *thread, const uint8_t *pc, JSTaggedType *sp, JSTaggedValue constpool, JSTaggedValue profileTypeInfo,
+    JSTaggedValue acc, int32_t hotnessCounter)
+{
+    HandleStaDynV8(thread, pc, sp, constpool, profileTypeInfo, acc, hotnessCounter);
+}
+
+void InterpreterAssembly::HandleLessDynPrefV8JeqzImm8(
+    JSThread *thread, const uint8_t *pc, JSTaggedType *sp, JSTaggedValue constpool, JSTaggedValue profileTypeInfo,
+    JSTaggedValue acc, int32_t hotnessCounter)
+{
+    HandleLessDynPrefV8(thread, pc, sp, constpool, profileTypeInfo, acc, hotnessCounter);
+}
+
 void InterpreterAssembly::HandleOverflow(
     JSThread *thread, const uint8_t *pc, JSTaggedType *sp, JSTaggedValue constpool, JSTaggedValue profileTypeInfo,
     JSTaggedValue acc, int32_t hotnessCounter)
@@ -3629,7 +3662,16 @@ inline JSTaggedValue InterpreterAssembly::UpdateHotnessCounter(JSThread* thread,
 {
     AsmInterpretedFrame *state = GET_ASM_FRAME(sp);
     thread->CheckSafepoint();
+    Jit *jit = thread->GetEcmaVM()->GetJit();
+    if (jit->IsEnabled()) {
+        [[maybe_unused]] EcmaHandleScope handleScope(thread);
+        jit->OnMethodHot(thread, JSHandle<JSFunction>(thread, state->function));
+    }
     JSFunction* function = JSFunction::Cast(state->function.GetTaggedObject());
+    PGOProfiler *profiler = thread->GetEcmaVM()->GetPGOProfiler();
+    if (profiler->IsEnabled()) {
+        profiler->Sample(function->GetMethod());
+    }
     JSTaggedValue profileTypeInfo = function->GetProfileTypeInfo();
     if (profileTypeInfo == JSTaggedValue::Undefined()) {
         auto method = function->GetMethod();
@@ -82,14 +82,15 @@ JSTaggedValue SlowRuntimeHelper::NewObject(EcmaRuntimeCallInfo *info)
 void SlowRuntimeHelper::SaveFrameToContext(JSThread *thread, JSHandle<GeneratorContext> context)
 {
     FrameHandler frameHandler(thread);
-    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
     uint32_t nregs = frameHandler.GetNumberArgs();
-    JSHandle<TaggedArray> regsArray = factory->NewTaggedArray(nregs);
+    JSHandle<TaggedArray> regsArray = GetContextRegsArray(thread, context, nregs);
     for (uint32_t i = 0; i < nregs; i++) {
         JSTaggedValue value = frameHandler.GetVRegValue(i);
-        regsArray->Set(thread, i, value);
+        // a register that still holds the value it was saved with needs no store with a barrier
+        if (regsArray->Get(i) != value) {
+            regsArray->Set(thread, i, value);
+        }
     }
-    context->SetRegsArray(thread, regsArray.GetTaggedValue());
     context->SetMethod(thread, frameHandler.GetFunction());
 
     context->SetAcc(thread, frameHandler.GetAcc());
@@ -98,6 +99,19 @@ void SlowRuntimeHelper::SaveFrameToContext(JSThread *thread, JSHandle<GeneratorC
     context->SetBCOffset(frameHandler.GetBytecodeOffset());
 }
 
+JSHandle<TaggedArray> SlowRuntimeHelper::GetContextRegsArray(JSThread *thread,
+                                                             const JSHandle<GeneratorContext> &context, uint32_t nregs)
+{
+    // the registers are copied back to the frame on resume, so the array is free again when the frame suspends
+    JSTaggedValue regsArray = context->GetRegsArray();
+    if (regsArray.IsTaggedArray() && TaggedArray::Cast(regsArray.GetTaggedObject())->GetLength() >= nregs) {
+        return JSHandle<TaggedArray>(thread, regsArray);
+    }
+    JSHandle<TaggedArray> newRegsArray = thread->GetEcmaVM()->GetFactory()->NewTaggedArray(nregs);
+    context->SetRegsArray(thread, newRegsArray.GetTaggedValue());
+    return newRegsArray;
+}
+
 JSTaggedValue ConstructGeneric(JSThread *thread, JSHandle<JSFunction> ctor, JSHandle<JSTaggedValue> newTgt,
                                JSHandle<JSTaggedValue> preArgs, uint32_t argsCount, uint32_t baseArgLocation)
 {
@@ -29,6 +29,10 @@ public:
 
     static void SaveFrameToContext(JSThread *thread, JSHandle<GeneratorContext> context);
 
+    // Get an array for the nregs registers of a suspended frame, the one of the previous suspend is reused.
+    static JSHandle<TaggedArray> GetContextRegsArray(JSThread *thread, const JSHandle<GeneratorContext> &context,
+                                                     uint32_t nregs);
+
     static JSTaggedValue Construct(JSThread *thread, JSHandle<JSTaggedValue> ctor, JSHandle<JSTaggedValue> newTarget,
                                    JSHandle<JSTaggedValue> preArgs, uint32_t argsCount, uint32_t baseArgLocation);
 };
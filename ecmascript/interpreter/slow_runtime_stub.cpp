@@ -17,6 +17,7 @@
 
 #include "ecmascript/base/number_helper.h"
 #include "ecmascript/builtins/builtins_regexp.h"
+#include "ecmascript/dfx/vmstat/bytecode_profiler.h"
 #include "ecmascript/global_dictionary-inl.h"
 #include "ecmascript/ic/profile_type_info.h"
 #include "ecmascript/interpreter/frame_handler.h"
@@ -43,6 +44,14 @@
 #include "ecmascript/template_string.h"
 
 namespace panda::ecmascript {
+inline void CountSlowRuntimeEntry(JSThread *thread)
+{
+    BytecodeProfiler *profiler = thread->GetEcmaVM()->GetBytecodeProfiler();
+    if (UNLIKELY(profiler->IsEnabled())) {
+        profiler->CountSlowPath();
+    }
+}
+
 JSTaggedValue SlowRuntimeStub::CallSpreadDyn(JSThread *thread, JSTaggedValue func, JSTaggedValue obj,
                                              JSTaggedValue array)
 {
@@ -108,7 +117,7 @@ JSTaggedValue SlowRuntimeStub::AsyncFunctionEnter(JSThread *thread)
     JSHandle<JSAsyncFuncObject> asyncFuncObj = factory->NewJSAsyncFuncObject();
     asyncFuncObj->SetPromise(thread, promiseObject);
 
-    JSHandle<GeneratorContext> context = factory->NewGeneratorContext();
+    JSHandle<GeneratorContext> context = JSAsyncFunction::NewAsyncContext(thread);
     context->SetGeneratorObject(thread, asyncFuncObj);
 
     // change state to EXECUTING
@@ -916,6 +925,8 @@ JSTaggedValue SlowRuntimeStub::AsyncFunctionResolveOrReject(JSThread *thread, JS
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
     info->SetCallArg(valueHandle.GetTaggedValue());
     [[maybe_unused]] JSTaggedValue res = JSFunction::Call(info);
+    // the function has completed, its context is free for the next async function
+    JSAsyncFunction::ReleaseAsyncContext(thread, asyncFuncObjHandle);
 
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
     return promise.GetTaggedValue();
@@ -1301,6 +1312,10 @@ JSTaggedValue SlowRuntimeStub::CopyDataProperties(JSThread *thread, JSTaggedValu
 
     JSHandle<JSTaggedValue> dstHandle(thread, dst);
     JSHandle<JSTaggedValue> srcHandle(thread, src);
+    if (JSObject::FastCopyDataProperties(thread, dstHandle, srcHandle)) {
+        RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+        return dstHandle.GetTaggedValue();
+    }
     if (!srcHandle->IsNull() && !srcHandle->IsUndefined()) {
         JSHandle<TaggedArray> keys = JSTaggedValue::GetOwnPropertyKeys(thread, srcHandle);
         RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
@@ -1396,7 +1411,8 @@ JSTaggedValue SlowRuntimeStub::CopyRestArgs(JSThread *thread, JSTaggedType *sp,
     INTERPRETER_TRACE(thread, Copyrestargs);
     [[maybe_unused]] EcmaHandleScope handleScope(thread);
 
-    JSHandle<JSTaggedValue> restArray = JSArray::ArrayCreate(thread, JSTaggedNumber(restNumArgs));
+    // the rest arguments are appended one by one, so the array stays packed
+    JSHandle<JSTaggedValue> restArray = JSArray::ArrayCreate(thread, JSTaggedNumber(0));
 
     JSMutableHandle<JSTaggedValue> element(thread, JSTaggedValue::Undefined());
     for (uint32_t i = 0; i < restNumArgs; ++i) {
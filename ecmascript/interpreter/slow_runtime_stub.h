@@ -162,6 +162,9 @@ public:
     static JSTaggedValue ThrowTypeError(JSThread *thread, const char *message);
 
 private:
+    // the entries are counted by INTERPRETER_TRACE for the bytecode profiler, see runtime_call_id.h
+    static constexpr bool IS_SLOW_RUNTIME_STUB = true;
+
     static JSTaggedValue ThrowSyntaxError(JSThread *thread, const char *message);
     static JSTaggedValue GetCallSpreadArgs(JSThread *thread, JSTaggedValue array);
     static JSTaggedValue SetClassInheritanceRelationship(JSThread *thread, JSTaggedValue ctor, JSTaggedValue base);
@@ -166,10 +166,10 @@
         &&DEBUG_HANDLE_JNEZ_IMM8,
         &&DEBUG_HANDLE_JNEZ_IMM16,
         &&DEBUG_EXCEPTION_HANDLER,
-        &&DEBUG_HANDLE_OVERFLOW,
-        &&DEBUG_HANDLE_OVERFLOW,
-        &&DEBUG_HANDLE_OVERFLOW,
-        &&DEBUG_HANDLE_OVERFLOW,
+        &&DEBUG_HANDLE_LDA_DYN_V8,
+        &&DEBUG_HANDLE_STA_DYN_V8,
+        &&DEBUG_HANDLE_STA_DYN_V8,
+        &&DEBUG_HANDLE_LESSDYN_PREF_V8,
         &&DEBUG_HANDLE_OVERFLOW,
         &&DEBUG_HANDLE_OVERFLOW,
         &&DEBUG_HANDLE_OVERFLOW,
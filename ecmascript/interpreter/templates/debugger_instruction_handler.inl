@@ -780,5 +780,5 @@
     }
     HANDLE_OPCODE(DEBUG_HANDLE_OVERFLOW)
     {
-        REAL_GOTO_DISPATCH_OPCODE(EcmaOpcode::LAST_OPCODE + 1);
+        REAL_GOTO_DISPATCH_OPCODE(EcmaOpcode::LAST_SUPER_OPCODE);
     }
@@ -166,10 +166,10 @@
         &&HANDLE_JNEZ_IMM8,
         &&HANDLE_JNEZ_IMM16,
         &&EXCEPTION_HANDLER,
-        &&HANDLE_OVERFLOW,
-        &&HANDLE_OVERFLOW,
-        &&HANDLE_OVERFLOW,
-        &&HANDLE_OVERFLOW,
+        &&HANDLE_LDA_DYN_V8_STA_DYN_V8,
+        &&HANDLE_STA_DYN_V8_LDA_DYN_V8,
+        &&HANDLE_STA_DYN_V8_CALLITHISRANGEDYN_PREF_IMM16_V8,
+        &&HANDLE_LESSDYN_PREF_V8_JEQZ_IMM8,
         &&HANDLE_OVERFLOW,
         &&HANDLE_OVERFLOW,
         &&HANDLE_OVERFLOW,
@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/jit/jit.h"
+
+#include <chrono>
+
+#include "ecmascript/ecma_handle_scope.h"
+#include "ecmascript/ecma_vm.h"
+#include "ecmascript/file_loader.h"
+#include "ecmascript/js_function.h"
+#include "ecmascript/llvm_stackmap_parser.h"
+#include "ecmascript/mem/heap-inl.h"
+#include "ecmascript/mem/machine_code.h"
+#include "ecmascript/object_factory.h"
+#include "ecmascript/taskpool/taskpool.h"
+
+namespace panda::ecmascript {
+namespace {
+uint64_t GetCurrentTimeInUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+}  // namespace
+
+Jit::Jit(EcmaVM *vm) : vm_(vm)
+{
+    const JSRuntimeOptions &options = vm->GetJSOptions();
+    codeBudget_ = options.GetJitCodeBudget();
+    compileTimeBudget_ = static_cast<uint64_t>(options.GetJitCompileTimeBudget()) * 1000;  // 1000: ms to us
+}
+
+Jit::~Jit()
+{
+    // The compilations are created by the compiler library, so they are released before it is unloaded.
+    {
+        os::memory::LockHolder holder(mutex_);
+        terminated_ = true;
+        queued_.clear();
+    }
+    WaitCompileTaskFinished();
+    finished_.clear();
+}
+
+void Jit::Initialize()
+{
+    auto handle = os::library_loader::Load(std::string(COMPILER_LIBRARY));
+    if (!handle) {
+        LOG_ECMA(ERROR) << "Jit is disabled, failed to load " << COMPILER_LIBRARY << ": " << handle.Error().ToString();
+        return;
+    }
+    auto sym = os::library_loader::ResolveSymbol(handle.Value(), CREATE_COMPILATION_SYMBOL);
+    if (!sym) {
+        LOG_ECMA(ERROR) << "Jit is disabled: " << sym.Error().ToString();
+        return;
+    }
+    createCompilation_ = reinterpret_cast<CreateJitCompilationFunc>(sym.Value());
+    libraryHandle_ = std::move(handle.Value());
+}
+
+bool Jit::IsOverBudget() const
+{
+    if (installedCodeSize_ >= codeBudget_) {
+        return true;
+    }
+    return compileTimeBudget_ != 0 && GetCompileTime() >= compileTimeBudget_;
+}
+
+void Jit::OnMethodHot(JSThread *thread, const JSHandle<JSFunction> &func)
+{
+    // The install may move func, so it is read through the handle afterwards.
+    InstallCompiledCode(thread);
+
+    JSMethod *method = func->GetMethod();
+    if (method->IsNativeWithCallField() || method->IsAotWithCallField() ||
+        states_.find(method) != states_.end()) {
+        return;
+    }
+    // A generator resumes at the bytecode offset saved by the interpreter, which compiled code can not do.
+    FunctionKind kind = func->GetFunctionKind();
+    if (kind == FunctionKind::GENERATOR_FUNCTION || kind == FunctionKind::ASYNC_FUNCTION ||
+        kind == FunctionKind::ASYNC_ARROW_FUNCTION) {
+        states_[method] = JitState::FAILED;
+        return;
+    }
+    if (IsOverBudget()) {
+        return;
+    }
+    {
+        os::memory::LockHolder holder(mutex_);
+        if (queued_.size() >= MAX_QUEUED_COMPILATIONS) {
+            return;
+        }
+    }
+
+    [[maybe_unused]] EcmaHandleScope handleScope(thread);
+    JSHandle<JSTaggedValue> constpool(thread, func->GetConstantPool());
+    auto request = std::make_unique<CompileRequest>();
+    request->method = method;
+    request->compilation.reset(createCompilation_(vm_, method));
+    if (request->compilation == nullptr || !request->compilation->BuildCircuit(constpool)) {
+        LOG_ECMA(DEBUG) << "Jit failed to build the circuit of " << method->GetMethodName();
+        states_[method] = JitState::FAILED;
+        return;
+    }
+    states_[method] = JitState::QUEUED;
+
+    os::memory::LockHolder holder(mutex_);
+    queued_.emplace_back(std::move(request));
+    if (!taskRunning_) {
+        taskRunning_ = true;
+        Taskpool::GetCurrentTaskpool()->PostTask(std::make_unique<CompileTask>(this));
+    }
+}
+
+std::unique_ptr<Jit::CompileRequest> Jit::PopRequest()
+{
+    os::memory::LockHolder holder(mutex_);
+    if (terminated_ || queued_.empty()) {
+        taskRunning_ = false;
+        taskFinishedCV_.SignalAll();
+        return nullptr;
+    }
+    auto request = std::move(queued_.front());
+    queued_.pop_front();
+    return request;
+}
+
+void Jit::FinishRequest(std::unique_ptr<CompileRequest> request, uint64_t time)
+{
+    compileTime_.fetch_add(time, std::memory_order_acq_rel);
+    os::memory::LockHolder holder(mutex_);
+    finished_.emplace_back(std::move(request));
+}
+
+bool Jit::CompileTask::Run([[maybe_unused]] uint32_t threadIndex)
+{
+    for (auto request = jit_->PopRequest(); request != nullptr; request = jit_->PopRequest()) {
+        uint64_t startTime = GetCurrentTimeInUs();
+        request->success = request->compilation->Compile(&request->code);
+        // The circuit is released on this thread instead of at the install.
+        request->compilation.reset();
+        jit_->FinishRequest(std::move(request), GetCurrentTimeInUs() - startTime);
+    }
+    return true;
+}
+
+void Jit::WaitCompileTaskFinished()
+{
+    os::memory::LockHolder holder(mutex_);
+    while (taskRunning_) {
+        taskFinishedCV_.Wait(&mutex_);
+    }
+}
+
+void Jit::InstallCompiledCode(JSThread *thread)
+{
+    std::vector<std::unique_ptr<CompileRequest>> finished;
+    {
+        os::memory::LockHolder holder(mutex_);
+        // Each install walks the heap for the closures, so wait for a batch while the task still compiles.
+        if (finished_.empty() || (taskRunning_ && finished_.size() < INSTALL_BATCH_SIZE)) {
+            return;
+        }
+        finished.swap(finished_);
+    }
+
+    [[maybe_unused]] EcmaHandleScope handleScope(thread);
+    std::unordered_map<JSMethod *, uintptr_t> installed;
+    for (auto &request : finished) {
+        JSMethod *method = request->method;
+        if (!request->success || installedCodeSize_ + request->code.code.size() > codeBudget_) {
+            LOG_ECMA(DEBUG) << "Jit drops the code of " << method->GetMethodName();
+            states_[method] = JitState::FAILED;
+            continue;
+        }
+        if (Install(request.get())) {
+            installed.emplace(method, codeEntries_[method]);
+        }
+    }
+    if (!installed.empty()) {
+        UpdateClosures(installed);
+    }
+}
+
+bool Jit::Install(CompileRequest *request)
+{
+    JitCode &code = request->code;
+    JSHandle<MachineCode> machineCode =
+        vm_->GetFactory()->NewMachineCodeObject(code.code.size(), code.code.data());
+    uintptr_t codeAddr = machineCode->GetDataOffsetAddress();
+    kungfu::LLVMStackMapParser *stackMapParser = vm_->GetFileLoader()->GetStackMapParser();
+    if (!code.stackMaps.empty()) {
+        auto stackMaps = std::make_unique<uint8_t[]>(code.stackMaps.size());
+        if (memcpy_s(stackMaps.get(), code.stackMaps.size(), code.stackMaps.data(), code.stackMaps.size()) != EOK) {
+            LOG_FULL(FATAL) << "memcpy_s failed";
+            UNREACHABLE();
+        }
+        if (!stackMapParser->CalculateStackMap(std::move(stackMaps), code.hostCodeAddr, codeAddr)) {
+            states_[request->method] = JitState::FAILED;
+            return false;
+        }
+    }
+    uintptr_t funcEntry = codeAddr + code.funcOffset;
+    kungfu::Func2FpDelta fun2fpDelta;
+    fun2fpDelta[funcEntry] = std::make_pair(code.fpDelta, code.funcSize);
+    stackMapParser->CalculateFuncFpDelta(fun2fpDelta);
+
+    codeObjects_.emplace_back(machineCode.GetTaggedValue());
+    codeEntries_[request->method] = funcEntry;
+    installedCodeSize_ += code.code.size();
+    states_[request->method] = JitState::INSTALLED;
+    LOG_ECMA(DEBUG) << "Jit installs " << request->method->GetMethodName() << " at " << std::hex << funcEntry;
+    return true;
+}
+
+void Jit::UpdateClosures(const std::unordered_map<JSMethod *, uintptr_t> &installed)
+{
+    // The closures created before the install, including the ones in the constant pools, get the code entry here
+    // and the later ones in SetCodeEntry. Only then are the methods marked, since the asm interpreter calls the
+    // code entry of any closure of a marked method. The closures of the methods installed earlier are already
+    // set, so only the methods of this batch are looked up.
+    Heap *heap = const_cast<Heap *>(vm_->GetHeap());
+    heap->Prepare();
+    heap->IterateOverObjects([&installed](TaggedObject *obj) {
+        if (!obj->GetClass()->IsJSFunction()) {
+            return;
+        }
+        JSFunction *func = JSFunction::Cast(obj);
+        auto iter = installed.find(func->GetMethod());
+        if (iter != installed.end()) {
+            func->SetCodeEntry(iter->second);
+        }
+    });
+    for (auto &entry : installed) {
+        entry.first->SetAotCodeBit(true);
+    }
+}
+
+void Jit::SetCodeEntry(JSFunction *func) const
+{
+    auto iter = codeEntries_.find(func->GetMethod());
+    if (iter != codeEntries_.end()) {
+        func->SetCodeEntry(iter->second);
+    }
+}
+
+void Jit::Iterate(const RootVisitor &v)
+{
+    for (auto &code : codeObjects_) {
+        v(Root::ROOT_VM, ObjectSlot(reinterpret_cast<uintptr_t>(&code)));
+    }
+}
+}  // namespace panda::ecmascript
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_JIT_JIT_H
+#define ECMASCRIPT_JIT_JIT_H
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "ecmascript/js_handle.h"
+#include "ecmascript/js_tagged_value.h"
+#include "ecmascript/mem/visitor.h"
+#include "ecmascript/taskpool/task.h"
+#include "libpandabase/os/library_loader.h"
+#include "os/mutex.h"
+
+namespace panda::ecmascript {
+class EcmaVM;
+class JSFunction;
+class JSMethod;
+class JSThread;
+
+// The machine code of one method, generated on a taskpool thread. The code is position independent, it is
+// copied into a MachineCode object when it is installed, and the stackmaps are relocated to that address.
+struct JitCode {
+    std::vector<uint8_t> code {};
+    std::vector<uint8_t> stackMaps {};
+    uintptr_t hostCodeAddr {0};  // address the code was generated at
+    uint32_t funcOffset {0};     // offset of the method entry in the code
+    uint32_t funcSize {0};
+    int fpDelta {0};
+};
+
+// One compilation of a method. It is created by the compiler library, which depends on the runtime and is
+// therefore loaded on demand, see Jit::Initialize.
+class JitCompilation {
+public:
+    JitCompilation() = default;
+    virtual ~JitCompilation() = default;
+    NO_COPY_SEMANTIC(JitCompilation);
+    NO_MOVE_SEMANTIC(JitCompilation);
+
+    // Translate the bytecode into a circuit. It runs on the js thread, since the string operands are resolved
+    // through the constant pool. The constant pool is not used after it returns.
+    virtual bool BuildCircuit(const JSHandle<JSTaggedValue> &constpool) = 0;
+    // Lower the circuit and generate the machine code. It runs on a taskpool thread and must not touch the heap.
+    virtual bool Compile(JitCode *code) = 0;
+};
+
+using CreateJitCompilationFunc = JitCompilation *(*)(EcmaVM *vm, const JSMethod *method);
+
+// Jit is the baseline tier above the asm interpreter. When the hotness counter of a method runs out, its circuit
+// is built on the js thread and queued; a single taskpool task lowers, schedules and generates the queued
+// circuits one by one. The generated code is installed on the js thread at a later hotness check: it is copied
+// into the machine code space, the code entry of every closure of the method is set and the method is marked as
+// compiled, so its next call from the asm interpreter enters the compiled code.
+// Compilation stops when the installed code exceeds the code budget or the background compile time exceeds the
+// time budget.
+class Jit {
+public:
+    explicit Jit(EcmaVM *vm);
+    ~Jit();
+    NO_COPY_SEMANTIC(Jit);
+    NO_MOVE_SEMANTIC(Jit);
+
+    // Load the compiler library. The jit stays disabled if it can not be loaded.
+    void Initialize();
+
+    // Compile with the given factory instead of the one of the compiler library.
+    void SetCreateCompilationFunc(CreateJitCompilationFunc func)
+    {
+        createCompilation_ = func;
+    }
+
+    bool IsEnabled() const
+    {
+        return createCompilation_ != nullptr;
+    }
+
+    // Called on the js thread when the hotness counter of the method of func runs out. It may trigger gc.
+    void OnMethodHot(JSThread *thread, const JSHandle<JSFunction> &func);
+    // Install the code compiled since the last call, once the compile task is idle or a batch is finished.
+    // It may trigger gc.
+    void InstallCompiledCode(JSThread *thread);
+    // Set the code entry of a new closure whose method has been compiled.
+    void SetCodeEntry(JSFunction *func) const;
+    void WaitCompileTaskFinished();
+    void Iterate(const RootVisitor &v);
+
+    bool IsCompiled(const JSMethod *method) const
+    {
+        return codeEntries_.find(method) != codeEntries_.end();
+    }
+
+    size_t GetInstalledCodeSize() const
+    {
+        return installedCodeSize_;
+    }
+
+    uint64_t GetCompileTime() const
+    {
+        return compileTime_.load(std::memory_order_acquire);
+    }
+
+    static constexpr const char *COMPILER_LIBRARY = "libark_jsoptimizer.so";
+    static constexpr const char *CREATE_COMPILATION_SYMBOL = "CreateJitCompilation";
+    // Circuits waiting for the compile task take memory, so hot methods are dropped beyond this count.
+    static constexpr size_t MAX_QUEUED_COMPILATIONS = 16;
+    // Finished compilations installed together while the compile task is still running.
+    static constexpr size_t INSTALL_BATCH_SIZE = 4;
+
+private:
+    enum class JitState : uint8_t {
+        QUEUED,
+        INSTALLED,
+        FAILED,
+    };
+
+    struct CompileRequest {
+        JSMethod *method {nullptr};
+        std::unique_ptr<JitCompilation> compilation {nullptr};
+        JitCode code {};
+        bool success {false};
+    };
+
+    class CompileTask : public Task {
+    public:
+        explicit CompileTask(Jit *jit) : jit_(jit) {}
+        ~CompileTask() override = default;
+        bool Run(uint32_t threadIndex) override;
+
+        NO_COPY_SEMANTIC(CompileTask);
+        NO_MOVE_SEMANTIC(CompileTask);
+
+    private:
+        Jit *jit_;
+    };
+
+    bool IsOverBudget() const;
+    std::unique_ptr<CompileRequest> PopRequest();
+    void FinishRequest(std::unique_ptr<CompileRequest> request, uint64_t time);
+    bool Install(CompileRequest *request);
+    void UpdateClosures(const std::unordered_map<JSMethod *, uintptr_t> &installed);
+
+    EcmaVM *vm_ {nullptr};
+    CreateJitCompilationFunc createCompilation_ {nullptr};
+    os::library_loader::LibraryHandle libraryHandle_ {nullptr};
+    size_t codeBudget_ {0};
+    uint64_t compileTimeBudget_ {0};  // in microseconds, 0 means no limit
+
+    // Accessed on the js thread only.
+    std::unordered_map<const JSMethod *, JitState> states_ {};
+    std::unordered_map<const JSMethod *, uintptr_t> codeEntries_ {};
+    std::vector<JSTaggedValue> codeObjects_ {};
+    size_t installedCodeSize_ {0};
+
+    // Shared with the compile task.
+    os::memory::Mutex mutex_;
+    os::memory::ConditionVariable taskFinishedCV_;
+    std::deque<std::unique_ptr<CompileRequest>> queued_ {};
+    std::vector<std::unique_ptr<CompileRequest>> finished_ {};
+    bool taskRunning_ {false};
+    bool terminated_ {false};
+    std::atomic<uint64_t> compileTime_ {0};  // in microseconds
+};
+}  // namespace panda::ecmascript
+#endif  // ECMASCRIPT_JIT_JIT_H
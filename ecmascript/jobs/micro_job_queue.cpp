@@ -15,11 +15,13 @@
 
 #include "ecmascript/jobs/micro_job_queue.h"
 
+#include "ecmascript/builtins/builtins_promise_job.h"
 #include "ecmascript/global_env.h"
 #include "ecmascript/jobs/hitrace_scope.h"
 #include "ecmascript/jobs/pending_job.h"
 #include "ecmascript/js_arguments.h"
 #include "ecmascript/js_handle.h"
+#include "ecmascript/js_promise.h"
 #include "ecmascript/js_tagged_value.h"
 #include "ecmascript/js_thread.h"
 #include "ecmascript/object_factory.h"
@@ -52,15 +54,47 @@ void MicroJobQueue::EnqueueJob(JSThread *thread, JSHandle<MicroJobQueue> jobQueu
     }
 }
 
+void MicroJobQueue::EnqueuePromiseReactionJob(JSThread *thread, JSHandle<MicroJobQueue> jobQueue,
+    const JSHandle<PromiseReaction> &reaction, const JSHandle<JSTaggedValue> &argument)
+{
+#if defined(ENABLE_HITRACE)
+    // the trace ids live in the PendingJob
+    JSHandle<TaggedArray> argv = thread->GetEcmaVM()->GetFactory()->NewTaggedArray(2);  // 2: reaction, argument
+    argv->Set(thread, 0, reaction);
+    argv->Set(thread, 1, argument);
+    JSHandle<JSFunction> promiseReactionsJob(thread->GetEcmaVM()->GetGlobalEnv()->GetPromiseReactionJob());
+    EnqueueJob(thread, jobQueue, QueueType::QUEUE_PROMISE, promiseReactionsJob, argv);
+#else
+    [[maybe_unused]] EcmaHandleScope handleScope(thread);
+    JSHandle<TaggedQueue> promiseQueue(thread, jobQueue->GetPromiseJobQueue());
+    promiseQueue = JSHandle<TaggedQueue>(thread,
+        TaggedQueue::Push(thread, promiseQueue, JSHandle<JSTaggedValue>::Cast(reaction)));
+    TaggedQueue *newPromiseQueue = TaggedQueue::Push(thread, promiseQueue, argument);
+    jobQueue->SetPromiseJobQueue(thread, JSTaggedValue(newPromiseQueue));
+#endif
+}
+
 void MicroJobQueue::ExecutePendingJob(JSThread *thread, JSHandle<MicroJobQueue> jobQueue)
 {
     [[maybe_unused]] EcmaHandleScope handleScope(thread);
     JSMutableHandle<TaggedQueue> promiseQueue(thread, jobQueue->GetPromiseJobQueue());
     JSMutableHandle<PendingJob> pendingJob(thread, JSTaggedValue::Undefined());
+    JSMutableHandle<PromiseReaction> reaction(thread, JSTaggedValue::Undefined());
+    JSMutableHandle<JSTaggedValue> argument(thread, JSTaggedValue::Undefined());
+    tooling::JsDebuggerManager *jsDebuggerManager = thread->GetEcmaVM()->GetJsDebuggerManager();
+    // the queue array is kept when it runs empty, the jobs enqueued by the next drain go to it again
     while (!promiseQueue->Empty()) {
         LOG_ECMA(VERBOSE) << "ExecutePendingJob length: " << promiseQueue->Size();
-        pendingJob.Update(promiseQueue->Pop(thread));
-        PendingJob::ExecutePendingJob(pendingJob, thread);
+        JSTaggedValue job = promiseQueue->Pop(thread);
+        if (job.IsPromiseReaction()) {
+            reaction.Update(job);
+            argument.Update(promiseQueue->Pop(thread));
+            jsDebuggerManager->GetNotificationManager()->PendingJobEntryEvent();
+            builtins::BuiltinsPromiseJob::ExecutePromiseReaction(thread, reaction, argument);
+        } else {
+            pendingJob.Update(job);
+            PendingJob::ExecutePendingJob(pendingJob, thread);
+        }
         if (thread->HasPendingException()) {
             return;
         }
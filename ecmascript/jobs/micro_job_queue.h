@@ -40,6 +40,10 @@ public:
 
     static void EnqueueJob(JSThread *thread, JSHandle<MicroJobQueue> jobQueue, QueueType queueType,
         const JSHandle<JSFunction> &job, const JSHandle<TaggedArray> &argv);
+    // A PromiseReactionJob is kept in place in the promise queue as the reaction followed by the argument, with
+    // no PendingJob and arguments array for it, and runs without a call of the job function.
+    static void EnqueuePromiseReactionJob(JSThread *thread, JSHandle<MicroJobQueue> jobQueue,
+        const JSHandle<PromiseReaction> &reaction, const JSHandle<JSTaggedValue> &argument);
     static void ExecutePendingJob(JSThread *thread, JSHandle<MicroJobQueue> jobQueue);
 
     static constexpr size_t PROMISE_JOB_QUEUE_OFFSET = Record::SIZE;
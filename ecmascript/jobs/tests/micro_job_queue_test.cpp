@@ -263,4 +263,51 @@ HWTEST_F_L0(MicroJobQueueTest, ExecutePendingJob_002)
     EXPECT_EQ(rejectPromise->GetPromiseState(), PromiseState::REJECTED);
     EXPECT_EQ(JSTaggedValue::SameValue(rejectPromise->GetPromiseResult(), JSTaggedValue(32)), true);
 }
+/**
+ * @tc.name: EnqueuePromiseReactionJob
+ * @tc.desc: Call "EnqueuePromiseReactionJob" function to enter a fulfill reaction and a reject reaction into the
+ *           promise job queue, calling "ExecutePendingJob" function to run them in order and check the promises of
+ *           their capabilities are settled with the arguments, then check the queue is empty and enter a job again.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(MicroJobQueueTest, EnqueuePromiseReactionJob)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    auto env = thread->GetEcmaVM()->GetGlobalEnv();
+    JSHandle<MicroJobQueue> handleMicrojob = thread->GetEcmaVM()->GetMicroJobQueue();
+    JSHandle<JSTaggedValue> promiseFunc = env->GetPromiseFunction();
+
+    JSHandle<PromiseCapability> capbility1 = JSPromise::NewPromiseCapability(thread, promiseFunc);
+    JSHandle<PromiseReaction> fulfillReaction = factory->NewPromiseReaction();
+    fulfillReaction->SetPromiseCapability(thread, capbility1.GetTaggedValue());
+    fulfillReaction->SetHandler(thread, thread->GlobalConstants()->GetIdentityString());
+    JSHandle<JSTaggedValue> value1(thread, JSTaggedValue(16));
+    MicroJobQueue::EnqueuePromiseReactionJob(thread, handleMicrojob, fulfillReaction, value1);
+
+    JSHandle<PromiseCapability> capbility2 = JSPromise::NewPromiseCapability(thread, promiseFunc);
+    JSHandle<PromiseReaction> rejectReaction = factory->NewPromiseReaction();
+    rejectReaction->SetPromiseCapability(thread, capbility2.GetTaggedValue());
+    rejectReaction->SetHandler(thread, thread->GlobalConstants()->GetThrowerString());
+    JSHandle<JSTaggedValue> value2(thread, JSTaggedValue(32));
+    MicroJobQueue::EnqueuePromiseReactionJob(thread, handleMicrojob, rejectReaction, value2);
+
+    JSHandle<TaggedQueue> promiseQueue(thread, handleMicrojob->GetPromiseJobQueue());
+    EXPECT_FALSE(promiseQueue->Empty());
+    MicroJobQueue::ExecutePendingJob(thread, handleMicrojob);
+    EXPECT_FALSE(thread->HasPendingException());
+
+    JSHandle<JSPromise> resolvePromise(thread, capbility1->GetPromise());
+    EXPECT_EQ(resolvePromise->GetPromiseState(), PromiseState::FULFILLED);
+    EXPECT_EQ(resolvePromise->GetPromiseResult().GetInt(), 16);
+    JSHandle<JSPromise> rejectPromise(thread, capbility2->GetPromise());
+    EXPECT_EQ(rejectPromise->GetPromiseState(), PromiseState::REJECTED);
+    EXPECT_EQ(rejectPromise->GetPromiseResult().GetInt(), 32);
+
+    // the queue is empty after the drain and takes the next job
+    promiseQueue = JSHandle<TaggedQueue>(thread, handleMicrojob->GetPromiseJobQueue());
+    EXPECT_TRUE(promiseQueue->Empty());
+    MicroJobQueue::EnqueuePromiseReactionJob(thread, handleMicrojob, fulfillReaction, value1);
+    EXPECT_FALSE(TaggedQueue::Cast(handleMicrojob->GetPromiseJobQueue().GetTaggedObject())->Empty());
+}
 } // namespace panda::test
\ No newline at end of file
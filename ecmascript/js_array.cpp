@@ -80,6 +80,10 @@ JSHandle<JSTaggedValue> JSArray::ArrayCreate(JSThread *thread, JSTaggedNumber le
     // 10. Perform OrdinaryDefineOwnProperty(A, "length", PropertyDescriptor{[[Value]]: length, [[Writable]]:
     // true, [[Enumerable]]: false, [[Configurable]]: false}).
     JSArray::Cast(*obj)->SetArrayLength(thread, normalArrayLength);
+    if (normalArrayLength > 0) {
+        // no element is set yet, all of them are holes.
+        JSHClass::TransitionElementsKind(thread, obj, ElementsKind::HOLE);
+    }
 
     return JSHandle<JSTaggedValue>(obj);
 }
@@ -206,6 +210,17 @@ void JSArray::SetCapacity(JSThread *thread, const JSHandle<JSObject> &array, uin
         JSArray::Cast(*array)->SetArrayLength(thread, newNumOfElements);
         return;
     }
+    if (newLen > oldLen) {
+        // the elements between the old and the new length are holes, unless they are set before, e.g. by splice.
+        bool hasHole = newLen > element->GetLength();
+        for (uint32_t i = oldLen; i < newLen && !hasHole; i++) {
+            hasHole = element->Get(i).IsHole();
+        }
+        if (hasHole) {
+            JSHClass::TransitionElementsKind(thread, array, ElementsKind::HOLE);
+            element = TaggedArray::Cast(array->GetElements().GetTaggedObject());
+        }
+    }
     uint32_t capacity = element->GetLength();
     if (newLen <= capacity) {
         // judge if need to cut down the array size, else fill the unused tail with holes
@@ -347,6 +362,7 @@ JSHandle<JSArray> JSArray::CreateArrayFromList(JSThread *thread, const JSHandle<
     JSArray::Cast(*obj)->SetArrayLength(thread, length);
 
     obj->SetElements(thread, elements);
+    JSHClass::TransitionElementsKind(thread, obj, Elements::ComputeElementsKind(*elements, length));
 
     return JSHandle<JSArray>(obj);
 }
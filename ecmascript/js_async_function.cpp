@@ -21,9 +21,11 @@
 #include "ecmascript/generator_helper.h"
 #include "ecmascript/global_env.h"
 #include "ecmascript/interpreter/interpreter.h"
+#include "ecmascript/js_generator_object.h"
 #include "ecmascript/js_promise.h"
 #include "ecmascript/js_tagged_value-inl.h"
 #include "ecmascript/object_factory.h"
+#include "ecmascript/tagged_array-inl.h"
 
 namespace panda::ecmascript {
 using BuiltinsPromiseHandler = builtins::BuiltinsPromiseHandler;
@@ -38,53 +40,115 @@ void JSAsyncFunction::AsyncFunctionAwait(JSThread *thread, const JSHandle<JSAsyn
 
     JSHandle<JSTaggedValue> asyncCtxt(thread, asyncFuncObj->GetGeneratorContext());
 
-    // 2.Let promiseCapability be ! NewPromiseCapability(%Promise%).
-    JSHandle<GlobalEnv> env = vm->GetGlobalEnv();
-    const GlobalEnvConstants *globalConst = thread->GlobalConstants();
-    JSHandle<PromiseCapability> pcap =
-        JSPromise::NewPromiseCapability(thread, JSHandle<JSTaggedValue>::Cast(env->GetPromiseFunction()));
-
-    // 3.Let resolveResult be ! Call(promiseCapability.[[Resolve]], undefined, « value »).
-    JSHandle<JSTaggedValue> resolve(thread, pcap->GetResolve());
-    JSHandle<JSTaggedValue> thisArg = globalConst->GetHandledUndefined();
-
-    JSHandle<JSTaggedValue> undefined = globalConst->GetHandledUndefined();
-    EcmaRuntimeCallInfo *info =
-        EcmaInterpreter::NewRuntimeCallInfo(thread, resolve, thisArg, undefined, 1);
+    // 2.Let promise be ? PromiseResolve(%Promise%, value).
+    JSHandle<JSPromise> promise = PromiseResolve(thread, value);
     RETURN_IF_ABRUPT_COMPLETION(thread);
-    info->SetCallArg(value.GetTaggedValue());
-    [[maybe_unused]] JSTaggedValue res = JSFunction::Call(info);
 
-    // 4.Let onFulfilled be a new built-in function object as defined in AsyncFunction Awaited Fulfilled.
+    // 3.Let onFulfilled be a new built-in function object as defined in AsyncFunction Awaited Fulfilled.
     JSHandle<JSAsyncAwaitStatusFunction> fulFunc = factory->NewJSAsyncAwaitStatusFunction(
         MethodIndex::BUILTINS_PROMISE_HANDLER_ASYNC_AWAIT_FULFILLED);
 
-    // 5.Let onRejected be a new built-in function object as defined in AsyncFunction Awaited Rejected.
+    // 4.Let onRejected be a new built-in function object as defined in AsyncFunction Awaited Rejected.
     JSHandle<JSAsyncAwaitStatusFunction> rejFunc = factory->NewJSAsyncAwaitStatusFunction(
         MethodIndex::BUILTINS_PROMISE_HANDLER_ASYNC_AWAIT_REJECTED);
 
-    // 6.Set onFulfilled.[[AsyncContext]] to asyncContext.
-    // 7.Set onRejected.[[AsyncContext]] to asyncContext.
+    // 5.Set onFulfilled.[[AsyncContext]] to asyncContext.
+    // 6.Set onRejected.[[AsyncContext]] to asyncContext.
     fulFunc->SetAsyncContext(thread, asyncCtxt);
     rejFunc->SetAsyncContext(thread, asyncCtxt);
 
-    // 8.Let throwawayCapability be ! NewPromiseCapability(%Promise%).
-    // 9.Set throwawayCapability.[[Promise]].[[PromiseIsHandled]] to true.
-    JSHandle<PromiseCapability> tcap =
-        JSPromise::NewPromiseCapability(thread, JSHandle<JSTaggedValue>::Cast(env->GetPromiseFunction()));
-    JSHandle<JSPromise>(thread, tcap->GetPromise())->SetPromiseIsHandled(true);
-
-    // 10.Perform ! PerformPromiseThen(promiseCapability.[[Promise]], onFulfilled, onRejected, throwawayCapability).
-    JSHandle<JSPromise> promise(thread, pcap->GetPromise());
+    // 7.Perform ! PerformPromiseThen(promise, onFulfilled, onRejected).
+    //   The result of the await functions is never used, so no throwaway capability is created for it.
+    JSHandle<PromiseCapability> noCapability(thread->GlobalConstants()->GetHandledUndefined());
     [[maybe_unused]] JSTaggedValue pres = BuiltinsPromise::PerformPromiseThen(
-        thread, promise, JSHandle<JSTaggedValue>::Cast(fulFunc), JSHandle<JSTaggedValue>::Cast(rejFunc), tcap);
+        thread, promise, JSHandle<JSTaggedValue>::Cast(fulFunc), JSHandle<JSTaggedValue>::Cast(rejFunc),
+        noCapability);
 
-    // 11.Remove asyncContext from the execution context stack and restore the execution context that
+    // 8.Remove asyncContext from the execution context stack and restore the execution context that
     //    is at the top of the execution context stack as the running execution context.
-    // 12.Set the code evaluation state of asyncContext such that when evaluation is resumed with a Completion
+    // 9.Set the code evaluation state of asyncContext such that when evaluation is resumed with a Completion
     //    resumptionValue the following steps will be performed:
     //   a.Return resumptionValue.
-    // 13.Return.
+    // 10.Return.
+}
+
+JSHandle<JSPromise> JSAsyncFunction::PromiseResolve(JSThread *thread, const JSHandle<JSTaggedValue> &value)
+{
+    auto vm = thread->GetEcmaVM();
+    JSHandle<GlobalEnv> env = vm->GetGlobalEnv();
+    JSHandle<JSTaggedValue> promiseFunc = env->GetPromiseFunction();
+    // 1.If IsPromise(x) is true, then
+    //   a.Let xConstructor be ? Get(x, "constructor").
+    //   b.If SameValue(xConstructor, C) is true, return x.
+    // A native promise is awaited directly, without a wrapper promise that waits for it in two more jobs.
+    if (value->IsJSPromise()) {
+        JSHandle<JSTaggedValue> ctorKey = thread->GlobalConstants()->GetHandledConstructorString();
+        JSHandle<JSTaggedValue> ctor = JSTaggedValue::GetProperty(thread, value, ctorKey).GetValue();
+        RETURN_HANDLE_IF_ABRUPT_COMPLETION(JSPromise, thread);
+        if (JSTaggedValue::SameValue(ctor, promiseFunc)) {
+            return JSHandle<JSPromise>::Cast(value);
+        }
+    }
+    // A value that is not an object has no then to look up, it fulfills the new promise right away, so the
+    // capability and the resolving functions of the promise are not needed.
+    if (!value->IsECMAObject()) {
+        ObjectFactory *factory = vm->GetFactory();
+        JSHandle<JSPromise> promise = JSHandle<JSPromise>::Cast(
+            factory->NewJSObjectByConstructor(JSHandle<JSFunction>(promiseFunc), promiseFunc));
+        promise->SetPromiseResult(thread, value);
+        promise->SetPromiseFulfillReactions(thread, JSTaggedValue::Undefined());
+        promise->SetPromiseRejectReactions(thread, JSTaggedValue::Undefined());
+        promise->SetPromiseState(PromiseState::FULFILLED);
+        return promise;
+    }
+    // 2.Let promiseCapability be ? NewPromiseCapability(C).
+    JSHandle<PromiseCapability> pcap = JSPromise::NewPromiseCapability(thread, promiseFunc);
+    RETURN_HANDLE_IF_ABRUPT_COMPLETION(JSPromise, thread);
+    // 3.Perform ? Call(promiseCapability.[[Resolve]], undefined, « x »).
+    JSHandle<JSTaggedValue> resolve(thread, pcap->GetResolve());
+    JSHandle<JSTaggedValue> undefined = thread->GlobalConstants()->GetHandledUndefined();
+    EcmaRuntimeCallInfo *info = EcmaInterpreter::NewRuntimeCallInfo(thread, resolve, undefined, undefined, 1);
+    RETURN_HANDLE_IF_ABRUPT_COMPLETION(JSPromise, thread);
+    info->SetCallArg(value.GetTaggedValue());
+    [[maybe_unused]] JSTaggedValue res = JSFunction::Call(info);
+    RETURN_HANDLE_IF_ABRUPT_COMPLETION(JSPromise, thread);
+    // 4.Return promiseCapability.[[Promise]].
+    return JSHandle<JSPromise>(thread, pcap->GetPromise());
+}
+
+JSHandle<GeneratorContext> JSAsyncFunction::NewAsyncContext(JSThread *thread)
+{
+    JSTaggedValue context = thread->GetEcmaVM()->PopAsyncContext();
+    if (context.IsHole()) {
+        return thread->GetEcmaVM()->GetFactory()->NewGeneratorContext();
+    }
+    return JSHandle<GeneratorContext>(thread, context);
+}
+
+void JSAsyncFunction::ReleaseAsyncContext(JSThread *thread, const JSHandle<JSAsyncFuncObject> &asyncFuncObj)
+{
+    JSTaggedValue contextValue = asyncFuncObj->GetGeneratorContext();
+    if (!contextValue.IsGeneratorContext()) {
+        return;
+    }
+    // the completed function is never resumed, nothing refers to its context but the await functions that ran
+    GeneratorContext *context = GeneratorContext::Cast(contextValue.GetTaggedObject());
+    JSTaggedValue undefined = JSTaggedValue::Undefined();
+    JSTaggedValue regsArray = context->GetRegsArray();
+    if (regsArray.IsTaggedArray()) {
+        TaggedArray *regs = TaggedArray::Cast(regsArray.GetTaggedObject());
+        for (uint32_t i = 0; i < regs->GetLength(); i++) {
+            regs->Set(thread, i, undefined);
+        }
+    }
+    context->SetMethod(thread, undefined);
+    context->SetAcc(thread, undefined);
+    context->SetGeneratorObject(thread, undefined);
+    context->SetLexicalEnv(thread, undefined);
+    context->SetNRegs(0);
+    context->SetBCOffset(0);
+    asyncFuncObj->SetGeneratorContext(thread, undefined);
+    thread->GetEcmaVM()->PushAsyncContext(contextValue);
 }
 
 JSHandle<JSTaggedValue> JSAsyncAwaitStatusFunction::AsyncFunctionAwaitFulfilled(
@@ -51,6 +51,14 @@ public:
 
     static void AsyncFunctionAwait(JSThread *thread, const JSHandle<JSAsyncFuncObject> &asyncFuncObj,
                                    const JSHandle<JSTaggedValue> &value);
+
+    // PromiseResolve(%Promise%, value) of the await, a native promise is returned as it is.
+    static JSHandle<JSPromise> PromiseResolve(JSThread *thread, const JSHandle<JSTaggedValue> &value);
+
+    // The context of an async function is taken from the pool of the vm, and goes back to it when the function
+    // completes, with its registers array, so that a call of an async function does not allocate them again.
+    static JSHandle<GeneratorContext> NewAsyncContext(JSThread *thread);
+    static void ReleaseAsyncContext(JSThread *thread, const JSHandle<JSAsyncFuncObject> &asyncFuncObj);
     static constexpr size_t SIZE = JSFunction::SIZE;
 
     DECL_VISIT_OBJECT_FOR_JS_OBJECT(JSFunction, SIZE, SIZE)
@@ -123,33 +123,16 @@ void JSForInIterator::FastGetAllEnumKeys(const JSThread *thread, const JSHandle<
         } else {
             JSHandle<TaggedArray> propertiesArr(thread, obj->GetProperties());
             if (!propertiesArr->IsDictionaryMode()) {
-                JSHClass *jsHclass = obj->GetJSHClass();
-                JSTaggedValue enumCache = jsHclass->GetEnumCache();
+                JSTaggedValue enumCache = JSObject::GetOrCreateEnumCache(thread, obj);
                 if (!enumCache.IsNull()) {
                     JSHandle<TaggedArray> cache(thread, enumCache);
-                    uint32_t length = cache->GetLength();
-                    if (length != numOfKeys) {
-                        JSHandle<LayoutInfo> layoutInfoHandle(thread, jsHclass->GetLayout());
-                        for (uint32_t i = 0; i < numOfKeys; i++) {
-                            JSTaggedValue key = layoutInfoHandle->GetKey(i);
-                            if (key.IsString()) {
-                                value.Update(key);
-                                if (layoutInfoHandle->GetAttr(i).IsEnumerable()) {
-                                    TaggedQueue::PushFixedQueue(thread, remaining, value);
-                                }
-                            }
-                        }
-                    } else {
-                        for (uint32_t i = 0; i < length; i++) {
-                            JSTaggedValue key = cache->Get(i);
-                            if (key.IsString()) {
-                                value.Update(key);
-                                TaggedQueue::PushFixedQueue(thread, remaining, value);
-                            }
-                        }
+                    uint32_t length = JSObject::GetEnumCacheLength(*cache);
+                    for (uint32_t i = 0; i < length; i++) {
+                        value.Update(cache->Get(i));
+                        TaggedQueue::PushFixedQueue(thread, remaining, value);
                     }
                 } else {
-                    JSHandle<LayoutInfo> layoutInfoHandle(thread, jsHclass->GetLayout());
+                    JSHandle<LayoutInfo> layoutInfoHandle(thread, obj->GetJSHClass()->GetLayout());
                     for (uint32_t i = 0; i < numOfKeys; i++) {
                         JSTaggedValue key = layoutInfoHandle->GetKey(i);
                         if (key.IsString()) {
@@ -105,7 +105,10 @@ JSHClass *JSFunction::GetOrCreateInitialJSHClass(JSThread *thread, const JSHandl
         proto = JSHandle<JSTaggedValue>(thread, fun->GetProtoOrDynClass());
     }
 
-    JSHandle<JSHClass> dynclass = factory->NewEcmaDynClass(JSObject::SIZE, JSType::JS_OBJECT, proto);
+    JSHandle<JSHClass> dynclass = factory->NewEcmaDynClass(JSObject::SIZE, JSType::JS_OBJECT,
+                                                           JSHClass::SLACK_TRACKING_INLINED_PROPERTIES);
+    dynclass->SetPrototype(thread, proto.GetTaggedValue());
+    dynclass->SetConstructionCounter(JSHClass::SLACK_TRACKING_CONSTRUCTION_COUNT);
     fun->SetProtoOrDynClass(thread, dynclass);
     return *dynclass;
 }
@@ -129,6 +132,7 @@ bool JSFunction::PrototypeSetter(JSThread *thread, const JSHandle<JSObject> &sel
         // need transition
         JSHandle<JSHClass> dynclass(thread, protoOrDyn);
         JSHandle<JSHClass> newDynclass = JSHClass::TransitionProto(thread, dynclass, value);
+        newDynclass->SetConstructionCounter(dynclass->GetConstructionCounter());
         if (value->IsECMAObject()) {
             JSObject::Cast(value->GetTaggedObject())->GetJSHClass()->SetIsPrototype(true);
         }
@@ -528,6 +532,9 @@ JSHandle<JSHClass> JSFunction::GetInstanceJSHClass(JSThread *thread, JSHandle<JS
     JSHandle<JSHClass> ctorInitialJSHClass(thread, JSFunction::GetOrCreateInitialJSHClass(thread, constructor));
     // newTarget is construct itself
     if (newTarget.GetTaggedValue() == constructor.GetTaggedValue()) {
+        if (UNLIKELY(ctorInitialJSHClass->IsInSlackTracking())) {
+            return TrackSlackOfInstances(thread, constructor, ctorInitialJSHClass);
+        }
         return ctorInitialJSHClass;
     }
 
@@ -537,7 +544,12 @@ JSHandle<JSHClass> JSFunction::GetInstanceJSHClass(JSThread *thread, JSHandle<JS
         if (newTargetFunc->IsDerivedConstructor()) {
             JSTaggedValue newTargetProto = JSTaggedValue::GetPrototype(thread, newTarget);
             if (newTargetProto == constructor.GetTaggedValue()) {
-                return GetOrCreateDerivedJSHClass(thread, newTargetFunc, ctorInitialJSHClass);
+                JSHandle<JSHClass> derivedJSHClass =
+                    GetOrCreateDerivedJSHClass(thread, newTargetFunc, ctorInitialJSHClass);
+                if (UNLIKELY(derivedJSHClass->IsInSlackTracking())) {
+                    return TrackSlackOfInstances(thread, newTargetFunc, derivedJSHClass);
+                }
+                return derivedJSHClass;
             }
         }
     }
@@ -585,10 +597,28 @@ JSHandle<JSHClass> JSFunction::GetOrCreateDerivedJSHClass(JSThread *thread, JSHa
     JSHandle<JSTaggedValue> prototype(thread, derived->GetProtoOrDynClass());
     ASSERT(!prototype->IsHole());
     newJSHClass->SetPrototype(thread, prototype);
+    // the derived class tracks its own slack while it still has the generous inlined properties of the base class.
+    if (ctorInitialJSHClass->IsInSlackTracking()) {
+        newJSHClass->SetConstructionCounter(JSHClass::SLACK_TRACKING_CONSTRUCTION_COUNT);
+    }
     derived->SetProtoOrDynClass(thread, newJSHClass);
     return newJSHClass;
 }
 
+JSHandle<JSHClass> JSFunction::TrackSlackOfInstances(JSThread *thread, const JSHandle<JSFunction> &func,
+                                                     const JSHandle<JSHClass> &initialDynClass)
+{
+    uint32_t counter = initialDynClass->GetConstructionCounter() - 1;
+    initialDynClass->SetConstructionCounter(counter);
+    if (counter != 0) {
+        return initialDynClass;
+    }
+    // The properties added to the instances constructed so far show how many inlined properties are needed.
+    JSHandle<JSHClass> finalDynClass = JSHClass::FinishSlackTracking(thread, initialDynClass);
+    func->SetProtoOrDynClass(thread, finalDynClass);
+    return finalDynClass;
+}
+
 // Those interface below is discarded
 void JSFunction::InitializeJSFunction(JSThread *thread, [[maybe_unused]] const JSHandle<GlobalEnv> &env,
                                       const JSHandle<JSFunction> &func, FunctionKind kind, bool strict)
@@ -233,6 +233,8 @@ public:
 private:
     static JSHandle<JSHClass> GetOrCreateDerivedJSHClass(JSThread *thread, JSHandle<JSFunction> derived,
                                                          JSHandle<JSHClass> ctorInitialDynClass);
+    static JSHandle<JSHClass> TrackSlackOfInstances(JSThread *thread, const JSHandle<JSFunction> &func,
+                                                    const JSHandle<JSHClass> &initialDynClass);
 };
 
 class JSGeneratorFunction : public JSFunction {
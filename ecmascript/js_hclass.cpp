@@ -138,6 +138,8 @@ void JSHClass::Initialize(const JSThread *thread, uint32_t size, JSType type, ui
     SetExtensible(true);
     SetIsPrototype(false);
     SetElementRepresentation(Representation::NONE);
+    // Only the hclasses coming from the initial array hclass track the kind of their elements.
+    SetElementsKind(ElementsKind::GENERIC);
     SetTransitions(thread, JSTaggedValue::Undefined());
     SetProtoChangeMarker(thread, JSTaggedValue::Null());
     SetProtoChangeDetails(thread, JSTaggedValue::Null());
@@ -156,12 +158,65 @@ JSHandle<JSHClass> JSHClass::Clone(const JSThread *thread, const JSHandle<JSHCla
     newJshclass->SetTransitions(thread, JSTaggedValue::Undefined());
     newJshclass->SetProtoChangeDetails(thread, JSTaggedValue::Null());
     newJshclass->SetEnumCache(thread, JSTaggedValue::Null());
+    // only the initial hclass of a constructor tracks the slack of its instances.
+    newJshclass->SetConstructionCounter(0);
     // reuse Attributes first.
     newJshclass->SetLayout(thread, jshclass->GetLayout());
 
     return newJshclass;
 }
 
+JSHandle<JSHClass> JSHClass::FinishSlackTracking(const JSThread *thread, const JSHandle<JSHClass> &jshclass)
+{
+    uint32_t inlinedProps = std::min(jshclass->GetMaxNumberOfPropsInTransitions(),
+                                     MAX_SLACK_TRACKING_INLINED_PROPERTIES);
+    inlinedProps = std::max(inlinedProps, jshclass->NumberOfProps());
+    jshclass->SetConstructionCounter(0);
+    if (inlinedProps == jshclass->GetInlinedProperties()) {
+        return jshclass;
+    }
+    // The instances allocated so far keep their size, so the hclass is replaced instead of shrunk in place.
+    JSHandle<JSHClass> newJshclass = thread->GetEcmaVM()->GetFactory()->NewEcmaDynClass(
+        jshclass->GetInlinedPropsStartSize(), jshclass->GetObjectType(), inlinedProps);
+    newJshclass->Copy(thread, *jshclass);
+    newJshclass->SetLayout(thread, jshclass->GetLayout());
+    return newJshclass;
+}
+
+uint32_t JSHClass::GetMaxNumberOfPropsInTransitions() const
+{
+    DISALLOW_GARBAGE_COLLECTION;
+    uint32_t maxProps = 0;
+    CVector<const JSHClass *> worklist {this};
+    while (!worklist.empty()) {
+        const JSHClass *current = worklist.back();
+        worklist.pop_back();
+        maxProps = std::max(maxProps, current->NumberOfProps());
+        JSTaggedValue transitions = current->GetTransitions();
+        if (transitions.IsUndefined()) {
+            continue;
+        }
+        if (transitions.IsWeak()) {
+            worklist.emplace_back(JSHClass::Cast(transitions.GetTaggedWeakRef()));
+            continue;
+        }
+        TransitionsDictionary *dict = TransitionsDictionary::Cast(transitions.GetTaggedObject());
+        int size = dict->Size();
+        for (int entry = 0; entry < size; entry++) {
+            JSTaggedValue key = dict->GetKey(entry);
+            if (key.IsUndefined() || key.IsHole()) {
+                continue;
+            }
+            // transitions whose hclass has been collected are left as undefined.
+            JSTaggedValue value = dict->GetValue(entry);
+            if (value.IsWeak()) {
+                worklist.emplace_back(JSHClass::Cast(value.GetTaggedWeakRef()));
+            }
+        }
+    }
+    return maxProps;
+}
+
 // use for transition to dictionary
 JSHandle<JSHClass> JSHClass::CloneWithoutInlinedProperties(const JSThread *thread, const JSHandle<JSHClass> &jshclass)
 {
@@ -176,6 +231,32 @@ void JSHClass::TransitionElementsToDictionary(const JSThread *thread, const JSHa
     }
     obj->GetJSHClass()->SetIsDictionaryElement(true);
     obj->GetJSHClass()->SetIsStableElements(false);
+    obj->GetJSHClass()->SetElementsKind(ElementsKind::GENERIC);
+}
+
+void JSHClass::TransitionElementsKind(const JSThread *thread, const JSHandle<JSObject> &obj, ElementsKind kind)
+{
+    if (obj->GetJSHClass()->ContainsElementsKind(kind)) {
+        return;
+    }
+    JSHandle<JSHClass> jshclass(thread, obj->GetJSHClass());
+    ElementsKind newKind = Elements::MergeElementsKind(jshclass->GetElementsKind(), kind);
+    // The kind is the metadata of a transition keyed by a private symbol, so it can not meet a property.
+    JSHandle<JSTaggedValue> key = thread->GetEcmaVM()->GetGlobalEnv()->GetElementsKindSymbol();
+    JSHandle<JSTaggedValue> metaData(thread, JSTaggedValue(static_cast<int32_t>(newKind)));
+    JSHandle<JSHClass> newJshclass;
+    JSHClass *newDyn = jshclass->FindProtoTransitions(key.GetTaggedValue(), metaData.GetTaggedValue());
+    if (newDyn != nullptr) {
+        newJshclass = JSHandle<JSHClass>(thread, newDyn);
+    } else {
+        newJshclass = JSHClass::Clone(thread, jshclass);
+        newJshclass->SetElementsKind(newKind);
+        AddProtoTransitions(thread, jshclass, newJshclass, key, metaData);
+    }
+#if ECMASCRIPT_ENABLE_IC
+    JSHClass::NotifyHclassChanged(thread, jshclass, newJshclass);
+#endif
+    obj->SetClass(*newJshclass);
 }
 
 JSHandle<JSHClass> JSHClass::SetPropertyOfObjHClass(const JSThread *thread, JSHandle<JSHClass> &jshclass,
@@ -403,6 +484,9 @@ void JSHClass::NotifyHclassChanged(const JSThread *thread, JSHandle<JSHClass> ol
     newHclass->SetIsPrototype(true);
     JSHClass::NoticeThroughChain(thread, oldHclass);
     JSHClass::RefreshUsers(thread, oldHclass, newHclass);
+    // Handlers in the megamorphic cache are keyed by the receiver hclass only, e.g. a transition handler
+    // does not know that a setter has been added to the prototype since.
+    const_cast<JSThread *>(thread)->ClearMegaICCache();
 }
 
 void JSHClass::RegisterOnProtoChain(const JSThread *thread, const JSHandle<JSHClass> &jshclass)
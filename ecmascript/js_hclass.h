@@ -17,6 +17,7 @@
 #define ECMASCRIPT_JS_HCLASS_H
 
 #include "ecmascript/ecma_macros.h"
+#include "ecmascript/elements.h"
 #include "ecmascript/mem/tagged_object.h"
 #include "ecmascript/js_tagged_value.h"
 #include "ecmascript/property_attributes.h"
@@ -264,8 +265,15 @@ public:
     using ClassPrototypeBit = ClassConstructorBit::NextFlag;                               // 22
     using GlobalConstOrBuiltinsObjectBit = ClassPrototypeBit::NextFlag;                    // 23
     using IsTSTypeBit = GlobalConstOrBuiltinsObjectBit::NextFlag;                          // 24
+    using ConstructionCounterBits = IsTSTypeBit::NextField<uint32_t, 3>;                   // 27
+    using ElementsKindBits = ConstructionCounterBits::NextField<ElementsKind, Elements::ELEMENTS_KIND_BITS>; // 31
 
     static constexpr int DEFAULT_CAPACITY_OF_IN_OBJECTS = 4;
+    // Slack tracking: the first instances of a constructor are allocated with generous inlined properties,
+    // then the initial hclass is replaced by one which only has as many as the instances really used.
+    static constexpr uint32_t SLACK_TRACKING_CONSTRUCTION_COUNT = 7;
+    static constexpr uint32_t SLACK_TRACKING_INLINED_PROPERTIES = 32;
+    static constexpr uint32_t MAX_SLACK_TRACKING_INLINED_PROPERTIES = 64;
     static constexpr int MAX_CAPACITY_OF_OUT_OBJECTS =
         PropertyAttributes::MAX_CAPACITY_OF_PROPERTIES - DEFAULT_CAPACITY_OF_IN_OBJECTS;
     static constexpr int OFFSET_MAX_OBJECT_SIZE_IN_WORDS_WITHOUT_INLINED = 5;
@@ -289,8 +297,12 @@ public:
     static JSHandle<JSHClass> Clone(const JSThread *thread, const JSHandle<JSHClass> &jshclass,
                                     bool withoutInlinedProperties = false);
     static JSHandle<JSHClass> CloneWithoutInlinedProperties(const JSThread *thread, const JSHandle<JSHClass> &jshclass);
+    // Return the hclass which replaces an initial hclass whose slack tracking is finished.
+    static JSHandle<JSHClass> FinishSlackTracking(const JSThread *thread, const JSHandle<JSHClass> &jshclass);
 
     static void TransitionElementsToDictionary(const JSThread *thread, const JSHandle<JSObject> &obj);
+    // Move obj to an hclass whose elements kind also covers the given kind, the hclass is shared by the transition.
+    static void TransitionElementsKind(const JSThread *thread, const JSHandle<JSObject> &obj, ElementsKind kind);
     static JSHandle<JSHClass> SetPropertyOfObjHClass(const JSThread *thread, JSHandle<JSHClass> &jshclass,
                                                      const JSHandle<JSTaggedValue> &key,
                                                      const PropertyAttributes &attr);
@@ -1256,6 +1268,41 @@ public:
         return HasConstructorBits::Decode(GetBitField());
     }
 
+    inline void SetConstructionCounter(uint32_t counter)
+    {
+        uint32_t newVal = ConstructionCounterBits::Update(GetBitField(), counter);
+        SetBitField(newVal);
+    }
+
+    inline uint32_t GetConstructionCounter() const
+    {
+        return ConstructionCounterBits::Decode(GetBitField());
+    }
+
+    inline void SetElementsKind(ElementsKind kind)
+    {
+        uint32_t newVal = ElementsKindBits::Update(GetBitField(), kind);
+        SetBitField(newVal);
+    }
+
+    inline ElementsKind GetElementsKind() const
+    {
+        return ElementsKindBits::Decode(GetBitField());
+    }
+
+    inline bool ContainsElementsKind(ElementsKind kind) const
+    {
+        return Elements::ContainsElementsKind(GetElementsKind(), kind);
+    }
+
+    inline bool IsInSlackTracking() const
+    {
+        return GetConstructionCounter() != 0;
+    }
+
+    // The max number of properties in this hclass and the hclasses transitioned from it.
+    uint32_t GetMaxNumberOfPropsInTransitions() const;
+
     inline void SetNumberOfProps(uint32_t num)
     {
         uint32_t bits = GetBitField1();
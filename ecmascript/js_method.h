@@ -173,6 +173,7 @@ struct PUBLIC_API JSMethod : public base::AlignedStruct<sizeof(uint64_t),
     using HotnessCounterBits = BitField<int16_t, 0, METHOD_ARGS_NUM_BITS>; // offset 0-15
     using MethodIdBits = HotnessCounterBits::NextField<uint32_t, METHOD_ARGS_METHODID_BITS>; // offset 16-47
     using SlotSizeBits = MethodIdBits::NextField<uint8_t, METHOD_ARGS_NUM_BYTES>; // offset 48-55
+    using BuiltinIdBits = SlotSizeBits::NextField<uint8_t, METHOD_ARGS_NUM_BYTES>; // offset 56-63
 
     uint32_t GetBytecodeArraySize() const;
 
@@ -230,6 +231,22 @@ struct PUBLIC_API JSMethod : public base::AlignedStruct<sizeof(uint64_t),
         return start;
     }
 
+    // the id of the fast call of a native builtin, BuiltinsFastCall::NONE when it has none
+    uint8_t GetBuiltinId() const
+    {
+        return BuiltinIdBits::Decode(literalInfo_);
+    }
+
+    void SetBuiltinId(uint8_t id)
+    {
+        literalInfo_ = BuiltinIdBits::Update(literalInfo_, id);
+    }
+
+    static size_t GetLiteralInfoOffset(bool isArch32)
+    {
+        return GetOffset<static_cast<size_t>(Index::LITERAL_INFO_INDEX)>(isArch32);
+    }
+
     uint32_t PUBLIC_API GetNumVregs() const;
 
     uint32_t GetCodeSize() const;
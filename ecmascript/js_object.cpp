@@ -225,6 +225,14 @@ bool JSObject::AddElementInternal(JSThread *thread, const JSHandle<JSObject> &re
                                   const JSHandle<JSTaggedValue> &value, PropertyAttributes attr)
 {
     bool isDictionary = receiver->GetJSHClass()->IsDictionaryElement();
+    if (!isDictionary) {
+        ElementsKind kind = Elements::ToElementsKind(value.GetTaggedValue());
+        if (receiver->IsJSArray() && index > JSArray::Cast(*receiver)->GetArrayLength()) {
+            // the elements between the old length and the index are holes
+            kind = Elements::MergeElementsKind(kind, ElementsKind::HOLE);
+        }
+        JSHClass::TransitionElementsKind(thread, receiver, kind);
+    }
     if (receiver->IsJSArray()) {
         DISALLOW_GARBAGE_COLLECTION;
         JSArray *arr = JSArray::Cast(*receiver);
@@ -348,21 +356,22 @@ JSHandle<TaggedArray> JSObject::GetAllEnumKeys(const JSThread *thread, const JSH
 
     TaggedArray *array = TaggedArray::Cast(obj->GetProperties().GetTaggedObject());
     if (!array->IsDictionaryMode()) {
-        JSHClass *jsHclass = obj->GetJSHClass();
-        JSTaggedValue enumCache = jsHclass->GetEnumCache();
+        JSTaggedValue enumCache = GetOrCreateEnumCache(thread, obj);
+        JSHandle<TaggedArray> keyArray = factory->NewTaggedArray(numOfKeys);
         if (!enumCache.IsNull()) {
-            auto keyArray = JSHandle<TaggedArray>(thread, enumCache);
-            *keys = keyArray->GetLength();
+            TaggedArray *cache = TaggedArray::Cast(enumCache.GetTaggedObject());
+            uint32_t length = GetEnumCacheLength(cache);
+            for (uint32_t i = 0; i < length; i++) {
+                keyArray->Set(thread, static_cast<uint32_t>(offset) + i, cache->Get(i));
+            }
+            *keys += length;
             return keyArray;
         }
-        JSHandle<TaggedArray> keyArray = factory->NewTaggedArray(numOfKeys);
+        JSHClass *jsHclass = obj->GetJSHClass();
         int end = static_cast<int>(jsHclass->NumberOfProps());
         if (end > 0) {
             LayoutInfo::Cast(jsHclass->GetLayout().GetTaggedObject())
                 ->GetAllEnumKeys(thread, end, offset, *keyArray, keys, obj);
-            if (*keys == keyArray->GetLength()) {
-                jsHclass->SetEnumCache(thread, keyArray.GetTaggedValue());
-            }
         }
         return keyArray;
     }
@@ -373,6 +382,136 @@ JSHandle<TaggedArray> JSObject::GetAllEnumKeys(const JSThread *thread, const JSH
     return keyArray;
 }
 
+JSTaggedValue JSObject::GetOrCreateEnumCache(const JSThread *thread, const JSHandle<JSObject> &obj)
+{
+    if (obj->IsJSGlobalObject() || TaggedArray::Cast(obj->GetProperties().GetTaggedObject())->IsDictionaryMode()) {
+        return JSTaggedValue::Null();
+    }
+    JSHandle<JSHClass> jsHclass(thread, obj->GetJSHClass());
+    JSTaggedValue enumCache = jsHclass->GetEnumCache();
+    if (!enumCache.IsNull()) {
+        return enumCache;
+    }
+    int end = static_cast<int>(jsHclass->NumberOfProps());
+    uint32_t length = 0;
+    LayoutInfo *layoutInfo = LayoutInfo::Cast(jsHclass->GetLayout().GetTaggedObject());
+    for (int i = 0; i < end; i++) {
+        if (layoutInfo->GetKey(i).IsString() && layoutInfo->GetAttr(i).IsEnumerable()) {
+            length++;
+        }
+    }
+    JSHandle<TaggedArray> cache = thread->GetEcmaVM()->GetFactory()->NewTaggedArray(length << 1U);
+    layoutInfo = LayoutInfo::Cast(jsHclass->GetLayout().GetTaggedObject());
+    uint32_t index = 0;
+    for (int i = 0; i < end; i++) {
+        JSTaggedValue key = layoutInfo->GetKey(i);
+        if (!key.IsString() || !layoutInfo->GetAttr(i).IsEnumerable()) {
+            continue;
+        }
+        if (layoutInfo->IsUninitializedProperty(obj, i)) {
+            return JSTaggedValue::Null();
+        }
+        cache->Set(thread, index, key);
+        cache->Set(thread, length + index, JSTaggedValue(i));
+        index++;
+    }
+    jsHclass->SetEnumCache(thread, cache.GetTaggedValue());
+    return cache.GetTaggedValue();
+}
+
+JSTaggedValue JSObject::GetEnumCacheValue(const TaggedArray *cache, uint32_t i) const
+{
+    JSHClass *jsHclass = GetJSHClass();
+    ASSERT(jsHclass->GetEnumCache() == JSTaggedValue(cache));
+    int index = cache->Get(GetEnumCacheLength(cache) + i).GetInt();
+    PropertyAttributes attr = LayoutInfo::Cast(jsHclass->GetLayout().GetTaggedObject())->GetAttr(index);
+    return GetProperty(jsHclass, attr);
+}
+
+JSHandle<TaggedArray> JSObject::FastEnumerableOwnPropertyNames(JSThread *thread, const JSHandle<JSObject> &obj,
+                                                               PropertyKind kind)
+{
+    JSHandle<JSTaggedValue> tagObj(obj);
+    if (!tagObj->IsJSObject() || tagObj->IsTypedArray() || tagObj->IsModuleNamespace() ||
+        tagObj->IsSpecialContainer() || obj->GetNumberOfElements() != 0) {
+        return JSHandle<TaggedArray>();
+    }
+    JSTaggedValue enumCache = GetOrCreateEnumCache(thread, obj);
+    if (enumCache.IsNull()) {
+        return JSHandle<TaggedArray>();
+    }
+    // a getter could change the object while the values are read, so all of them must be initialized data properties
+    JSHandle<TaggedArray> cache(thread, enumCache);
+    uint32_t length = GetEnumCacheLength(*cache);
+    for (uint32_t i = 0; i < length; i++) {
+        JSTaggedValue value = obj->GetEnumCacheValue(*cache, i);
+        if (value.IsAccessor() || value.IsHole()) {
+            return JSHandle<TaggedArray>();
+        }
+    }
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<TaggedArray> properties = factory->NewTaggedArray(length);
+    for (uint32_t i = 0; i < length; i++) {
+        if (kind == PropertyKind::KEY) {
+            properties->Set(thread, i, cache->Get(i));
+            continue;
+        }
+        if (kind == PropertyKind::VALUE) {
+            properties->Set(thread, i, obj->GetEnumCacheValue(*cache, i));
+            continue;
+        }
+        ASSERT_PRINT(kind == PropertyKind::KEY_VALUE, "kind is invalid");
+        JSHandle<TaggedArray> keyValue = factory->NewTaggedArray(2);  // 2: key-value pair
+        keyValue->Set(thread, 0, cache->Get(i));
+        keyValue->Set(thread, 1, obj->GetEnumCacheValue(*cache, i));
+        JSHandle<JSArray> entry = JSArray::CreateArrayFromList(thread, keyValue);
+        properties->Set(thread, i, entry.GetTaggedValue());
+    }
+    return properties;
+}
+
+bool JSObject::FastCopyDataProperties(JSThread *thread, const JSHandle<JSTaggedValue> &dst,
+                                      const JSHandle<JSTaggedValue> &src)
+{
+    if (!src->IsJSObject() || src->IsTypedArray() || src->IsModuleNamespace() || src->IsJSPrimitiveRef() ||
+        src->IsSpecialContainer()) {
+        return false;
+    }
+    JSHandle<JSObject> obj(src);
+    if (obj->GetNumberOfElements() != 0) {
+        return false;
+    }
+    JSTaggedValue enumCache = GetOrCreateEnumCache(thread, obj);
+    if (enumCache.IsNull()) {
+        return false;
+    }
+    // symbol keys and non-enumerable keys are not in the cache, so the object must have none of them
+    JSHandle<TaggedArray> cache(thread, enumCache);
+    uint32_t length = GetEnumCacheLength(*cache);
+    if (length != obj->GetJSHClass()->NumberOfProps()) {
+        return false;
+    }
+    for (uint32_t i = 0; i < length; i++) {
+        JSTaggedValue value = obj->GetEnumCacheValue(*cache, i);
+        if (value.IsAccessor() || value.IsHole()) {
+            return false;
+        }
+    }
+    // defining a data property on dst does not call into js code, so the shape of src stays the one of the cache
+    JSMutableHandle<JSTaggedValue> key(thread, JSTaggedValue::Undefined());
+    JSMutableHandle<JSTaggedValue> value(thread, JSTaggedValue::Undefined());
+    for (uint32_t i = 0; i < length; i++) {
+        key.Update(cache->Get(i));
+        value.Update(obj->GetEnumCacheValue(*cache, i));
+        LayoutInfo *layoutInfo = LayoutInfo::Cast(obj->GetJSHClass()->GetLayout().GetTaggedObject());
+        PropertyAttributes attr = layoutInfo->GetAttr(cache->Get(length + i).GetInt());
+        PropertyDescriptor desc(thread, value, attr.IsWritable(), attr.IsEnumerable(), attr.IsConfigurable());
+        JSTaggedValue::DefineOwnProperty(thread, dst, key, desc);
+        RETURN_VALUE_IF_ABRUPT_COMPLETION(thread, true);
+    }
+    return true;
+}
+
 void JSObject::GetAllElementKeys(JSThread *thread, const JSHandle<JSObject> &obj, int offset,
                                  const JSHandle<TaggedArray> &keyArray)
 {
@@ -1375,6 +1514,11 @@ JSHandle<TaggedArray> JSObject::EnumerableOwnPropertyNames(JSThread *thread, con
     // 1. Assert: Type(O) is Object.
     ASSERT_PRINT(obj->IsECMAObject(), "obj is not object");
 
+    JSHandle<TaggedArray> fastProperties = FastEnumerableOwnPropertyNames(thread, obj, kind);
+    if (!fastProperties.IsEmpty()) {
+        return fastProperties;
+    }
+
     // 2. Let ownKeys be ? O.[[OwnPropertyKeys]]().
     JSHandle<TaggedArray> ownKeys = JSTaggedValue::GetOwnPropertyKeys(thread, JSHandle<JSTaggedValue>(obj));
     RETURN_HANDLE_IF_ABRUPT_COMPLETION(TaggedArray, thread);
@@ -1932,6 +2076,9 @@ int32_t ECMAObject::GetHash() const
         TaggedArray *array = TaggedArray::Cast(value.GetTaggedObject());
         return array->Get(0).GetInt();
     }
+    if (value.IsInt()) {
+        return value.GetInt();
+    }
     JSThread *thread = this->GetJSThread();
     JSHandle<JSTaggedValue> valueHandle(thread, value);
     return JSTaggedValue::ToInt32(thread, valueHandle);
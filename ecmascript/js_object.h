@@ -571,6 +571,24 @@ public:
     static JSHandle<TaggedArray> GetAllEnumKeys(const JSThread *thread, const JSHandle<JSObject> &obj, int offset,
                                                 uint32_t numOfKeys, uint32_t *keys);
 
+    // The enum cache of a hclass holds its enumerable string keys in the order of the layout, followed by the
+    // layout index of each of them. A transition makes a new hclass without a cache. Null is returned for an
+    // object whose keys are not in its layout, or when one of them is uninitialized.
+    static JSTaggedValue GetOrCreateEnumCache(const JSThread *thread, const JSHandle<JSObject> &obj);
+    static uint32_t GetEnumCacheLength(const TaggedArray *cache)
+    {
+        return cache->GetLength() >> 1U;  // 1: the keys are followed by their indices
+    }
+    // the value of the key i of the enum cache of the hclass of this object
+    JSTaggedValue GetEnumCacheValue(const TaggedArray *cache, uint32_t i) const;
+    // EnumerableOwnPropertyNames of an object with no elements and only data properties, read from its enum cache
+    static JSHandle<TaggedArray> FastEnumerableOwnPropertyNames(JSThread *thread, const JSHandle<JSObject> &obj,
+                                                                PropertyKind kind);
+    // CopyDataProperties of an object whose own properties are all enumerable data properties with string keys,
+    // false if the object does not qualify and nothing was copied
+    static bool FastCopyDataProperties(JSThread *thread, const JSHandle<JSTaggedValue> &dst,
+                                       const JSHandle<JSTaggedValue> &src);
+
     static void AddAccessor(JSThread *thread, const JSHandle<JSTaggedValue> &obj, const JSHandle<JSTaggedValue> &key,
                             const JSHandle<AccessorData> &value, PropertyAttributes attr);
 
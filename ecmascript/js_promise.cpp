@@ -165,17 +165,11 @@ JSTaggedValue JSPromise::TriggerPromiseReactions(JSThread *thread, const JSHandl
     // 1. Repeat for each reaction in reactions, in original insertion order
     // a. Perform EnqueueJob("PromiseJobs", PromiseReactionJob, «reaction, argument»).
     JSHandle<job::MicroJobQueue> job = thread->GetEcmaVM()->GetMicroJobQueue();
-    JSHandle<GlobalEnv> globalEnv = thread->GetEcmaVM()->GetGlobalEnv();
     const GlobalEnvConstants *globalConst = thread->GlobalConstants();
-    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
-    JSHandle<JSFunction> promiseReactionsJob(globalEnv->GetPromiseReactionJob());
     JSMutableHandle<PromiseReaction> reaction(thread, JSTaggedValue::Undefined());
     while (!reactions->Empty()) {
         reaction.Update(reactions->Pop(thread));
-        JSHandle<TaggedArray> arguments = factory->NewTaggedArray(2);  // 2 means the length of new array
-        arguments->Set(thread, 0, reaction);
-        arguments->Set(thread, 1, argument);
-        job::MicroJobQueue::EnqueueJob(thread, job, job::QueueType::QUEUE_PROMISE, promiseReactionsJob, arguments);
+        job::MicroJobQueue::EnqueuePromiseReactionJob(thread, job, reaction, argument);
     }
     // 2. Return undefined.
     return globalConst->GetUndefined();
@@ -59,6 +59,7 @@ public:
         parser->Add(&aotOutputFile_);
         parser->Add(&targetTriple_);
         parser->Add(&asmOptLevel_);
+        parser->Add(&compilerThreads_);
         parser->Add(&logCompiledMethods);
         parser->Add(&internal_memory_size_limit_);
         parser->Add(&heap_size_limit_);
@@ -70,6 +71,21 @@ public:
         parser->Add(&snapshotOutputFile_);
         parser->Add(&enableRuntimeStat_);
         parser->Add(&logTypeInfer_);
+        parser->Add(&enableJit_);
+        parser->Add(&jitCodeBudget_);
+        parser->Add(&jitCompileTimeBudget_);
+        parser->Add(&enablePGOProfiler_);
+        parser->Add(&pgoProfileOutput_);
+        parser->Add(&pgoProfile_);
+        parser->Add(&pgoHotnessThreshold_);
+        parser->Add(&enableAotSpeculation_);
+        parser->Add(&deoptThreshold_);
+        parser->Add(&enableAotInlining_);
+        parser->Add(&compilerOptLevel_);
+        parser->Add(&enableLazyTranslation_);
+        parser->Add(&lazyTranslationList_);
+        parser->Add(&enableSuperInstructions_);
+        parser->Add(&enableBytecodeProfiler_);
     }
 
     bool EnableArkTools() const
@@ -153,6 +169,16 @@ public:
         asmOptLevel_.SetValue(value);
     }
 
+    uint32_t GetCompilerThreads() const
+    {
+        return compilerThreads_.GetValue();
+    }
+
+    void SetCompilerThreads(uint32_t value)
+    {
+        compilerThreads_.SetValue(value);
+    }
+
     bool EnableForceGC() const
     {
         return enableForceGc_.GetValue();
@@ -458,6 +484,156 @@ public:
         logTypeInfer_.SetValue(value);
     }
 
+    bool EnableJit() const
+    {
+        return enableJit_.GetValue();
+    }
+
+    void SetEnableJit(bool value)
+    {
+        enableJit_.SetValue(value);
+    }
+
+    uint32_t GetJitCodeBudget() const
+    {
+        return jitCodeBudget_.GetValue();
+    }
+
+    void SetJitCodeBudget(uint32_t value)
+    {
+        jitCodeBudget_.SetValue(value);
+    }
+
+    uint32_t GetJitCompileTimeBudget() const
+    {
+        return jitCompileTimeBudget_.GetValue();
+    }
+
+    void SetJitCompileTimeBudget(uint32_t value)
+    {
+        jitCompileTimeBudget_.SetValue(value);
+    }
+
+    bool EnablePGOProfiler() const
+    {
+        return enablePGOProfiler_.GetValue();
+    }
+
+    void SetEnablePGOProfiler(bool value)
+    {
+        enablePGOProfiler_.SetValue(value);
+    }
+
+    std::string GetPGOProfileOutput() const
+    {
+        return pgoProfileOutput_.GetValue();
+    }
+
+    void SetPGOProfileOutput(std::string value)
+    {
+        pgoProfileOutput_.SetValue(std::move(value));
+    }
+
+    std::string GetPGOProfile() const
+    {
+        return pgoProfile_.GetValue();
+    }
+
+    void SetPGOProfile(std::string value)
+    {
+        pgoProfile_.SetValue(std::move(value));
+    }
+
+    uint32_t GetPGOHotnessThreshold() const
+    {
+        return pgoHotnessThreshold_.GetValue();
+    }
+
+    void SetPGOHotnessThreshold(uint32_t value)
+    {
+        pgoHotnessThreshold_.SetValue(value);
+    }
+
+    bool EnableAotSpeculation() const
+    {
+        return enableAotSpeculation_.GetValue();
+    }
+
+    void SetEnableAotSpeculation(bool value)
+    {
+        enableAotSpeculation_.SetValue(value);
+    }
+
+    uint32_t GetDeoptThreshold() const
+    {
+        return deoptThreshold_.GetValue();
+    }
+
+    void SetDeoptThreshold(uint32_t value)
+    {
+        deoptThreshold_.SetValue(value);
+    }
+
+    bool EnableAotInlining() const
+    {
+        return enableAotInlining_.GetValue();
+    }
+
+    void SetEnableAotInlining(bool value)
+    {
+        enableAotInlining_.SetValue(value);
+    }
+
+    uint32_t GetCompilerOptLevel() const
+    {
+        return compilerOptLevel_.GetValue();
+    }
+
+    void SetCompilerOptLevel(uint32_t value)
+    {
+        compilerOptLevel_.SetValue(value);
+    }
+
+    bool EnableLazyTranslation() const
+    {
+        return enableLazyTranslation_.GetValue();
+    }
+
+    void SetEnableLazyTranslation(bool value)
+    {
+        enableLazyTranslation_.SetValue(value);
+    }
+
+    std::string GetLazyTranslationList() const
+    {
+        return lazyTranslationList_.GetValue();
+    }
+
+    void SetLazyTranslationList(std::string value)
+    {
+        lazyTranslationList_.SetValue(std::move(value));
+    }
+
+    bool EnableSuperInstructions() const
+    {
+        return enableSuperInstructions_.GetValue();
+    }
+
+    void SetEnableSuperInstructions(bool value)
+    {
+        enableSuperInstructions_.SetValue(value);
+    }
+
+    bool EnableBytecodeProfiler() const
+    {
+        return enableBytecodeProfiler_.GetValue();
+    }
+
+    void SetEnableBytecodeProfiler(bool value)
+    {
+        enableBytecodeProfiler_.SetValue(value);
+    }
+
 private:
     static constexpr uint64_t INTERNAL_MEMORY_SIZE_LIMIT_DEFAULT = 2147483648;
     static constexpr uint64_t COMPILER_MEMORY_SIZE_LIMIT_DEFAULT = 268435456;
@@ -485,6 +661,8 @@ private:
         Default: "x86_64-unknown-linux-gnu")"};
     PandArg<uint32_t> asmOptLevel_ {"opt-level", 3,
         R"(Optimization level configuration on llvm back end. Default: "3")"};
+    PandArg<uint32_t> compilerThreads_ {"compiler-threads", 0,
+        R"(Number of threads compiling methods in aot compiler, 0 means all the taskpool threads. Default: 0)"};
     PandArg<uint32_t> maxNonmovableSpaceCapacity_ {"maxNonmovableSpaceCapacity",
         4 * 1024 * 1024,
         R"(set max nonmovable space capacity)"};
@@ -517,6 +695,41 @@ private:
         R"(enable statistics of runtime state. Default: false)"};
     PandArg<bool> logTypeInfer_ {"log-Type-Infer", false,
         R"(print aot type infer log. Default: false)"};
+    PandArg<bool> enableJit_ {"enable-jit", false,
+        R"(Compile hot methods on a background thread, requires the asm interpreter. Default: false)"};
+    PandArg<uint32_t> jitCodeBudget_ {"jit-code-budget", 16 * 1024 * 1024,
+        R"(Max size of the code installed by the jit. Default: 16M)"};
+    PandArg<uint32_t> jitCompileTimeBudget_ {"jit-compile-time-budget", 10000,
+        R"(Max time in milliseconds spent by the jit compiling, 0 means no limit. Default: 10000)"};
+    PandArg<bool> enablePGOProfiler_ {"enable-pgo-profiler", false,
+        R"(Record the hotness of methods and the inline cache feedback for the aot compiler. Default: false)"};
+    PandArg<std::string> pgoProfileOutput_ {"pgo-profile-output", "",
+        R"(Path the pgo profile is written to when the vm exits, empty means not written. Default: "")"};
+    PandArg<std::string> pgoProfile_ {"pgo-profile", "",
+        R"(Path to the pgo profile guiding the aot compiler, empty means all methods are compiled. Default: "")"};
+    PandArg<uint32_t> pgoHotnessThreshold_ {"pgo-hotness-threshold", 1,
+        R"(Min hotness in the pgo profile of the methods compiled by the aot compiler. Default: 1)"};
+    PandArg<bool> enableAotSpeculation_ {"aot-speculation", false,
+        R"(Let the aot compiler speculate on the pgo profile and deoptimize when a speculation fails. Default: false)"};
+    PandArg<uint32_t> deoptThreshold_ {"deopt-threshold", 10,
+        R"(Number of deopts after which a method runs in the interpreter only. Default: 10)"};
+    PandArg<bool> enableAotInlining_ {"aot-inlining", true,
+        R"(Let the aot compiler inline small functions into their callers. Default: true)"};
+    PandArg<uint32_t> compilerOptLevel_ {"compiler-opt-level", 2,
+        R"(Optimization level of the circuit ir in aot compiler, 0: none, 1: escape analysis, value numbering )"
+        R"(and dead code elimination, 2: also loop invariant code motion. Default: 2)"};
+    PandArg<bool> enableLazyTranslation_ {"enable-lazy-translation", false,
+        R"(Translate the bytecode of a method when it is called first instead of when its file is loaded. )"
+        R"(Default: false)"};
+    PandArg<std::string> lazyTranslationList_ {"lazy-translation-list", "",
+        R"(Path to the list of the methods translated lazily, the listed methods are translated when their file )"
+        R"(is loaded and the list is rewritten when the vm exits. Default: "")"};
+    PandArg<bool> enableSuperInstructions_ {"enable-super-instructions", false,
+        R"(Fuse frequent pairs of instructions into superinstructions when the bytecode is translated, )"
+        R"(not with the jit nor for files loaded with aot code or while debugging. Default: false)"};
+    PandArg<bool> enableBytecodeProfiler_ {"enable-bytecode-profiler", false,
+        R"(Count the bytecodes run by the interpreter by opcode and by method, the slow paths and the ic misses, )"
+        R"(and log the counts when the vm is destroyed. Default: false)"};
     PandArg<bool> isWorker_ {"IsWorker", false,
         R"(whether is worker vm)"};
 };
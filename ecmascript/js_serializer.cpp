@@ -1098,6 +1098,10 @@ JSHandle<JSTaggedValue> JSDeserializer::ReadJSArray()
     if (!JudgeType(SerializationUID::INT32) || !ReadInt(&arrLength)) {
         return JSHandle<JSTaggedValue>();
     }
+    if (static_cast<uint32_t>(arrLength) > jsArray->GetArrayLength()) {
+        // the elements after the last one defined are holes
+        JSHClass::TransitionElementsKind(thread_, JSHandle<JSObject>(jsArray), ElementsKind::HOLE);
+    }
     jsArray->SetLength(thread_, JSTaggedValue(arrLength));
     return arrayTag;
 }
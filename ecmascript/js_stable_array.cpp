@@ -31,6 +31,12 @@ JSTaggedValue JSStableArray::Push(JSHandle<JSArray> receiver, EcmaRuntimeCallInf
     uint32_t oldLength = receiver->GetArrayLength();
     uint32_t newLength = argc + oldLength;
 
+    ElementsKind kind = ElementsKind::NONE;
+    for (uint32_t k = 0; k < argc; k++) {
+        kind = Elements::MergeElementsKind(kind, Elements::ToElementsKind(argv->GetCallArg(k).GetTaggedValue()));
+    }
+    JSHClass::TransitionElementsKind(thread, JSHandle<JSObject>::Cast(receiver), kind);
+
     TaggedArray *elements = TaggedArray::Cast(receiver->GetElements().GetTaggedObject());
     if (newLength > elements->GetLength()) {
         elements = *JSObject::GrowElementsCapacity(thread, JSHandle<JSObject>::Cast(receiver), newLength);
@@ -45,10 +51,30 @@ JSTaggedValue JSStableArray::Push(JSHandle<JSArray> receiver, EcmaRuntimeCallInf
     return JSTaggedValue(newLength);
 }
 
+JSTaggedValue JSStableArray::PushInPlace(JSThread *thread, JSArray *receiver, JSTaggedValue value)
+{
+    DISALLOW_GARBAGE_COLLECTION;
+    if (!receiver->GetJSHClass()->ContainsElementsKind(Elements::ToElementsKind(value))) {
+        return JSTaggedValue::Hole();
+    }
+    TaggedArray *elements = TaggedArray::Cast(receiver->GetElements().GetTaggedObject());
+    uint32_t oldLength = receiver->GetArrayLength();
+    if (oldLength >= elements->GetLength()) {
+        return JSTaggedValue::Hole();
+    }
+    elements->Set(thread, oldLength, value);
+    receiver->SetArrayLength(thread, oldLength + 1);
+    return JSTaggedValue(oldLength + 1);
+}
+
 JSTaggedValue JSStableArray::Pop(JSHandle<JSArray> receiver, EcmaRuntimeCallInfo *argv)
+{
+    return Pop(argv->GetThread(), *receiver);
+}
+
+JSTaggedValue JSStableArray::Pop(JSThread *thread, JSArray *receiver)
 {
     DISALLOW_GARBAGE_COLLECTION;
-    JSThread *thread = argv->GetThread();
     uint32_t length = receiver->GetArrayLength();
     if (length == 0) {
         return JSTaggedValue::Undefined();
@@ -84,6 +110,7 @@ JSTaggedValue JSStableArray::Splice(JSHandle<JSArray> receiver, EcmaRuntimeCallI
     TaggedArray *srcElements = TaggedArray::Cast(thisObjHandle->GetElements().GetTaggedObject());
     JSHandle<TaggedArray> srcElementsHandle(thread, srcElements);
     if (newArray.IsStableJSArray(thread)) {
+        JSHClass::TransitionElementsKind(thread, newArrayHandle, thisObjHandle->GetJSHClass()->GetElementsKind());
         TaggedArray *destElements = TaggedArray::Cast(newArrayHandle->GetElements().GetTaggedObject());
         if (actualDeleteCount > destElements->GetLength()) {
             destElements = *JSObject::GrowElementsCapacity(thread, newArrayHandle, actualDeleteCount);
@@ -121,6 +148,16 @@ JSTaggedValue JSStableArray::Splice(JSHandle<JSArray> receiver, EcmaRuntimeCallI
         RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
     }
 
+    // the holes moved by the splice become undefined
+    ElementsKind kind = ElementsKind::NONE;
+    if (Elements::IsHoley(thisObjHandle->GetJSHClass()->GetElementsKind())) {
+        kind = ElementsKind::PACKED;
+    }
+    for (uint32_t i = 2; i < argc; i++) {
+        kind = Elements::MergeElementsKind(kind, Elements::ToElementsKind(argv->GetCallArg(i).GetTaggedValue()));
+    }
+    JSHClass::TransitionElementsKind(thread, thisObjHandle, kind);
+
     uint32_t oldCapacity = srcElementsHandle->GetLength();
     uint32_t newCapacity = len - actualDeleteCount + insertCount;
     if (insertCount < actualDeleteCount) {
@@ -160,12 +197,17 @@ JSTaggedValue JSStableArray::Splice(JSHandle<JSArray> receiver, EcmaRuntimeCallI
 
 JSTaggedValue JSStableArray::Shift(JSHandle<JSArray> receiver, EcmaRuntimeCallInfo *argv)
 {
-    DISALLOW_GARBAGE_COLLECTION;
     JSThread *thread = argv->GetThread();
     uint32_t length = receiver->GetArrayLength();
     if (length == 0) {
         return JSTaggedValue::Undefined();
     }
+    // the holes moved by the shift become undefined
+    if (Elements::IsHoley(receiver->GetJSHClass()->GetElementsKind())) {
+        JSHClass::TransitionElementsKind(thread, JSHandle<JSObject>::Cast(receiver), ElementsKind::PACKED);
+    }
+
+    DISALLOW_GARBAGE_COLLECTION;
 
     TaggedArray *elements = TaggedArray::Cast(receiver->GetElements().GetTaggedObject());
     auto result = elements->Get(0);
@@ -269,4 +311,20 @@ JSTaggedValue JSStableArray::Join(JSHandle<JSArray> receiver, EcmaRuntimeCallInf
     ASSERT_PRINT(isOneByte == EcmaString::CanBeCompressed(newString), "isOneByte does not match the real value!");
     return JSTaggedValue(newString);
 }
+
+JSTaggedValue JSStableArray::GetPackedElement(JSThread *thread, JSTaggedValue receiver, uint32_t index)
+{
+    if (!receiver.IsStableJSArray(thread)) {
+        return JSTaggedValue::Hole();
+    }
+    JSArray *array = JSArray::Cast(receiver.GetTaggedObject());
+    if (!Elements::IsPacked(array->GetJSHClass()->GetElementsKind()) || index >= array->GetArrayLength()) {
+        return JSTaggedValue::Hole();
+    }
+    TaggedArray *elements = TaggedArray::Cast(array->GetElements().GetTaggedObject());
+    if (index >= elements->GetLength()) {
+        return JSTaggedValue::Hole();
+    }
+    return elements->Get(index);
+}
 }  // namespace panda::ecmascript
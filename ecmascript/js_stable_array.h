@@ -26,10 +26,18 @@ public:
     enum SeparatorFlag : int { MINUS_ONE = -1, MINUS_TWO = -2 };
     static JSTaggedValue Push(JSHandle<JSArray> receiver, EcmaRuntimeCallInfo *argv);
     static JSTaggedValue Pop(JSHandle<JSArray> receiver, EcmaRuntimeCallInfo *argv);
+    // Push and Pop on a stable array which never allocate, for the fast calls of the builtins. PushInPlace returns
+    // hole when the value needs a transition of the elements kind or the elements are full.
+    static JSTaggedValue PushInPlace(JSThread *thread, JSArray *receiver, JSTaggedValue value);
+    static JSTaggedValue Pop(JSThread *thread, JSArray *receiver);
     static JSTaggedValue Splice(JSHandle<JSArray> receiver, EcmaRuntimeCallInfo *argv,
                                 double start, double insertCount, double actualDeleteCount);
     static JSTaggedValue Shift(JSHandle<JSArray> receiver, EcmaRuntimeCallInfo *argv);
     static JSTaggedValue Join(JSHandle<JSArray> receiver, EcmaRuntimeCallInfo *argv);
+    // Return the element at the index if the receiver is a stable array of a packed elements kind and the index is
+    // below its length, otherwise return hole. Such an element is an own data property, so the HasProperty and Get
+    // of the generic path are not needed. Callbacks may change the array, so check it again for every index.
+    static JSTaggedValue GetPackedElement(JSThread *thread, JSTaggedValue receiver, uint32_t index);
 };
 }  // namespace panda::ecmascript
 #endif  // ECMASCRIPT_JS_STABLE_ARRAY_H
\ No newline at end of file
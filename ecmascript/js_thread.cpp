@@ -16,6 +16,7 @@
 #include "ecmascript/llvm_stackmap_parser.h"
 #include "ecmascript/ecma_param_configuration.h"
 #include "ecmascript/global_env_constants-inl.h"
+#include "ecmascript/ic/mega_ic_cache.h"
 #include "ecmascript/ic/properties_cache.h"
 #include "ecmascript/interpreter/interpreter-inl.h"
 
@@ -47,6 +48,8 @@ JSThread::JSThread(EcmaVM *vm) : id_(os::thread::GetCurrentThreadId()), vm_(vm)
     auto chunk = vm->GetChunk();
     globalStorage_ = chunk->New<EcmaGlobalStorage>(this, chunk);
     propertiesCache_ = new PropertiesCache();
+    glueData_.loadMegaICCache_ = new MegaICCache();
+    glueData_.storeMegaICCache_ = new MegaICCache();
     vmThreadControl_ = new VmThreadControl();
 }
 
@@ -70,6 +73,14 @@ JSThread::~JSThread()
         delete propertiesCache_;
         propertiesCache_ = nullptr;
     }
+    if (glueData_.loadMegaICCache_ != nullptr) {
+        delete glueData_.loadMegaICCache_;
+        glueData_.loadMegaICCache_ = nullptr;
+    }
+    if (glueData_.storeMegaICCache_ != nullptr) {
+        delete glueData_.storeMegaICCache_;
+        glueData_.storeMegaICCache_ = nullptr;
+    }
     if (vmThreadControl_ != nullptr) {
         delete vmThreadControl_;
         vmThreadControl_ = nullptr;
@@ -117,11 +128,22 @@ const JSTaggedType *JSThread::GetCurrentInterpretedFrame() const
     return GetCurrentSPFrame();
 }
 
+void JSThread::ClearMegaICCache()
+{
+    if (glueData_.loadMegaICCache_ != nullptr) {
+        glueData_.loadMegaICCache_->Clear();
+    }
+    if (glueData_.storeMegaICCache_ != nullptr) {
+        glueData_.storeMegaICCache_->Clear();
+    }
+}
+
 void JSThread::Iterate(const RootVisitor &v0, const RootRangeVisitor &v1)
 {
     if (propertiesCache_ != nullptr) {
         propertiesCache_->Clear();
     }
+    ClearMegaICCache();
 
     if (!glueData_.exception_.IsHole()) {
         v0(Root::ROOT_VM, ObjectSlot(ToUintPtr(&glueData_.exception_)));
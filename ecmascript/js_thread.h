@@ -33,6 +33,7 @@ namespace panda::ecmascript {
 class EcmaHandleScope;
 class EcmaVM;
 class HeapRegionAllocator;
+class MegaICCache;
 class PropertiesCache;
 
 enum class MarkStatus : uint8_t {
@@ -405,6 +406,19 @@ public:
         return propertiesCache_;
     }
 
+    MegaICCache *GetLoadMegaICCache() const
+    {
+        return glueData_.loadMegaICCache_;
+    }
+
+    MegaICCache *GetStoreMegaICCache() const
+    {
+        return glueData_.storeMegaICCache_;
+    }
+
+    // Called when the hclass of a prototype changes, the handlers cached for its users may be stale.
+    void ClearMegaICCache();
+
     void SetMarkStatus(MarkStatus status)
     {
         MarkStatusBits::Set(status, &glueData_.threadStateBitField_);
@@ -517,6 +531,8 @@ public:
                                                  BCDebuggerStubEntries,
                                                  base::AlignedUint64,
                                                  base::AlignedPointer,
+                                                 base::AlignedPointer,
+                                                 base::AlignedPointer,
                                                  GlobalEnvConstants> {
         enum class Index : size_t {
             BCStubEntriesIndex = 0,
@@ -532,6 +548,8 @@ public:
             BCDebuggerStubEntriesIndex,
             StateBitFieldIndex,
             FrameBaseIndex,
+            LoadMegaICCacheIndex,
+            StoreMegaICCacheIndex,
             GlobalConstIndex,
             NumOfMembers
         };
@@ -607,6 +625,16 @@ public:
             return GetOffset<static_cast<size_t>(Index::FrameBaseIndex)>(isArch32);
         }
 
+        static size_t GetLoadMegaICCacheOffset(bool isArch32)
+        {
+            return GetOffset<static_cast<size_t>(Index::LoadMegaICCacheIndex)>(isArch32);
+        }
+
+        static size_t GetStoreMegaICCacheOffset(bool isArch32)
+        {
+            return GetOffset<static_cast<size_t>(Index::StoreMegaICCacheIndex)>(isArch32);
+        }
+
         alignas(EAS) BCStubEntries bcStubEntries_;
         alignas(EAS) JSTaggedValue exception_ {JSTaggedValue::Hole()};
         alignas(EAS) JSTaggedValue globalObject_ {JSTaggedValue::Hole()};
@@ -620,6 +648,8 @@ public:
         alignas(EAS) BCDebuggerStubEntries bcDebuggerStubEntries_;
         alignas(EAS) volatile uint64_t threadStateBitField_ {0ULL};
         alignas(EAS) JSTaggedType *frameBase_ {nullptr};
+        alignas(EAS) MegaICCache *loadMegaICCache_ {nullptr};
+        alignas(EAS) MegaICCache *storeMegaICCache_ {nullptr};
         alignas(EAS) GlobalEnvConstants globalConst_;
     };
     STATIC_ASSERT_EQ_ARCH(sizeof(GlueData), GlueData::SizeArch32, GlueData::SizeArch64);
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "ecmascript/interpreter/interpreter-inl.h"
+#include "ecmascript/jspandafile/panda_file_translator.h"
+#include "libpandabase/utils/pandargs.h"
+#include "libpandafile/class_data_accessor-inl.h"
+#include "libpandafile/file.h"
+#include "libpandafile/method_data_accessor-inl.h"
+
+// ark_opcode_pairs counts how often each opcode follows another one in the methods of a set of panda files, as
+// the interpreter dispatches them after the translation, to find the pairs worth a superinstruction.
+namespace panda::ecmascript {
+using OpcodePair = std::pair<EcmaOpcode, EcmaOpcode>;
+
+// the formats of an instruction share its name, e.g. JEQZ, so the opcode follows it
+std::string OpcodeName(EcmaOpcode opcode)
+{
+    return GetEcmaOpcodeStr(opcode) + "(" + std::to_string(static_cast<uint32_t>(opcode)) + ")";
+}
+
+bool CountOpcodePairs(const std::string &fileName, std::map<OpcodePair, uint64_t> *pairs, uint64_t *instructions)
+{
+    auto pf = panda_file::OpenPandaFileOrZip(fileName);
+    if (pf == nullptr) {
+        return false;
+    }
+    // the methods that share their code are counted once
+    std::set<const uint8_t *> countedCode;
+    for (uint32_t index : pf->GetClasses()) {
+        panda_file::File::EntityId classId(index);
+        if (pf->IsExternal(classId)) {
+            continue;
+        }
+        panda_file::ClassDataAccessor cda(*pf, classId);
+        cda.EnumerateMethods([&pf, &countedCode, pairs, instructions](panda_file::MethodDataAccessor &mda) {
+            auto codeId = mda.GetCodeId();
+            if (!codeId.has_value()) {
+                return;
+            }
+            panda_file::CodeDataAccessor codeDataAccessor(*pf, codeId.value());
+            const uint8_t *insns = codeDataAccessor.GetInstructions();
+            if (!countedCode.insert(insns).second) {
+                return;
+            }
+            auto bcIns = BytecodeInstruction(insns);
+            auto bcInsLast = bcIns.JumpTo(codeDataAccessor.GetCodeSize());
+            bool hasPrev = false;
+            EcmaOpcode prev = EcmaOpcode::LAST_OPCODE;
+            while (bcIns.GetAddress() != bcInsLast.GetAddress()) {
+                EcmaOpcode opcode = PandaFileTranslator::GetEcmaOpcode(bcIns.GetAddress());
+                if (hasPrev) {
+                    (*pairs)[OpcodePair(prev, opcode)]++;
+                }
+                prev = opcode;
+                hasPrev = true;
+                (*instructions)++;
+                bcIns = bcIns.GetNext();
+            }
+        });
+    }
+    return true;
+}
+
+int Main(const int argc, const char **argv)
+{
+    panda::PandArg<bool> help("help", false, "Print this message and exit");
+    panda::PandArg<uint32_t> top("top", 30, "Number of the most frequent pairs printed, 0 prints all of them");
+    // tail arguments
+    panda::PandArg<arg_list_t> files("files", {""}, "path to pandafiles", ":");
+    panda::PandArgParser paParser;
+    paParser.Add(&help);
+    paParser.Add(&top);
+    paParser.PushBackTail(&files);
+    paParser.EnableTail();
+
+    if (!paParser.Parse(argc, argv) || files.GetValue().empty() || help.GetValue()) {
+        std::cerr << paParser.GetErrorString() << std::endl;
+        std::cerr << "Usage: ark_opcode_pairs [OPTIONS] file1:file2:file3" << std::endl;
+        std::cerr << std::endl;
+        std::cerr << "optional arguments:" << std::endl;
+        std::cerr << paParser.GetHelpString() << std::endl;
+        return 1;
+    }
+
+    std::map<OpcodePair, uint64_t> pairs;
+    uint64_t instructions = 0;
+    for (const auto &fileName : files.GetValue()) {
+        if (!CountOpcodePairs(fileName, &pairs, &instructions)) {
+            std::cerr << "Cannot open panda file '" << fileName << "'" << std::endl;
+            return -1;
+        }
+    }
+
+    std::vector<std::pair<OpcodePair, uint64_t>> sortedPairs(pairs.begin(), pairs.end());
+    std::stable_sort(sortedPairs.begin(), sortedPairs.end(), [](const auto &a, const auto &b) {
+        return a.second > b.second;
+    });
+    if (top.GetValue() != 0 && sortedPairs.size() > top.GetValue()) {
+        sortedPairs.resize(top.GetValue());
+    }
+    std::cout << "instructions: " << instructions << std::endl;
+    for (const auto &[pair, count] : sortedPairs) {
+        double percent = instructions == 0 ? 0 : 100.0 * count / instructions;  // 100: percent
+        std::cout << std::setw(10) << count << std::setw(8) << std::fixed << std::setprecision(2) << percent
+                  << "%  " << OpcodeName(pair.first) << " " << OpcodeName(pair.second) << std::endl;
+    }
+    paParser.DisableTail();
+    return 0;
+}
+}  // namespace panda::ecmascript
+
+int main(int argc, const char **argv)
+{
+    return panda::ecmascript::Main(argc, argv);
+}
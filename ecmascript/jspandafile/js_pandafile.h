@@ -22,6 +22,7 @@
 #include "ecmascript/jspandafile/constpool_value.h"
 #include "ecmascript/mem/c_containers.h"
 #include "libpandafile/file.h"
+#include "os/mutex.h"
 
 namespace panda {
 namespace panda_file {
@@ -93,6 +94,11 @@ public:
 
     JSMethod *FindMethods(uint32_t offset) const;
 
+    bool HasMethod(uint32_t offset) const
+    {
+        return methodMap_.find(offset) != methodMap_.end();
+    }
+
     Span<const uint32_t> GetClasses() const
     {
         return pf_->GetClasses();
@@ -117,6 +123,17 @@ public:
         return isLoadedAOT_;
     }
 
+    // The translator fuses the frequent pairs of instructions of the file into superinstructions.
+    void SetSuperInstructionsEnabled(bool enabled)
+    {
+        enableSuperInstructions_ = enabled;
+    }
+
+    bool IsSuperInstructionsEnabled() const
+    {
+        return enableSuperInstructions_;
+    }
+
     uint32_t GetTypeSummaryIndex() const
     {
         return typeSummaryIndex_;
@@ -146,6 +163,46 @@ public:
         return dupMethodOffsetToUniqMethodOffset_.at(methodOffset);
     }
 
+    // The methods of a lazily translated file switch from the translation entry to their bytecode in two stores
+    // that the callers read without synchronization, so the file is used by the thread that loaded it only.
+    void SetLazyTranslationThread(uint32_t threadId)
+    {
+        isLazyTranslation_ = true;
+        lazyTranslationThread_ = threadId;
+    }
+
+    bool IsUsableByThread(uint32_t threadId) const
+    {
+        return !isLazyTranslation_ || lazyTranslationThread_ == threadId;
+    }
+
+    os::memory::Mutex &GetTranslationLock() const
+    {
+        return translationLock_;
+    }
+
+    // The code shared by several methods is translated with the first of them that is called.
+    bool IsTranslatedCode(const uint8_t *insns) const
+    {
+        return translatedCode_.count(insns) > 0;
+    }
+
+    void AddTranslatedCode(const uint8_t *insns)
+    {
+        translatedCode_.insert(insns);
+    }
+
+    // The methods translated lazily, in the order they were called first.
+    void AddLazyTranslatedMethod(uint32_t methodOffset)
+    {
+        lazyTranslatedMethods_.emplace_back(methodOffset);
+    }
+
+    const CVector<uint32_t> &GetLazyTranslatedMethods() const
+    {
+        return lazyTranslatedMethods_;
+    }
+
 private:
     void Initialize();
     uint32_t constpoolIndex_ {0};
@@ -162,7 +219,13 @@ private:
     bool isCjs_ {false};
     bool hasTSTypes_ {false};
     bool isLoadedAOT_ {false};
+    bool enableSuperInstructions_ {false};
     uint32_t typeSummaryIndex_ {0};
+    bool isLazyTranslation_ {false};
+    uint32_t lazyTranslationThread_ {0};
+    mutable os::memory::Mutex translationLock_;
+    CUnorderedSet<const uint8_t *> translatedCode_ {};
+    CVector<uint32_t> lazyTranslatedMethods_ {};
 };
 }  // namespace ecmascript
 }  // namespace panda
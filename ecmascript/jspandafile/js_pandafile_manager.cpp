@@ -16,6 +16,7 @@
 #include "ecmascript/jspandafile/js_pandafile_manager.h"
 #include "ecmascript/file_loader.h"
 #include "ecmascript/jspandafile/program_object.h"
+#include "ecmascript/tooling/interface/js_debugger_manager.h"
 
 namespace panda::ecmascript {
 static const size_t MALLOC_SIZE_LIMIT = 2147483648; // Max internal memory used by the VM declared in options
@@ -123,10 +124,12 @@ const JSPandaFile *JSPandaFileManager::FindJSPandaFile(const CString &filename)
     if (filename.empty()) {
         return nullptr;
     }
+    // the other threads load their own copy of a lazily translated file
+    uint32_t threadId = JSThread::GetCurrentThreadId();
     os::memory::LockHolder lock(jsPandaFileLock_);
     for (const auto &iter : loadedJSPandaFiles_) {
         const JSPandaFile *pf = iter.first;
-        if (pf->GetJSPandaFileDesc() == filename) {
+        if (pf->GetJSPandaFileDesc() == filename && pf->IsUsableByThread(threadId)) {
             return pf;
         }
     }
@@ -244,7 +247,21 @@ const JSPandaFile *JSPandaFileManager::GenerateJSPandaFile(JSThread *thread, con
         methodName = JSPandaFile::ENTRY_FUNCTION_NAME;
     }
 
-    PandaFileTranslator::TranslateClasses(newJsPandaFile, methodName);
+    // the aot code and the breakpoints of the debugger refer to the translated bytecode
+    EcmaVM *vm = thread->GetEcmaVM();
+    const JSRuntimeOptions &options = vm->GetJSOptions();
+    bool isLazy = options.EnableLazyTranslation() && !newJsPandaFile->IsLoadedAOT() &&
+        !vm->GetJsDebuggerManager()->IsDebugMode();
+    // the jit builds its circuits from the translated bytecode, which has the plain opcodes only
+    newJsPandaFile->SetSuperInstructionsEnabled(options.EnableSuperInstructions() && !options.EnableJit() &&
+        !newJsPandaFile->IsLoadedAOT() && !vm->GetJsDebuggerManager()->IsDebugMode());
+    if (isLazy) {
+        newJsPandaFile->SetLazyTranslationThread(JSThread::GetCurrentThreadId());
+    }
+    PandaFileTranslator::TranslateClasses(newJsPandaFile, methodName, nullptr, isLazy);
+    if (isLazy && !options.GetLazyTranslationList().empty()) {
+        PandaFileTranslator::TranslateListedMethods(newJsPandaFile, options.GetLazyTranslationList());
+    }
     {
         os::memory::LockHolder lock(jsPandaFileLock_);
         const JSPandaFile *jsPandaFile = FindJSPandaFile(desc);
@@ -15,6 +15,9 @@
 
 #include "ecmascript/jspandafile/panda_file_translator.h"
 
+#include <fstream>
+
+#include "ecmascript/ecma_runtime_call_info.h"
 #include "ecmascript/file_loader.h"
 #include "ecmascript/global_env.h"
 #include "ecmascript/interpreter/interpreter.h"
@@ -33,6 +36,7 @@
 #include "libpandabase/utils/utf.h"
 #include "libpandafile/bytecode_instruction-inl.h"
 #include "libpandafile/class_data_accessor-inl.h"
+#include "libpandafile/method_data_accessor-inl.h"
 
 namespace panda::ecmascript {
 template<class T, class... Args>
@@ -42,9 +46,10 @@ static T *InitializeMemory(T *mem, Args... args)
 }
 
 void PandaFileTranslator::TranslateClasses(JSPandaFile *jsPandaFile, const CString &methodName,
-                                           std::vector<MethodPcInfo> *methodPcInfos)
+                                           std::vector<MethodPcInfo> *methodPcInfos, bool isLazy)
 {
     ASSERT(jsPandaFile != nullptr && jsPandaFile->GetMethods() != nullptr);
+    ASSERT(!isLazy || (methodPcInfos == nullptr && !jsPandaFile->IsLoadedAOT()));
     JSMethod *methods = jsPandaFile->GetMethods();
     const panda_file::File *pf = jsPandaFile->GetPandaFile();
     size_t methodIdx = 0;
@@ -59,8 +64,8 @@ void PandaFileTranslator::TranslateClasses(JSPandaFile *jsPandaFile, const CStri
             continue;
         }
         panda_file::ClassDataAccessor cda(*pf, classId);
-        cda.EnumerateMethods([jsPandaFile, &translatedCode, &sd, methods, &methodIdx, pf, &methodPcInfos, &isLoadedAOT]
-            (panda_file::MethodDataAccessor &mda) {
+        cda.EnumerateMethods([jsPandaFile, &translatedCode, &sd, methods, &methodIdx, pf, &methodPcInfos, &isLoadedAOT,
+                              isLazy](panda_file::MethodDataAccessor &mda) {
             auto codeId = mda.GetCodeId();
             ASSERT(codeId.has_value());
 
@@ -79,7 +84,16 @@ void PandaFileTranslator::TranslateClasses(JSPandaFile *jsPandaFile, const CStri
             const uint8_t *insns = codeDataAccessor.GetInstructions();
             if (translatedCode.find(insns) == translatedCode.end()) {
                 translatedCode.insert(insns);
-                TranslateBytecode(jsPandaFile, codeSize, insns, method, methodPcInfos);
+                if (isLazy) {
+                    ScanBytecode(jsPandaFile, codeSize, insns, method);
+                } else {
+                    TranslateBytecode(jsPandaFile, codeSize, insns, method, methodPcInfos);
+                }
+            }
+            if (isLazy) {
+                // the method is called as a native one until it is translated
+                method->SetNativeBit(true);
+                method->SetNativePointer(reinterpret_cast<void *>(LazyTranslationEntry));
             }
             jsPandaFile->SetMethodToMap(method);
             if (isLoadedAOT) {
@@ -87,6 +101,96 @@ void PandaFileTranslator::TranslateClasses(JSPandaFile *jsPandaFile, const CStri
             }
         });
     }
+    uint32_t mainMethodIndex = jsPandaFile->GetMainMethodIndex();
+    if (isLazy && jsPandaFile->HasMethod(mainMethodIndex)) {
+        TranslateMethod(jsPandaFile, jsPandaFile->FindMethods(mainMethodIndex));
+    }
+}
+
+bool PandaFileTranslator::IsWaitingForTranslation(const JSMethod *method)
+{
+    return method->GetNativePointer() == reinterpret_cast<void *>(LazyTranslationEntry);
+}
+
+JSTaggedValue PandaFileTranslator::LazyTranslationEntry(EcmaRuntimeCallInfo *info)
+{
+    JSHandle<JSTaggedValue> func = info->GetFunction();
+    JSMethod *method = ECMAObject::Cast(func->GetTaggedObject())->GetCallTarget();
+    TranslateMethod(const_cast<JSPandaFile *>(method->GetJSPandaFile()), method);
+    // The callers skip the checks of a bytecode method for a native one, so they are done here. A call throws
+    // for a class constructor.
+    if (info->GetNewTarget()->IsUndefined()) {
+        return JSFunction::Call(info);
+    }
+    // As for a bytecode method, the caller of a base constructor has created the this object, which is the
+    // result unless the constructor returns an object.
+    JSThread *thread = info->GetThread();
+    JSHandle<JSTaggedValue> thisObj = info->GetThis();
+    JSTaggedValue result = EcmaInterpreter::Execute(info);
+    RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+    if (result.IsECMAObject() || !JSHandle<JSFunction>::Cast(func)->IsBase()) {
+        return result;
+    }
+    return thisObj.GetTaggedValue();
+}
+
+void PandaFileTranslator::TranslateMethod(JSPandaFile *jsPandaFile, JSMethod *method)
+{
+    // the file is used by this thread only, the lock keeps the lists consistent for DumpLazyTranslatedMethods
+    os::memory::LockHolder lock(jsPandaFile->GetTranslationLock());
+    if (!method->IsNativeWithCallField()) {
+        return;
+    }
+    const panda_file::File *pf = jsPandaFile->GetPandaFile();
+    panda_file::MethodDataAccessor mda(*pf, method->GetMethodId());
+    panda_file::CodeDataAccessor codeDataAccessor(*pf, mda.GetCodeId().value());
+    const uint8_t *insns = codeDataAccessor.GetInstructions();
+    if (!jsPandaFile->IsTranslatedCode(insns)) {
+        jsPandaFile->AddTranslatedCode(insns);
+        TranslateBytecode(jsPandaFile, codeDataAccessor.GetCodeSize(), insns, method, nullptr);
+    }
+    method->SetBytecodeArray(insns);
+    method->SetNativeBit(false);
+    jsPandaFile->AddLazyTranslatedMethod(method->GetMethodId().GetOffset());
+}
+
+void PandaFileTranslator::TranslateListedMethods(JSPandaFile *jsPandaFile, const std::string &listFile)
+{
+    std::ifstream file(listFile);
+    if (!file.good()) {
+        return;
+    }
+    std::string_view desc(jsPandaFile->GetJSPandaFileDesc().c_str(), jsPandaFile->GetJSPandaFileDesc().size());
+    std::string line;
+    // each line is the descriptor of a file and the offset of a method in it, separated by the last space
+    while (std::getline(file, line)) {
+        size_t pos = line.find_last_of(' ');
+        if (pos == std::string::npos || std::string_view(line).substr(0, pos) != desc) {
+            continue;
+        }
+        auto methodOffset = static_cast<uint32_t>(std::strtoul(line.c_str() + pos + 1, nullptr, 0));
+        // the list may be older than the file
+        if (jsPandaFile->HasMethod(methodOffset)) {
+            TranslateMethod(jsPandaFile, jsPandaFile->FindMethods(methodOffset));
+        }
+    }
+}
+
+bool PandaFileTranslator::DumpLazyTranslatedMethods(const std::string &listFile)
+{
+    std::ofstream file(listFile, std::ios::trunc);
+    if (!file.good()) {
+        LOG_ECMA(ERROR) << "open file " << listFile << " error";
+        return false;
+    }
+    JSPandaFileManager::GetInstance()->EnumerateJSPandaFiles([&file](const JSPandaFile *jsPandaFile) {
+        os::memory::LockHolder lock(jsPandaFile->GetTranslationLock());
+        for (uint32_t methodOffset : jsPandaFile->GetLazyTranslatedMethods()) {
+            file << jsPandaFile->GetJSPandaFileDesc() << " " << methodOffset << "\n";
+        }
+        return true;
+    });
+    return file.good();
 }
 
 JSHandle<Program> PandaFileTranslator::GenerateProgram(EcmaVM *vm, const JSPandaFile *jsPandaFile)
@@ -251,8 +355,12 @@ JSTaggedValue PandaFileTranslator::ParseConstPool(EcmaVM *vm, const JSPandaFile
             }
             uint32_t length = literal->GetLength();
 
-            JSHandle<JSArray> arr(JSArray::ArrayCreate(thread, JSTaggedNumber(length)));
+            JSHandle<JSArray> arr(JSArray::ArrayCreate(thread, JSTaggedNumber(0)));
+            arr->SetArrayLength(thread, length);
             arr->SetElements(thread, literal);
+            // the arrays cloned from this literal share its hclass and so its elements kind
+            JSHClass::TransitionElementsKind(thread, JSHandle<JSObject>(arr),
+                                             Elements::ComputeElementsKind(*literal, length));
             constpool->Set(thread, value.GetConstpoolIndex(), arr.GetTaggedValue());
         } else if (value.GetConstpoolType() == ConstPoolType::CLASS_LITERAL) {
             size_t index = it.first;
@@ -276,66 +384,85 @@ JSTaggedValue PandaFileTranslator::ParseConstPool(EcmaVM *vm, const JSPandaFile
     return constpool.GetTaggedValue();
 }
 
-void PandaFileTranslator::FixOpcode(uint8_t *pc)
+EcmaOpcode PandaFileTranslator::GetEcmaOpcode(const uint8_t *pc)
 {
     auto opcode = static_cast<BytecodeInstruction::Opcode>(*pc);
 
     switch (opcode) {
         case BytecodeInstruction::Opcode::MOV_V4_V4:
-            *pc = static_cast<uint8_t>(EcmaOpcode::MOV_V4_V4);
-            break;
+            return EcmaOpcode::MOV_V4_V4;
         case BytecodeInstruction::Opcode::MOV_DYN_V8_V8:
-            *pc = static_cast<uint8_t>(EcmaOpcode::MOV_DYN_V8_V8);
-            break;
+            return EcmaOpcode::MOV_DYN_V8_V8;
         case BytecodeInstruction::Opcode::MOV_DYN_V16_V16:
-            *pc = static_cast<uint8_t>(EcmaOpcode::MOV_DYN_V16_V16);
-            break;
+            return EcmaOpcode::MOV_DYN_V16_V16;
         case BytecodeInstruction::Opcode::LDA_STR_ID32:
-            *pc = static_cast<uint8_t>(EcmaOpcode::LDA_STR_ID32);
-            break;
+            return EcmaOpcode::LDA_STR_ID32;
         case BytecodeInstruction::Opcode::JMP_IMM8:
-            *pc = static_cast<uint8_t>(EcmaOpcode::JMP_IMM8);
-            break;
+            return EcmaOpcode::JMP_IMM8;
         case BytecodeInstruction::Opcode::JMP_IMM16:
-            *pc = static_cast<uint8_t>(EcmaOpcode::JMP_IMM16);
-            break;
+            return EcmaOpcode::JMP_IMM16;
         case BytecodeInstruction::Opcode::JMP_IMM32:
-            *pc = static_cast<uint8_t>(EcmaOpcode::JMP_IMM32);
-            break;
+            return EcmaOpcode::JMP_IMM32;
         case BytecodeInstruction::Opcode::JEQZ_IMM8:
-            *pc = static_cast<uint8_t>(EcmaOpcode::JEQZ_IMM8);
-            break;
+            return EcmaOpcode::JEQZ_IMM8;
         case BytecodeInstruction::Opcode::JEQZ_IMM16:
-            *pc = static_cast<uint8_t>(EcmaOpcode::JEQZ_IMM16);
-            break;
+            return EcmaOpcode::JEQZ_IMM16;
         case BytecodeInstruction::Opcode::JNEZ_IMM8:
-            *pc = static_cast<uint8_t>(EcmaOpcode::JNEZ_IMM8);
-            break;
+            return EcmaOpcode::JNEZ_IMM8;
         case BytecodeInstruction::Opcode::JNEZ_IMM16:
-            *pc = static_cast<uint8_t>(EcmaOpcode::JNEZ_IMM16);
-            break;
+            return EcmaOpcode::JNEZ_IMM16;
         case BytecodeInstruction::Opcode::LDA_DYN_V8:
-            *pc = static_cast<uint8_t>(EcmaOpcode::LDA_DYN_V8);
-            break;
+            return EcmaOpcode::LDA_DYN_V8;
         case BytecodeInstruction::Opcode::STA_DYN_V8:
-            *pc = static_cast<uint8_t>(EcmaOpcode::STA_DYN_V8);
-            break;
+            return EcmaOpcode::STA_DYN_V8;
         case BytecodeInstruction::Opcode::LDAI_DYN_IMM32:
-            *pc = static_cast<uint8_t>(EcmaOpcode::LDAI_DYN_IMM32);
-            break;
+            return EcmaOpcode::LDAI_DYN_IMM32;
         case BytecodeInstruction::Opcode::FLDAI_DYN_IMM64:
-            *pc = static_cast<uint8_t>(EcmaOpcode::FLDAI_DYN_IMM64);
-            break;
+            return EcmaOpcode::FLDAI_DYN_IMM64;
         case BytecodeInstruction::Opcode::RETURN_DYN:
-            *pc = static_cast<uint8_t>(EcmaOpcode::RETURN_DYN);
-            break;
+            return EcmaOpcode::RETURN_DYN;
         default:
             if (*pc != static_cast<uint8_t>(BytecodeInstruction::Opcode::ECMA_LDNAN_PREF_NONE)) {
                 LOG_FULL(FATAL) << "Is not an Ecma Opcode opcode: " << static_cast<uint16_t>(opcode);
                 UNREACHABLE();
             }
-            *pc = *(pc + 1);
-            *(pc + 1) = 0xFF;
+            return static_cast<EcmaOpcode>(*(pc + 1));
+    }
+}
+
+void PandaFileTranslator::FixOpcode(uint8_t *pc)
+{
+    EcmaOpcode opcode = GetEcmaOpcode(pc);
+    if (*pc == static_cast<uint8_t>(BytecodeInstruction::Opcode::ECMA_LDNAN_PREF_NONE)) {
+        *(pc + 1) = 0xFF;
+    }
+    *pc = static_cast<uint8_t>(opcode);
+}
+
+void PandaFileTranslator::FixSuperInstruction(uint8_t *prevPc, const uint8_t *pc)
+{
+    // only the opcode of the first instruction changes, a jump to the second one and the pc a call returns to
+    // still find it as it is, and the debugger dispatches a superinstruction to the handler of its first one
+    auto second = static_cast<EcmaOpcode>(*pc);
+    switch (static_cast<EcmaOpcode>(*prevPc)) {
+        case EcmaOpcode::LDA_DYN_V8:
+            if (second == EcmaOpcode::STA_DYN_V8) {
+                *prevPc = static_cast<uint8_t>(EcmaOpcode::LDA_DYN_V8_STA_DYN_V8);
+            }
+            break;
+        case EcmaOpcode::STA_DYN_V8:
+            if (second == EcmaOpcode::LDA_DYN_V8) {
+                *prevPc = static_cast<uint8_t>(EcmaOpcode::STA_DYN_V8_LDA_DYN_V8);
+            } else if (second == EcmaOpcode::CALLITHISRANGEDYN_PREF_IMM16_V8) {
+                *prevPc = static_cast<uint8_t>(EcmaOpcode::STA_DYN_V8_CALLITHISRANGEDYN_PREF_IMM16_V8);
+            }
+            break;
+        case EcmaOpcode::LESSDYN_PREF_V8:
+            if (second == EcmaOpcode::JEQZ_IMM8) {
+                *prevPc = static_cast<uint8_t>(EcmaOpcode::LESSDYN_PREF_V8_JEQZ_IMM8);
+            }
+            break;
+        default:
             break;
     }
 }
@@ -474,91 +601,140 @@ void PandaFileTranslator::FixInstructionId32(const BytecodeInstruction &inst, ui
 void PandaFileTranslator::TranslateBytecode(JSPandaFile *jsPandaFile, uint32_t insSz, const uint8_t *insArr,
                                             const JSMethod *method, std::vector<MethodPcInfo> *methodPcInfos)
 {
-    const panda_file::File *pf = jsPandaFile->GetPandaFile();
     auto bcIns = BytecodeInstruction(insArr);
     auto bcInsLast = bcIns.JumpTo(insSz);
     if (methodPcInfos != nullptr) {
         methodPcInfos->push_back(MethodPcInfo{method, {}});
     }
 
+    // the aot compiler gets the pcs of the plain instructions
+    bool fuseInstructions = methodPcInfos == nullptr && jsPandaFile->IsSuperInstructionsEnabled();
+    uint8_t *prevPc = nullptr;
     while (bcIns.GetAddress() != bcInsLast.GetAddress()) {
-        if (bcIns.HasFlag(BytecodeInstruction::Flags::STRING_ID) &&
-            BytecodeInstruction::HasId(bcIns.GetFormat(), 0)) {
-            auto index = jsPandaFile->GetOrInsertConstantPool(
-                ConstPoolType::STRING, bcIns.GetId().AsFileId().GetOffset());
+        ResolveInstructionIds(jsPandaFile, bcIns, method, true);
+        // NOLINTNEXTLINE(hicpp-use-auto)
+        auto pc = const_cast<uint8_t *>(bcIns.GetAddress());
+        bcIns = bcIns.GetNext();
+        FixOpcode(pc);
+        UpdateICOffset(const_cast<JSMethod *>(method), pc);
+        if (fuseInstructions && prevPc != nullptr) {
+            FixSuperInstruction(prevPc, pc);
+        }
+        prevPc = pc;
+        if (methodPcInfos != nullptr) {
+            auto &pcArray = methodPcInfos->back().pcArray;
+            pcArray.emplace_back(pc);
+        }
+    }
+    if (methodPcInfos != nullptr) {
+        auto &pcArray = methodPcInfos->back().pcArray;
+        pcArray.emplace_back(const_cast<uint8_t *>(bcInsLast.GetAddress()));
+    }
+}
+
+// The constant pool of a file is created with the first program of the file, with an entry for each of the
+// literals, strings and functions its bytecode refers to. So the bytecode of all of the methods is scanned
+// for them when the file is loaded, and only the rewrite of the bytecode, which writes to the pages of the file,
+// waits until the method is called first.
+void PandaFileTranslator::ScanBytecode(JSPandaFile *jsPandaFile, uint32_t insSz, const uint8_t *insArr,
+                                       const JSMethod *method)
+{
+    auto bcIns = BytecodeInstruction(insArr);
+    auto bcInsLast = bcIns.JumpTo(insSz);
+    while (bcIns.GetAddress() != bcInsLast.GetAddress()) {
+        ResolveInstructionIds(jsPandaFile, bcIns, method, false);
+        bcIns = bcIns.GetNext();
+    }
+}
+
+// Add the constant pool entries an instruction refers to, and write their indexes into it with needFix.
+void PandaFileTranslator::ResolveInstructionIds(JSPandaFile *jsPandaFile, const BytecodeInstruction &bcIns,
+                                                const JSMethod *method, bool needFix)
+{
+    const panda_file::File *pf = jsPandaFile->GetPandaFile();
+    if (bcIns.HasFlag(BytecodeInstruction::Flags::STRING_ID) &&
+        BytecodeInstruction::HasId(bcIns.GetFormat(), 0)) {
+        auto index = jsPandaFile->GetOrInsertConstantPool(
+            ConstPoolType::STRING, bcIns.GetId().AsFileId().GetOffset());
+        if (needFix) {
             FixInstructionId32(bcIns, index);
-        } else {
-            BytecodeInstruction::Opcode opcode = static_cast<BytecodeInstruction::Opcode>(bcIns.GetOpcode());
-            switch (opcode) {
-                uint32_t index;
-                uint32_t methodId;
-                case BytecodeInstruction::Opcode::ECMA_DEFINEFUNCDYN_PREF_ID16_IMM16_V8:
-                    methodId = pf->ResolveMethodIndex(method->GetMethodId(), bcIns.GetId().AsIndex()).GetOffset();
-                    index = jsPandaFile->GetOrInsertConstantPool(ConstPoolType::BASE_FUNCTION, methodId);
+        }
+    } else {
+        BytecodeInstruction::Opcode opcode = static_cast<BytecodeInstruction::Opcode>(bcIns.GetOpcode());
+        switch (opcode) {
+            uint32_t index;
+            uint32_t methodId;
+            case BytecodeInstruction::Opcode::ECMA_DEFINEFUNCDYN_PREF_ID16_IMM16_V8:
+                methodId = pf->ResolveMethodIndex(method->GetMethodId(), bcIns.GetId().AsIndex()).GetOffset();
+                index = jsPandaFile->GetOrInsertConstantPool(ConstPoolType::BASE_FUNCTION, methodId);
+                if (needFix) {
                     FixInstructionId32(bcIns, index);
-                    break;
-                case BytecodeInstruction::Opcode::ECMA_DEFINENCFUNCDYN_PREF_ID16_IMM16_V8:
-                    methodId = pf->ResolveMethodIndex(method->GetMethodId(), bcIns.GetId().AsIndex()).GetOffset();
-                    index = jsPandaFile->GetOrInsertConstantPool(ConstPoolType::NC_FUNCTION, methodId);
+                }
+                break;
+            case BytecodeInstruction::Opcode::ECMA_DEFINENCFUNCDYN_PREF_ID16_IMM16_V8:
+                methodId = pf->ResolveMethodIndex(method->GetMethodId(), bcIns.GetId().AsIndex()).GetOffset();
+                index = jsPandaFile->GetOrInsertConstantPool(ConstPoolType::NC_FUNCTION, methodId);
+                if (needFix) {
                     FixInstructionId32(bcIns, index);
-                    break;
-                case BytecodeInstruction::Opcode::ECMA_DEFINEGENERATORFUNC_PREF_ID16_IMM16_V8:
-                    methodId = pf->ResolveMethodIndex(method->GetMethodId(), bcIns.GetId().AsIndex()).GetOffset();
-                    index = jsPandaFile->GetOrInsertConstantPool(ConstPoolType::GENERATOR_FUNCTION, methodId);
+                }
+                break;
+            case BytecodeInstruction::Opcode::ECMA_DEFINEGENERATORFUNC_PREF_ID16_IMM16_V8:
+                methodId = pf->ResolveMethodIndex(method->GetMethodId(), bcIns.GetId().AsIndex()).GetOffset();
+                index = jsPandaFile->GetOrInsertConstantPool(ConstPoolType::GENERATOR_FUNCTION, methodId);
+                if (needFix) {
                     FixInstructionId32(bcIns, index);
-                    break;
-                case BytecodeInstruction::Opcode::ECMA_DEFINEASYNCFUNC_PREF_ID16_IMM16_V8:
-                    methodId = pf->ResolveMethodIndex(method->GetMethodId(), bcIns.GetId().AsIndex()).GetOffset();
-                    index = jsPandaFile->GetOrInsertConstantPool(ConstPoolType::ASYNC_FUNCTION, methodId);
+                }
+                break;
+            case BytecodeInstruction::Opcode::ECMA_DEFINEASYNCFUNC_PREF_ID16_IMM16_V8:
+                methodId = pf->ResolveMethodIndex(method->GetMethodId(), bcIns.GetId().AsIndex()).GetOffset();
+                index = jsPandaFile->GetOrInsertConstantPool(ConstPoolType::ASYNC_FUNCTION, methodId);
+                if (needFix) {
                     FixInstructionId32(bcIns, index);
-                    break;
-                case BytecodeInstruction::Opcode::ECMA_DEFINEMETHOD_PREF_ID16_IMM16_V8:
-                    methodId = pf->ResolveMethodIndex(method->GetMethodId(), bcIns.GetId().AsIndex()).GetOffset();
-                    index = jsPandaFile->GetOrInsertConstantPool(ConstPoolType::METHOD, methodId);
+                }
+                break;
+            case BytecodeInstruction::Opcode::ECMA_DEFINEMETHOD_PREF_ID16_IMM16_V8:
+                methodId = pf->ResolveMethodIndex(method->GetMethodId(), bcIns.GetId().AsIndex()).GetOffset();
+                index = jsPandaFile->GetOrInsertConstantPool(ConstPoolType::METHOD, methodId);
+                if (needFix) {
                     FixInstructionId32(bcIns, index);
-                    break;
-                case BytecodeInstruction::Opcode::ECMA_CREATEOBJECTWITHBUFFER_PREF_IMM16:
-                case BytecodeInstruction::Opcode::ECMA_CREATEOBJECTHAVINGMETHOD_PREF_IMM16: {
-                    auto imm = bcIns.GetImm<BytecodeInstruction::Format::PREF_IMM16>();
-                    index = jsPandaFile->GetOrInsertConstantPool(ConstPoolType::OBJECT_LITERAL,
-                        static_cast<uint16_t>(imm));
+                }
+                break;
+            case BytecodeInstruction::Opcode::ECMA_CREATEOBJECTWITHBUFFER_PREF_IMM16:
+            case BytecodeInstruction::Opcode::ECMA_CREATEOBJECTHAVINGMETHOD_PREF_IMM16: {
+                auto imm = bcIns.GetImm<BytecodeInstruction::Format::PREF_IMM16>();
+                index = jsPandaFile->GetOrInsertConstantPool(ConstPoolType::OBJECT_LITERAL,
+                    static_cast<uint16_t>(imm));
+                if (needFix) {
                     FixInstructionId32(bcIns, index);
-                    break;
                 }
-                case BytecodeInstruction::Opcode::ECMA_CREATEARRAYWITHBUFFER_PREF_IMM16: {
-                    auto imm = bcIns.GetImm<BytecodeInstruction::Format::PREF_IMM16>();
-                    index = jsPandaFile->GetOrInsertConstantPool(ConstPoolType::ARRAY_LITERAL,
-                        static_cast<uint16_t>(imm));
+                break;
+            }
+            case BytecodeInstruction::Opcode::ECMA_CREATEARRAYWITHBUFFER_PREF_IMM16: {
+                auto imm = bcIns.GetImm<BytecodeInstruction::Format::PREF_IMM16>();
+                index = jsPandaFile->GetOrInsertConstantPool(ConstPoolType::ARRAY_LITERAL,
+                    static_cast<uint16_t>(imm));
+                if (needFix) {
                     FixInstructionId32(bcIns, index);
-                    break;
                 }
-                case BytecodeInstruction::Opcode::ECMA_DEFINECLASSWITHBUFFER_PREF_ID16_IMM16_IMM16_V8_V8: {
-                    methodId = pf->ResolveMethodIndex(method->GetMethodId(), bcIns.GetId().AsIndex()).GetOffset();
-                    index = jsPandaFile->GetOrInsertConstantPool(ConstPoolType::CLASS_FUNCTION, methodId);
+                break;
+            }
+            case BytecodeInstruction::Opcode::ECMA_DEFINECLASSWITHBUFFER_PREF_ID16_IMM16_IMM16_V8_V8: {
+                methodId = pf->ResolveMethodIndex(method->GetMethodId(), bcIns.GetId().AsIndex()).GetOffset();
+                index = jsPandaFile->GetOrInsertConstantPool(ConstPoolType::CLASS_FUNCTION, methodId);
+                if (needFix) {
                     FixInstructionId32(bcIns, index);
-                    auto imm = bcIns.GetImm<BytecodeInstruction::Format::PREF_ID16_IMM16_IMM16_V8_V8>();
-                    index = jsPandaFile->GetOrInsertConstantPool(ConstPoolType::CLASS_LITERAL,
-                        static_cast<uint16_t>(imm));
+                }
+                auto imm = bcIns.GetImm<BytecodeInstruction::Format::PREF_ID16_IMM16_IMM16_V8_V8>();
+                index = jsPandaFile->GetOrInsertConstantPool(ConstPoolType::CLASS_LITERAL,
+                    static_cast<uint16_t>(imm));
+                if (needFix) {
                     FixInstructionId32(bcIns, index, 1);
-                    break;
                 }
-                default:
-                    break;
+                break;
             }
+            default:
+                break;
         }
-        // NOLINTNEXTLINE(hicpp-use-auto)
-        auto pc = const_cast<uint8_t *>(bcIns.GetAddress());
-        bcIns = bcIns.GetNext();
-        FixOpcode(pc);
-        UpdateICOffset(const_cast<JSMethod *>(method), pc);
-        if (methodPcInfos != nullptr) {
-            auto &pcArray = methodPcInfos->back().pcArray;
-            pcArray.emplace_back(pc);
-        }
-    }
-    if (methodPcInfos != nullptr) {
-        auto &pcArray = methodPcInfos->back().pcArray;
-        pcArray.emplace_back(const_cast<uint8_t *>(bcInsLast.GetAddress()));
     }
 }
 
@@ -50,14 +50,29 @@ public:
     NO_COPY_SEMANTIC(PandaFileTranslator);
     NO_MOVE_SEMANTIC(PandaFileTranslator);
     static JSHandle<Program> GenerateProgram(EcmaVM *vm, const JSPandaFile *jsPandaFile);
+    // With isLazy, the methods but the main one get an entry that translates them when they are called first.
     static void TranslateClasses(JSPandaFile *jsPandaFile, const CString &methodName,
-                                 std::vector<MethodPcInfo> *methodPcInfos = nullptr);
+                                 std::vector<MethodPcInfo> *methodPcInfos = nullptr, bool isLazy = false);
+    // Translate the methods of a lazily translated file that are in the list written by DumpLazyTranslatedMethods.
+    static void TranslateListedMethods(JSPandaFile *jsPandaFile, const std::string &listFile);
+    static bool DumpLazyTranslatedMethods(const std::string &listFile);
+    // A lazily translated method looks native until its first call.
+    static bool IsWaitingForTranslation(const JSMethod *method);
+    // The opcode of the instruction at pc of the bytecode of a panda file as the interpreter sees it translated.
+    static EcmaOpcode GetEcmaOpcode(const uint8_t *pc);
 
 private:
+    static JSTaggedValue LazyTranslationEntry(EcmaRuntimeCallInfo *info);
+    static void TranslateMethod(JSPandaFile *jsPandaFile, JSMethod *method);
     static void TranslateBytecode(JSPandaFile *jsPandaFile, uint32_t insSz, const uint8_t *insArr,
                                   const JSMethod *method, std::vector<MethodPcInfo> *methodPcInfos);
+    static void ScanBytecode(JSPandaFile *jsPandaFile, uint32_t insSz, const uint8_t *insArr,
+                             const JSMethod *method);
+    static void ResolveInstructionIds(JSPandaFile *jsPandaFile, const BytecodeInstruction &bcIns,
+                                      const JSMethod *method, bool needFix);
     static void FixInstructionId32(const BytecodeInstruction &inst, uint32_t index, uint32_t fixOrder = 0);
     static void FixOpcode(uint8_t *pc);
+    static void FixSuperInstruction(uint8_t *prevPc, const uint8_t *pc);
     static void UpdateICOffset(JSMethod *method, uint8_t *pc);
     static JSTaggedValue ParseConstPool(EcmaVM *vm, const JSPandaFile *jsPandaFile);
     static void DefineClassesInConstPool(JSThread *thread, JSHandle<ConstantPool> constpool,
@@ -105,6 +105,28 @@ public:
         return -1;
     }
 
+    // Insert without growing the table, for the fast calls of the builtins which must not allocate. It returns
+    // false and changes nothing when the key is new and the table has no room for it.
+    inline bool InsertInPlace(const JSThread *thread, JSTaggedValue key, JSTaggedValue value)
+    {
+        ASSERT(IsKey(key));
+        int entry = FindElement(key);
+        if (entry != -1) {
+            SetValue(thread, entry, value);
+            return true;
+        }
+        if (!HasSufficientCapacity(1)) {
+            return false;
+        }
+        uint32_t bucket = HashToBucket(LinkedHash::Hash(key));
+        entry = NumberOfElements() + NumberOfDeletedElements();
+        InsertNewEntry(thread, bucket, entry);
+        SetKey(thread, entry, key);
+        SetValue(thread, entry, value);
+        SetNumberOfElements(thread, NumberOfElements() + 1);
+        return true;
+    }
+
     inline void RemoveEntry(const JSThread *thread, int entry)
     {
         ASSERT_PRINT(entry >= 0 && entry < Capacity(), "entry must be a non-negative integer less than capacity");
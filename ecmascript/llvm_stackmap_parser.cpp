@@ -14,6 +14,9 @@
  */
 
 #include "ecmascript/llvm_stackmap_parser.h"
+
+#include <algorithm>
+
 #include "ecmascript/compiler/assembler/assembler.h"
 #include "ecmascript/frames.h"
 #include "ecmascript/mem/slots.h"
@@ -143,19 +146,107 @@ bool LLVMStackMapParser::CollectGCSlots(uintptr_t callSiteAddr, uintptr_t callsi
     return true;
 }
 
+const DeoptInfo *LLVMStackMapParser::GetDeoptInfoByPc(uintptr_t callSiteAddr) const
+{
+    for (auto &pc2DeoptInfo : pc2DeoptInfoVec_) {
+        auto it = pc2DeoptInfo.find(callSiteAddr);
+        if (it != pc2DeoptInfo.end()) {
+            return &(it->second);
+        }
+    }
+    return nullptr;
+}
+
+bool LLVMStackMapParser::CollectDeoptValues(uintptr_t callSiteAddr, uintptr_t callsiteFp, uintptr_t callSiteSp,
+    std::vector<JSTaggedType> &values) const
+{
+    const DeoptInfo *infos = GetDeoptInfoByPc(callSiteAddr);
+    if (infos == nullptr) {
+        return false;
+    }
+    for (const auto &info : *infos) {
+        if (info.isConstant) {
+            values.emplace_back(static_cast<JSTaggedType>(info.constant));
+            continue;
+        }
+        uintptr_t address = GetStackSlotAddress(info.slot, callSiteSp, callsiteFp);
+        if (info.size == sizeof(uint32_t)) {
+            values.emplace_back(*reinterpret_cast<uint32_t *>(address));
+        } else {
+            values.emplace_back(*reinterpret_cast<JSTaggedType *>(address));
+        }
+    }
+    return true;
+}
+
+bool LLVMStackMapParser::CalcDeoptInfo(const StkMapRecordTy &record, DeoptInfo &deoptInfo) const
+{
+    const auto &locations = record.Locations;
+    const size_t firstIndex = static_cast<size_t>(LocationTy::CONSTANT_FIRST_ELEMENT_INDEX);
+    if (locations.size() < firstIndex ||
+        locations[LocationTy::DEOPT_COUNT_INDEX].location != LocationTy::Kind::CONSTANT ||
+        locations[LocationTy::DEOPT_COUNT_INDEX].OffsetOrSmallConstant < 0) {
+        return false;
+    }
+    size_t numDeopt = static_cast<size_t>(locations[LocationTy::DEOPT_COUNT_INDEX].OffsetOrSmallConstant);
+    if (firstIndex + numDeopt > locations.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < numDeopt; i++) {
+        const LocationTy &loc = locations[firstIndex + i];
+        DeoptValueLocation value;
+        value.size = loc.LocationSize;
+        switch (loc.location) {
+            case LocationTy::Kind::CONSTANT:
+                value.constant = loc.OffsetOrSmallConstant;
+                break;
+            case LocationTy::Kind::CONSTANTNDEX:
+                value.constant = static_cast<int64_t>(llvmStackMap_.Constants.at(loc.OffsetOrSmallConstant)
+                    .LargeConstant);
+                break;
+            case LocationTy::Kind::INDIRECT:
+                value.isConstant = false;
+                value.slot = DwarfRegAndOffsetType(loc.DwarfRegNum, loc.OffsetOrSmallConstant);
+                break;
+            default:
+                // a value kept in a register can not be read after the call
+                return false;
+        }
+        deoptInfo.emplace_back(value);
+    }
+    return true;
+}
+
 void LLVMStackMapParser::CalcCallSite()
 {
     uint64_t recordNum = 0;
     Pc2CallSiteInfo pc2CallSiteInfo;
     Pc2ConstInfo pc2ConstInfo;
+    Pc2DeoptInfo pc2DeoptInfo;
     auto calStkMapRecordFunc =
-        [this, &recordNum, &pc2CallSiteInfo, &pc2ConstInfo](uintptr_t address, uint32_t recordId) {
-        struct StkMapRecordHeadTy recordHead = llvmStackMap_.StkMapRecord[recordNum + recordId].head;
+        [this, &recordNum, &pc2CallSiteInfo, &pc2ConstInfo, &pc2DeoptInfo](uintptr_t address, uint32_t recordId) {
+        const StkMapRecordTy &record = llvmStackMap_.StkMapRecord[recordNum + recordId];
+        struct StkMapRecordHeadTy recordHead = record.head;
+        // the deopt values spilled to the frame are read by the deoptimizer, not visited by the gc
+        int deoptEnd = LocationTy::CONSTANT_FIRST_ELEMENT_INDEX;
+        DeoptInfo deoptInfo;
+        if (CalcDeoptInfo(record, deoptInfo)) {
+            deoptEnd += static_cast<int>(deoptInfo.size());
+            bool hasSpilledValue = std::any_of(deoptInfo.begin(), deoptInfo.end(),
+                [](const DeoptValueLocation &value) { return !value.isConstant; });
+            if (hasSpilledValue) {
+                pc2DeoptInfo[address + recordHead.InstructionOffset] = std::move(deoptInfo);
+            }
+        }
         for (int j = 0; j < recordHead.NumLocations; j++) {
-            struct LocationTy loc = llvmStackMap_.StkMapRecord[recordNum + recordId].Locations[j];
+            struct LocationTy loc = record.Locations[j];
             uint32_t instructionOffset = recordHead.InstructionOffset;
             uintptr_t callsite = address + instructionOffset;
             uint64_t  patchPointID = recordHead.PatchPointID;
+            if (loc.location == LocationTy::Kind::INDIRECT && j >= LocationTy::CONSTANT_FIRST_ELEMENT_INDEX &&
+                j < deoptEnd) {
+                continue;
+            }
             if (loc.location == LocationTy::Kind::INDIRECT) {
                 OPTIONAL_LOG_COMPILER(DEBUG) << "DwarfRegNum:" << loc.DwarfRegNum << " loc.OffsetOrSmallConstant:"
                     << loc.OffsetOrSmallConstant << "address:" << address << " instructionOffset:" <<
@@ -185,6 +276,7 @@ void LLVMStackMapParser::CalcCallSite()
     }
     pc2CallSiteInfoVec_.emplace_back(pc2CallSiteInfo);
     pc2ConstInfoVec_.emplace_back(pc2ConstInfo);
+    pc2DeoptInfoVec_.emplace_back(pc2DeoptInfo);
 }
 
 bool LLVMStackMapParser::CalculateStackMap(std::unique_ptr<uint8_t []> stackMapAddr)
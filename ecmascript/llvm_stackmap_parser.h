@@ -37,6 +37,16 @@ using Func2FpDelta = std::unordered_map<uintptr_t, FpDelta>; // value: fpDelta &
 using ConstInfo = std::vector<OffsetType>;
 using Pc2ConstInfo = std::unordered_map<uintptr_t, ConstInfo>;
 
+// A value of the deopt bundle of a call, which is either a constant or spilled to the frame of the caller.
+struct DeoptValueLocation {
+    bool isConstant {true};
+    uint16_t size {0};
+    DwarfRegAndOffsetType slot {};
+    int64_t constant {0};
+};
+using DeoptInfo = std::vector<DeoptValueLocation>;
+using Pc2DeoptInfo = std::unordered_map<uintptr_t, DeoptInfo>;
+
 struct Header {
     uint8_t  stackmapversion; // Stack Map Version (current version is 3)
     uint8_t  Reserved0; // Reserved (expected to be 0)
@@ -93,6 +103,8 @@ struct  LocationTy {
         CONSTANT = 4,
         CONSTANTNDEX = 5,
     };
+    // the first three locations of a statepoint are its calling convention, its flags and its deopt value count
+    static constexpr int DEOPT_COUNT_INDEX = 2;
     static constexpr int CONSTANT_FIRST_ELEMENT_INDEX = 3;
     Kind location;
     uint8_t Reserved_0;
@@ -225,6 +237,10 @@ public:
         return {};
     }
 
+    const DeoptInfo *GetDeoptInfoByPc(uintptr_t callSiteAddr) const;
+    // Read the values of the deopt bundle of a call from the frame of its caller, in the order of the bundle.
+    bool CollectDeoptValues(uintptr_t callSiteAddr, uintptr_t callsiteFp, uintptr_t callSiteSp,
+                            std::vector<JSTaggedType> &values) const;
     explicit LLVMStackMapParser(bool enableLog = false)
     {
         pc2CallSiteInfoVec_.clear();
@@ -233,6 +249,7 @@ public:
         funAddr_.clear();
         fun2FpDelta_.clear();
         pc2ConstInfoVec_.clear();
+        pc2DeoptInfoVec_.clear();
     }
     ~LLVMStackMapParser()
     {
@@ -241,9 +258,11 @@ public:
         funAddr_.clear();
         fun2FpDelta_.clear();
         pc2ConstInfoVec_.clear();
+        pc2DeoptInfoVec_.clear();
     }
 private:
     void CalcCallSite();
+    bool CalcDeoptInfo(const StkMapRecordTy &record, DeoptInfo &deoptInfo) const;
     void PrintCallSiteInfo(const CallSiteInfo *infos, OptimizedLeaveFrame *frame) const;
     void PrintCallSiteInfo(const CallSiteInfo *infos, uintptr_t callSiteFp, uintptr_t callSiteSp) const;
     int FindFpDelta(uintptr_t funcAddr, uintptr_t callsitePc) const;
@@ -262,6 +281,7 @@ private:
     std::set<uintptr_t> funAddr_;
     std::vector<Func2FpDelta> fun2FpDelta_;
     std::vector<Pc2ConstInfo> pc2ConstInfoVec_;
+    std::vector<Pc2DeoptInfo> pc2DeoptInfoVec_;
 };
 } // namespace panda::ecmascript::kungfu
 #endif  // ECMASCRIPT_LLVM_STACKMAP_PARSER_H
\ No newline at end of file
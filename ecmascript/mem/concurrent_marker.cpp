@@ -24,6 +24,7 @@
 #include "ecmascript/mem/verification.h"
 #include "ecmascript/mem/visitor.h"
 #include "ecmascript/mem/gc_stats.h"
+#include "ecmascript/mem/gc_tracer.h"
 #include "ecmascript/ecma_string_table.h"
 #include "ecmascript/taskpool/taskpool.h"
 #include "ecmascript/runtime_call_id.h"
@@ -76,6 +77,7 @@ void ConcurrentMarker::ReMark()
     LOG_GC(DEBUG) << "ConcurrentMarker: Remarking Begin";
     MEM_ALLOCATE_AND_GC_TRACE(vm_, ReMarking);
     ClockScope scope;
+    GCTraceScope traceScope(heap_->GetGCTracer(), GCTraceCollector::CONCURRENT_MARKER, GCTracePhase::REMARK);
     Marker *nonMovableMarker = heap_->GetNonMovableMarker();
     nonMovableMarker->MarkRoots(MAIN_THREAD_INDEX);
     if (!heap_->IsFullMark() && !heap_->IsParallelGCEnabled()) {
@@ -143,13 +145,18 @@ void ConcurrentMarker::InitializeMarking()
         heapObjectSize_ = heap_->GetNewSpace()->GetHeapObjectSize();
     }
     workManager_->Initialize(TriggerGCType::OLD_GC, ParallelGCTaskPhase::CONCURRENT_HANDLE_GLOBAL_POOL_TASK);
+    GCTraceScope traceScope(heap_->GetGCTracer(), GCTraceCollector::CONCURRENT_MARKER, GCTracePhase::MARK_ROOTS);
     heap_->GetNonMovableMarker()->MarkRoots(MAIN_THREAD_INDEX);
 }
 
 bool ConcurrentMarker::MarkerTask::Run(uint32_t threadId)
 {
     ClockScope clockScope;
-    heap_->GetNonMovableMarker()->ProcessMarkStack(threadId);
+    {
+        GCTraceScope traceScope(heap_->GetGCTracer(), GCTraceCollector::CONCURRENT_MARKER, GCTracePhase::MARK,
+                                static_cast<size_t>(heap_->GetConcurrentMarker()->GetHeapObjectSize()));
+        heap_->GetNonMovableMarker()->ProcessMarkStack(threadId);
+    }
     heap_->WaitRunningTaskFinished();
     heap_->GetConcurrentMarker()->FinishMarking(clockScope.TotalSpentTime());
     return true;
@@ -16,6 +16,7 @@
 #include "ecmascript/mem/concurrent_sweeper.h"
 
 #include "ecmascript/ecma_macros.h"
+#include "ecmascript/mem/gc_tracer.h"
 #include "ecmascript/mem/heap.h"
 #include "ecmascript/mem/region-inl.h"
 #include "ecmascript/mem/space-inl.h"
@@ -63,7 +64,10 @@ void ConcurrentSweeper::Sweep(bool fullGC)
 void ConcurrentSweeper::AsyncSweepSpace(MemSpaceType type, bool isMain)
 {
     auto space = heap_->GetSpaceWithType(type);
-    space->AsyncSweep(isMain);
+    {
+        GCTraceScope traceScope(heap_->GetGCTracer(), GCTraceCollector::CONCURRENT_SWEEPER, GCTracePhase::SWEEP);
+        traceScope.SetBytes(space->AsyncSweep(isMain));
+    }
 
     os::memory::LockHolder holder(mutexs_[type]);
     if (--remainingTaskNum_[type] == 0) {
@@ -24,6 +24,7 @@
 #include "ecmascript/mem/space-inl.h"
 #include "ecmascript/mem/visitor.h"
 #include "ecmascript/mem/gc_stats.h"
+#include "ecmascript/mem/gc_tracer.h"
 #include "ecmascript/ecma_string_table.h"
 #include "ecmascript/runtime_call_id.h"
 
@@ -81,7 +82,14 @@ void FullGC::Initialize()
 void FullGC::Mark()
 {
     ECMA_BYTRACE_NAME(HITRACE_TAG_ARK, "FullGC::Mark");
-    heap_->GetCompressGCMarker()->MarkRoots(MAIN_THREAD_INDEX);
+    GCTracer *tracer = heap_->GetGCTracer();
+    {
+        GCTraceScope traceScope(tracer, GCTraceCollector::FULL_GC, GCTracePhase::MARK_ROOTS);
+        heap_->GetCompressGCMarker()->MarkRoots(MAIN_THREAD_INDEX);
+    }
+    // Objects are copied to the compress space while they are marked.
+    GCTraceScope traceScope(tracer, GCTraceCollector::FULL_GC, GCTracePhase::EVACUATE,
+                            youngSpaceCommitSize_ + oldSpaceCommitSize_);
     heap_->GetCompressGCMarker()->ProcessMarkStack(MAIN_THREAD_INDEX);
     heap_->WaitRunningTaskFinished();
 }
@@ -89,59 +97,64 @@ void FullGC::Mark()
 void FullGC::Sweep()
 {
     ECMA_BYTRACE_NAME(HITRACE_TAG_ARK, "FullGC::Sweep");
-    // process weak reference
-    auto totalThreadCount = Taskpool::GetCurrentTaskpool()->GetTotalThreadNum() + 1; // gc thread and main thread
-    for (uint32_t i = 0; i < totalThreadCount; i++) {
-        ProcessQueue *queue = workManager_->GetWeakReferenceQueue(i);
-
-        while (true) {
-            auto obj = queue->PopBack();
-            if (UNLIKELY(obj == nullptr)) {
-                break;
+    GCTracer *tracer = heap_->GetGCTracer();
+    {
+        GCTraceScope weakTraceScope(tracer, GCTraceCollector::FULL_GC, GCTracePhase::WEAK_PROCESS);
+        // process weak reference
+        auto totalThreadCount = Taskpool::GetCurrentTaskpool()->GetTotalThreadNum() + 1; // gc thread and main thread
+        for (uint32_t i = 0; i < totalThreadCount; i++) {
+            ProcessQueue *queue = workManager_->GetWeakReferenceQueue(i);
+
+            while (true) {
+                auto obj = queue->PopBack();
+                if (UNLIKELY(obj == nullptr)) {
+                    break;
+                }
+                ObjectSlot slot(ToUintPtr(obj));
+                JSTaggedValue value(slot.GetTaggedType());
+                auto header = value.GetTaggedWeakRef();
+
+                Region *objectRegion = Region::ObjectAddressToRange(header);
+                if (!objectRegion->InYoungOrOldSpace()) {
+                    if (!objectRegion->Test(header)) {
+                        slot.Update(static_cast<JSTaggedType>(JSTaggedValue::Undefined().GetRawData()));
+                    }
+                } else {
+                    MarkWord markWord(header);
+                    if (markWord.IsForwardingAddress()) {
+                        TaggedObject *dst = markWord.ToForwardingAddress();
+                        auto weakRef = JSTaggedValue(JSTaggedValue(dst).CreateAndGetWeakRef()).GetRawTaggedObject();
+                        slot.Update(weakRef);
+                    } else {
+                        slot.Update(static_cast<JSTaggedType>(JSTaggedValue::Undefined().GetRawData()));
+                    }
+                }
             }
-            ObjectSlot slot(ToUintPtr(obj));
-            JSTaggedValue value(slot.GetTaggedType());
-            auto header = value.GetTaggedWeakRef();
+        }
 
+        auto stringTable = heap_->GetEcmaVM()->GetEcmaStringTable();
+        WeakRootVisitor gcUpdateWeak = [](TaggedObject *header) {
             Region *objectRegion = Region::ObjectAddressToRange(header);
             if (!objectRegion->InYoungOrOldSpace()) {
-                if (!objectRegion->Test(header)) {
-                    slot.Update(static_cast<JSTaggedType>(JSTaggedValue::Undefined().GetRawData()));
-                }
-            } else {
-                MarkWord markWord(header);
-                if (markWord.IsForwardingAddress()) {
-                    TaggedObject *dst = markWord.ToForwardingAddress();
-                    auto weakRef = JSTaggedValue(JSTaggedValue(dst).CreateAndGetWeakRef()).GetRawTaggedObject();
-                    slot.Update(weakRef);
-                } else {
-                    slot.Update(static_cast<JSTaggedType>(JSTaggedValue::Undefined().GetRawData()));
+                if (objectRegion->Test(header)) {
+                    return header;
                 }
+                return reinterpret_cast<TaggedObject *>(ToUintPtr(nullptr));
             }
-        }
-    }
 
-    auto stringTable = heap_->GetEcmaVM()->GetEcmaStringTable();
-    WeakRootVisitor gcUpdateWeak = [](TaggedObject *header) {
-        Region *objectRegion = Region::ObjectAddressToRange(header);
-        if (!objectRegion->InYoungOrOldSpace()) {
-            if (objectRegion->Test(header)) {
-                return header;
+            MarkWord markWord(header);
+            if (markWord.IsForwardingAddress()) {
+                return markWord.ToForwardingAddress();
             }
             return reinterpret_cast<TaggedObject *>(ToUintPtr(nullptr));
-        }
-
-        MarkWord markWord(header);
-        if (markWord.IsForwardingAddress()) {
-            return markWord.ToForwardingAddress();
-        }
-        return reinterpret_cast<TaggedObject *>(ToUintPtr(nullptr));
-    };
-    stringTable->SweepWeakReference(gcUpdateWeak);
-    heap_->GetEcmaVM()->GetJSThread()->IterateWeakEcmaGlobalStorage(gcUpdateWeak);
-    heap_->GetEcmaVM()->ProcessReferences(gcUpdateWeak);
+        };
+        stringTable->SweepWeakReference(gcUpdateWeak);
+        heap_->GetEcmaVM()->GetJSThread()->IterateWeakEcmaGlobalStorage(gcUpdateWeak);
+        heap_->GetEcmaVM()->ProcessReferences(gcUpdateWeak);
+    }
 
     heap_->UpdateDerivedObjectInStack();
+    GCTraceScope sweepTraceScope(tracer, GCTraceCollector::FULL_GC, GCTracePhase::SWEEP);
     heap_->GetSweeper()->Sweep(true);
 }
 
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/mem/gc_tracer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+
+#include "libpandabase/os/thread.h"
+
+namespace panda::ecmascript {
+void GCTracer::Record(const GCTraceEvent &event)
+{
+    uint64_t index = writeIndex_.fetch_add(1, std::memory_order_relaxed);
+    Slot &slot = slots_[index & CAPACITY_MASK];
+    // odd sequence: the slot is being written.
+    slot.sequence.store(index * 2 + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.event = event;
+    // even sequence: the slot holds the event with this index.
+    slot.sequence.store(index * 2 + 2, std::memory_order_release);
+}
+
+void GCTracer::Clear()
+{
+    // Events recorded before are not exported any more, including the ones which are still being written.
+    clearedIndex_.store(writeIndex_.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+std::vector<GCTraceEvent> GCTracer::GetEvents() const
+{
+    std::vector<GCTraceEvent> events;
+    uint64_t end = writeIndex_.load(std::memory_order_acquire);
+    uint64_t start = end > CAPACITY ? end - CAPACITY : 0;
+    start = std::max(start, clearedIndex_.load(std::memory_order_acquire));
+    events.reserve(end - start);
+    for (uint64_t index = start; index < end; index++) {
+        const Slot &slot = slots_[index & CAPACITY_MASK];
+        uint64_t expected = index * 2 + 2;
+        if (slot.sequence.load(std::memory_order_acquire) != expected) {
+            continue;
+        }
+        GCTraceEvent event = slot.event;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != expected) {
+            continue;
+        }
+        events.emplace_back(event);
+    }
+    return events;
+}
+
+std::string GCTracer::ToChromeTraceEvent(const GCTraceEvent &event)
+{
+    std::stringstream stream;
+    stream << "{\"name\":\"" << GetCollectorName(event.collector) << "::" << GetPhaseName(event.phase) << "\","
+           << "\"cat\":\"ark.gc\",\"ph\":\"X\","
+           << "\"ts\":" << event.startTime << ","
+           << "\"dur\":" << event.duration << ","
+           << "\"pid\":0,"
+           << "\"tid\":" << event.threadId << ","
+           << "\"args\":{\"collector\":\"" << GetCollectorName(event.collector) << "\","
+           << "\"phase\":\"" << GetPhaseName(event.phase) << "\","
+           << "\"bytes\":" << event.bytes << "}}";
+    return stream.str();
+}
+
+std::string GCTracer::ToChromeTrace() const
+{
+    std::string trace = "{\"traceEvents\":[";
+    bool first = true;
+    for (const auto &event : GetEvents()) {
+        if (!first) {
+            trace += ",";
+        }
+        trace += ToChromeTraceEvent(event);
+        first = false;
+    }
+    trace += "],\"displayTimeUnit\":\"ms\"}";
+    return trace;
+}
+
+const char *GCTracer::GetCollectorName(GCTraceCollector collector)
+{
+    switch (collector) {
+        case GCTraceCollector::STW_YOUNG_GC:
+            return "STWYoungGC";
+        case GCTraceCollector::PARTIAL_GC:
+            return "PartialGC";
+        case GCTraceCollector::FULL_GC:
+            return "FullGC";
+        case GCTraceCollector::CONCURRENT_MARKER:
+            return "ConcurrentMarker";
+        case GCTraceCollector::CONCURRENT_SWEEPER:
+            return "ConcurrentSweeper";
+        default:
+            return "UnknownCollector";
+    }
+}
+
+const char *GCTracer::GetPhaseName(GCTracePhase phase)
+{
+    switch (phase) {
+        case GCTracePhase::MARK_ROOTS:
+            return "MarkRoots";
+        case GCTracePhase::MARK:
+            return "Mark";
+        case GCTracePhase::REMARK:
+            return "ReMark";
+        case GCTracePhase::EVACUATE:
+            return "Evacuate";
+        case GCTracePhase::UPDATE_REFERENCE:
+            return "UpdateReference";
+        case GCTracePhase::SWEEP:
+            return "Sweep";
+        case GCTracePhase::WEAK_PROCESS:
+            return "WeakProcess";
+        default:
+            return "UnknownPhase";
+    }
+}
+
+uint64_t GCTracer::GetCurrentTimeInUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+GCTraceScope::GCTraceScope(GCTracer *tracer, GCTraceCollector collector, GCTracePhase phase, size_t bytes)
+{
+    if (tracer == nullptr || !tracer->IsEnabled()) {
+        return;
+    }
+    tracer_ = tracer;
+    event_.collector = collector;
+    event_.phase = phase;
+    event_.bytes = bytes;
+    event_.threadId = static_cast<uint32_t>(os::thread::GetCurrentThreadId());
+    event_.startTime = GCTracer::GetCurrentTimeInUs();
+}
+
+GCTraceScope::~GCTraceScope()
+{
+    if (tracer_ == nullptr) {
+        return;
+    }
+    event_.duration = GCTracer::GetCurrentTimeInUs() - event_.startTime;
+    tracer_->Record(event_);
+}
+}  // namespace panda::ecmascript
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_MEM_GC_TRACER_H
+#define ECMASCRIPT_MEM_GC_TRACER_H
+
+#include <array>
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "libpandabase/macros.h"
+
+namespace panda::ecmascript {
+enum class GCTraceCollector : uint8_t {
+    STW_YOUNG_GC,
+    PARTIAL_GC,
+    FULL_GC,
+    CONCURRENT_MARKER,
+    CONCURRENT_SWEEPER
+};
+
+enum class GCTracePhase : uint8_t {
+    MARK_ROOTS,
+    MARK,
+    REMARK,
+    EVACUATE,
+    UPDATE_REFERENCE,
+    SWEEP,
+    WEAK_PROCESS
+};
+
+struct GCTraceEvent {
+    uint64_t startTime {0};  // in microseconds
+    uint64_t duration {0};   // in microseconds
+    size_t bytes {0};
+    uint32_t threadId {0};
+    GCTraceCollector collector {GCTraceCollector::STW_YOUNG_GC};
+    GCTracePhase phase {GCTracePhase::MARK};
+};
+
+// GCTracer records the phases of every gc into a fixed size ring buffer. Phases are recorded from the js thread
+// and the gc threads at the same time, so each slot is protected by a sequence number instead of a lock:
+// an odd sequence means the slot is being written, and readers skip slots which are written or overwritten
+// while they are copied. When the buffer is full the oldest events are overwritten.
+class GCTracer {
+public:
+    GCTracer() = default;
+    ~GCTracer() = default;
+    NO_COPY_SEMANTIC(GCTracer);
+    NO_MOVE_SEMANTIC(GCTracer);
+
+    void Enable()
+    {
+        enabled_.store(true, std::memory_order_release);
+    }
+
+    void Disable()
+    {
+        enabled_.store(false, std::memory_order_release);
+    }
+
+    bool IsEnabled() const
+    {
+        return enabled_.load(std::memory_order_acquire);
+    }
+
+    void Record(const GCTraceEvent &event);
+    void Clear();
+
+    // Return the events still in the buffer, from the oldest to the newest.
+    std::vector<GCTraceEvent> GetEvents() const;
+
+    // Each event is exported as a complete event ("ph": "X") of the chrome trace event format.
+    static std::string ToChromeTraceEvent(const GCTraceEvent &event);
+    // The whole buffer as a json object which can be loaded by chrome://tracing.
+    std::string ToChromeTrace() const;
+
+    static const char *GetCollectorName(GCTraceCollector collector);
+    static const char *GetPhaseName(GCTracePhase phase);
+    static uint64_t GetCurrentTimeInUs();
+
+    static constexpr size_t CAPACITY = 4096;
+
+private:
+    struct Slot {
+        std::atomic<uint64_t> sequence {0};
+        GCTraceEvent event;
+    };
+
+    static constexpr size_t CAPACITY_MASK = CAPACITY - 1;
+    static_assert((CAPACITY & CAPACITY_MASK) == 0, "capacity of gc tracer must be a power of 2");
+
+    std::array<Slot, CAPACITY> slots_ {};
+    std::atomic<uint64_t> writeIndex_ {0};
+    std::atomic<uint64_t> clearedIndex_ {0};
+    std::atomic<bool> enabled_ {false};
+};
+
+// Record the time spent in the enclosing scope as one phase of a collector, if the tracer is enabled.
+class GCTraceScope {
+public:
+    GCTraceScope(GCTracer *tracer, GCTraceCollector collector, GCTracePhase phase, size_t bytes = 0);
+    ~GCTraceScope();
+    NO_COPY_SEMANTIC(GCTraceScope);
+    NO_MOVE_SEMANTIC(GCTraceScope);
+
+    void SetBytes(size_t bytes)
+    {
+        event_.bytes = bytes;
+    }
+
+private:
+    GCTracer *tracer_ {nullptr};
+    GCTraceEvent event_;
+};
+}  // namespace panda::ecmascript
+
+#endif  // ECMASCRIPT_MEM_GC_TRACER_H
@@ -39,6 +39,7 @@
 #include "ecmascript/mem/verification.h"
 #include "ecmascript/mem/work_manager.h"
 #include "ecmascript/mem/gc_stats.h"
+#include "ecmascript/mem/gc_tracer.h"
 #include "ecmascript/ecma_string_table.h"
 #include "ecmascript/runtime_call_id.h"
 #include "ecmascript/js_finalization_registry.h"
@@ -51,6 +52,7 @@ Heap::Heap(EcmaVM *ecmaVm) : ecmaVm_(ecmaVm), thread_(ecmaVm->GetJSThread()),
 void Heap::Initialize()
 {
     memController_ = new MemController(this);
+    gcTracer_ = new GCTracer();
     auto &config = ecmaVm_->GetEcmaParamConfiguration();
     size_t maxHeapSize = config.GetMaxHeapSize();
     size_t minSemiSpaceCapacity = config.GetMinSemiSpaceSize();
@@ -203,6 +205,10 @@ void Heap::Destroy()
         delete memController_;
         memController_ = nullptr;
     }
+    if (gcTracer_ != nullptr) {
+        delete gcTracer_;
+        gcTracer_ = nullptr;
+    }
     if (sweeper_ != nullptr) {
         delete sweeper_;
         sweeper_ = nullptr;
@@ -303,9 +309,14 @@ void Heap::CollectGarbage(TriggerGCType gcType)
     isVerifying_ = true;
     // pre gc heap verify
     sweeper_->EnsureAllTaskFinished();
-    auto failCount = Verification(this).VerifyAll();
-    if (failCount > 0) {
-        LOG_GC(FATAL) << "Before gc heap corrupted and " << failCount << " corruptions";
+    size_t failCount = 0;
+    {
+        Verification verification(this);
+        failCount = verification.VerifyAll();
+        if (failCount > 0) {
+            LOG_GC(FATAL) << "Before gc heap corrupted and " << failCount << " corruptions\n"
+                          << verification.DumpFailures();
+        }
     }
     isVerifying_ = false;
 #endif
@@ -384,9 +395,13 @@ void Heap::CollectGarbage(TriggerGCType gcType)
     // post gc heap verify
     isVerifying_ = true;
     sweeper_->EnsureAllTaskFinished();
-    failCount = Verification(this).VerifyAll();
-    if (failCount > 0) {
-        LOG_GC(FATAL) << "After gc heap corrupted and " << failCount << " corruptions";
+    {
+        Verification verification(this);
+        failCount = verification.VerifyAll();
+        if (failCount > 0) {
+            LOG_GC(FATAL) << "After gc heap corrupted and " << failCount << " corruptions\n"
+                          << verification.DumpFailures();
+        }
     }
     isVerifying_ = false;
 #endif
@@ -402,35 +417,7 @@ void Heap::ThrowOutOfMemoryError(size_t size, std::string functionName)
 
 size_t Heap::VerifyHeapObjects() const
 {
-    size_t failCount = 0;
-    {
-        VerifyObjectVisitor verifier(this, &failCount);
-        activeSemiSpace_->IterateOverObjects(verifier);
-    }
-
-    {
-        VerifyObjectVisitor verifier(this, &failCount);
-        oldSpace_->IterateOverObjects(verifier);
-    }
-
-    {
-        VerifyObjectVisitor verifier(this, &failCount);
-        nonMovableSpace_->IterateOverObjects(verifier);
-    }
-
-    {
-        VerifyObjectVisitor verifier(this, &failCount);
-        hugeObjectSpace_->IterateOverObjects(verifier);
-    }
-    {
-        VerifyObjectVisitor verifier(this, &failCount);
-        machineCodeSpace_->IterateOverObjects(verifier);
-    }
-    {
-        VerifyObjectVisitor verifier(this, &failCount);
-        snapshotSpace_->IterateOverObjects(verifier);
-    }
-    return failCount;
+    return ParallelHeapVerifier(this, nullptr).Run();
 }
 
 void Heap::AdjustOldSpaceLimit()
@@ -705,6 +692,85 @@ void Heap::NotifyMemoryPressure(bool inHighMemoryPressure)
     }
 }
 
+bool Heap::NotifyIdle(int64_t idleTimeMs)
+{
+    if (idleTimeMs <= 0) {
+        return false;
+    }
+    ECMA_BYTRACE_NAME(HITRACE_TAG_ARK, "Heap::NotifyIdle");
+    double deadlineMs = MemController::GetSystemTimeInMs() + idleTimeMs;
+    // Concurrent marking is still running, any gc now would have to wait for it.
+    if (thread_->IsMarking()) {
+        return false;
+    }
+    if (TryFinishConcurrentMarkingInIdle(deadlineMs)) {
+        return true;
+    }
+    bool workDone = false;
+    // The js thread helps the sweeper tasks instead of waiting for them, so the remaining work is small.
+    if (sweeper_->isSweeping()) {
+        sweeper_->EnsureAllTaskFinished();
+        workDone = true;
+    }
+    // At most one gc is run in an idle period, the predictions are not accurate enough to chain them.
+    if (TryCollectYoungGarbageInIdle(deadlineMs) || TryCompactOldSpaceInIdle(deadlineMs)) {
+        return true;
+    }
+    return workDone;
+}
+
+bool Heap::TryFinishConcurrentMarkingInIdle(double deadlineMs)
+{
+    if (!thread_->IsMarkFinished()) {
+        return false;
+    }
+    double predictedPauseMs = IsFullMark() ? memController_->PredictFullMarkGCPauseMs(GetHeapObjectSize()) :
+        memController_->PredictYoungGCPauseMs(activeSemiSpace_->GetHeapObjectSize());
+    if (predictedPauseMs > RemainingIdleTimeMs(deadlineMs)) {
+        return false;
+    }
+    LOG_GC(DEBUG) << "Heap::NotifyIdle finish concurrent marking, predicted pause " << predictedPauseMs;
+    concurrentMarker_->HandleMarkingFinished();
+    return true;
+}
+
+bool Heap::TryCollectYoungGarbageInIdle(double deadlineMs)
+{
+    size_t newSpaceObjectSize = activeSemiSpace_->GetHeapObjectSize();
+    if (newSpaceObjectSize < activeSemiSpace_->GetInitialCapacity() * IDLE_YOUNG_GC_TRIGGER_RATE) {
+        return false;
+    }
+    double predictedPauseMs = memController_->PredictYoungGCPauseMs(newSpaceObjectSize);
+    if (predictedPauseMs > RemainingIdleTimeMs(deadlineMs)) {
+        return false;
+    }
+    LOG_GC(DEBUG) << "Heap::NotifyIdle young gc, predicted pause " << predictedPauseMs;
+    // The semi space capacity is shrunk by Resume() if the survival rate turns out to be low.
+    CollectGarbage(TriggerGCType::YOUNG_GC);
+    return true;
+}
+
+bool Heap::TryCompactOldSpaceInIdle(double deadlineMs)
+{
+    size_t committedSize = oldSpace_->GetCommittedSize();
+    if (committedSize < IDLE_COMPACT_MIN_OLD_SPACE_SIZE ||
+        oldSpace_->GetHeapObjectSize() > committedSize * (1 - IDLE_COMPACT_FRAGMENTATION_RATE)) {
+        return false;
+    }
+    double predictedPauseMs = memController_->PredictFullGCPauseMs(GetHeapObjectSize());
+    if (predictedPauseMs > RemainingIdleTimeMs(deadlineMs)) {
+        return false;
+    }
+    LOG_GC(DEBUG) << "Heap::NotifyIdle full gc, predicted pause " << predictedPauseMs;
+    CollectGarbage(TriggerGCType::FULL_GC);
+    return true;
+}
+
+double Heap::RemainingIdleTimeMs(double deadlineMs)
+{
+    return deadlineMs - MemController::GetSystemTimeInMs();
+}
+
 bool Heap::CheckCanDistributeTask()
 {
     os::memory::LockHolder holder(waitTaskFinishedMutex_);
@@ -720,8 +786,40 @@ void Heap::ReduceTaskCount()
     }
 }
 
+GCTraceCollector Heap::ParallelGCTask::GetTraceCollector() const
+{
+    switch (taskPhase_) {
+        case ParallelGCTaskPhase::SEMI_HANDLE_THREAD_ROOTS_TASK:
+        case ParallelGCTaskPhase::SEMI_HANDLE_SNAPSHOT_TASK:
+        case ParallelGCTaskPhase::SEMI_HANDLE_GLOBAL_POOL_TASK:
+            return GCTraceCollector::STW_YOUNG_GC;
+        case ParallelGCTaskPhase::OLD_HANDLE_GLOBAL_POOL_TASK:
+            return GCTraceCollector::PARTIAL_GC;
+        case ParallelGCTaskPhase::COMPRESS_HANDLE_GLOBAL_POOL_TASK:
+            return GCTraceCollector::FULL_GC;
+        default:
+            return GCTraceCollector::CONCURRENT_MARKER;
+    }
+}
+
+GCTracePhase Heap::ParallelGCTask::GetTracePhase() const
+{
+    switch (taskPhase_) {
+        case ParallelGCTaskPhase::SEMI_HANDLE_THREAD_ROOTS_TASK:
+        case ParallelGCTaskPhase::SEMI_HANDLE_SNAPSHOT_TASK:
+        case ParallelGCTaskPhase::CONCURRENT_HANDLE_OLD_TO_NEW_TASK:
+            return GCTracePhase::MARK_ROOTS;
+        case ParallelGCTaskPhase::COMPRESS_HANDLE_GLOBAL_POOL_TASK:
+            // the full gc copies the objects while it marks them
+            return GCTracePhase::EVACUATE;
+        default:
+            return GCTracePhase::MARK;
+    }
+}
+
 bool Heap::ParallelGCTask::Run(uint32_t threadIndex)
 {
+    GCTraceScope traceScope(heap_->GetGCTracer(), GetTraceCollector(), GetTracePhase());
     switch (taskPhase_) {
         case ParallelGCTaskPhase::SEMI_HANDLE_THREAD_ROOTS_TASK:
             heap_->GetSemiGCMarker()->MarkRoots(threadIndex);
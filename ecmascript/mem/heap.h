@@ -20,6 +20,7 @@
 #include "ecmascript/frames.h"
 #include "ecmascript/js_thread.h"
 #include "ecmascript/mem/chunk_containers.h"
+#include "ecmascript/mem/gc_tracer.h"
 #include "ecmascript/mem/linear_space.h"
 #include "ecmascript/mem/mark_stack.h"
 #include "ecmascript/mem/sparse_space.h"
@@ -192,6 +193,11 @@ public:
         return memController_;
     }
 
+    GCTracer *GetGCTracer() const
+    {
+        return gcTracer_;
+    }
+
     /*
      * For object allocations.
      */
@@ -249,6 +255,11 @@ public:
     }
     void ChangeGCParams(bool inBackground);
     void NotifyMemoryPressure(bool inHighMemoryPressure);
+    /*
+     * Run GC work that is predicted to finish within the given idle time.
+     * Return true if any GC work was done.
+     */
+    bool NotifyIdle(int64_t idleTimeMs);
     bool CheckCanDistributeTask();
 
     void WaitRunningTaskFinished();
@@ -407,6 +418,17 @@ private:
     void ReduceTaskCount();
     void WaitClearTaskFinished();
     inline void ReclaimRegions(TriggerGCType gcType);
+    bool TryFinishConcurrentMarkingInIdle(double deadlineMs);
+    bool TryCollectYoungGarbageInIdle(double deadlineMs);
+    bool TryCompactOldSpaceInIdle(double deadlineMs);
+
+    static double RemainingIdleTimeMs(double deadlineMs);
+
+    // Young gc is only worthwhile in idle time when the semi space is filled above this rate.
+    static constexpr double IDLE_YOUNG_GC_TRIGGER_RATE = 0.5;
+    // Old space is compacted in idle time when more than this rate of its committed size is not alive.
+    static constexpr double IDLE_COMPACT_FRAGMENTATION_RATE = 0.5;
+    static constexpr size_t IDLE_COMPACT_MIN_OLD_SPACE_SIZE = 4_MB;
 
     class ParallelGCTask : public Task {
     public:
@@ -418,6 +440,9 @@ private:
         NO_MOVE_SEMANTIC(ParallelGCTask);
 
     private:
+        GCTraceCollector GetTraceCollector() const;
+        GCTracePhase GetTracePhase() const;
+
         Heap *heap_ {nullptr};
         ParallelGCTaskPhase taskPhase_;
     };
@@ -527,6 +552,9 @@ private:
      */
     MemController *memController_ {nullptr};
 
+    // The tracer recording per-phase timeline of each gc, which is disabled by default.
+    GCTracer *gcTracer_ {nullptr};
+
     // Region allocators.
     NativeAreaAllocator *nativeAreaAllocator_ {nullptr};
     HeapRegionAllocator *heapRegionAllocator_ {nullptr};
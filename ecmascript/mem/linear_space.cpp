@@ -95,32 +95,37 @@ void LinearSpace::ResetAllocator()
 
 void LinearSpace::IterateOverObjects(const std::function<void(TaggedObject *object)> &visitor) const
 {
-    auto current = GetCurrentRegion();
     EnumerateRegions([&](Region *region) {
-        auto curPtr = region->GetBegin();
-        uintptr_t endPtr;
-        if (region == current) {
-            auto top = allocator_.GetTop();
-            endPtr = curPtr + region->GetAllocatedBytes(top);
-        } else {
-            endPtr = curPtr + region->GetAllocatedBytes();
-        }
+        IterateOverObjectsInRegion(region, visitor);
+    });
+}
 
-        size_t objSize;
-        while (curPtr < endPtr) {
-            auto freeObject = FreeObject::Cast(curPtr);
-            if (!freeObject->IsFreeObject()) {
-                auto obj = reinterpret_cast<TaggedObject *>(curPtr);
-                visitor(obj);
-                objSize = obj->GetClass()->SizeFromJSHClass(obj);
-            } else {
-                objSize = freeObject->Available();
-            }
-            curPtr += objSize;
-            CHECK_OBJECT_SIZE(objSize);
+void LinearSpace::IterateOverObjectsInRegion(Region *region,
+                                             const std::function<void(TaggedObject *object)> &visitor) const
+{
+    auto curPtr = region->GetBegin();
+    uintptr_t endPtr;
+    if (region == GetCurrentRegion()) {
+        auto top = allocator_.GetTop();
+        endPtr = curPtr + region->GetAllocatedBytes(top);
+    } else {
+        endPtr = curPtr + region->GetAllocatedBytes();
+    }
+
+    size_t objSize;
+    while (curPtr < endPtr) {
+        auto freeObject = FreeObject::Cast(curPtr);
+        if (!freeObject->IsFreeObject()) {
+            auto obj = reinterpret_cast<TaggedObject *>(curPtr);
+            visitor(obj);
+            objSize = obj->GetClass()->SizeFromJSHClass(obj);
+        } else {
+            objSize = freeObject->Available();
         }
-        CHECK_REGION_END(curPtr, endPtr);
-    });
+        curPtr += objSize;
+        CHECK_OBJECT_SIZE(objSize);
+    }
+    CHECK_REGION_END(curPtr, endPtr);
 }
 
 SemiSpace::SemiSpace(Heap *heap, size_t initialCapacity, size_t maximumCapacity)
@@ -29,6 +29,8 @@ public:
     void Stop();
     void ResetAllocator();
     void IterateOverObjects(const std::function<void(TaggedObject *object)> &objectVisitor) const;
+    void IterateOverObjectsInRegion(Region *region,
+                                    const std::function<void(TaggedObject *object)> &objectVisitor) const;
     void DecreaseSurvivalObjectSize(size_t objSize)
     {
         survivalObjectSize_ -= objSize;
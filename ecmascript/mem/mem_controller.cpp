@@ -92,6 +92,8 @@ void MemController::StartCalculationBeforeGC()
     size_t codeSpaceAllocAccumulatedSize = heap_->GetMachineCodeSpace()->GetTotalAllocatedSize();
     double currentTimeInMs = GetSystemTimeInMs();
     gcStartTime_ = currentTimeInMs;
+    newSpaceObjectSizeBeforeGC_ = newSpace->GetHeapObjectSize();
+    heapObjectSizeBeforeGC_ = heap_->GetHeapObjectSize();
     size_t oldSpaceAllocSize = oldSpaceAllocAccumulatedSize - oldSpaceAllocAccumulatedSize_;
     size_t nonMovableSpaceAllocSize = nonMovableSpaceAllocAccumulatedSize - nonMovableSpaceAllocAccumulatedSize_;
     size_t codeSpaceAllocSize = codeSpaceAllocAccumulatedSize - codeSpaceAllocAccumulatedSize_;
@@ -140,10 +142,13 @@ void MemController::StopCalculationAfterGC(TriggerGCType gcType)
         case TriggerGCType::YOUNG_GC:
         case TriggerGCType::OLD_GC: {
             if (heap_->IsFullMark()) {
+                recordedFullMarkGCPauses_.Push(MakeBytesAndDuration(heapObjectSizeBeforeGC_, duration));
                 if (heap_->GetConcurrentMarker()->IsEnabled()) {
                     duration += heap_->GetConcurrentMarker()->GetDuration();
                 }
                 recordedMarkCompacts_.Push(MakeBytesAndDuration(heap_->GetHeapObjectSize(), duration));
+            } else {
+                recordedYoungGCPauses_.Push(MakeBytesAndDuration(newSpaceObjectSizeBeforeGC_, duration));
             }
             break;
         }
@@ -235,4 +240,41 @@ double MemController::GetFullSpaceConcurrentMarkSpeedPerMS() const
 {
     return CalculateAverageSpeed(recordedConcurrentMarks_);
 }
+
+double MemController::GetYoungGCSpeedPerMS() const
+{
+    return CalculateAverageSpeed(recordedYoungGCPauses_);
+}
+
+double MemController::GetFullMarkGCSpeedPerMS() const
+{
+    return CalculateAverageSpeed(recordedFullMarkGCPauses_);
+}
+
+double MemController::PredictYoungGCPauseMs(size_t newSpaceObjectSize) const
+{
+    double speed = GetYoungGCSpeedPerMS();
+    if (speed == 0) {
+        speed = DEFAULT_YOUNG_GC_SPEED_PER_MS;
+    }
+    return newSpaceObjectSize / speed;
+}
+
+double MemController::PredictFullMarkGCPauseMs(size_t heapObjectSize) const
+{
+    double speed = GetFullMarkGCSpeedPerMS();
+    if (speed == 0) {
+        speed = DEFAULT_FULL_MARK_GC_SPEED_PER_MS;
+    }
+    return heapObjectSize / speed;
+}
+
+double MemController::PredictFullGCPauseMs(size_t heapObjectSize) const
+{
+    double speed = CalculateAverageSpeed(recordedMarkCompacts_);
+    if (speed == 0) {
+        speed = DEFAULT_MARK_COMPACT_SPEED_PER_MS;
+    }
+    return heapObjectSize / speed;
+}
 }  // namespace panda::ecmascript
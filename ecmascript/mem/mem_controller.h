@@ -63,6 +63,15 @@ public:
     double GetOldSpaceAllocationThroughputPerMS() const;
     double GetNewSpaceConcurrentMarkSpeedPerMS() const;
     double GetFullSpaceConcurrentMarkSpeedPerMS() const;
+    double GetYoungGCSpeedPerMS() const;
+    double GetFullMarkGCSpeedPerMS() const;
+
+    /*
+     * Predicted pause (in ms) of each kind of GC work, used to decide which task fits in an idle period.
+     */
+    double PredictYoungGCPauseMs(size_t newSpaceObjectSize) const;
+    double PredictFullMarkGCPauseMs(size_t heapObjectSize) const;
+    double PredictFullGCPauseMs(size_t heapObjectSize) const;
 
     double GetAllocTimeMs() const
     {
@@ -154,6 +163,9 @@ private:
     size_t codeSpaceAllocSizeSinceGC_ {0};
     size_t hugeObjectAllocSizeSinceGC_{0};
 
+    size_t newSpaceObjectSizeBeforeGC_ {0};
+    size_t heapObjectSizeBeforeGC_ {0};
+
     int startCounter_ {0};
     double markCompactSpeedCache_ {0.0};
 
@@ -167,7 +179,15 @@ private:
     base::GCRingBuffer<BytesAndDuration, LENGTH> recordedSemiConcurrentMarks_;
     base::GCRingBuffer<double, LENGTH> recordedSurvivalRates_;
 
+    // Pauses of young gc and of partial gc with full mark, excluding the time spent in concurrent marking.
+    base::GCRingBuffer<BytesAndDuration, LENGTH> recordedYoungGCPauses_;
+    base::GCRingBuffer<BytesAndDuration, LENGTH> recordedFullMarkGCPauses_;
+
     static constexpr double THROUGHPUT_TIME_FRAME_MS = 5000;
+    // Conservative speeds (bytes per ms) used for predictions before any gc has been recorded.
+    static constexpr double DEFAULT_YOUNG_GC_SPEED_PER_MS = 100 * 1024;
+    static constexpr double DEFAULT_FULL_MARK_GC_SPEED_PER_MS = 256 * 1024;
+    static constexpr double DEFAULT_MARK_COMPACT_SPEED_PER_MS = 128 * 1024;
     static constexpr int MILLISECOND_PER_SECOND = 1000;
 };
 
@@ -25,6 +25,7 @@
 #include "ecmascript/mem/tlab_allocator-inl.h"
 #include "ecmascript/mem/visitor.h"
 #include "ecmascript/mem/gc_stats.h"
+#include "ecmascript/mem/gc_tracer.h"
 #include "ecmascript/ecma_string_table.h"
 #include "ecmascript/runtime_call_id.h"
 
@@ -79,11 +80,15 @@ void ParallelEvacuator::EvacuateSpace()
 
 bool ParallelEvacuator::EvacuateSpace(TlabAllocator *allocator, bool isMain)
 {
+    GCTraceScope traceScope(heap_->GetGCTracer(), GCTraceCollector::PARTIAL_GC, GCTracePhase::EVACUATE);
+    size_t evacuatedSize = 0;
     std::unique_ptr<Workload> region = GetWorkloadSafe();
     while (region != nullptr) {
+        evacuatedSize += region->GetRegion()->AliveObject();
         EvacuateRegion(allocator, region->GetRegion());
         region = GetWorkloadSafe();
     }
+    traceScope.SetBytes(evacuatedSize);
     allocator->Finalize();
     if (!isMain) {
         os::memory::LockHolder holder(mutex_);
@@ -219,6 +224,7 @@ void ParallelEvacuator::UpdateReference()
 void ParallelEvacuator::UpdateRoot()
 {
     MEM_ALLOCATE_AND_GC_TRACE(heap_->GetEcmaVM(), UpdateRoot);
+    GCTraceScope traceScope(heap_->GetGCTracer(), GCTraceCollector::PARTIAL_GC, GCTracePhase::UPDATE_REFERENCE);
     RootVisitor gcUpdateYoung = [this]([[maybe_unused]] Root type, ObjectSlot slot) {
         UpdateObjectSlot(slot);
     };
@@ -255,6 +261,7 @@ void ParallelEvacuator::UpdateRecordWeakReference()
 void ParallelEvacuator::UpdateWeakReference()
 {
     MEM_ALLOCATE_AND_GC_TRACE(heap_->GetEcmaVM(), UpdateWeakReference);
+    GCTraceScope traceScope(heap_->GetGCTracer(), GCTraceCollector::PARTIAL_GC, GCTracePhase::WEAK_PROCESS);
     UpdateRecordWeakReference();
     auto stringTable = heap_->GetEcmaVM()->GetEcmaStringTable();
     bool isFullMark = heap_->IsFullMark();
@@ -387,11 +394,15 @@ void ParallelEvacuator::WaitFinished()
 
 bool ParallelEvacuator::ProcessWorkloads(bool isMain)
 {
+    GCTraceScope traceScope(heap_->GetGCTracer(), GCTraceCollector::PARTIAL_GC, GCTracePhase::UPDATE_REFERENCE);
+    size_t updatedSize = 0;
     std::unique_ptr<Workload> region = GetWorkloadSafe();
     while (region != nullptr) {
+        updatedSize += region->GetRegion()->GetSize();
         region->Process(isMain);
         region = GetWorkloadSafe();
     }
+    traceScope.SetBytes(updatedSize);
     if (!isMain) {
         os::memory::LockHolder holder(mutex_);
         if (--parallel_ <= 0) {
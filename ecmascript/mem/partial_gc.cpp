@@ -27,6 +27,7 @@
 #include "ecmascript/mem/space-inl.h"
 #include "ecmascript/mem/visitor.h"
 #include "ecmascript/mem/gc_stats.h"
+#include "ecmascript/mem/gc_tracer.h"
 #include "ecmascript/ecma_string_table.h"
 #include "ecmascript/runtime_call_id.h"
 
@@ -93,7 +94,12 @@ void PartialGC::Mark()
         heap_->GetConcurrentMarker()->ReMark();
         return;
     }
-    heap_->GetNonMovableMarker()->MarkRoots(MAIN_THREAD_INDEX);
+    GCTracer *tracer = heap_->GetGCTracer();
+    {
+        GCTraceScope traceScope(tracer, GCTraceCollector::PARTIAL_GC, GCTracePhase::MARK_ROOTS);
+        heap_->GetNonMovableMarker()->MarkRoots(MAIN_THREAD_INDEX);
+    }
+    GCTraceScope traceScope(tracer, GCTraceCollector::PARTIAL_GC, GCTracePhase::MARK);
     if (heap_->IsFullMark()) {
         heap_->GetNonMovableMarker()->ProcessMarkStack(MAIN_THREAD_INDEX);
     } else {
@@ -106,8 +112,12 @@ void PartialGC::Mark()
 void PartialGC::Sweep()
 {
     ECMA_BYTRACE_NAME(HITRACE_TAG_ARK, "PartialGC::Sweep");
-    ProcessNativeDelete();
+    {
+        GCTraceScope traceScope(heap_->GetGCTracer(), GCTraceCollector::PARTIAL_GC, GCTracePhase::WEAK_PROCESS);
+        ProcessNativeDelete();
+    }
     if (heap_->IsFullMark()) {
+        GCTraceScope traceScope(heap_->GetGCTracer(), GCTraceCollector::PARTIAL_GC, GCTracePhase::SWEEP);
         heap_->GetSweeper()->Sweep();
     }
 }
@@ -168,6 +168,14 @@ inline void Region::InsertOldToNewRSet(uintptr_t addr)
     set->Insert(ToUintPtr(this), addr);
 }
 
+inline bool Region::TestOldToNewRSet(uintptr_t addr) const
+{
+    if (oldToNewSet_ != nullptr && oldToNewSet_->Test(ToUintPtr(this), addr)) {
+        return true;
+    }
+    return sweepingRSet_ != nullptr && sweepingRSet_->Test(ToUintPtr(this), addr);
+}
+
 template <typename Visitor>
 inline void Region::IterateAllOldToNewBits(Visitor visitor)
 {
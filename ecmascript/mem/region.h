@@ -206,6 +206,8 @@ public:
     void DeleteCrossRegionRSet();
     // Old to new remembered set
     void InsertOldToNewRSet(uintptr_t addr);
+    // The bit may still be in the rset of sweeping, which is merged back after the region is swept.
+    bool TestOldToNewRSet(uintptr_t addr) const;
     template <typename Visitor>
     void IterateAllOldToNewBits(Visitor visitor);
     void ClearOldToNewRSet();
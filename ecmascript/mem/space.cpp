@@ -116,11 +116,17 @@ size_t HugeObjectSpace::GetHeapObjectSize() const
 void HugeObjectSpace::IterateOverObjects(const std::function<void(TaggedObject *object)> &objectVisitor) const
 {
     EnumerateRegions([&](Region *region) {
-        uintptr_t curPtr = region->GetBegin();
-        objectVisitor(reinterpret_cast<TaggedObject *>(curPtr));
+        IterateOverObjectsInRegion(region, objectVisitor);
     });
 }
 
+void HugeObjectSpace::IterateOverObjectsInRegion(Region *region,
+                                                 const std::function<void(TaggedObject *object)> &objectVisitor) const
+{
+    uintptr_t curPtr = region->GetBegin();
+    objectVisitor(reinterpret_cast<TaggedObject *>(curPtr));
+}
+
 void HugeObjectSpace::RecliamHugeRegion()
 {
     if (hugeNeedFreeList_.IsEmpty()) {
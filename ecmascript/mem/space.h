@@ -202,6 +202,8 @@ public:
     void FinishConcurrentSweep();
     size_t GetHeapObjectSize() const;
     void IterateOverObjects(const std::function<void(TaggedObject *object)> &objectVisitor) const;
+    void IterateOverObjectsInRegion(Region *region,
+                                    const std::function<void(TaggedObject *object)> &objectVisitor) const;
 
     void RecliamHugeRegion();
 
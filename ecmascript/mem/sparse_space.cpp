@@ -131,10 +131,12 @@ void SparseSpace::PrepareSweeping()
     allocator_->RebuildFreeList();
 }
 
-void SparseSpace::AsyncSweep(bool isMain)
+size_t SparseSpace::AsyncSweep(bool isMain)
 {
+    size_t sweptSize = 0;
     Region *current = GetSweepingRegionSafe();
     while (current != nullptr) {
+        sweptSize += current->GetSize();
         FreeRegion(current, isMain);
         // Main thread sweeping region is added;
         if (!isMain) {
@@ -145,6 +147,7 @@ void SparseSpace::AsyncSweep(bool isMain)
         }
         current = GetSweepingRegionSafe();
     }
+    return sweptSize;
 }
 
 void SparseSpace::Sweep()
@@ -246,30 +249,41 @@ void SparseSpace::FreeLiveRange(Region *current, uintptr_t freeStart, uintptr_t
 
 void SparseSpace::IterateOverObjects(const std::function<void(TaggedObject *object)> &visitor) const
 {
-    allocator_->FillBumpPointer();
+    FillBumpPointer();
     EnumerateRegions([&](Region *region) {
-        if (region->InCollectSet()) {
-            return;
-        }
-        uintptr_t curPtr = region->GetBegin();
-        uintptr_t endPtr = region->GetEnd();
-        while (curPtr < endPtr) {
-            auto freeObject = FreeObject::Cast(curPtr);
-            size_t objSize;
-            if (!freeObject->IsFreeObject()) {
-                auto obj = reinterpret_cast<TaggedObject *>(curPtr);
-                visitor(obj);
-                objSize = obj->GetClass()->SizeFromJSHClass(obj);
-            } else {
-                objSize = freeObject->Available();
-            }
-            curPtr += objSize;
-            CHECK_OBJECT_SIZE(objSize);
-        }
-        CHECK_REGION_END(curPtr, endPtr);
+        IterateOverObjectsInRegion(region, visitor);
     });
 }
 
+void SparseSpace::FillBumpPointer() const
+{
+    allocator_->FillBumpPointer();
+}
+
+void SparseSpace::IterateOverObjectsInRegion(Region *region,
+                                             const std::function<void(TaggedObject *object)> &visitor) const
+{
+    if (region->InCollectSet()) {
+        return;
+    }
+    uintptr_t curPtr = region->GetBegin();
+    uintptr_t endPtr = region->GetEnd();
+    while (curPtr < endPtr) {
+        auto freeObject = FreeObject::Cast(curPtr);
+        size_t objSize;
+        if (!freeObject->IsFreeObject()) {
+            auto obj = reinterpret_cast<TaggedObject *>(curPtr);
+            visitor(obj);
+            objSize = obj->GetClass()->SizeFromJSHClass(obj);
+        } else {
+            objSize = freeObject->Available();
+        }
+        curPtr += objSize;
+        CHECK_OBJECT_SIZE(objSize);
+    }
+    CHECK_REGION_END(curPtr, endPtr);
+}
+
 size_t SparseSpace::GetHeapObjectSize() const
 {
     return liveObjectSize_;
@@ -51,7 +51,8 @@ public:
 
     // For sweeping
     void PrepareSweeping();
-    void AsyncSweep(bool isMain);
+    // Return the size of the regions swept by this call.
+    size_t AsyncSweep(bool isMain);
     void Sweep();
 
     bool FillSweptRegion();
@@ -68,6 +69,10 @@ public:
     void DetachFreeObjectSet(Region *region);
 
     void IterateOverObjects(const std::function<void(TaggedObject *object)> &objectVisitor) const;
+    // The bump pointer area has to be filled before the objects of a single region are iterated.
+    void FillBumpPointer() const;
+    void IterateOverObjectsInRegion(Region *region,
+                                    const std::function<void(TaggedObject *object)> &objectVisitor) const;
 
     size_t GetHeapObjectSize() const;
 
@@ -26,6 +26,7 @@
 #include "ecmascript/mem/tlab_allocator-inl.h"
 #include "ecmascript/mem/visitor.h"
 #include "ecmascript/mem/gc_stats.h"
+#include "ecmascript/mem/gc_tracer.h"
 #include "ecmascript/ecma_string_table.h"
 #include "ecmascript/runtime_call_id.h"
 
@@ -69,6 +70,7 @@ void STWYoungGC::Initialize()
 void STWYoungGC::Mark()
 {
     ECMA_BYTRACE_NAME(HITRACE_TAG_ARK, "STWYoungGC::Mark");
+    GCTraceScope traceScope(heap_->GetGCTracer(), GCTraceCollector::STW_YOUNG_GC, GCTracePhase::MARK, commitSize_);
     auto region = heap_->GetOldSpace()->GetCurrentRegion();
 
     if (parallelGC_) {
@@ -95,6 +97,7 @@ void STWYoungGC::Mark()
 void STWYoungGC::Sweep()
 {
     ECMA_BYTRACE_NAME(HITRACE_TAG_ARK, "STWYoungGC::Sweep");
+    GCTraceScope traceScope(heap_->GetGCTracer(), GCTraceCollector::STW_YOUNG_GC, GCTracePhase::WEAK_PROCESS);
     auto totalThreadCount = static_cast<uint32_t>(
         Taskpool::GetCurrentTaskpool()->GetTotalThreadNum() + 1);  // gc thread and main thread
     for (uint32_t i = 0; i < totalThreadCount; i++) {
@@ -15,55 +15,244 @@
 
 #include "verification.h"
 
+#include <algorithm>
+#include <sstream>
+
 #include "ecmascript/js_tagged_value-inl.h"
+#include "ecmascript/mem/mark_word.h"
+#include "ecmascript/mem/region-inl.h"
 #include "ecmascript/mem/slots.h"
+#include "ecmascript/mem/space-inl.h"
 #include "ecmascript/mem/visitor.h"
+#include "ecmascript/taskpool/taskpool.h"
 
 namespace panda::ecmascript {
+void VerifyFailureRecorder::Record(const VerifyFailure &failure)
+{
+    recordedCount_.fetch_add(1, std::memory_order_relaxed);
+    os::memory::LockHolder lock(lock_);
+    if (failures_.size() < MAX_KEPT_FAILURES) {
+        failures_.emplace_back(failure);
+    }
+}
+
+std::vector<VerifyFailure> VerifyFailureRecorder::GetFailures() const
+{
+    os::memory::LockHolder lock(lock_);
+    return failures_;
+}
+
+std::string VerifyFailureRecorder::Dump() const
+{
+    std::stringstream stream;
+    auto failures = GetFailures();
+    for (const auto &failure : failures) {
+        Region *region = Region::ObjectAddressToRange(failure.object);
+        stream << "kind:" << GetKindName(failure.kind)
+               << " object:" << std::hex << failure.object
+               << " space:" << region->GetSpaceTypeName()
+               << " slot:" << failure.slot
+               << " value:" << failure.value << std::dec << "\n";
+    }
+    size_t recorded = GetRecordedCount();
+    if (recorded > failures.size()) {
+        stream << (recorded - failures.size()) << " more failures are not kept\n";
+    }
+    return stream.str();
+}
+
+const char *VerifyFailureRecorder::GetKindName(VerifyKind kind)
+{
+    switch (kind) {
+        case VerifyKind::DEAD_OBJECT:
+            return "DeadObject";
+        case VerifyKind::DEAD_WEAK_OBJECT:
+            return "DeadWeakObject";
+        case VerifyKind::INVALID_HCLASS:
+            return "InvalidHClass";
+        case VerifyKind::FORWARDED_OBJECT:
+            return "ForwardedObject";
+        case VerifyKind::MISSING_OLD_TO_NEW_RSET:
+            return "MissingOldToNewRSet";
+        default:
+            return "Unknown";
+    }
+}
+
 // Verify the object body
 void VerifyObjectVisitor::VisitAllObjects(TaggedObject *obj)
 {
+    if (!VerifyHClass(obj)) {
+        return;
+    }
     auto jsHclass = obj->GetClass();
+    Region *objectRegion = Region::ObjectAddressToRange(obj);
     objXRay_.VisitObjectBody<VisitType::OLD_GC_VISIT>(
-        obj, jsHclass, [this]([[maybe_unused]] TaggedObject *root, ObjectSlot start, ObjectSlot end,
-                              [[maybe_unused]] bool isNative) {
+        obj, jsHclass, [this, objectRegion](TaggedObject *root, ObjectSlot start, ObjectSlot end,
+                                            [[maybe_unused]] bool isNative) {
             for (ObjectSlot slot = start; slot < end; slot++) {
-                JSTaggedValue value(slot.GetTaggedType());
-                if (value.IsWeak()) {
-                    if (!heap_->IsAlive(value.GetTaggedWeakRef())) {
-                        LOG_GC(ERROR) << "Heap verify detected a dead weak object " << value.GetTaggedObject()
-                                            << " at object:" << slot.SlotAddress();
-                        ++(*failCount_);
-                    }
-                } else if (value.IsHeapObject()) {
-                    if (!heap_->IsAlive(value.GetTaggedObject())) {
-                        LOG_GC(ERROR) << "Heap verify detected a dead object at " << value.GetTaggedObject()
-                                            << " at object:" << slot.SlotAddress();
-                        ++(*failCount_);
-                    }
-                }
+                VerifySlot(root, objectRegion, slot);
             }
         });
 }
 
+bool VerifyObjectVisitor::VerifyHClass(TaggedObject *obj)
+{
+    // The header of an object which has been evacuated is the forwarding address instead of the hclass.
+    if (MarkWord(obj).IsForwardingAddress()) {
+        Fail(VerifyKind::FORWARDED_OBJECT, obj, 0, 0);
+        return false;
+    }
+    JSHClass *jsHclass = obj->GetClass();
+    if (jsHclass == nullptr || !heap_->ContainObject(jsHclass) ||
+        Region::ObjectAddressToRange(jsHclass)->InYoungSpace() || !jsHclass->GetClass()->IsHClass()) {
+        Fail(VerifyKind::INVALID_HCLASS, obj, 0, reinterpret_cast<JSTaggedType>(jsHclass));
+        return false;
+    }
+    return true;
+}
+
+void VerifyObjectVisitor::VerifySlot(TaggedObject *obj, Region *objectRegion, ObjectSlot slot)
+{
+    JSTaggedValue value(slot.GetTaggedType());
+    TaggedObject *object = nullptr;
+    if (value.IsWeak()) {
+        object = value.GetTaggedWeakRef();
+        if (!heap_->IsAlive(object)) {
+            Fail(VerifyKind::DEAD_WEAK_OBJECT, obj, slot.SlotAddress(), value.GetRawData());
+            return;
+        }
+    } else if (value.IsHeapObject()) {
+        object = value.GetTaggedObject();
+        if (!heap_->IsAlive(object)) {
+            Fail(VerifyKind::DEAD_OBJECT, obj, slot.SlotAddress(), value.GetRawData());
+            return;
+        }
+    } else {
+        return;
+    }
+
+    // After evacuation every reference has to be updated to the new address of the object.
+    if (MarkWord(object).IsForwardingAddress()) {
+        Fail(VerifyKind::FORWARDED_OBJECT, obj, slot.SlotAddress(), value.GetRawData());
+        return;
+    }
+    Region *valueRegion = Region::ObjectAddressToRange(object);
+    if (!objectRegion->InYoungSpace() && valueRegion->InYoungSpace() &&
+        !objectRegion->TestOldToNewRSet(slot.SlotAddress())) {
+        Fail(VerifyKind::MISSING_OLD_TO_NEW_RSET, obj, slot.SlotAddress(), value.GetRawData());
+    }
+}
+
+void VerifyObjectVisitor::Fail(VerifyKind kind, TaggedObject *obj, uintptr_t slot, JSTaggedType value)
+{
+    LOG_GC(ERROR) << "Heap verify detected " << VerifyFailureRecorder::GetKindName(kind) << " at object:" << obj
+                  << " slot:" << reinterpret_cast<void *>(slot) << " value:" << std::hex << value << std::dec;
+    ++(*failCount_);
+    if (recorder_ != nullptr) {
+        recorder_->Record({kind, ToUintPtr(obj), slot, value});
+    }
+}
+
+size_t ParallelHeapVerifier::Run()
+{
+    CollectRegions();
+    if (heap_->IsParallelGCEnabled()) {
+        os::memory::LockHolder holder(mutex_);
+        size_t taskNum = std::min<size_t>(Taskpool::GetCurrentTaskpool()->GetTotalThreadNum(), regions_.size());
+        parallel_ = static_cast<int>(taskNum);
+        for (int i = 0; i < parallel_; i++) {
+            Taskpool::GetCurrentTaskpool()->PostTask(std::make_unique<VerifyRegionTask>(this));
+        }
+    }
+    VerifyRegions(true);
+    WaitFinished();
+    return failCount_.load(std::memory_order_relaxed);
+}
+
+void ParallelHeapVerifier::CollectRegions()
+{
+    auto collect = [this](Region *region) {
+        regions_.emplace_back(region);
+    };
+    heap_->GetNewSpace()->EnumerateRegions(collect);
+    heap_->GetOldSpace()->FillBumpPointer();
+    heap_->GetOldSpace()->EnumerateRegions(collect);
+    heap_->GetNonMovableSpace()->FillBumpPointer();
+    heap_->GetNonMovableSpace()->EnumerateRegions(collect);
+    heap_->GetHugeObjectSpace()->EnumerateRegions(collect);
+    heap_->GetMachineCodeSpace()->FillBumpPointer();
+    heap_->GetMachineCodeSpace()->EnumerateRegions(collect);
+    heap_->GetSnapshotSpace()->EnumerateRegions(collect);
+}
+
+void ParallelHeapVerifier::VerifyRegions(bool isMain)
+{
+    size_t failCount = 0;
+    size_t index = nextRegion_.fetch_add(1, std::memory_order_relaxed);
+    while (index < regions_.size()) {
+        VerifyRegion(regions_[index], &failCount);
+        index = nextRegion_.fetch_add(1, std::memory_order_relaxed);
+    }
+    failCount_.fetch_add(failCount, std::memory_order_relaxed);
+    if (!isMain) {
+        os::memory::LockHolder holder(mutex_);
+        if (--parallel_ <= 0) {
+            condition_.SignalAll();
+        }
+    }
+}
+
+void ParallelHeapVerifier::VerifyRegion(Region *region, size_t *failCount) const
+{
+    VerifyObjectVisitor verifier(heap_, failCount, recorder_);
+    if (region->InYoungSpace()) {
+        heap_->GetNewSpace()->IterateOverObjectsInRegion(region, verifier);
+    } else if (region->InOldSpace()) {
+        heap_->GetOldSpace()->IterateOverObjectsInRegion(region, verifier);
+    } else if (region->InNonMovableSpace()) {
+        heap_->GetNonMovableSpace()->IterateOverObjectsInRegion(region, verifier);
+    } else if (region->InHugeObjectSpace()) {
+        heap_->GetHugeObjectSpace()->IterateOverObjectsInRegion(region, verifier);
+    } else if (region->InMachineCodeSpace()) {
+        heap_->GetMachineCodeSpace()->IterateOverObjectsInRegion(region, verifier);
+    } else if (region->InSnapshotSpace()) {
+        heap_->GetSnapshotSpace()->IterateOverObjectsInRegion(region, verifier);
+    }
+}
+
+void ParallelHeapVerifier::WaitFinished()
+{
+    os::memory::LockHolder holder(mutex_);
+    while (parallel_ > 0) {
+        condition_.Wait(&mutex_);
+    }
+}
+
+bool ParallelHeapVerifier::VerifyRegionTask::Run([[maybe_unused]] uint32_t threadIndex)
+{
+    verifier_->VerifyRegions(false);
+    return true;
+}
+
 size_t Verification::VerifyRoot() const
 {
     size_t failCount = 0;
     RootVisitor visit1 = [this, &failCount]([[maybe_unused]] Root type, ObjectSlot slot) {
         JSTaggedValue value(slot.GetTaggedType());
         if (value.IsWeak()) {
-            VerifyObjectVisitor(heap_, &failCount)(value.GetTaggedWeakRef());
+            VerifyObjectVisitor(heap_, &failCount, &recorder_)(value.GetTaggedWeakRef());
         } else if (value.IsHeapObject()) {
-            VerifyObjectVisitor(heap_, &failCount)(value.GetTaggedObject());
+            VerifyObjectVisitor(heap_, &failCount, &recorder_)(value.GetTaggedObject());
         }
     };
     RootRangeVisitor visit2 = [this, &failCount]([[maybe_unused]] Root type, ObjectSlot start, ObjectSlot end) {
         for (ObjectSlot slot = start; slot < end; slot++) {
             JSTaggedValue value(slot.GetTaggedType());
             if (value.IsWeak()) {
-                VerifyObjectVisitor(heap_, &failCount)(value.GetTaggedWeakRef());
+                VerifyObjectVisitor(heap_, &failCount, &recorder_)(value.GetTaggedWeakRef());
             } else if (value.IsHeapObject()) {
-                VerifyObjectVisitor(heap_, &failCount)(value.GetTaggedObject());
+                VerifyObjectVisitor(heap_, &failCount, &recorder_)(value.GetTaggedObject());
             }
         }
     };
@@ -77,7 +266,7 @@ size_t Verification::VerifyRoot() const
 
 size_t Verification::VerifyHeap() const
 {
-    size_t failCount = heap_->VerifyHeapObjects();
+    size_t failCount = ParallelHeapVerifier(heap_, &recorder_).Run();
     if (failCount > 0) {
         LOG_GC(ERROR) << "VerifyHeap detects deadObject count is " << failCount;
     }
@@ -16,20 +16,69 @@
 #ifndef ECMASCRIPT_MEM_HEAP_VERIFICATION_H
 #define ECMASCRIPT_MEM_HEAP_VERIFICATION_H
 
+#include <atomic>
 #include <cstdint>
+#include <string>
+#include <vector>
 
 #include "ecmascript/mem/heap.h"
 #include "ecmascript/mem/object_xray.h"
 #include "ecmascript/mem/mem.h"
 #include "ecmascript/mem/slots.h"
+#include "ecmascript/taskpool/task.h"
+#include "os/mutex.h"
 
 namespace panda::ecmascript {
+enum class VerifyKind : uint8_t {
+    DEAD_OBJECT,
+    DEAD_WEAK_OBJECT,
+    INVALID_HCLASS,
+    FORWARDED_OBJECT,
+    MISSING_OLD_TO_NEW_RSET
+};
+
+struct VerifyFailure {
+    VerifyKind kind {VerifyKind::DEAD_OBJECT};
+    uintptr_t object {0};
+    uintptr_t slot {0};  // 0 if the failure is about the object itself
+    JSTaggedType value {0};
+};
+
+// Failures are reported from the js thread and the taskpool threads. Only the first ones are kept for the dump.
+class VerifyFailureRecorder {
+public:
+    VerifyFailureRecorder() = default;
+    ~VerifyFailureRecorder() = default;
+    NO_COPY_SEMANTIC(VerifyFailureRecorder);
+    NO_MOVE_SEMANTIC(VerifyFailureRecorder);
+
+    void Record(const VerifyFailure &failure);
+    std::vector<VerifyFailure> GetFailures() const;
+
+    size_t GetRecordedCount() const
+    {
+        return recordedCount_.load(std::memory_order_relaxed);
+    }
+
+    // One line for each kept failure, with the kind, the object and its space, the slot and the value.
+    std::string Dump() const;
+
+    static const char *GetKindName(VerifyKind kind);
+
+    static constexpr size_t MAX_KEPT_FAILURES = 64;
+
+private:
+    mutable os::memory::Mutex lock_;
+    std::vector<VerifyFailure> failures_;
+    std::atomic<size_t> recordedCount_ {0};
+};
+
 // Verify the object body
 // NOLINTNEXTLINE(cppcoreguidelines-special-member-functions, hicpp-special-member-functions)
 class VerifyObjectVisitor {
 public:
-    VerifyObjectVisitor(const Heap *heap, size_t *failCount)
-        : heap_(heap), failCount_(failCount), objXRay_(heap->GetEcmaVM())
+    VerifyObjectVisitor(const Heap *heap, size_t *failCount, VerifyFailureRecorder *recorder = nullptr)
+        : heap_(heap), failCount_(failCount), recorder_(recorder), objXRay_(heap->GetEcmaVM())
     {
     }
     ~VerifyObjectVisitor() = default;
@@ -46,12 +95,55 @@ public:
 
 private:
     void VisitAllObjects(TaggedObject *obj);
+    bool VerifyHClass(TaggedObject *obj);
+    void VerifySlot(TaggedObject *obj, Region *objectRegion, ObjectSlot slot);
+    void Fail(VerifyKind kind, TaggedObject *obj, uintptr_t slot, JSTaggedType value);
 
     const Heap* const heap_ {nullptr};
     size_t* const failCount_ {nullptr};
+    VerifyFailureRecorder* const recorder_ {nullptr};
     ObjectXRay objXRay_;
 };
 
+// Verify the objects of the heap region by region, on the js thread and the taskpool threads.
+class ParallelHeapVerifier {
+public:
+    ParallelHeapVerifier(const Heap *heap, VerifyFailureRecorder *recorder) : heap_(heap), recorder_(recorder) {}
+    ~ParallelHeapVerifier() = default;
+    NO_COPY_SEMANTIC(ParallelHeapVerifier);
+    NO_MOVE_SEMANTIC(ParallelHeapVerifier);
+
+    size_t Run();
+
+private:
+    class VerifyRegionTask : public Task {
+    public:
+        explicit VerifyRegionTask(ParallelHeapVerifier *verifier) : verifier_(verifier) {}
+        ~VerifyRegionTask() override = default;
+        bool Run(uint32_t threadIndex) override;
+
+        NO_COPY_SEMANTIC(VerifyRegionTask);
+        NO_MOVE_SEMANTIC(VerifyRegionTask);
+
+    private:
+        ParallelHeapVerifier *verifier_;
+    };
+
+    void CollectRegions();
+    void VerifyRegions(bool isMain);
+    void VerifyRegion(Region *region, size_t *failCount) const;
+    void WaitFinished();
+
+    const Heap *heap_ {nullptr};
+    VerifyFailureRecorder *recorder_ {nullptr};
+    std::vector<Region *> regions_;
+    std::atomic<size_t> nextRegion_ {0};
+    std::atomic<size_t> failCount_ {0};
+    int parallel_ {0};
+    os::memory::Mutex mutex_;
+    os::memory::ConditionVariable condition_;
+};
+
 class Verification {
 public:
     explicit Verification(const Heap *heap) : heap_(heap), objXRay_(heap->GetEcmaVM()) {}
@@ -66,12 +158,18 @@ public:
 
     size_t VerifyRoot() const;
     size_t VerifyHeap() const;
+
+    std::string DumpFailures() const
+    {
+        return recorder_.Dump();
+    }
 private:
     NO_COPY_SEMANTIC(Verification);
     NO_MOVE_SEMANTIC(Verification);
 
     const Heap *heap_ {nullptr};
     ObjectXRay objXRay_;
+    mutable VerifyFailureRecorder recorder_;
 };
 }  // namespace panda::ecmascript
 
@@ -16,11 +16,13 @@
 #include "ecmascript/napi/include/dfx_jsnapi.h"
 #include "ecmascript/dfx/cpu_profiler/cpu_profiler.h"
 #include "ecmascript/dfx/hprof/heap_profiler.h"
+#include "ecmascript/dfx/vmstat/bytecode_profiler.h"
 #include "ecmascript/base/error_helper.h"
 #include "ecmascript/ecma_vm.h"
 #include "ecmascript/mem/c_string.h"
 #include "ecmascript/mem/heap-inl.h"
 #include "ecmascript/mem/gc_stats.h"
+#include "ecmascript/mem/gc_tracer.h"
 #include "ecmascript/tooling/interface/file_stream.h"
 #include "ecmascript/tooling/interface/stream.h"
 
@@ -152,6 +154,61 @@ void DFXJSNApi::NotifyMemoryPressure(EcmaVM *vm, bool inHighMemoryPressure)
 {
     const_cast<ecmascript::Heap *>(vm->GetHeap())->NotifyMemoryPressure(inHighMemoryPressure);
 }
+
+void DFXJSNApi::StartGCTracing(const EcmaVM *vm)
+{
+    ecmascript::GCTracer *tracer = vm->GetHeap()->GetGCTracer();
+    tracer->Clear();
+    tracer->Enable();
+}
+
+void DFXJSNApi::StopGCTracing(const EcmaVM *vm)
+{
+    vm->GetHeap()->GetGCTracer()->Disable();
+}
+
+void DFXJSNApi::GetGCTraceEvents(const EcmaVM *vm, std::vector<std::string> &traceEvents)
+{
+    for (const auto &event : vm->GetHeap()->GetGCTracer()->GetEvents()) {
+        traceEvents.emplace_back(ecmascript::GCTracer::ToChromeTraceEvent(event));
+    }
+}
+
+bool DFXJSNApi::DumpGCTrace(const EcmaVM *vm, const std::string &filePath)
+{
+    FileStream stream(filePath);
+    if (!stream.Good()) {
+        return false;
+    }
+    std::string trace = vm->GetHeap()->GetGCTracer()->ToChromeTrace();
+    bool result = stream.WriteChunk(trace.data(), static_cast<int32_t>(trace.size()));
+    stream.EndOfStream();
+    return result;
+}
+
+void DFXJSNApi::StartBytecodeProfiler(const EcmaVM *vm)
+{
+    ecmascript::BytecodeProfiler *profiler = vm->GetBytecodeProfiler();
+    profiler->Clear();
+    profiler->Enable();
+}
+
+void DFXJSNApi::StopBytecodeProfiler(const EcmaVM *vm)
+{
+    vm->GetBytecodeProfiler()->Disable();
+}
+
+bool DFXJSNApi::DumpBytecodeProfile(const EcmaVM *vm, const std::string &filePath)
+{
+    FileStream stream(filePath);
+    if (!stream.Good()) {
+        return false;
+    }
+    std::string profile = vm->GetBytecodeProfiler()->Dump();
+    bool result = stream.WriteChunk(profile.data(), static_cast<int32_t>(profile.size()));
+    stream.EndOfStream();
+    return result;
+}
 #if defined(ECMASCRIPT_SUPPORT_CPUPROFILER)
 void DFXJSNApi::StartCpuProfilerForFile(const EcmaVM *vm, const std::string &fileName)
 {
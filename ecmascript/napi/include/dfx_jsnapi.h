@@ -64,6 +64,17 @@ public:
     static void NotifyApplicationState(EcmaVM *vm, bool inBackground);
     static void NotifyMemoryPressure(EcmaVM *vm, bool inHighMemoryPressure);
 
+    // gc tracing, the events are exported in the chrome trace event format.
+    static void StartGCTracing(const EcmaVM *vm);
+    static void StopGCTracing(const EcmaVM *vm);
+    static void GetGCTraceEvents(const EcmaVM *vm, std::vector<std::string> &traceEvents);
+    static bool DumpGCTrace(const EcmaVM *vm, const std::string &filePath);
+
+    // bytecode profiler, it counts the bytecodes run by the interpreter from the next entry of the interpreter.
+    static void StartBytecodeProfiler(const EcmaVM *vm);
+    static void StopBytecodeProfiler(const EcmaVM *vm);
+    static bool DumpBytecodeProfile(const EcmaVM *vm, const std::string &filePath);
+
     // profile generator
 #if defined(ECMASCRIPT_SUPPORT_CPUPROFILER)
     static void StartCpuProfilerForFile(const EcmaVM *vm, const std::string &fileName);
@@ -971,6 +971,36 @@ public:
         return isWorker_;
     }
 
+    void SetEnablePGOProfiler(bool value)
+    {
+        enablePGOProfiler_ = value;
+    }
+
+    void SetPGOProfileOutput(const std::string &path)
+    {
+        pgoProfileOutput_ = path;
+    }
+
+    void SetEnableLazyTranslation(bool value)
+    {
+        enableLazyTranslation_ = value;
+    }
+
+    void SetLazyTranslationList(const std::string &path)
+    {
+        lazyTranslationList_ = path;
+    }
+
+    void SetEnableSuperInstructions(bool value)
+    {
+        enableSuperInstructions_ = value;
+    }
+
+    void SetEnableBytecodeProfiler(bool value)
+    {
+        enableBytecodeProfiler_ = value;
+    }
+
 private:
     std::string GetGcType() const
     {
@@ -1066,6 +1096,36 @@ private:
         return asmOpcodeDisableRange_;
     }
 
+    bool GetEnablePGOProfiler() const
+    {
+        return enablePGOProfiler_;
+    }
+
+    std::string GetPGOProfileOutput() const
+    {
+        return pgoProfileOutput_;
+    }
+
+    bool GetEnableLazyTranslation() const
+    {
+        return enableLazyTranslation_;
+    }
+
+    std::string GetLazyTranslationList() const
+    {
+        return lazyTranslationList_;
+    }
+
+    bool GetEnableSuperInstructions() const
+    {
+        return enableSuperInstructions_;
+    }
+
+    bool GetEnableBytecodeProfiler() const
+    {
+        return enableBytecodeProfiler_;
+    }
+
     GC_TYPE gcType_ = GC_TYPE::EPSILON;
     LOG_LEVEL logLevel_ = LOG_LEVEL::DEBUG;
     uint32_t gcPoolSize_ = DEFAULT_GC_POOL_SIZE;
@@ -1081,6 +1141,12 @@ private:
     bool enableAsmInterpreter_ {false};
     bool isWorker_ {false};
     std::string asmOpcodeDisableRange_ {""};
+    bool enablePGOProfiler_ {false};
+    std::string pgoProfileOutput_ {};
+    bool enableLazyTranslation_ {false};
+    std::string lazyTranslationList_ {};
+    bool enableSuperInstructions_ {false};
+    bool enableBytecodeProfiler_ {false};
     friend JSNApi;
 };
 
@@ -1127,6 +1193,9 @@ public:
     // Memory
     // fixme: Rename SEMI_GC to YOUNG_GC
     static void TriggerGC(const EcmaVM *vm, TRIGGER_GC_TYPE gcType = TRIGGER_GC_TYPE::SEMI_GC);
+    // Called by the embedder's event loop when the js thread will be idle for deadlineMs milliseconds.
+    // Return true if some GC work was done.
+    static bool NotifyIdle(const EcmaVM *vm, int64_t deadlineMs);
     // Exception
     static void ThrowException(const EcmaVM *vm, Local<JSValueRef> error);
     static Local<ObjectRef> GetAndClearUncaughtException(const EcmaVM *vm);
@@ -1135,6 +1204,9 @@ public:
     static bool StartDebugger(const char *libraryPath, EcmaVM *vm, bool isDebugMode, int32_t instanceId = 0,
         const DebuggerPostTask &debuggerPostTask = {});
     static bool StopDebugger(EcmaVM *vm);
+    // Profile guided aot: write the hotness of methods and the inline cache feedback recorded with
+    // "SetEnablePGOProfiler" to a file for ark_aot_compiler.
+    static bool DumpPGOProfile(const EcmaVM *vm, const std::string &fileName);
     // Serialize & Deserialize.
     static void* SerializeValue(const EcmaVM *vm, Local<JSValueRef> data, Local<JSValueRef> transfer);
     static Local<JSValueRef> DeserializeValue(const EcmaVM *vm, void *recoder, void *hint);
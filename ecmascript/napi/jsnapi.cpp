@@ -34,6 +34,7 @@
 #include "ecmascript/interpreter/fast_runtime_stub-inl.h"
 #include "ecmascript/jobs/micro_job_queue.h"
 #include "ecmascript/jspandafile/js_pandafile_executor.h"
+#include "ecmascript/jspandafile/panda_file_translator.h"
 #include "ecmascript/js_array.h"
 #include "ecmascript/js_arraybuffer.h"
 #include "ecmascript/js_bigint.h"
@@ -58,6 +59,7 @@
 #include "ecmascript/module/js_module_manager.h"
 #include "ecmascript/module/js_module_source_text.h"
 #include "ecmascript/object_factory.h"
+#include "ecmascript/pgo/pgo_profiler.h"
 #include "ecmascript/tagged_array.h"
 #include "ecmascript/tooling/interface/js_debugger_manager.h"
 #include "generated/base_options.h"
@@ -97,6 +99,7 @@ using ecmascript::JSTaggedType;
 using ecmascript::JSTaggedValue;
 using ecmascript::JSThread;
 using ecmascript::ObjectFactory;
+using ecmascript::PGOProfiler;
 using ecmascript::PromiseCapability;
 using ecmascript::PropertyDescriptor;
 using ecmascript::OperationResult;
@@ -142,6 +145,14 @@ EcmaVM *JSNApi::CreateJSVM(const RuntimeOption &option)
     // asmInterpreter
     runtimeOptions.SetEnableAsmInterpreter(option.GetEnableAsmInterpreter());
     runtimeOptions.SetAsmOpcodeDisableRange(option.GetAsmOpcodeDisableRange());
+    // pgo profiler
+    runtimeOptions.SetEnablePGOProfiler(option.GetEnablePGOProfiler());
+    runtimeOptions.SetPGOProfileOutput(option.GetPGOProfileOutput());
+    // lazy translation
+    runtimeOptions.SetEnableLazyTranslation(option.GetEnableLazyTranslation());
+    runtimeOptions.SetLazyTranslationList(option.GetLazyTranslationList());
+    runtimeOptions.SetEnableSuperInstructions(option.GetEnableSuperInstructions());
+    runtimeOptions.SetEnableBytecodeProfiler(option.GetEnableBytecodeProfiler());
 
     // Dfx
     base_options::Options baseOptions("");
@@ -209,6 +220,27 @@ void JSNApi::TriggerGC(const EcmaVM *vm,  TRIGGER_GC_TYPE gcType)
     }
 }
 
+bool JSNApi::NotifyIdle(const EcmaVM *vm, int64_t deadlineMs)
+{
+    if (vm->GetJSThread() == nullptr || !vm->IsInitialized()) {
+        return false;
+    }
+    return const_cast<ecmascript::Heap *>(vm->GetHeap())->NotifyIdle(deadlineMs);
+}
+
+bool JSNApi::DumpPGOProfile(const EcmaVM *vm, const std::string &fileName)
+{
+    if (vm->GetJSThread() == nullptr || !vm->IsInitialized()) {
+        return false;
+    }
+    PGOProfiler *profiler = vm->GetPGOProfiler();
+    if (!profiler->IsEnabled()) {
+        LOG_ECMA(ERROR) << "The pgo profiler is not enabled";
+        return false;
+    }
+    return profiler->Dump(fileName);
+}
+
 void JSNApi::ThrowException(const EcmaVM *vm, Local<JSValueRef> error)
 {
     auto thread = vm->GetJSThread();
@@ -1151,7 +1183,7 @@ bool FunctionRef::IsNative(const EcmaVM *vm)
     JSThread *thread = vm->GetJSThread();
     JSHandle<JSFunctionBase> func = JSHandle<JSFunctionBase>(thread, JSNApiHelper::ToJSTaggedValue(this));
     JSMethod *method = func->GetMethod();
-    return method->IsNativeWithCallField();
+    return method->IsNativeWithCallField() && !PandaFileTranslator::IsWaitingForTranslation(method);
 }
 
 // ----------------------------------- ArrayRef ----------------------------------------
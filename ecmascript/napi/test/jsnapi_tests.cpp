@@ -443,6 +443,18 @@ HWTEST_F_L0(JSNApiTests, ArrayBufferWithBuffer)
     ASSERT_TRUE(isFree);
 }
 
+HWTEST_F_L0(JSNApiTests, NotifyIdle)
+{
+    LocalScope scope(vm_);
+    ASSERT_FALSE(JSNApi::NotifyIdle(vm_, 0));
+    const int32_t length = 15;
+    Local<ArrayBufferRef> arrayBuffer = ArrayBufferRef::New(vm_, length);
+    // 1000 : idle time in ms which is long enough for any gc of the test heap
+    JSNApi::NotifyIdle(vm_, 1000);
+    ASSERT_TRUE(arrayBuffer->IsArrayBuffer());
+    ASSERT_EQ(arrayBuffer->ByteLength(vm_), length);
+}
+
 HWTEST_F_L0(JSNApiTests, DataView)
 {
     LocalScope scope(vm_);
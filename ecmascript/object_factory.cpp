@@ -21,6 +21,7 @@
 #include "ecmascript/builtins/builtins_collator.h"
 #include "ecmascript/builtins/builtins_date_time_format.h"
 #include "ecmascript/builtins/builtins_errors.h"
+#include "ecmascript/builtins/builtins_fast_call.h"
 #include "ecmascript/builtins/builtins_global.h"
 #include "ecmascript/builtins/builtins_number_format.h"
 #include "ecmascript/builtins/builtins_promise.h"
@@ -37,6 +38,7 @@
 #include "ecmascript/ic/property_box.h"
 #include "ecmascript/ic/proto_change_details.h"
 #include "ecmascript/interpreter/frame_handler.h"
+#include "ecmascript/jit/jit.h"
 #include "ecmascript/jobs/micro_job_queue.h"
 #include "ecmascript/jobs/pending_job.h"
 #include "ecmascript/jspandafile/class_info_extractor.h"
@@ -166,6 +168,7 @@ JSMethod *ObjectFactory::NewMethodForNativeFunction(const void *func)
 
     method->SetNativeBit(true);
     method->SetNumArgsWithCallField(numArgs);
+    method->SetBuiltinId(builtins::BuiltinsFastCall::GetBuiltinId(func));
     nativeMethods_.push_back(method);
     return nativeMethods_.back();
 }
@@ -1438,6 +1441,12 @@ JSHandle<JSFunction> ObjectFactory::NewJSFunctionByDynClass(JSMethod *method, co
     clazz->SetExtensible(true);
     JSFunction::InitializeJSFunction(thread_, function, kind);
     function->SetMethod(method);
+    if (method->IsAotWithCallField()) {
+        Jit *jit = vm_->GetJit();
+        if (jit != nullptr && jit->IsEnabled()) {
+            jit->SetCodeEntry(*function);
+        }
+    }
     return function;
 }
 
@@ -406,6 +406,9 @@ bool ObjectOperator::UpdateDataValue(const JSHandle<JSObject> &receiver, const J
                                      bool isInternalAccessor, bool mayThrow)
 {
     if (IsElement()) {
+        if (!receiver->GetJSHClass()->IsDictionaryElement()) {
+            JSHClass::TransitionElementsKind(thread_, receiver, Elements::ToElementsKind(value.GetTaggedValue()));
+        }
         TaggedArray *elements = TaggedArray::Cast(receiver->GetElements().GetTaggedObject());
         if (!elements->IsDictionaryMode()) {
             elements->Set(thread_, GetIndex(), value.GetTaggedValue());
@@ -562,6 +565,13 @@ void ObjectOperator::WriteElement(const JSHandle<JSObject> &receiver, JSTaggedVa
 
     TaggedArray *elements = TaggedArray::Cast(receiver->GetElements().GetTaggedObject());
     if (!elements->IsDictionaryMode()) {
+        ElementsKind kind = Elements::ToElementsKind(value);
+        if (!receiver->GetJSHClass()->ContainsElementsKind(kind)) {
+            JSHandle<JSTaggedValue> valueHandle(thread_, value);
+            JSHClass::TransitionElementsKind(thread_, receiver, kind);
+            value = valueHandle.GetTaggedValue();
+            elements = TaggedArray::Cast(receiver->GetElements().GetTaggedObject());
+        }
         elements->Set(thread_, index_, value);
         receiver->GetJSHClass()->UpdateRepresentation(value);
         return;
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/pgo/pgo_profile.h"
+
+#include <algorithm>
+#include <fstream>
+
+namespace panda::ecmascript {
+namespace {
+// The profile is a list of records of 32 bits integers in the host byte order and length prefixed strings:
+//   magic, version, method count
+//   per method: file hash, method id, hotness, site count
+//   per site: slot id, ic state, layout count
+//   per layout: object type, elements kind, flags, entry count
+//   per entry: flags, key
+constexpr uint32_t DICTIONARY_FLAG = 1U;
+constexpr uint32_t STRING_KEY_FLAG = 1U;
+constexpr uint32_t INLINED_FLAG = 1U << 1U;
+constexpr uint32_t ACCESSOR_FLAG = 1U << 2U;
+// The profile is not trusted, so the counts are bounded before anything is allocated for them.
+constexpr uint32_t MAX_RECORD_COUNT = 1U << 24U;
+
+// The inline caches keep at most this many hclasses before they go megamorphic.
+constexpr size_t MAX_POLY_LAYOUTS = ProfileTypeAccessor::CACHE_MAX_LEN / 2;
+
+void WriteU32(std::ofstream &file, uint32_t value)
+{
+    file.write(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+void WriteString(std::ofstream &file, const std::string &value)
+{
+    WriteU32(file, static_cast<uint32_t>(value.size()));
+    file.write(value.data(), static_cast<std::streamsize>(value.size()));
+}
+
+bool ReadU32(std::ifstream &file, uint32_t *value)
+{
+    file.read(reinterpret_cast<char *>(value), sizeof(*value));
+    return file.good();
+}
+
+bool ReadCount(std::ifstream &file, uint32_t *count)
+{
+    return ReadU32(file, count) && *count <= MAX_RECORD_COUNT;
+}
+
+bool ReadString(std::ifstream &file, std::string *value)
+{
+    uint32_t size = 0;
+    if (!ReadCount(file, &size)) {
+        return false;
+    }
+    value->resize(size);
+    file.read(value->data(), static_cast<std::streamsize>(size));
+    return file.good();
+}
+
+bool ReadLayout(std::ifstream &file, PGOLayout *layout)
+{
+    uint32_t flags = 0;
+    uint32_t entryCount = 0;
+    if (!ReadU32(file, &layout->objectType) || !ReadU32(file, &layout->elementsKind) || !ReadU32(file, &flags) ||
+        !ReadCount(file, &entryCount)) {
+        return false;
+    }
+    layout->isDictionary = (flags & DICTIONARY_FLAG) != 0;
+    layout->entries.resize(entryCount);
+    for (auto &entry : layout->entries) {
+        if (!ReadU32(file, &flags) || !ReadString(file, &entry.key)) {
+            return false;
+        }
+        entry.isStringKey = (flags & STRING_KEY_FLAG) != 0;
+        entry.isInlined = (flags & INLINED_FLAG) != 0;
+        entry.isAccessor = (flags & ACCESSOR_FLAG) != 0;
+    }
+    return true;
+}
+
+bool ReadSite(std::ifstream &file, PGOSiteProfile *site)
+{
+    uint32_t state = 0;
+    uint32_t layoutCount = 0;
+    if (!ReadU32(file, &site->slotId) || !ReadU32(file, &state) || !ReadCount(file, &layoutCount) ||
+        state > static_cast<uint32_t>(ProfileTypeAccessor::ICState::MEGA)) {
+        return false;
+    }
+    site->state = static_cast<ProfileTypeAccessor::ICState>(state);
+    site->layouts.resize(layoutCount);
+    for (auto &layout : site->layouts) {
+        if (!ReadLayout(file, &layout)) {
+            return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
+int32_t PGOLayout::FindEntry(const std::string &key) const
+{
+    for (size_t i = 0; i < entries.size(); i++) {
+        if (entries[i].isStringKey && entries[i].key == key) {
+            return static_cast<int32_t>(i);
+        }
+    }
+    return -1;
+}
+
+void PGOSiteProfile::Merge(const PGOSiteProfile &other)
+{
+    state = std::max(state, other.state);
+    if (state == ProfileTypeAccessor::ICState::MEGA) {
+        layouts.clear();
+        return;
+    }
+    for (const auto &layout : other.layouts) {
+        if (std::find(layouts.begin(), layouts.end(), layout) == layouts.end()) {
+            layouts.emplace_back(layout);
+        }
+    }
+    if (layouts.size() > MAX_POLY_LAYOUTS) {
+        state = ProfileTypeAccessor::ICState::MEGA;
+        layouts.clear();
+    } else if (layouts.size() > 1) {
+        state = ProfileTypeAccessor::ICState::POLY;
+    }
+}
+
+const PGOSiteProfile *PGOMethodProfile::FindSite(uint32_t slotId) const
+{
+    auto iter = std::lower_bound(sites.begin(), sites.end(), slotId,
+        [](const PGOSiteProfile &site, uint32_t id) { return site.slotId < id; });
+    if (iter == sites.end() || iter->slotId != slotId) {
+        return nullptr;
+    }
+    return &(*iter);
+}
+
+PGOSiteProfile *PGOMethodProfile::FindOrAddSite(uint32_t slotId)
+{
+    auto iter = std::lower_bound(sites.begin(), sites.end(), slotId,
+        [](const PGOSiteProfile &site, uint32_t id) { return site.slotId < id; });
+    if (iter == sites.end() || iter->slotId != slotId) {
+        iter = sites.insert(iter, PGOSiteProfile {slotId, ProfileTypeAccessor::ICState::UNINIT, {}});
+    }
+    return &(*iter);
+}
+
+const PGOMethodProfile *PGOProfile::FindMethod(uint32_t fileHash, uint32_t methodId) const
+{
+    auto iter = methods_.find(std::make_pair(fileHash, methodId));
+    if (iter == methods_.end()) {
+        return nullptr;
+    }
+    return &iter->second;
+}
+
+bool PGOProfile::Save(const std::string &fileName) const
+{
+    std::ofstream file(fileName.c_str(), std::ofstream::binary);
+    if (!file.good()) {
+        LOG_ECMA(ERROR) << "Can not open the pgo profile " << fileName;
+        return false;
+    }
+    WriteU32(file, MAGIC);
+    WriteU32(file, VERSION);
+    WriteU32(file, static_cast<uint32_t>(methods_.size()));
+    for (const auto &[id, method] : methods_) {
+        WriteU32(file, id.first);
+        WriteU32(file, id.second);
+        WriteU32(file, method.hotness);
+        WriteU32(file, static_cast<uint32_t>(method.sites.size()));
+        for (const auto &site : method.sites) {
+            WriteU32(file, site.slotId);
+            WriteU32(file, static_cast<uint32_t>(site.state));
+            WriteU32(file, static_cast<uint32_t>(site.layouts.size()));
+            for (const auto &layout : site.layouts) {
+                WriteU32(file, layout.objectType);
+                WriteU32(file, layout.elementsKind);
+                WriteU32(file, layout.isDictionary ? DICTIONARY_FLAG : 0);
+                WriteU32(file, static_cast<uint32_t>(layout.entries.size()));
+                for (const auto &entry : layout.entries) {
+                    uint32_t flags = (entry.isStringKey ? STRING_KEY_FLAG : 0) |
+                        (entry.isInlined ? INLINED_FLAG : 0) | (entry.isAccessor ? ACCESSOR_FLAG : 0);
+                    WriteU32(file, flags);
+                    WriteString(file, entry.key);
+                }
+            }
+        }
+    }
+    file.close();
+    return !file.fail();
+}
+
+bool PGOProfile::Load(const std::string &fileName)
+{
+    std::ifstream file(fileName.c_str(), std::ifstream::binary);
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    uint32_t methodCount = 0;
+    if (!ReadU32(file, &magic) || magic != MAGIC || !ReadU32(file, &version) || version != VERSION ||
+        !ReadCount(file, &methodCount)) {
+        LOG_ECMA(ERROR) << "Invalid pgo profile " << fileName;
+        return false;
+    }
+    methods_.clear();
+    for (uint32_t i = 0; i < methodCount; i++) {
+        uint32_t fileHash = 0;
+        uint32_t methodId = 0;
+        uint32_t siteCount = 0;
+        PGOMethodProfile method;
+        if (!ReadU32(file, &fileHash) || !ReadU32(file, &methodId) || !ReadU32(file, &method.hotness) ||
+            !ReadCount(file, &siteCount)) {
+            LOG_ECMA(ERROR) << "Truncated pgo profile " << fileName;
+            methods_.clear();
+            return false;
+        }
+        method.sites.resize(siteCount);
+        for (auto &site : method.sites) {
+            if (!ReadSite(file, &site)) {
+                LOG_ECMA(ERROR) << "Truncated pgo profile " << fileName;
+                methods_.clear();
+                return false;
+            }
+        }
+        methods_.emplace(std::make_pair(fileHash, methodId), std::move(method));
+    }
+    return true;
+}
+}  // namespace panda::ecmascript
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_PGO_PGO_PROFILE_H
+#define ECMASCRIPT_PGO_PGO_PROFILE_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "ecmascript/ic/profile_type_info.h"
+
+namespace panda::ecmascript {
+// A property of an observed hclass, in the order of its layout. Symbol keys have no name.
+struct PGOLayoutEntry {
+    std::string key {};
+    bool isStringKey {false};
+    bool isInlined {false};
+    bool isAccessor {false};
+
+    bool operator==(const PGOLayoutEntry &other) const
+    {
+        return key == other.key && isStringKey == other.isStringKey && isInlined == other.isInlined &&
+            isAccessor == other.isAccessor;
+    }
+};
+
+// The layout of an hclass seen by an inline cache. A dictionary hclass has no entries.
+struct PGOLayout {
+    uint32_t objectType {0};
+    uint32_t elementsKind {0};
+    bool isDictionary {false};
+    std::vector<PGOLayoutEntry> entries {};
+
+    bool operator==(const PGOLayout &other) const
+    {
+        return objectType == other.objectType && elementsKind == other.elementsKind &&
+            isDictionary == other.isDictionary && entries == other.entries;
+    }
+
+    // Return the entry of the string key, or -1 if the layout does not have it.
+    int32_t FindEntry(const std::string &key) const;
+};
+
+// The inline cache of a bytecode, identified by the ic slot the translator assigned to it.
+struct PGOSiteProfile {
+    uint32_t slotId {0};
+    ProfileTypeAccessor::ICState state {ProfileTypeAccessor::ICState::UNINIT};
+    std::vector<PGOLayout> layouts {};
+
+    // Merge the layouts seen by another closure of the same method.
+    void Merge(const PGOSiteProfile &other);
+};
+
+struct PGOMethodProfile {
+    // The number of times the hotness counter of the method ran out.
+    uint32_t hotness {0};
+    // Sorted by slot id.
+    std::vector<PGOSiteProfile> sites {};
+
+    const PGOSiteProfile *FindSite(uint32_t slotId) const;
+    PGOSiteProfile *FindOrAddSite(uint32_t slotId);
+};
+
+// PGOProfile is the profile written by a running vm and read by the aot compiler. The methods are identified by
+// the unique id of their panda file and their method id, like the entries of the aot file.
+class PUBLIC_API PGOProfile {
+public:
+    PGOProfile() = default;
+    ~PGOProfile() = default;
+    NO_COPY_SEMANTIC(PGOProfile);
+    NO_MOVE_SEMANTIC(PGOProfile);
+
+    PGOMethodProfile *FindOrAddMethod(uint32_t fileHash, uint32_t methodId)
+    {
+        return &methods_[std::make_pair(fileHash, methodId)];
+    }
+
+    const PGOMethodProfile *FindMethod(uint32_t fileHash, uint32_t methodId) const;
+
+    uint32_t GetHotness(uint32_t fileHash, uint32_t methodId) const
+    {
+        const PGOMethodProfile *method = FindMethod(fileHash, methodId);
+        return method == nullptr ? 0 : method->hotness;
+    }
+
+    size_t GetMethodCount() const
+    {
+        return methods_.size();
+    }
+
+    bool Save(const std::string &fileName) const;
+    bool Load(const std::string &fileName);
+
+private:
+    static constexpr uint32_t MAGIC = 0x4F475041;  // "APGO"
+    static constexpr uint32_t VERSION = 1;
+
+    std::map<std::pair<uint32_t, uint32_t>, PGOMethodProfile> methods_ {};
+};
+}  // namespace panda::ecmascript
+#endif  // ECMASCRIPT_PGO_PGO_PROFILE_H
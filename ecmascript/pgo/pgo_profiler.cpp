@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/pgo/pgo_profiler.h"
+
+#include "ecmascript/ecma_vm.h"
+#include "ecmascript/js_function.h"
+#include "ecmascript/js_hclass-inl.h"
+#include "ecmascript/jspandafile/js_pandafile.h"
+#include "ecmascript/layout_info-inl.h"
+#include "ecmascript/mem/heap-inl.h"
+#include "ecmascript/tagged_array-inl.h"
+
+namespace panda::ecmascript {
+namespace {
+JSHClass *GetWeakHClass(JSTaggedValue value)
+{
+    if (!value.IsWeak()) {
+        return nullptr;
+    }
+    JSTaggedValue referent(value.GetWeakReferent());
+    if (!referent.IsJSHClass()) {
+        return nullptr;
+    }
+    return JSHClass::Cast(referent.GetTaggedObject());
+}
+
+// The hclasses of a polymorphic inline cache are stored as pairs of a weak hclass and a handler.
+bool CollectPolyLayouts(TaggedArray *array, PGOSiteProfile *site)
+{
+    if (array->GetLength() == 0 || GetWeakHClass(array->Get(0)) == nullptr) {
+        return false;
+    }
+    for (uint32_t i = 0; i < array->GetLength(); i += 2) {  // 2: hclass and handler
+        JSHClass *hclass = GetWeakHClass(array->Get(i));
+        if (hclass != nullptr) {
+            PGOLayout layout;
+            PGOProfiler::CollectLayout(hclass, &layout);
+            site->layouts.emplace_back(std::move(layout));
+        }
+    }
+    site->state = site->layouts.size() > 1 ? ProfileTypeAccessor::ICState::POLY : ProfileTypeAccessor::ICState::MONO;
+    return true;
+}
+}  // namespace
+
+PGOProfiler::PGOProfiler(EcmaVM *vm) : vm_(vm), enabled_(vm->GetJSOptions().EnablePGOProfiler()) {}
+
+void PGOProfiler::CollectLayout(JSHClass *hclass, PGOLayout *layout)
+{
+    layout->objectType = static_cast<uint32_t>(hclass->GetObjectType());
+    layout->elementsKind = static_cast<uint32_t>(hclass->GetElementsKind());
+    layout->isDictionary = hclass->IsDictionaryMode();
+    if (layout->isDictionary) {
+        return;
+    }
+    LayoutInfo *layoutInfo = LayoutInfo::Cast(hclass->GetLayout().GetTaggedObject());
+    uint32_t propNumber = hclass->NumberOfProps();
+    layout->entries.resize(propNumber);
+    for (uint32_t i = 0; i < propNumber; i++) {
+        PGOLayoutEntry &entry = layout->entries[i];
+        JSTaggedValue key = layoutInfo->GetKey(i);
+        PropertyAttributes attr = layoutInfo->GetAttr(i);
+        entry.isStringKey = key.IsString();
+        if (entry.isStringKey) {
+            entry.key = CstringConvertToStdString(ConvertToString(EcmaString::Cast(key.GetTaggedObject()),
+                                                                  StringConvertedUsage::LOGICOPERATION));
+        }
+        entry.isInlined = attr.IsInlinedProps();
+        entry.isAccessor = attr.IsAccessor();
+    }
+}
+
+void PGOProfiler::CollectSites(JSFunction *func, PGOMethodProfile *methodProfile)
+{
+    JSTaggedValue profileTypeInfo = func->GetProfileTypeInfo();
+    if (!profileTypeInfo.IsTaggedArray()) {
+        return;
+    }
+    // The slots are read without knowing the bytecodes they belong to: a named or element cache starts with a weak
+    // hclass or an array of them, a keyed cache with its key followed by the array, and a megamorphic cache holds
+    // holes. The global caches hold property boxes and strings, which are not recorded.
+    ProfileTypeInfo *info = ProfileTypeInfo::Cast(profileTypeInfo.GetTaggedObject());
+    uint32_t length = info->GetLength();
+    for (uint32_t slotId = 0; slotId < length; slotId++) {
+        JSTaggedValue first = info->Get(slotId);
+        JSTaggedValue second = slotId + 1 < length ? info->Get(slotId + 1) : JSTaggedValue::Undefined();
+        PGOSiteProfile site {slotId, ProfileTypeAccessor::ICState::UNINIT, {}};
+        JSHClass *hclass = GetWeakHClass(first);
+        if (hclass != nullptr) {
+            PGOLayout layout;
+            CollectLayout(hclass, &layout);
+            site.layouts.emplace_back(std::move(layout));
+            site.state = ProfileTypeAccessor::ICState::MONO;
+        } else if (!first.IsWeak() && first.IsTaggedArray()) {
+            if (!CollectPolyLayouts(TaggedArray::Cast(first.GetTaggedObject()), &site)) {
+                continue;
+            }
+        } else if ((first.IsString() || first.IsSymbol()) && !second.IsWeak() && second.IsTaggedArray()) {
+            if (!CollectPolyLayouts(TaggedArray::Cast(second.GetTaggedObject()), &site)) {
+                continue;
+            }
+        } else if (first.IsHole()) {
+            site.state = ProfileTypeAccessor::ICState::MEGA;
+        } else {
+            continue;
+        }
+        methodProfile->FindOrAddSite(slotId)->Merge(site);
+        // the second slot of a cache is its handler or a part of it, a global cache has only one
+        if (!first.IsHole() || second.IsHole()) {
+            slotId++;
+        }
+    }
+}
+
+void PGOProfiler::Collect(PGOProfile *profile)
+{
+    CUnorderedMap<JSMethod *, PGOMethodProfile *> methodProfiles;
+    for (auto [method, hotness] : hotness_) {
+        const JSPandaFile *jsPandaFile = method->GetJSPandaFile();
+        if (jsPandaFile == nullptr) {
+            continue;
+        }
+        PGOMethodProfile *methodProfile =
+            profile->FindOrAddMethod(jsPandaFile->GetFileUniqId(), method->GetMethodId().GetOffset());
+        methodProfile->hotness += hotness;
+        methodProfiles[method] = methodProfile;
+    }
+
+    Heap *heap = const_cast<Heap *>(vm_->GetHeap());
+    heap->Prepare();
+    heap->IterateOverObjects([&methodProfiles](TaggedObject *obj) {
+        if (!obj->GetClass()->IsJSFunction()) {
+            return;
+        }
+        JSFunction *func = JSFunction::Cast(obj);
+        auto iter = methodProfiles.find(func->GetMethod());
+        if (iter != methodProfiles.end()) {
+            CollectSites(func, iter->second);
+        }
+    });
+}
+
+bool PGOProfiler::Dump(const std::string &fileName)
+{
+    PGOProfile profile;
+    Collect(&profile);
+    if (!profile.Save(fileName)) {
+        return false;
+    }
+    LOG_ECMA(INFO) << "Dump the pgo profile of " << profile.GetMethodCount() << " methods to " << fileName;
+    return true;
+}
+
+void PGOProfiler::DumpAtExit()
+{
+    std::string fileName = vm_->GetJSOptions().GetPGOProfileOutput();
+    if (enabled_ && !fileName.empty()) {
+        Dump(fileName);
+    }
+}
+}  // namespace panda::ecmascript
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_PGO_PGO_PROFILER_H
+#define ECMASCRIPT_PGO_PGO_PROFILER_H
+
+#include "ecmascript/mem/c_containers.h"
+#include "ecmascript/pgo/pgo_profile.h"
+
+namespace panda::ecmascript {
+class EcmaVM;
+class JSFunction;
+class JSHClass;
+class JSMethod;
+
+// PGOProfiler records the profile of a vm for the aot compiler. The hotness of a method is sampled each time its
+// hotness counter runs out in the interpreters, and the inline cache feedback is read from the closures on the heap
+// when the profile is collected, so recording costs nothing on the fast paths.
+class PGOProfiler {
+public:
+    explicit PGOProfiler(EcmaVM *vm);
+    ~PGOProfiler() = default;
+    NO_COPY_SEMANTIC(PGOProfiler);
+    NO_MOVE_SEMANTIC(PGOProfiler);
+
+    bool IsEnabled() const
+    {
+        return enabled_;
+    }
+
+    void Sample(JSMethod *method)
+    {
+        hotness_[method]++;
+    }
+
+    // Collect the hotness and the inline cache feedback of the sampled methods.
+    void Collect(PGOProfile *profile);
+    bool Dump(const std::string &fileName);
+    // Dump to the file given by "pgo-profile-output", if any.
+    void DumpAtExit();
+
+    // Add the inline cache feedback of a closure to the profile of its method.
+    static void CollectSites(JSFunction *func, PGOMethodProfile *methodProfile);
+    static void CollectLayout(JSHClass *hclass, PGOLayout *layout);
+
+private:
+    EcmaVM *vm_ {nullptr};
+    bool enabled_ {false};
+    CUnorderedMap<JSMethod *, uint32_t> hotness_ {};
+};
+}  // namespace panda::ecmascript
+#endif  // ECMASCRIPT_PGO_PGO_PROFILER_H
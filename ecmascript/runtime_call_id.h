@@ -128,11 +128,13 @@ namespace panda::ecmascript {
     V(StArraySpread)                \
     V(GetCallSpreadArgs)            \
     V(TryLoadICByName)              \
+    V(TryLoadICByMega)              \
     V(LoadICByName)                 \
     V(GetPropertyByName)            \
     V(TryLoadICByValue)             \
     V(LoadICByValue)                \
     V(TryStoreICByName)             \
+    V(TryStoreICByMega)             \
     V(StoreICByName)                \
     V(TryStoreICByValue)            \
     V(StoreICByValue)               \
@@ -842,9 +844,18 @@ enum EcmaRuntimeCallerId {
     RUNTIME_CALLER_NUMBER,
 };
 
+class JSThread;
+// SlowRuntimeStub shadows this flag, so INTERPRETER_TRACE counts its entries for the bytecode profiler.
+static constexpr bool IS_SLOW_RUNTIME_STUB = false;
+// Defined in slow_runtime_stub.cpp, the other users of INTERPRETER_TRACE only name it in a discarded branch.
+inline void CountSlowRuntimeEntry(JSThread *thread);
+
 #if ECMASCRIPT_ENABLE_INTERPRETER_RUNTIME_STAT
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define INTERPRETER_TRACE(thread, name)                                                        \
+    if constexpr (IS_SLOW_RUNTIME_STUB) {                                                      \
+        CountSlowRuntimeEntry(thread);                                                         \
+    }                                                                                          \
     [[maybe_unused]] JSThread *_js_thread_ = thread;                                           \
     [[maybe_unused]] EcmaRuntimeStat *_run_stat_ = _js_thread_->GetEcmaVM()->GetRuntimeStat(); \
     RuntimeTimerScope interpret_##name##_scope_(INTERPRETER_CALLER_ID(name) _run_stat_)
@@ -854,7 +865,12 @@ enum EcmaRuntimeCallerId {
     [[maybe_unused]] EcmaRuntimeStat *_run_stat_ = _js_thread_->GetEcmaVM()->GetRuntimeStat(); \
     RuntimeTimerScope interpret_##name##_scope_(RUNTIME_CALLER_ID(name) _run_stat_)
 #else
-#define INTERPRETER_TRACE(thread, name) static_cast<void>(0) // NOLINT(cppcoreguidelines-macro-usage)
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define INTERPRETER_TRACE(thread, name)       \
+    if constexpr (IS_SLOW_RUNTIME_STUB) {     \
+        CountSlowRuntimeEntry(thread);        \
+    }                                         \
+    static_cast<void>(0)
 #define RUNTIME_TRACE(thread, name) static_cast<void>(0) // NOLINT(cppcoreguidelines-macro-usage)
 #endif // ECMASCRIPT_ENABLE_INTERPRETER_RUNTIME_STAT
 
@@ -17,6 +17,7 @@
 #define ECMASCRIPT_STUBS_RUNTIME_STUBS_INL_H
 
 #include "runtime_stubs.h"
+#include "ecmascript/builtins/builtins_function.h"
 #include "ecmascript/builtins/builtins_regexp.h"
 #include "ecmascript/llvm_stackmap_parser.h"
 #include "ecmascript/ecma_string_table.h"
@@ -278,6 +279,8 @@ JSTaggedValue RuntimeStubs::RuntimeAsyncFunctionResolveOrReject(JSThread *thread
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
     info->SetCallArg(value.GetTaggedValue());
     [[maybe_unused]] JSTaggedValue res = JSFunction::Call(info);
+    // the function has completed, its context is free for the next async function
+    JSAsyncFunction::ReleaseAsyncContext(thread, asyncFuncObjHandle);
 
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
     return promise.GetTaggedValue();
@@ -286,6 +289,10 @@ JSTaggedValue RuntimeStubs::RuntimeAsyncFunctionResolveOrReject(JSThread *thread
 JSTaggedValue RuntimeStubs::RuntimeCopyDataProperties(JSThread *thread, const JSHandle<JSTaggedValue> &dst,
                                                       const JSHandle<JSTaggedValue> &src)
 {
+    if (JSObject::FastCopyDataProperties(thread, dst, src)) {
+        RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+        return dst.GetTaggedValue();
+    }
     if (!src->IsNull() && !src->IsUndefined()) {
         JSHandle<TaggedArray> keys = JSTaggedValue::GetOwnPropertyKeys(thread, src);
         RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
@@ -851,7 +858,7 @@ JSTaggedValue RuntimeStubs::RuntimeAsyncFunctionEnter(JSThread *thread)
     JSHandle<JSAsyncFuncObject> asyncFuncObj = factory->NewJSAsyncFuncObject();
     asyncFuncObj->SetPromise(thread, promiseObject);
 
-    JSHandle<GeneratorContext> context = factory->NewGeneratorContext();
+    JSHandle<GeneratorContext> context = JSAsyncFunction::NewAsyncContext(thread);
     context->SetGeneratorObject(thread, asyncFuncObj);
 
     // change state to EXECUTING
@@ -1225,7 +1232,8 @@ JSTaggedValue RuntimeStubs::RuntimeGetUnmapedArgs(JSThread *thread, JSTaggedType
 JSTaggedValue RuntimeStubs::RuntimeCopyRestArgs(JSThread *thread, JSTaggedType *sp, uint32_t restNumArgs,
                                                 uint32_t startIdx)
 {
-    JSHandle<JSTaggedValue> restArray = JSArray::ArrayCreate(thread, JSTaggedNumber(restNumArgs));
+    // the rest arguments are appended one by one, so the array stays packed
+    JSHandle<JSTaggedValue> restArray = JSArray::ArrayCreate(thread, JSTaggedNumber(0));
 
     JSMutableHandle<JSTaggedValue> element(thread, JSTaggedValue::Undefined());
     for (uint32_t i = 0; i < restNumArgs; ++i) {
@@ -1689,7 +1697,8 @@ JSTaggedValue RuntimeStubs::RuntimeNewAotLexicalEnvWithNameDyn(JSThread *thread,
 JSTaggedValue RuntimeStubs::RuntimeCopyAotRestArgs(JSThread *thread, uint32_t actualArgc, uint32_t restIndex)
 {
     uint32_t actualRestNum = actualArgc - FIXED_NUM_ARGS - restIndex;
-    JSHandle<JSTaggedValue> restArray = JSArray::ArrayCreate(thread, JSTaggedNumber(actualRestNum));
+    // the rest arguments are appended one by one, so the array stays packed
+    JSHandle<JSTaggedValue> restArray = JSArray::ArrayCreate(thread, JSTaggedNumber(0));
 
     auto argv = GetActualArgv(thread);
     int idx = 0;
@@ -1705,6 +1714,59 @@ JSTaggedValue RuntimeStubs::RuntimeCopyAotRestArgs(JSThread *thread, uint32_t ac
     return restArray.GetTaggedValue();
 }
 
+JSTaggedValue RuntimeStubs::RuntimeGetAotFrameArgs(JSThread *thread, uint32_t actualArgc, uint32_t restIndex,
+                                                   bool isRest)
+{
+    if (isRest) {
+        return RuntimeCopyAotRestArgs(thread, actualArgc, restIndex);
+    }
+    return RuntimeGetAotUnmapedArgs(thread, actualArgc);
+}
+
+JSTaggedValue RuntimeStubs::RuntimeLdAotFrameArgByValue(JSThread *thread, uint32_t actualArgc, uint32_t restIndex,
+                                                        bool isRest, const JSHandle<JSTaggedValue> &key)
+{
+    uint32_t first = FIXED_NUM_ARGS + restIndex;
+    if (key->IsInt() && key->GetInt() >= 0 && first + static_cast<uint32_t>(key->GetInt()) < actualArgc) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        return JSTaggedValue(GetActualArgv(thread)[first + static_cast<uint32_t>(key->GetInt())]);
+    }
+    // any other key is looked up on the object and its prototypes, so the object is created for it
+    JSHandle<JSTaggedValue> object(thread, RuntimeGetAotFrameArgs(thread, actualArgc, restIndex, isRest));
+    RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+    return RuntimeLdObjByValue(thread, object, key, false, JSTaggedValue::Undefined());
+}
+
+JSTaggedValue RuntimeStubs::RuntimeCallAotApplyFrameArgs(JSThread *thread, const JSHandle<JSTaggedValue> &apply,
+                                                         const JSHandle<JSTaggedValue> &func,
+                                                         const JSHandle<JSTaggedValue> &thisArg,
+                                                         uint32_t actualArgc, uint32_t restIndex, bool isRest)
+{
+    JSHandle<JSTaggedValue> undefined = thread->GlobalConstants()->GetHandledUndefined();
+    bool isBuiltinApply = apply->IsJSFunction() && ECMAObject::Cast(apply->GetTaggedObject())->GetCallTarget()->
+        GetNativePointer() == reinterpret_cast<void *>(builtins::BuiltinsFunction::FunctionPrototypeApply);
+    if (isBuiltinApply && func->IsCallable()) {
+        // Function.prototype.apply would read the same arguments from the object
+        uint32_t first = FIXED_NUM_ARGS + restIndex;
+        uint32_t length = actualArgc > first ? actualArgc - first : 0;
+        JSTaggedType *argv = GetActualArgv(thread);
+        EcmaRuntimeCallInfo *info = EcmaInterpreter::NewRuntimeCallInfo(thread, func, thisArg, undefined, length);
+        RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+        for (uint32_t i = 0; i < length; i++) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            info->SetCallArg(static_cast<int32_t>(i), JSTaggedValue(argv[first + i]));
+        }
+        return JSFunction::Call(info);
+    }
+    JSHandle<JSTaggedValue> object(thread, RuntimeGetAotFrameArgs(thread, actualArgc, restIndex, isRest));
+    RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+    // 2: thisArg and the object
+    EcmaRuntimeCallInfo *info = EcmaInterpreter::NewRuntimeCallInfo(thread, apply, func, undefined, 2);
+    RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+    info->SetCallArg(thisArg.GetTaggedValue(), object.GetTaggedValue());
+    return JSFunction::Call(info);
+}
+
 JSTaggedValue RuntimeStubs::RuntimeSuspendAotGenerator(JSThread *thread, const JSHandle<JSTaggedValue> &genObj,
                                                        const JSHandle<JSTaggedValue> &value)
 {
@@ -16,8 +16,10 @@
 #include "runtime_stubs-inl.h"
 #include "ecmascript/accessor_data.h"
 #include "ecmascript/base/number_helper.h"
+#include "ecmascript/builtins/builtins_fast_call.h"
 #include "ecmascript/compiler/call_signature.h"
 #include "ecmascript/compiler/rt_call_signature.h"
+#include "ecmascript/deoptimizer/deoptimizer.h"
 #include "ecmascript/ecma_macros.h"
 #include "ecmascript/ecma_vm.h"
 #include "ecmascript/frames.h"
@@ -27,6 +29,7 @@
 #include "ecmascript/ic/properties_cache.h"
 #include "ecmascript/interpreter/interpreter-inl.h"
 #include "ecmascript/interpreter/interpreter_assembly.h"
+#include "ecmascript/jit/jit.h"
 #include "ecmascript/js_api_arraylist.h"
 #include "ecmascript/js_function.h"
 #include "ecmascript/js_object.h"
@@ -37,6 +40,7 @@
 #include "ecmascript/layout_info.h"
 #include "ecmascript/mem/space-inl.h"
 #include "ecmascript/message_string.h"
+#include "ecmascript/pgo/pgo_profiler.h"
 #include "ecmascript/object_factory.h"
 #include "ecmascript/tagged_dictionary.h"
 #include "libpandabase/utils/string_helpers.h"
@@ -785,7 +789,15 @@ DEF_RUNTIME_STUBS(UpdateHotnessCounter)
     auto sp = const_cast<JSTaggedType *>(thread->GetCurrentInterpretedFrame());
     AsmInterpretedFrame *state = GET_ASM_FRAME(sp);
     thread->CheckSafepoint();
+    Jit *jit = thread->GetEcmaVM()->GetJit();
+    if (jit->IsEnabled()) {
+        jit->OnMethodHot(thread, JSHandle<JSFunction>(thread, state->function));
+    }
     auto thisFunc = JSFunction::Cast(state->function.GetTaggedObject());
+    PGOProfiler *profiler = thread->GetEcmaVM()->GetPGOProfiler();
+    if (profiler->IsEnabled()) {
+        profiler->Sample(thisFunc->GetMethod());
+    }
     if (thisFunc->GetProfileTypeInfo() == JSTaggedValue::Undefined()) {
         auto method = thisFunc->GetCallTarget();
         auto res = RuntimeNotifyInlineCache(thread, JSHandle<JSFunction>(thread, thisFunc), method);
@@ -883,6 +895,15 @@ DEF_RUNTIME_STUBS(SuspendAotGenerator)
     return RuntimeSuspendAotGenerator(thread, obj, value).GetRawData();
 }
 
+DEF_RUNTIME_STUBS(GetAotGeneratorRegsArray)
+{
+    RUNTIME_STUBS_HEADER(GetAotGeneratorRegsArray);
+    JSHandle<JSGeneratorObject> genObj = GetHArg<JSGeneratorObject>(argv, argc, 0);
+    JSTaggedValue length = GetArg(argv, argc, 1);
+    JSHandle<GeneratorContext> context(thread, genObj->GetGeneratorContext());
+    return SlowRuntimeHelper::GetContextRegsArray(thread, context, length.GetInt()).GetTaggedValue().GetRawData();
+}
+
 DEF_RUNTIME_STUBS(UpFrame)
 {
     RUNTIME_STUBS_HEADER(UpFrame);
@@ -1594,6 +1615,30 @@ DEF_RUNTIME_STUBS(CopyAotRestArgs)
     return RuntimeCopyAotRestArgs(thread, actualArgc.GetInt(), restIndex.GetInt()).GetRawData();
 }
 
+DEF_RUNTIME_STUBS(LdAotFrameArgByValue)
+{
+    RUNTIME_STUBS_HEADER(LdAotFrameArgByValue);
+    JSTaggedValue actualArgc = GetArg(argv, argc, 0);
+    JSTaggedValue restIndex = GetArg(argv, argc, 1);
+    JSTaggedValue isRest = GetArg(argv, argc, 2);  // 2: means the third parameter
+    JSHandle<JSTaggedValue> key = GetHArg<JSTaggedValue>(argv, argc, 3);  // 3: means the fourth parameter
+    return RuntimeLdAotFrameArgByValue(thread, actualArgc.GetInt(), restIndex.GetInt(), isRest.IsTrue(),
+                                       key).GetRawData();
+}
+
+DEF_RUNTIME_STUBS(CallAotApplyFrameArgs)
+{
+    RUNTIME_STUBS_HEADER(CallAotApplyFrameArgs);
+    JSHandle<JSTaggedValue> apply = GetHArg<JSTaggedValue>(argv, argc, 0);
+    JSHandle<JSTaggedValue> func = GetHArg<JSTaggedValue>(argv, argc, 1);
+    JSHandle<JSTaggedValue> thisArg = GetHArg<JSTaggedValue>(argv, argc, 2);  // 2: means the third parameter
+    JSTaggedValue actualArgc = GetArg(argv, argc, 3);  // 3: means the fourth parameter
+    JSTaggedValue restIndex = GetArg(argv, argc, 4);  // 4: means the fifth parameter
+    JSTaggedValue isRest = GetArg(argv, argc, 5);  // 5: means the sixth parameter
+    return RuntimeCallAotApplyFrameArgs(thread, apply, func, thisArg, actualArgc.GetInt(), restIndex.GetInt(),
+                                        isRest.IsTrue()).GetRawData();
+}
+
 DEF_RUNTIME_STUBS(NewAotObjDynRange)
 {
     RUNTIME_STUBS_HEADER(NewAotObjDynRange);
@@ -1656,6 +1701,16 @@ DEF_RUNTIME_STUBS(StAotLexVarDyn)
     return JSTaggedValue::VALUE_HOLE;
 }
 
+DEF_RUNTIME_STUBS(DeoptHandler)
+{
+    RUNTIME_STUBS_HEADER(DeoptHandler);
+    JSTaggedValue result = thread->GetEcmaVM()->GetDeoptimizer()->Deoptimize(thread);
+    if (UNLIKELY(thread->HasPendingException())) {
+        return JSTaggedValue::Exception().GetRawData();
+    }
+    return result.GetRawData();
+}
+
 JSTaggedType RuntimeStubs::CreateArrayFromList([[maybe_unused]]uintptr_t argGlue, int32_t argc, JSTaggedValue *argvPtr)
 {
     auto thread = JSThread::GlueToJSThread(argGlue);
@@ -1729,6 +1784,14 @@ bool RuntimeStubs::BigIntEquals(JSTaggedType left, JSTaggedType right)
     return BigInt::Equal(JSTaggedValue(left), JSTaggedValue(right));
 }
 
+JSTaggedType RuntimeStubs::CallFastBuiltin(uintptr_t argGlue, int32_t builtinId, JSTaggedType thisValue,
+                                           int32_t argc, JSTaggedType arg0, JSTaggedType arg1)
+{
+    auto thread = JSThread::GlueToJSThread(argGlue);
+    return builtins::BuiltinsFastCall::Call(thread, static_cast<uint8_t>(builtinId), JSTaggedValue(thisValue),
+        static_cast<uint32_t>(argc), JSTaggedValue(arg0), JSTaggedValue(arg1)).GetRawData();
+}
+
 void RuntimeStubs::Initialize(JSThread *thread)
 {
 #define DEF_RUNTIME_STUB(name) kungfu::RuntimeStubCSigns::ID_##name
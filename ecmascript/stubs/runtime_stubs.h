@@ -75,6 +75,7 @@ using JSFunctionEntryType = uint64_t (*)(uintptr_t glue, uintptr_t prevFp, uint3
     V(CreateArrayFromList)                     \
     V(StringsAreEquals)                        \
     V(BigIntEquals)                            \
+    V(CallFastBuiltin)                         \
 
 #define RUNTIME_STUB_WITH_GC_LIST(V)      \
     V(AddElementInternal)                 \
@@ -217,18 +218,22 @@ using JSFunctionEntryType = uint64_t (*)(uintptr_t glue, uintptr_t prevFp, uint3
     V(GetAotUnmapedArgs)                  \
     V(GetAotUnmapedArgsWithRestArgs)      \
     V(CopyAotRestArgs)                    \
+    V(LdAotFrameArgByValue)               \
+    V(CallAotApplyFrameArgs)              \
     V(NotifyBytecodePcChanged)            \
     V(GetAotLexicalEnv)                   \
     V(NewAotLexicalEnvDyn)                \
     V(NewAotLexicalEnvWithNameDyn)        \
     V(SuspendAotGenerator)                \
+    V(GetAotGeneratorRegsArray)           \
     V(NewAotObjDynRange)                  \
     V(GetTypeArrayPropertyByIndex)        \
     V(SetTypeArrayPropertyByIndex)        \
     V(AotNewObjWithIHClass)               \
     V(PopAotLexicalEnv)                   \
     V(LdAotLexVarDyn)                     \
-    V(StAotLexVarDyn)
+    V(StAotLexVarDyn)                     \
+    V(DeoptHandler)
 
 #define RUNTIME_STUB_LIST(V)                     \
     RUNTIME_ASM_STUB_LIST(V)                     \
@@ -285,6 +290,8 @@ public:
                                         JSTaggedType key, int32_t num);
     static bool StringsAreEquals(EcmaString *str1, EcmaString *str2);
     static bool BigIntEquals(JSTaggedType left, JSTaggedType right);
+    static JSTaggedType CallFastBuiltin(uintptr_t argGlue, int32_t builtinId, JSTaggedType thisValue, int32_t argc,
+                                        JSTaggedType arg0, JSTaggedType arg1);
 private:
     static void PrintHeapReginInfo(uintptr_t argGlue);
 
@@ -479,6 +486,14 @@ private:
                                                                    JSHandle<JSTaggedValue> &currentLexEnv,
                                                                    JSHandle<JSTaggedValue> &func);
     static inline JSTaggedValue RuntimeCopyAotRestArgs(JSThread *thread, uint32_t actualArgc, uint32_t restIndex);
+    static inline JSTaggedValue RuntimeGetAotFrameArgs(JSThread *thread, uint32_t actualArgc, uint32_t restIndex,
+                                                       bool isRest);
+    static inline JSTaggedValue RuntimeLdAotFrameArgByValue(JSThread *thread, uint32_t actualArgc, uint32_t restIndex,
+                                                            bool isRest, const JSHandle<JSTaggedValue> &key);
+    static inline JSTaggedValue RuntimeCallAotApplyFrameArgs(JSThread *thread, const JSHandle<JSTaggedValue> &apply,
+                                                             const JSHandle<JSTaggedValue> &func,
+                                                             const JSHandle<JSTaggedValue> &thisArg,
+                                                             uint32_t actualArgc, uint32_t restIndex, bool isRest);
     static inline JSTaggedValue RuntimeSuspendAotGenerator(JSThread *thread, const JSHandle<JSTaggedValue> &genObj,
                                                            const JSHandle<JSTaggedValue> &value);
     static inline JSTaggedValue RuntimeNewAotObjDynRange(JSThread *thread, uintptr_t argv, uint32_t argc);
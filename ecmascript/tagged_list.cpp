@@ -123,6 +123,8 @@ JSTaggedValue TaggedList<Derived>::TaggedListToArray(const JSThread *thread, con
         newElements->Set(thread, i, list->Get(i));
     }
     array->SetElements(thread, newElements);
+    JSHClass::TransitionElementsKind(thread, JSHandle<JSObject>(array),
+                                     Elements::ComputeElementsKind(*newElements, length));
     return array.GetTaggedValue();
 }
 
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/deoptimizer/deoptimizer.h"
+#include "ecmascript/ecma_vm.h"
+#include "ecmascript/global_env.h"
+#include "ecmascript/js_function.h"
+#include "ecmascript/js_generator_object.h"
+#include "ecmascript/object_factory.h"
+#include "ecmascript/tests/test_helper.h"
+#include "libpandafile/bytecode_instruction-inl.h"
+
+using namespace panda::ecmascript;
+
+namespace panda::test {
+class DeoptimizerTest : public testing::Test {
+public:
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "SetUpTestCase";
+    }
+
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "TearDownCase";
+    }
+
+    void SetUp() override
+    {
+        TestHelper::CreateEcmaVMWithScope(instance, thread, scope);
+    }
+
+    void TearDown() override
+    {
+        TestHelper::DestroyEcmaVMWithScope(instance, scope);
+    }
+
+    EcmaVM *instance {nullptr};
+    EcmaHandleScope *scope {nullptr};
+    JSThread *thread {nullptr};
+};
+
+/**
+ * @tc.name: RecordDeopt
+ * @tc.desc: "RecordDeopt" function counts the deopts of a method and clears its aot code bit once the count reaches
+ *           the deopt threshold.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(DeoptimizerTest, RecordDeopt)
+{
+    ObjectFactory *factory = instance->GetFactory();
+    JSMethod *method = factory->NewMethodForNativeFunction(nullptr);
+    method->SetAotCodeBit(true);
+    Deoptimizer deoptimizer(instance);
+    uint32_t threshold = instance->GetJSOptions().GetDeoptThreshold();
+    ASSERT_GT(threshold, 0U);
+    for (uint32_t i = 1; i < threshold; i++) {
+        EXPECT_FALSE(deoptimizer.RecordDeopt(method));
+        EXPECT_TRUE(method->IsAotWithCallField());
+    }
+    EXPECT_TRUE(deoptimizer.RecordDeopt(method));
+    EXPECT_FALSE(method->IsAotWithCallField());
+    EXPECT_EQ(deoptimizer.GetDeoptCount(method), threshold);
+    // an invalidated method is not invalidated again
+    EXPECT_FALSE(deoptimizer.RecordDeopt(method));
+}
+
+/**
+ * @tc.name: NewContext
+ * @tc.desc: "NewContext" function turns the values of a frame state into a generator context, which resumes the
+ *           function at the bytecode of the frame state with its acc and registers.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(DeoptimizerTest, NewContext)
+{
+    ObjectFactory *factory = instance->GetFactory();
+    JSHandle<GlobalEnv> env = instance->GetGlobalEnv();
+    JSMethod *method = factory->NewMethodForNativeFunction(nullptr);
+    JSHandle<JSFunction> func = factory->NewJSFunction(env, method);
+    const uint32_t pcOffset = 10;
+    std::vector<JSTaggedType> values {
+        2,  // 2: index of the bytecode
+        pcOffset,
+        func.GetTaggedValue().GetRawData(),
+        JSTaggedValue(1).GetRawData(),
+        JSTaggedValue(2).GetRawData(),
+        JSTaggedValue::Undefined().GetRawData(),
+    };
+    JSHandle<GeneratorContext> context = Deoptimizer::NewContext(thread, values, env.GetTaggedValue());
+    EXPECT_EQ(context->GetMethod(), func.GetTaggedValue());
+    EXPECT_EQ(context->GetAcc(), JSTaggedValue(1));
+    EXPECT_EQ(context->GetLexicalEnv(), env.GetTaggedValue());
+    ASSERT_EQ(context->GetNRegs(), 2U);
+    TaggedArray *regs = TaggedArray::Cast(context->GetRegsArray().GetTaggedObject());
+    EXPECT_EQ(regs->Get(0), JSTaggedValue(2));
+    EXPECT_EQ(regs->Get(1), JSTaggedValue::Undefined());
+    EXPECT_EQ(context->GetBCOffset() + BytecodeInstruction::Size(BytecodeInstruction::Format::PREF_V8_V8), pcOffset);
+}
+}  // namespace panda::test
@@ -15,6 +15,7 @@
 
 #include "ecmascript/ecma_vm.h"
 #include "ecmascript/mem/full_gc.h"
+#include "ecmascript/mem/gc_tracer.h"
 #include "ecmascript/object_factory.h"
 #include "ecmascript/mem/concurrent_marker.h"
 #include "ecmascript/mem/stw_young_gc.h"
@@ -164,4 +165,74 @@ HWTEST_F_L0(GCTest, NotifyMemoryPressure)
     heap->NotifyMemoryPressure(false);
     EXPECT_EQ(heap->GetMemGrowingType(), MemGrowingType::CONSERVATIVE);
 }
+
+HWTEST_F_L0(GCTest, NotifyIdleCollectsYoungGarbage)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    auto heap = const_cast<Heap *>(thread->GetEcmaVM()->GetHeap());
+    // a concurrent marking started by the allocations below would make the idle notification wait for it
+    heap->GetConcurrentMarker()->EnableConcurrentMarking(EnableConcurrentMarkType::DISABLE);
+    heap->CollectGarbage(TriggerGCType::YOUNG_GC);
+    EXPECT_FALSE(heap->NotifyIdle(0));
+
+    auto newSpace = heap->GetNewSpace();
+    // 3 / 4: above the fill rate of the semi space which makes a young gc worthwhile in idle time
+    size_t garbageSize = newSpace->GetInitialCapacity() * 3 / 4;
+    {
+        [[maybe_unused]] ecmascript::EcmaHandleScope baseScope(thread);
+        while (newSpace->GetHeapObjectSize() < garbageSize) {
+            factory->NewTaggedArray(512);
+        }
+    }
+    // 1000: idle time in ms which is long enough for a young gc of the test heap
+    EXPECT_TRUE(heap->NotifyIdle(1000));
+    EXPECT_LT(newSpace->GetHeapObjectSize(), garbageSize);
+}
+
+HWTEST_F_L0(GCTest, GCTracerRecordPhases)
+{
+    auto heap = const_cast<Heap *>(thread->GetEcmaVM()->GetHeap());
+    GCTracer *tracer = heap->GetGCTracer();
+    EXPECT_FALSE(tracer->IsEnabled());
+    heap->CollectGarbage(TriggerGCType::FULL_GC);
+    EXPECT_TRUE(tracer->GetEvents().empty());
+
+    tracer->Enable();
+    heap->CollectGarbage(TriggerGCType::FULL_GC);
+    heap->Prepare();
+    tracer->Disable();
+    auto events = tracer->GetEvents();
+    bool hasMarkRoots = false;
+    bool hasSweep = false;
+    for (const auto &event : events) {
+        if (event.collector == GCTraceCollector::FULL_GC && event.phase == GCTracePhase::MARK_ROOTS) {
+            hasMarkRoots = true;
+        }
+        if (event.phase == GCTracePhase::SWEEP) {
+            hasSweep = true;
+        }
+    }
+    EXPECT_TRUE(hasMarkRoots);
+    EXPECT_TRUE(hasSweep);
+    std::string trace = tracer->ToChromeTrace();
+    EXPECT_TRUE(trace.find("\"name\":\"FullGC::MarkRoots\"") != std::string::npos);
+
+    tracer->Clear();
+    EXPECT_TRUE(tracer->GetEvents().empty());
+}
+
+HWTEST_F_L0(GCTest, GCTracerOverwriteOldestEvents)
+{
+    GCTracer tracer;
+    size_t count = GCTracer::CAPACITY + 10;  // 10 : events which overwrite the oldest ones
+    for (size_t i = 0; i < count; i++) {
+        GCTraceEvent event;
+        event.bytes = i;
+        tracer.Record(event);
+    }
+    auto events = tracer.GetEvents();
+    EXPECT_EQ(events.size(), GCTracer::CAPACITY);
+    EXPECT_EQ(events.front().bytes, 10U);
+    EXPECT_EQ(events.back().bytes, count - 1);
+}
 }  // namespace panda::test
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/ecma_vm.h"
+#include "ecmascript/global_env.h"
+#include "ecmascript/jit/jit.h"
+#include "ecmascript/js_function.h"
+#include "ecmascript/js_method.h"
+#include "ecmascript/object_factory.h"
+#include "ecmascript/tests/test_helper.h"
+
+using namespace panda::ecmascript;
+
+namespace panda::test {
+class JitTest : public testing::Test {
+public:
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "SetUpTestCase";
+    }
+
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "TearDownCase";
+    }
+
+    void SetUp() override
+    {
+        TestHelper::CreateEcmaVMWithScope(instance, thread, scope);
+    }
+
+    void TearDown() override
+    {
+        TestHelper::DestroyEcmaVMWithScope(instance, scope);
+    }
+
+    EcmaVM *instance {nullptr};
+    EcmaHandleScope *scope {nullptr};
+    JSThread *thread {nullptr};
+};
+
+// The code is installed but never called, so it does not have to be valid machine code.
+class FakeJitCompilation : public JitCompilation {
+public:
+    FakeJitCompilation() = default;
+    ~FakeJitCompilation() override = default;
+    NO_COPY_SEMANTIC(FakeJitCompilation);
+    NO_MOVE_SEMANTIC(FakeJitCompilation);
+
+    bool BuildCircuit([[maybe_unused]] const JSHandle<JSTaggedValue> &constpool) override
+    {
+        return true;
+    }
+
+    bool Compile(JitCode *code) override
+    {
+        code->code.assign(CODE_SIZE, 0);
+        code->funcOffset = 0;
+        code->funcSize = CODE_SIZE;
+        return true;
+    }
+
+    static constexpr size_t CODE_SIZE = 64;
+};
+
+static JitCompilation *CreateFakeJitCompilation([[maybe_unused]] EcmaVM *vm,
+                                                [[maybe_unused]] const JSMethod *method)
+{
+    return new FakeJitCompilation();
+}
+
+/**
+ * @tc.name: InstallCompiledCode
+ * @tc.desc: A hot method is compiled on the taskpool and installed by "InstallCompiledCode" function, then the
+ *           method is marked as compiled and the closures created before and after the install enter its code.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(JitTest, InstallCompiledCode)
+{
+    ObjectFactory *factory = instance->GetFactory();
+    JSHandle<GlobalEnv> env = instance->GetGlobalEnv();
+    Jit *jit = instance->GetJit();
+    jit->SetCreateCompilationFunc(CreateFakeJitCompilation);
+    ASSERT_TRUE(jit->IsEnabled());
+
+    JSMethod *method = factory->NewMethodForNativeFunction(nullptr);
+    method->SetNativeBit(false);
+    JSHandle<JSFunction> firstFunc = factory->NewJSFunction(env, method);
+    size_t installedSize = jit->GetInstalledCodeSize();
+
+    jit->OnMethodHot(thread, firstFunc);
+    jit->WaitCompileTaskFinished();
+    EXPECT_FALSE(method->IsAotWithCallField());
+    EXPECT_FALSE(jit->IsCompiled(method));
+
+    jit->InstallCompiledCode(thread);
+    EXPECT_TRUE(method->IsAotWithCallField());
+    EXPECT_TRUE(jit->IsCompiled(method));
+    EXPECT_NE(firstFunc->GetCodeEntry(), 0U);
+    EXPECT_EQ(jit->GetInstalledCodeSize(), installedSize + FakeJitCompilation::CODE_SIZE);
+
+    JSHandle<JSFunction> secondFunc = factory->NewJSFunction(env, method);
+    EXPECT_EQ(secondFunc->GetCodeEntry(), firstFunc->GetCodeEntry());
+
+    // a compiled method is not compiled again
+    jit->OnMethodHot(thread, secondFunc);
+    jit->WaitCompileTaskFinished();
+    jit->InstallCompiledCode(thread);
+    EXPECT_EQ(jit->GetInstalledCodeSize(), installedSize + FakeJitCompilation::CODE_SIZE);
+}
+
+/**
+ * @tc.name: SkipGeneratorFunction
+ * @tc.desc: Generator and async functions resume in the interpreter, so "OnMethodHot" function does not compile
+ *           their methods.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(JitTest, SkipGeneratorFunction)
+{
+    ObjectFactory *factory = instance->GetFactory();
+    JSHandle<GlobalEnv> env = instance->GetGlobalEnv();
+    Jit *jit = instance->GetJit();
+    jit->SetCreateCompilationFunc(CreateFakeJitCompilation);
+
+    JSMethod *generatorMethod = factory->NewMethodForNativeFunction(nullptr);
+    generatorMethod->SetNativeBit(false);
+    JSHandle<JSFunction> generatorFunc =
+        factory->NewJSFunction(env, generatorMethod, FunctionKind::GENERATOR_FUNCTION);
+    JSMethod *asyncMethod = factory->NewMethodForNativeFunction(nullptr);
+    asyncMethod->SetNativeBit(false);
+    JSHandle<JSFunction> asyncFunc = factory->NewJSFunction(env, asyncMethod, FunctionKind::ASYNC_FUNCTION);
+
+    jit->OnMethodHot(thread, generatorFunc);
+    jit->OnMethodHot(thread, asyncFunc);
+    jit->WaitCompileTaskFinished();
+    jit->InstallCompiledCode(thread);
+    EXPECT_FALSE(jit->IsCompiled(generatorMethod));
+    EXPECT_FALSE(generatorMethod->IsAotWithCallField());
+    EXPECT_FALSE(jit->IsCompiled(asyncMethod));
+    EXPECT_FALSE(asyncMethod->IsAotWithCallField());
+}
+}  // namespace panda::test
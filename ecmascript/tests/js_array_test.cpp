@@ -187,4 +187,42 @@ HWTEST_F_L0(JSArrayTest, Iterator)
         EXPECT_EQ(static_cast<int>(i), JSObject::GetProperty(thread, iter_value, element_key).GetValue()->GetInt());
     }
 }
+
+HWTEST_F_L0(JSArrayTest, ElementsKindTransition)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<JSTaggedValue> intValue(thread, JSTaggedValue(1));
+    JSHandle<JSTaggedValue> doubleValue(thread, JSTaggedValue(1.5));
+    JSHandle<JSTaggedValue> objValue(factory->NewEmptyJSObject());
+
+    JSHandle<JSTaggedValue> arr(thread, JSArray::ArrayCreate(thread, JSTaggedNumber(0)));
+    EXPECT_EQ(JSObject::Cast(arr->GetTaggedObject())->GetJSHClass()->GetElementsKind(), ElementsKind::NONE);
+    JSArray::FastSetPropertyByValue(thread, arr, 0, intValue);
+    EXPECT_EQ(JSObject::Cast(arr->GetTaggedObject())->GetJSHClass()->GetElementsKind(), ElementsKind::PACKED_SMI);
+    JSArray::FastSetPropertyByValue(thread, arr, 1, doubleValue);
+    EXPECT_EQ(JSObject::Cast(arr->GetTaggedObject())->GetJSHClass()->GetElementsKind(), ElementsKind::PACKED_DOUBLE);
+    // overwriting an element also widens the kind
+    JSArray::FastSetPropertyByValue(thread, arr, 0, objValue);
+    EXPECT_EQ(JSObject::Cast(arr->GetTaggedObject())->GetJSHClass()->GetElementsKind(), ElementsKind::PACKED);
+    // storing beyond the length leaves holes
+    JSArray::FastSetPropertyByValue(thread, arr, 5, intValue);
+    EXPECT_EQ(JSObject::Cast(arr->GetTaggedObject())->GetJSHClass()->GetElementsKind(), ElementsKind::HOLEY);
+
+    // arrays which go through the same transitions share the hclass
+    JSHandle<JSTaggedValue> arr1(thread, JSArray::ArrayCreate(thread, JSTaggedNumber(0)));
+    JSHandle<JSTaggedValue> arr2(thread, JSArray::ArrayCreate(thread, JSTaggedNumber(0)));
+    JSArray::FastSetPropertyByValue(thread, arr1, 0, intValue);
+    JSArray::FastSetPropertyByValue(thread, arr2, 0, intValue);
+    EXPECT_EQ(JSObject::Cast(arr1->GetTaggedObject())->GetJSHClass(),
+              JSObject::Cast(arr2->GetTaggedObject())->GetJSHClass());
+    // a narrower value does not change the hclass
+    JSArray::FastSetPropertyByValue(thread, arr2, 1, doubleValue);
+    JSHClass *doubleClass = JSObject::Cast(arr2->GetTaggedObject())->GetJSHClass();
+    JSArray::FastSetPropertyByValue(thread, arr2, 2, intValue);
+    EXPECT_EQ(JSObject::Cast(arr2->GetTaggedObject())->GetJSHClass(), doubleClass);
+
+    // an array created with a length is holey
+    JSHandle<JSTaggedValue> arr3(thread, JSArray::ArrayCreate(thread, JSTaggedNumber(10)));
+    EXPECT_TRUE(Elements::IsHoley(JSObject::Cast(arr3->GetTaggedObject())->GetJSHClass()->GetElementsKind()));
+}
 }  // namespace panda::test
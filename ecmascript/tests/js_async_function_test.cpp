@@ -97,4 +97,34 @@ HWTEST_F_L0(JSAsyncFunctionTest, AsyncFunctionAwait)
     // promiese is undefined.
     EXPECT_TRUE(asyncFuncObj->GetPromise().IsUndefined());
 }
+/**
+ * @tc.name: ReleaseAsyncContext
+ * @tc.desc: Call "ReleaseAsyncContext" function to release the context of a completed async function, check the
+ *           context is cleared and is returned by the next call of "NewAsyncContext" function with its registers.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(JSAsyncFunctionTest, ReleaseAsyncContext)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<JSAsyncFuncObject> asyncFuncObj = factory->NewJSAsyncFuncObject();
+    JSHandle<GeneratorContext> context = JSAsyncFunction::NewAsyncContext(thread);
+    JSHandle<TaggedArray> regsArray = factory->NewTaggedArray(2);
+    regsArray->Set(thread, 0, JSTaggedValue(1));
+    regsArray->Set(thread, 1, JSTaggedValue(2));
+    context->SetRegsArray(thread, regsArray);
+    context->SetGeneratorObject(thread, asyncFuncObj);
+    asyncFuncObj->SetGeneratorContext(thread, context);
+
+    JSAsyncFunction::ReleaseAsyncContext(thread, asyncFuncObj);
+    EXPECT_TRUE(asyncFuncObj->GetGeneratorContext().IsUndefined());
+    EXPECT_TRUE(context->GetGeneratorObject().IsUndefined());
+    EXPECT_TRUE(regsArray->Get(0).IsUndefined());
+    EXPECT_TRUE(regsArray->Get(1).IsUndefined());
+
+    JSHandle<GeneratorContext> newContext = JSAsyncFunction::NewAsyncContext(thread);
+    EXPECT_EQ(newContext.GetTaggedValue(), context.GetTaggedValue());
+    EXPECT_EQ(newContext->GetRegsArray(), regsArray.GetTaggedValue());
+    EXPECT_NE(JSAsyncFunction::NewAsyncContext(thread).GetTaggedValue(), context.GetTaggedValue());
+}
 }  // namespace panda::test
\ No newline at end of file
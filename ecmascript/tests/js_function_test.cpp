@@ -169,4 +169,39 @@ HWTEST_F_L0(JSFunctionTest, SetSymbolFunctionName)
     EXPECT_TRUE(functionName->IsString());
     EXPECT_TRUE(EcmaString::StringsAreEqual(*(JSHandle<EcmaString>(functionName)), *name));
 }
+
+HWTEST_F_L0(JSFunctionTest, SlackTrackingOfInstances)
+{
+    EcmaVM *ecmaVM = thread->GetEcmaVM();
+    ObjectFactory *factory = ecmaVM->GetFactory();
+    JSHandle<GlobalEnv> env = ecmaVM->GetGlobalEnv();
+    JSHandle<JSFunction> func = factory->NewJSFunction(env, static_cast<void *>(nullptr),
+                                                       FunctionKind::BASE_CONSTRUCTOR);
+    JSHandle<JSTaggedValue> funcHandle(func);
+    JSHandle<JSTaggedValue> keyA(factory->NewFromASCII("a"));
+    JSHandle<JSTaggedValue> keyB(factory->NewFromASCII("b"));
+    JSHandle<JSTaggedValue> value(thread, JSTaggedValue(1));
+
+    uint32_t count = JSHClass::SLACK_TRACKING_CONSTRUCTION_COUNT;
+    for (uint32_t i = 0; i < count - 1; i++) {
+        JSHandle<JSObject> obj = factory->NewJSObjectByConstructor(func, funcHandle);
+        EXPECT_EQ(obj->GetJSHClass()->GetInlinedProperties(), JSHClass::SLACK_TRACKING_INLINED_PROPERTIES);
+        JSObject::SetProperty(thread, JSHandle<JSTaggedValue>(obj), keyA, value);
+        JSObject::SetProperty(thread, JSHandle<JSTaggedValue>(obj), keyB, value);
+    }
+    JSHClass *initialClass = JSHClass::Cast(func->GetProtoOrDynClass().GetTaggedObject());
+    EXPECT_TRUE(initialClass->IsInSlackTracking());
+
+    // the last construction finishes slack tracking, and the later instances only have the used properties.
+    JSHandle<JSObject> obj = factory->NewJSObjectByConstructor(func, funcHandle);
+    JSHClass *finalClass = JSHClass::Cast(func->GetProtoOrDynClass().GetTaggedObject());
+    EXPECT_NE(finalClass, initialClass);
+    EXPECT_FALSE(finalClass->IsInSlackTracking());
+    EXPECT_EQ(finalClass->GetInlinedProperties(), 2U);
+    EXPECT_EQ(obj->GetJSHClass(), finalClass);
+    JSObject::SetProperty(thread, JSHandle<JSTaggedValue>(obj), keyA, value);
+    JSObject::SetProperty(thread, JSHandle<JSTaggedValue>(obj), keyB, value);
+    EXPECT_EQ(obj->GetJSHClass()->NumberOfProps(), 2U);
+    EXPECT_EQ(obj->GetJSHClass()->GetInlinedProperties(), 2U);
+}
 }  // namespace panda::test
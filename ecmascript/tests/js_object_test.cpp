@@ -15,11 +15,14 @@
 
 #include "ecmascript/base/builtins_base.h"
 
+#include "ecmascript/containers/containers_private.h"
 #include "ecmascript/ecma_runtime_call_info.h"
 #include "ecmascript/ecma_string.h"
 #include "ecmascript/ecma_vm.h"
 #include "ecmascript/global_env.h"
 #include "ecmascript/ic/proto_change_details.h"
+#include "ecmascript/interpreter/slow_runtime_stub.h"
+#include "ecmascript/js_api_linked_list.h"
 #include "ecmascript/js_function.h"
 #include "ecmascript/js_handle.h"
 #include "ecmascript/js_hclass.h"
@@ -29,6 +32,7 @@
 #include "ecmascript/object_operator.h"
 #include "ecmascript/tagged_array-inl.h"
 #include "ecmascript/tagged_dictionary.h"
+#include "ecmascript/tagged_list.h"
 #include "ecmascript/tests/test_helper.h"
 #include "ecmascript/weak_vector.h"
 
@@ -1365,4 +1369,78 @@ HWTEST_F_L0(JSObjectTest, UpdateWeakTransitions)
     EXPECT_EQ(hc0->FindTransitions(keyA.GetTaggedValue(), attr.GetTaggedValue()), obj3->GetClass());
     EXPECT_EQ(hc0->FindTransitions(keyB.GetTaggedValue(), attr.GetTaggedValue()), obj4->GetClass());
 }
+
+HWTEST_F_L0(JSObjectTest, EnumCache)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<JSTaggedValue> objFunc(thread, JSObjectTestCreate(thread));
+    JSHandle<JSObject> obj1 = factory->NewJSObjectByConstructor(JSHandle<JSFunction>(objFunc), objFunc);
+    JSHandle<JSObject> obj2 = factory->NewJSObjectByConstructor(JSHandle<JSFunction>(objFunc), objFunc);
+    JSHandle<JSTaggedValue> keyA(factory->NewFromASCII("a"));
+    JSHandle<JSTaggedValue> keyB(factory->NewFromASCII("b"));
+    JSHandle<JSTaggedValue> keyC(factory->NewFromASCII("c"));
+    JSObject::SetProperty(thread, obj1, keyA, JSHandle<JSTaggedValue>(thread, JSTaggedValue(1)));
+    JSObject::SetProperty(thread, obj1, keyB, JSHandle<JSTaggedValue>(thread, JSTaggedValue(2)));
+    JSObject::SetProperty(thread, obj2, keyA, JSHandle<JSTaggedValue>(thread, JSTaggedValue(3)));
+    JSObject::SetProperty(thread, obj2, keyB, JSHandle<JSTaggedValue>(thread, JSTaggedValue(4)));
+    EXPECT_EQ(obj1->GetJSHClass(), obj2->GetJSHClass());
+    EXPECT_TRUE(obj1->GetJSHClass()->GetEnumCache().IsNull());
+
+    // the cache is made once for the shape and read with the indices of the layout
+    JSHandle<TaggedArray> cache(thread, JSObject::GetOrCreateEnumCache(thread, obj1));
+    EXPECT_EQ(JSObject::GetEnumCacheLength(*cache), 2U);
+    EXPECT_EQ(cache->Get(0), keyA.GetTaggedValue());
+    EXPECT_EQ(cache->Get(1), keyB.GetTaggedValue());
+    EXPECT_EQ(JSObject::GetOrCreateEnumCache(thread, obj2), cache.GetTaggedValue());
+    EXPECT_EQ(obj2->GetEnumCacheValue(*cache, 0), JSTaggedValue(3));
+    EXPECT_EQ(obj2->GetEnumCacheValue(*cache, 1), JSTaggedValue(4));
+
+    JSHandle<TaggedArray> values = JSObject::EnumerableOwnPropertyNames(thread, obj1, PropertyKind::VALUE);
+    EXPECT_EQ(values->GetLength(), 2U);
+    EXPECT_EQ(values->Get(1), JSTaggedValue(2));
+
+    // a transition makes a shape without a cache
+    JSObject::SetProperty(thread, obj2, keyC, JSHandle<JSTaggedValue>(thread, JSTaggedValue(5)));
+    EXPECT_NE(obj1->GetJSHClass(), obj2->GetJSHClass());
+    EXPECT_TRUE(obj2->GetJSHClass()->GetEnumCache().IsNull());
+    JSHandle<TaggedArray> newCache(thread, JSObject::GetOrCreateEnumCache(thread, obj2));
+    EXPECT_EQ(JSObject::GetEnumCacheLength(*newCache), 3U);
+    EXPECT_EQ(obj2->GetEnumCacheValue(*newCache, 2), JSTaggedValue(5));
+}
+
+HWTEST_F_L0(JSObjectTest, EnumCacheOfContainer)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<GlobalEnv> env = thread->GetEcmaVM()->GetGlobalEnv();
+    JSHandle<JSTaggedValue> globalObject = env->GetJSGlobalObject();
+    JSHandle<JSTaggedValue> privateKey(factory->NewFromASCII("ArkPrivate"));
+    JSHandle<JSTaggedValue> arkPrivate = JSObject::GetProperty(thread, globalObject, privateKey).GetValue();
+    auto objCallInfo = TestHelper::CreateEcmaRuntimeCallInfo(thread, JSTaggedValue::Undefined(), 6);  // 6: arg len
+    objCallInfo->SetFunction(JSTaggedValue::Undefined());
+    objCallInfo->SetThis(arkPrivate.GetTaggedValue());
+    objCallInfo->SetCallArg(0, JSTaggedValue(static_cast<int>(containers::ContainerTag::LinkedList)));
+    [[maybe_unused]] auto prev = TestHelper::SetupFrame(thread, objCallInfo);
+    JSHandle<JSTaggedValue> constructor(thread, containers::ContainersPrivate::Load(objCallInfo));
+    TestHelper::TearDownFrame(thread, prev);
+
+    JSHandle<JSAPILinkedList> list = JSHandle<JSAPILinkedList>::Cast(
+        factory->NewJSObjectByConstructor(JSHandle<JSFunction>(constructor), constructor));
+    list->SetDoubleList(thread, TaggedDoubleList::Create(thread));
+    JSAPILinkedList::Add(thread, list, JSHandle<JSTaggedValue>(thread, JSTaggedValue(1)));
+    JSAPILinkedList::Add(thread, list, JSHandle<JSTaggedValue>(thread, JSTaggedValue(2)));
+    JSHandle<JSObject> obj(list);
+    JSHandle<JSTaggedValue> src(list);
+
+    // the data of a container is not in its layout, so both fast paths must leave it to the container keys
+    EXPECT_EQ(obj->GetNumberOfElements(), 0U);
+    EXPECT_TRUE(JSObject::FastEnumerableOwnPropertyNames(thread, obj, PropertyKind::KEY).IsEmpty());
+    JSHandle<JSTaggedValue> objFunc(thread, JSObjectTestCreate(thread));
+    JSHandle<JSTaggedValue> dst(factory->NewJSObjectByConstructor(JSHandle<JSFunction>(objFunc), objFunc));
+    EXPECT_FALSE(JSObject::FastCopyDataProperties(thread, dst, src));
+
+    JSObject::EnumerableOwnPropertyNames(thread, obj, PropertyKind::VALUE);
+    SlowRuntimeStub::CopyDataProperties(thread, dst.GetTaggedValue(), src.GetTaggedValue());
+    EXPECT_FALSE(thread->HasPendingException());
+    EXPECT_TRUE(obj->GetJSHClass()->GetEnumCache().IsNull());
+}
 }  // namespace panda::test
@@ -105,4 +105,25 @@ HWTEST_F_L0(JSVerificationTest, VerifyHeapObjects)
     VerifyObjectVisitor objVerifier(heap, &failCount);
     const_cast<SemiSpace *>(heap->GetNewSpace())->IterateOverObjects(objVerifier);  // newspace reference the old space
 }
+
+HWTEST_F_L0(JSVerificationTest, VerifyOldToNewRSet)
+{
+    auto ecmaVm = thread->GetEcmaVM();
+    auto heap = const_cast<Heap *>(ecmaVm->GetHeap());
+    auto objectFactory = ecmaVm->GetFactory();
+    EXPECT_EQ(heap->VerifyHeapObjects(), 0U);
+
+    JSHandle<TaggedArray> oldArray = objectFactory->NewTaggedArray(1, JSTaggedValue::Undefined(),
+                                                                   MemSpaceType::OLD_SPACE);
+    JSHandle<TaggedArray> newArray = objectFactory->NewTaggedArray(1, JSTaggedValue::Undefined(),
+                                                                   MemSpaceType::SEMI_SPACE);
+    // store the young object without the write barrier, so the slot is missing in the old to new rset.
+    Barriers::SetDynPrimitive<JSTaggedType>(oldArray->GetData(), 0, newArray.GetTaggedValue().GetRawData());
+    Verification verifier(heap);
+    EXPECT_EQ(verifier.VerifyHeap(), 1U);
+    EXPECT_NE(verifier.DumpFailures().find("MissingOldToNewRSet"), std::string::npos);
+
+    oldArray->Set(thread, 0, newArray.GetTaggedValue());
+    EXPECT_EQ(heap->VerifyHeapObjects(), 0U);
+}
 }  // namespace panda::test
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <fstream>
+
+#include "ecmascript/ecma_vm.h"
+#include "ecmascript/global_env.h"
+#include "ecmascript/js_function.h"
+#include "ecmascript/js_object-inl.h"
+#include "ecmascript/object_factory.h"
+#include "ecmascript/pgo/pgo_profiler.h"
+#include "ecmascript/tests/test_helper.h"
+
+using namespace panda::ecmascript;
+
+namespace panda::test {
+class PGOProfilerTest : public testing::Test {
+public:
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "SetUpTestCase";
+    }
+
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "TearDownCase";
+    }
+
+    void SetUp() override
+    {
+        TestHelper::CreateEcmaVMWithScope(instance, thread, scope);
+    }
+
+    void TearDown() override
+    {
+        TestHelper::DestroyEcmaVMWithScope(instance, scope);
+    }
+
+    EcmaVM *instance {nullptr};
+    EcmaHandleScope *scope {nullptr};
+    JSThread *thread {nullptr};
+};
+
+static PGOLayout CreateLayout(const std::vector<std::string> &keys)
+{
+    PGOLayout layout;
+    layout.objectType = static_cast<uint32_t>(JSType::JS_OBJECT);
+    for (const auto &key : keys) {
+        layout.entries.emplace_back(PGOLayoutEntry {key, true, true, false});
+    }
+    return layout;
+}
+
+/**
+ * @tc.name: SaveAndLoad
+ * @tc.desc: A profile written by "Save" function is read back by "Load" function with the same methods, sites and
+ *           layouts, and a file that is not a profile is rejected.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(PGOProfilerTest, SaveAndLoad)
+{
+    const std::string fileName = "pgo_profiler_test.ap";
+    PGOProfile profile;
+    PGOMethodProfile *method = profile.FindOrAddMethod(1, 2);
+    method->hotness = 3;
+    PGOSiteProfile *site = method->FindOrAddSite(4);
+    site->state = ProfileTypeAccessor::ICState::MONO;
+    site->layouts.emplace_back(CreateLayout({"x", "y"}));
+    ASSERT_TRUE(profile.Save(fileName));
+
+    PGOProfile loaded;
+    ASSERT_TRUE(loaded.Load(fileName));
+    EXPECT_EQ(loaded.GetMethodCount(), 1U);
+    EXPECT_EQ(loaded.GetHotness(1, 2), 3U);
+    EXPECT_EQ(loaded.GetHotness(1, 3), 0U);
+    const PGOSiteProfile *loadedSite = loaded.FindMethod(1, 2)->FindSite(4);
+    ASSERT_NE(loadedSite, nullptr);
+    EXPECT_EQ(loadedSite->state, ProfileTypeAccessor::ICState::MONO);
+    ASSERT_EQ(loadedSite->layouts.size(), 1U);
+    EXPECT_TRUE(loadedSite->layouts[0] == site->layouts[0]);
+    EXPECT_EQ(loadedSite->layouts[0].FindEntry("y"), 1);
+
+    {
+        std::ofstream file(fileName.c_str(), std::ofstream::binary | std::ofstream::trunc);
+        file << "not a profile";
+    }
+    EXPECT_FALSE(loaded.Load(fileName));
+    std::remove(fileName.c_str());
+}
+
+/**
+ * @tc.name: MergeSites
+ * @tc.desc: "Merge" function keeps the distinct layouts of a site, which goes polymorphic with two of them and
+ *           megamorphic with more than an inline cache holds.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(PGOProfilerTest, MergeSites)
+{
+    PGOMethodProfile method;
+    PGOSiteProfile *site = method.FindOrAddSite(0);
+    PGOSiteProfile other {0, ProfileTypeAccessor::ICState::MONO, {CreateLayout({"x"})}};
+    site->Merge(other);
+    site->Merge(other);
+    EXPECT_EQ(site->state, ProfileTypeAccessor::ICState::MONO);
+    EXPECT_EQ(site->layouts.size(), 1U);
+
+    other.layouts[0] = CreateLayout({"y"});
+    site->Merge(other);
+    EXPECT_EQ(site->state, ProfileTypeAccessor::ICState::POLY);
+    EXPECT_EQ(site->layouts.size(), 2U);
+
+    for (const char *key : {"a", "b", "c", "d"}) {
+        other.layouts[0] = CreateLayout({key});
+        site->Merge(other);
+    }
+    EXPECT_EQ(site->state, ProfileTypeAccessor::ICState::MEGA);
+    EXPECT_TRUE(site->layouts.empty());
+}
+
+/**
+ * @tc.name: CollectSites
+ * @tc.desc: "CollectSites" function records the layout of the hclass in a monomorphic inline cache of a closure.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(PGOProfilerTest, CollectSites)
+{
+    ObjectFactory *factory = instance->GetFactory();
+    JSHandle<GlobalEnv> env = instance->GetGlobalEnv();
+    JSHandle<JSObject> obj = factory->NewEmptyJSObject();
+    JSHandle<JSTaggedValue> keyX(factory->NewFromASCII("x"));
+    JSHandle<JSTaggedValue> keyY(factory->NewFromASCII("y"));
+    JSHandle<JSTaggedValue> value(thread, JSTaggedValue(1));
+    JSObject::SetProperty(thread, JSHandle<JSTaggedValue>(obj), keyX, value);
+    JSObject::SetProperty(thread, JSHandle<JSTaggedValue>(obj), keyY, value);
+
+    JSMethod *method = factory->NewMethodForNativeFunction(nullptr);
+    JSHandle<JSFunction> func = factory->NewJSFunction(env, method);
+    JSHandle<ProfileTypeInfo> profileTypeInfo = factory->NewProfileTypeInfo(2);  // 2: hclass and handler
+    JSHandle<JSTaggedValue> hclass(thread, JSTaggedValue(obj->GetJSHClass()));
+    profileTypeInfo->Set(thread, 0, hclass.GetTaggedValue().CreateAndGetWeakRef());
+    profileTypeInfo->Set(thread, 1, JSTaggedValue(1));
+    func->SetProfileTypeInfo(thread, profileTypeInfo.GetTaggedValue());
+
+    PGOMethodProfile methodProfile;
+    PGOProfiler::CollectSites(*func, &methodProfile);
+    ASSERT_EQ(methodProfile.sites.size(), 1U);
+    const PGOSiteProfile *site = methodProfile.FindSite(0);
+    ASSERT_NE(site, nullptr);
+    EXPECT_EQ(site->state, ProfileTypeAccessor::ICState::MONO);
+    ASSERT_EQ(site->layouts.size(), 1U);
+    const PGOLayout &layout = site->layouts[0];
+    EXPECT_FALSE(layout.isDictionary);
+    EXPECT_EQ(layout.FindEntry("x"), 0);
+    ASSERT_EQ(layout.FindEntry("y"), 1);
+    EXPECT_TRUE(layout.entries[1].isInlined);
+    EXPECT_FALSE(layout.entries[1].isAccessor);
+}
+}  // namespace panda::test
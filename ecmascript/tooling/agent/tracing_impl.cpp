@@ -93,13 +93,14 @@ void TracingImpl::Frontend::BufferUsage()
     channel_->SendNotification(bufferUsage);
 }
 
-void TracingImpl::Frontend::DataCollected()
+void TracingImpl::Frontend::DataCollected(std::vector<std::unique_ptr<PtJson>> value)
 {
     if (!AllowNotify()) {
         return;
     }
 
     tooling::DataCollected dataCollected;
+    dataCollected.SetValue(std::move(value));
     channel_->SendNotification(dataCollected);
 }
 
@@ -115,7 +116,24 @@ void TracingImpl::Frontend::TracingComplete()
 
 DispatchResponse TracingImpl::End()
 {
-    return DispatchResponse::Fail("End not support now.");
+    if (!isTracing_) {
+        return DispatchResponse::Fail("Tracing is not started.");
+    }
+    DFXJSNApi::StopGCTracing(vm_);
+    isTracing_ = false;
+
+    std::vector<std::string> traceEvents;
+    DFXJSNApi::GetGCTraceEvents(vm_, traceEvents);
+    std::vector<std::unique_ptr<PtJson>> value;
+    for (const auto &event : traceEvents) {
+        std::unique_ptr<PtJson> json = PtJson::Parse(event);
+        if (json != nullptr) {
+            value.emplace_back(std::move(json));
+        }
+    }
+    frontend_.DataCollected(std::move(value));
+    frontend_.TracingComplete();
+    return DispatchResponse::Ok();
 }
 
 DispatchResponse TracingImpl::GetCategories([[maybe_unused]] std::vector<std::string> categories)
@@ -136,6 +154,12 @@ DispatchResponse TracingImpl::RequestMemoryDump([[maybe_unused]] std::unique_ptr
 
 DispatchResponse TracingImpl::Start([[maybe_unused]] std::unique_ptr<StartParams> params)
 {
-    return DispatchResponse::Fail("Start not support now.");
+    // Only the gc timeline is traced for now, the categories are ignored.
+    if (isTracing_) {
+        return DispatchResponse::Fail("Tracing is already started.");
+    }
+    DFXJSNApi::StartGCTracing(vm_);
+    isTracing_ = true;
+    return DispatchResponse::Ok();
 }
 }  // namespace panda::ecmascript::tooling
\ No newline at end of file
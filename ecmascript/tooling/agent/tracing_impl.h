@@ -60,7 +60,7 @@ public:
         explicit Frontend(ProtocolChannel *channel) : channel_(channel) {}
 
         void BufferUsage();
-        void DataCollected();
+        void DataCollected(std::vector<std::unique_ptr<PtJson>> value);
         void TracingComplete();
 
     private:
@@ -72,8 +72,9 @@ private:
     NO_COPY_SEMANTIC(TracingImpl);
     NO_MOVE_SEMANTIC(TracingImpl);
 
-    [[maybe_unused]] const EcmaVM *vm_ {nullptr};
-    [[maybe_unused]] Frontend frontend_;
+    const EcmaVM *vm_ {nullptr};
+    Frontend frontend_;
+    bool isTracing_ {false};
 };
 }  // namespace panda::ecmascript::tooling
 #endif
\ No newline at end of file
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+declare function print(str:any):string;
+
+// the callee a method defines itself is inlined
+function sumOfSquares(n: number) {
+    function square(x: number) {
+        return x * x;
+    }
+    let total = 0;
+    for (let i = 0; i < n; i++) {
+        total += square(i);
+    }
+    return total;
+}
+print(sumOfSquares(10));
+
+// the callee a method stores to a global once is inlined behind a check of the call target
+function combine(a: number, b: number) {
+    return a + b;
+}
+function multiply(a: number, b: number) {
+    return a * b;
+}
+function replaceCombine() {
+    combine = multiply;
+}
+let combined = 0;
+for (let i = 1; i <= 4; i++) {
+    combined = combine(combined, i);
+}
+print(combined);
+// the global is reassigned, so the check fails and the call goes to the new target
+replaceCombine();
+combined = 1;
+for (let i = 1; i <= 4; i++) {
+    combined = combine(combined, i);
+}
+print(combined);
+
+// a missing argument of the callee is undefined and an extra one is dropped
+function describe(a: any, b: any) {
+    return typeof a + " " + typeof b;
+}
+print(describe(1));
+print(describe("x", 2, 3));
+
+// the exceptions of an inlined callee leave through the exception path of the call
+function readX(o: any) {
+    return o.x;
+}
+function fail(message: string) {
+    throw new Error(message);
+}
+let caught = 0;
+for (let i = 0; i < 4; i++) {
+    try {
+        let value = readX(i % 2 == 0 ? {x: i} : undefined);
+        print(value);
+    } catch (e) {
+        caught++;
+    }
+}
+print(caught);
+try {
+    fail("thrown by the callee");
+    print("not reached");
+} catch (e) {
+    print(e.message);
+}
+
+// the result of the callee is used after the exception path merges
+function checked(x: number) {
+    if (x < 0) {
+        throw new RangeError("negative");
+    }
+    return x * 2;
+}
+let results: any[] = [];
+for (let i = -1; i <= 1; i++) {
+    try {
+        results.push(checked(i));
+    } catch (e) {
+        results.push(e.name);
+    }
+}
+print(results.join(","));
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+declare function print(str:any):string;
+
+// 300 functions make two shards of METHODS_PER_SHARD methods, the compiled file must not depend on the threads
+// which compile the shards
+let functions: any[] = [];
+functions.push((x: number) => x + 0, (x: number) => x + 1, (x: number) => x + 2, (x: number) => x + 3);
+functions.push((x: number) => x + 4, (x: number) => x + 5, (x: number) => x + 6, (x: number) => x + 7);
+functions.push((x: number) => x + 8, (x: number) => x + 9, (x: number) => x + 10, (x: number) => x + 11);
+functions.push((x: number) => x + 12, (x: number) => x + 13, (x: number) => x + 14, (x: number) => x + 15);
+functions.push((x: number) => x + 16, (x: number) => x + 17, (x: number) => x + 18, (x: number) => x + 19);
+functions.push((x: number) => x + 20, (x: number) => x + 21, (x: number) => x + 22, (x: number) => x + 23);
+functions.push((x: number) => x + 24, (x: number) => x + 25, (x: number) => x + 26, (x: number) => x + 27);
+functions.push((x: number) => x + 28, (x: number) => x + 29, (x: number) => x + 30, (x: number) => x + 31);
+functions.push((x: number) => x + 32, (x: number) => x + 33, (x: number) => x + 34, (x: number) => x + 35);
+functions.push((x: number) => x + 36, (x: number) => x + 37, (x: number) => x + 38, (x: number) => x + 39);
+functions.push((x: number) => x + 40, (x: number) => x + 41, (x: number) => x + 42, (x: number) => x + 43);
+functions.push((x: number) => x + 44, (x: number) => x + 45, (x: number) => x + 46, (x: number) => x + 47);
+functions.push((x: number) => x + 48, (x: number) => x + 49, (x: number) => x + 50, (x: number) => x + 51);
+functions.push((x: number) => x + 52, (x: number) => x + 53, (x: number) => x + 54, (x: number) => x + 55);
+functions.push((x: number) => x + 56, (x: number) => x + 57, (x: number) => x + 58, (x: number) => x + 59);
+functions.push((x: number) => x + 60, (x: number) => x + 61, (x: number) => x + 62, (x: number) => x + 63);
+functions.push((x: number) => x + 64, (x: number) => x + 65, (x: number) => x + 66, (x: number) => x + 67);
+functions.push((x: number) => x + 68, (x: number) => x + 69, (x: number) => x + 70, (x: number) => x + 71);
+functions.push((x: number) => x + 72, (x: number) => x + 73, (x: number) => x + 74, (x: number) => x + 75);
+functions.push((x: number) => x + 76, (x: number) => x + 77, (x: number) => x + 78, (x: number) => x + 79);
+functions.push((x: number) => x + 80, (x: number) => x + 81, (x: number) => x + 82, (x: number) => x + 83);
+functions.push((x: number) => x + 84, (x: number) => x + 85, (x: number) => x + 86, (x: number) => x + 87);
+functions.push((x: number) => x + 88, (x: number) => x + 89, (x: number) => x + 90, (x: number) => x + 91);
+functions.push((x: number) => x + 92, (x: number) => x + 93, (x: number) => x + 94, (x: number) => x + 95);
+functions.push((x: number) => x + 96, (x: number) => x + 97, (x: number) => x + 98, (x: number) => x + 99);
+functions.push((x: number) => x + 100, (x: number) => x + 101, (x: number) => x + 102, (x: number) => x + 103);
+functions.push((x: number) => x + 104, (x: number) => x + 105, (x: number) => x + 106, (x: number) => x + 107);
+functions.push((x: number) => x + 108, (x: number) => x + 109, (x: number) => x + 110, (x: number) => x + 111);
+functions.push((x: number) => x + 112, (x: number) => x + 113, (x: number) => x + 114, (x: number) => x + 115);
+functions.push((x: number) => x + 116, (x: number) => x + 117, (x: number) => x + 118, (x: number) => x + 119);
+functions.push((x: number) => x + 120, (x: number) => x + 121, (x: number) => x + 122, (x: number) => x + 123);
+functions.push((x: number) => x + 124, (x: number) => x + 125, (x: number) => x + 126, (x: number) => x + 127);
+functions.push((x: number) => x + 128, (x: number) => x + 129, (x: number) => x + 130, (x: number) => x + 131);
+functions.push((x: number) => x + 132, (x: number) => x + 133, (x: number) => x + 134, (x: number) => x + 135);
+functions.push((x: number) => x + 136, (x: number) => x + 137, (x: number) => x + 138, (x: number) => x + 139);
+functions.push((x: number) => x + 140, (x: number) => x + 141, (x: number) => x + 142, (x: number) => x + 143);
+functions.push((x: number) => x + 144, (x: number) => x + 145, (x: number) => x + 146, (x: number) => x + 147);
+functions.push((x: number) => x + 148, (x: number) => x + 149, (x: number) => x + 150, (x: number) => x + 151);
+functions.push((x: number) => x + 152, (x: number) => x + 153, (x: number) => x + 154, (x: number) => x + 155);
+functions.push((x: number) => x + 156, (x: number) => x + 157, (x: number) => x + 158, (x: number) => x + 159);
+functions.push((x: number) => x + 160, (x: number) => x + 161, (x: number) => x + 162, (x: number) => x + 163);
+functions.push((x: number) => x + 164, (x: number) => x + 165, (x: number) => x + 166, (x: number) => x + 167);
+functions.push((x: number) => x + 168, (x: number) => x + 169, (x: number) => x + 170, (x: number) => x + 171);
+functions.push((x: number) => x + 172, (x: number) => x + 173, (x: number) => x + 174, (x: number) => x + 175);
+functions.push((x: number) => x + 176, (x: number) => x + 177, (x: number) => x + 178, (x: number) => x + 179);
+functions.push((x: number) => x + 180, (x: number) => x + 181, (x: number) => x + 182, (x: number) => x + 183);
+functions.push((x: number) => x + 184, (x: number) => x + 185, (x: number) => x + 186, (x: number) => x + 187);
+functions.push((x: number) => x + 188, (x: number) => x + 189, (x: number) => x + 190, (x: number) => x + 191);
+functions.push((x: number) => x + 192, (x: number) => x + 193, (x: number) => x + 194, (x: number) => x + 195);
+functions.push((x: number) => x + 196, (x: number) => x + 197, (x: number) => x + 198, (x: number) => x + 199);
+functions.push((x: number) => x + 200, (x: number) => x + 201, (x: number) => x + 202, (x: number) => x + 203);
+functions.push((x: number) => x + 204, (x: number) => x + 205, (x: number) => x + 206, (x: number) => x + 207);
+functions.push((x: number) => x + 208, (x: number) => x + 209, (x: number) => x + 210, (x: number) => x + 211);
+functions.push((x: number) => x + 212, (x: number) => x + 213, (x: number) => x + 214, (x: number) => x + 215);
+functions.push((x: number) => x + 216, (x: number) => x + 217, (x: number) => x + 218, (x: number) => x + 219);
+functions.push((x: number) => x + 220, (x: number) => x + 221, (x: number) => x + 222, (x: number) => x + 223);
+functions.push((x: number) => x + 224, (x: number) => x + 225, (x: number) => x + 226, (x: number) => x + 227);
+functions.push((x: number) => x + 228, (x: number) => x + 229, (x: number) => x + 230, (x: number) => x + 231);
+functions.push((x: number) => x + 232, (x: number) => x + 233, (x: number) => x + 234, (x: number) => x + 235);
+functions.push((x: number) => x + 236, (x: number) => x + 237, (x: number) => x + 238, (x: number) => x + 239);
+functions.push((x: number) => x + 240, (x: number) => x + 241, (x: number) => x + 242, (x: number) => x + 243);
+functions.push((x: number) => x + 244, (x: number) => x + 245, (x: number) => x + 246, (x: number) => x + 247);
+functions.push((x: number) => x + 248, (x: number) => x + 249, (x: number) => x + 250, (x: number) => x + 251);
+functions.push((x: number) => x + 252, (x: number) => x + 253, (x: number) => x + 254, (x: number) => x + 255);
+functions.push((x: number) => x + 256, (x: number) => x + 257, (x: number) => x + 258, (x: number) => x + 259);
+functions.push((x: number) => x + 260, (x: number) => x + 261, (x: number) => x + 262, (x: number) => x + 263);
+functions.push((x: number) => x + 264, (x: number) => x + 265, (x: number) => x + 266, (x: number) => x + 267);
+functions.push((x: number) => x + 268, (x: number) => x + 269, (x: number) => x + 270, (x: number) => x + 271);
+functions.push((x: number) => x + 272, (x: number) => x + 273, (x: number) => x + 274, (x: number) => x + 275);
+functions.push((x: number) => x + 276, (x: number) => x + 277, (x: number) => x + 278, (x: number) => x + 279);
+functions.push((x: number) => x + 280, (x: number) => x + 281, (x: number) => x + 282, (x: number) => x + 283);
+functions.push((x: number) => x + 284, (x: number) => x + 285, (x: number) => x + 286, (x: number) => x + 287);
+functions.push((x: number) => x + 288, (x: number) => x + 289, (x: number) => x + 290, (x: number) => x + 291);
+functions.push((x: number) => x + 292, (x: number) => x + 293, (x: number) => x + 294, (x: number) => x + 295);
+functions.push((x: number) => x + 296, (x: number) => x + 297, (x: number) => x + 298, (x: number) => x + 299);
+let total = 0;
+for (let i = 0; i < functions.length; i++) {
+    total += functions[i](i);
+}
+print(functions.length);
+print(total);
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+declare function print(str:any):string;
+
+// the key is proven in bounds, the checks are dropped
+function sum(arr: number[]) {
+    let total = 0;
+    for (let i = 0; i < arr.length; i++) {
+        total += arr[i];
+    }
+    return total;
+}
+print(sum([1, 2, 3, 4]));
+
+// the last key is the length, the bounds check must stay
+function sumOffByOne(arr: number[]) {
+    let total = 0;
+    let misses = 0;
+    for (let i = 0; i <= arr.length; i++) {
+        if (arr[i] === undefined) {
+            misses++;
+        } else {
+            total += arr[i];
+        }
+    }
+    return total + " " + misses;
+}
+print(sumOffByOne([1, 2, 3, 4]));
+
+// a decrementing key goes below 0
+function sumDown(arr: number[]) {
+    let total = 0;
+    let misses = 0;
+    for (let i = arr.length - 1; i >= -1; i--) {
+        if (arr[i] === undefined) {
+            misses++;
+        } else {
+            total += arr[i];
+        }
+    }
+    return total + " " + misses;
+}
+print(sumDown([1, 2, 3, 4]));
+
+// a negative key is a named property, not an element
+function readNegative(arr: number[]) {
+    let values: any[] = [];
+    for (let i = -2; i < arr.length; i++) {
+        values.push(arr[i]);
+    }
+    return values.join(",");
+}
+let negative: any = [5, 6];
+negative[-1] = 7;
+print(readNegative(negative));
+
+// the array shrinks between the comparison and the access
+function sumShrinking(arr: number[]) {
+    let total = 0;
+    let misses = 0;
+    for (let i = 0; i < arr.length; i++) {
+        if (i == 1) {
+            arr.splice(1);
+        }
+        if (arr[i] === undefined) {
+            misses++;
+        } else {
+            total += arr[i];
+        }
+    }
+    return total + " " + misses;
+}
+print(sumShrinking([1, 2, 3, 4, 5, 6]));
+
+// the length is read once before the array shrinks
+function sumCachedLength(arr: number[]) {
+    let total = 0;
+    let misses = 0;
+    let length = arr.length;
+    for (let i = 0; i < length; i++) {
+        if (i == 2) {
+            arr.length = 2;
+        }
+        if (arr[i] === undefined) {
+            misses++;
+        } else {
+            total += arr[i];
+        }
+    }
+    return total + " " + misses;
+}
+print(sumCachedLength([1, 2, 3, 4]));
+
+// the holes of a holey array are read from the prototype chain
+function readHoley(arr: number[]) {
+    let values: any[] = [];
+    for (let i = 0; i < arr.length; i++) {
+        values.push(arr[i]);
+    }
+    return values.join(",");
+}
+let holey: number[] = [1, , 3];
+holey[5] = 6;
+print(readHoley(holey));
+let arrayProto: any = Array.prototype;
+arrayProto[1] = 42;
+print(readHoley(holey));
+delete arrayProto[1];
+print(readHoley(holey));
+
+// the stores of a counted loop, one past the end appends
+function fill(arr: number[], n: number) {
+    for (let i = 0; i <= n; i++) {
+        arr[i] = i * 1.5;
+    }
+    return arr.length + " " + arr[n];
+}
+print(fill([0, 0, 0], 3));
+print(fill([], 4));
+
+// a store into a hole keeps the array holey
+function fillEven(arr: number[]) {
+    for (let i = 0; i < arr.length; i += 2) {
+        arr[i] = i;
+    }
+    return arr.join(",");
+}
+let sparse: number[] = [];
+sparse[4] = 9;
+print(fillEven(sparse));
+
+// typed arrays ignore the keys out of their bounds
+function sumTyped(arr: Int32Array) {
+    let total = 0;
+    let misses = 0;
+    for (let i = -1; i <= arr.length; i++) {
+        if (arr[i] === undefined) {
+            misses++;
+        } else {
+            total += arr[i];
+        }
+    }
+    return total + " " + misses;
+}
+let ints = new Int32Array(4);
+for (let i = 0; i <= ints.length; i++) {
+    ints[i] = i + 1;
+}
+print(sumTyped(ints));
+
+function scaleTyped(arr: Float64Array) {
+    for (let i = arr.length - 1; i >= 0; i--) {
+        arr[i] = arr[i] * 0.5;
+    }
+    arr[arr.length] = 100;
+    return arr.join(",") + " " + arr.length;
+}
+let doubles = new Float64Array([1, 2, 3]);
+print(scaleTyped(doubles));
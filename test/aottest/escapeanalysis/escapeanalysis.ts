@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+declare function print(str:any):string;
+
+// the objects are only read after their creation, they are replaced by their values
+function point(x: number, y: number) {
+    let p = {x: x, y: y};
+    return p.x * p.y;
+}
+print(point(3, 4));
+
+function pair(a: number, b: number) {
+    let items = [a, b];
+    return items[0] + items[1] + items.length;
+}
+print(pair(5, 6));
+
+function overwritten(a: number) {
+    let p = {v: a, w: 0};
+    p = {v: p.v + 1, w: p.v};
+    return p.v + " " + p.w;
+}
+print(overwritten(1));
+
+// a key that was not stored is looked up on the prototype chain
+let objectProto: any = Object.prototype;
+let arrayProto: any = Array.prototype;
+objectProto.inherited = "from Object.prototype";
+arrayProto[3] = "from Array.prototype";
+function missingKey(a: number) {
+    let p: any = {a: a};
+    return p.a + " " + p.inherited + " " + typeof p.toString;
+}
+print(missingKey(1));
+function missingIndex(a: number) {
+    let items: any = [a];
+    return items[0] + " " + items[3] + " " + items[1];
+}
+print(missingIndex(2));
+delete objectProto.inherited;
+delete arrayProto[3];
+print(missingKey(1));
+print(missingIndex(2));
+
+// an object passed to a call escapes, the callee sees and changes it
+function touch(o: any) {
+    o.x = o.x * 10;
+    return o;
+}
+function passed(x: number) {
+    let p = {x: x};
+    let q = touch(p);
+    return p.x + " " + (p === q);
+}
+print(passed(7));
+
+// an object stored into another one escapes
+let kept: any[] = [];
+function stored(x: number) {
+    let p = {x: x};
+    kept.push(p);
+    let holder = {inner: p};
+    holder.inner.x++;
+    return p.x;
+}
+print(stored(1));
+print(kept[0].x);
+
+// a store behind a branch keeps the object
+function branched(x: number, flag: boolean) {
+    let p = {x: x};
+    if (flag) {
+        p.x = x * 2;
+    }
+    return p.x;
+}
+print(branched(4, true));
+print(branched(4, false));
+
+// an object created in a loop keeps the values of its own iteration
+function perIteration(n: number) {
+    let total = 0;
+    for (let i = 0; i < n; i++) {
+        let p = {i: i, square: i * i};
+        total += p.square - p.i;
+    }
+    return total;
+}
+print(perIteration(5));
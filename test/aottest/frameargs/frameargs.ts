@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+declare function print(str:any):string;
+function count() {
+    return arguments.length;
+}
+
+function second() {
+    return arguments[1];
+}
+
+function key(k:any) {
+    return arguments[k];
+}
+
+function sum(a:any, b:any, c:any) {
+    return a + b + c;
+}
+
+function forward(a:any, b:any, c:any) {
+    return sum.apply(undefined, arguments);
+}
+
+function restCount(a:any, ...rest:any) {
+    return rest.length;
+}
+
+function restFirst(a:any, ...rest:any) {
+    return rest[0];
+}
+
+function restForward(a:any, ...rest:any) {
+    return sum.apply(undefined, rest);
+}
+
+print(count());
+print(count(1, 2, 3));
+print(second(1, "two"));
+print(second(1));
+print(key("length", 1, 2));
+print(key(1, 2));
+print(forward(1, 2, 3));
+print(restCount(1));
+print(restCount(1, 2, 3));
+print(restFirst(1, "first"));
+print(restFirst(1));
+print(restForward(0, 4, 5, 6));
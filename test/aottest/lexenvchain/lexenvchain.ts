@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+declare function print(str:any):string;
+
+// the closures below keep the env they are called with, so they access it without the frame
+function makeCounter() {
+    let count = 0;
+    return function () {
+        count++;
+        return count;
+    };
+}
+let counter = makeCounter();
+counter();
+print(counter());
+
+function outer(a: number) {
+    let b = 10;
+    function middle(c: number) {
+        let d = 100;
+        function inner() {
+            return a + b + c + d;
+        }
+        return inner();
+    }
+    return middle(1000);
+}
+print(outer(1));
+
+function apply(f: any, x: number) {
+    return f(x);
+}
+function sum(n: number) {
+    let total = 0;
+    for (let i = 0; i < n; i++) {
+        total = apply((x: number) => total + x, i);
+    }
+    return total;
+}
+print(sum(5));
+
+// a new env for each iteration
+let getters: any[] = [];
+for (let i = 0; i < 3; i++) {
+    getters.push(() => i);
+}
+print(getters[0]() + getters[1]() + getters[2]());
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+declare function print(str:any):string;
+
+// the numbers of the invariant operands are computed once
+function scaled(n: number, a: number, b: number) {
+    let total = 0;
+    for (let i = 0; i < n; i++) {
+        total += a * b + i;
+    }
+    return total;
+}
+print(scaled(4, 3, 5));
+
+// the load can't be hoisted above the store of the loop
+function loadAfterStore(o: any, n: number) {
+    let total = 0;
+    for (let i = 0; i < n; i++) {
+        total += o.x;
+        o.x = i;
+    }
+    return total + " " + o.x;
+}
+print(loadAfterStore({x: 10}, 4));
+
+// the load can't be hoisted above a call which stores to the object
+function bump(o: any) {
+    o.x++;
+}
+function loadAfterCall(o: any, n: number) {
+    let total = 0;
+    for (let i = 0; i < n; i++) {
+        bump(o);
+        total += o.x;
+    }
+    return total;
+}
+print(loadAfterCall({x: 0}, 4));
+
+// the length changes with each push
+function lengths(arr: number[], n: number) {
+    let seen: any[] = [];
+    for (let i = 0; i < n; i++) {
+        seen.push(arr.length);
+        arr.push(i);
+    }
+    return seen.join(",");
+}
+print(lengths([], 4));
+
+// the global changes in the callee
+let counter = 0;
+function step() {
+    counter += 2;
+}
+function readGlobal(n: number) {
+    let total = 0;
+    for (let i = 0; i < n; i++) {
+        step();
+        total += counter;
+    }
+    return total;
+}
+print(readGlobal(3));
+
+// two loads of a getter are two calls, they can't be merged
+function twoLoads(o: any) {
+    return o.next + o.next;
+}
+let calls = 0;
+let source = {
+    get next() {
+        calls++;
+        return calls;
+    }
+};
+print(twoLoads(source));
+print(calls);
+
+// two calls with the same arguments both run
+function twoCalls(f: any) {
+    let first = f(1);
+    let second = f(1);
+    return first + " " + second;
+}
+let runs = 0;
+print(twoCalls((x: number) => x + runs++));
+
+// the result of a store is unused, the store still runs
+function unusedResult(o: any) {
+    let unused = o.y = 5;
+    step();
+    return o.y + " " + counter;
+}
+print(unusedResult({}));
+
+// the loads in a loop with a store by a key see the stored values
+function prefixSums(arr: number[]) {
+    for (let i = 1; i < arr.length; i++) {
+        arr[i] = arr[i - 1] + arr[i];
+    }
+    return arr.join(",");
+}
+print(prefixSums([1, 1, 1, 1]));
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+var log = [];
+
+// an await of a native promise resumes in one job, before the second reaction of a promise chain
+async function awaitNative() {
+    await Promise.resolve();
+    log.push("native");
+}
+
+// a promise whose constructor is not %Promise% is wrapped, and waits for its then
+class SubPromise extends Promise {}
+async function awaitSubclass() {
+    await SubPromise.resolve();
+    log.push("subclass");
+}
+
+// a thenable is called through its then
+async function awaitThenable() {
+    var value = await { then(resolve) { resolve("thenable"); } };
+    log.push(value);
+}
+
+async function awaitRejected() {
+    try {
+        await Promise.reject("rejected");
+    } catch (e) {
+        log.push(e);
+    }
+}
+
+awaitNative();
+awaitSubclass();
+awaitThenable();
+awaitRejected();
+Promise.resolve().then(() => log.push("tick1")).then(() => log.push("tick2")).then(() => log.push("tick3"))
+    .then(() => print(log.join()));
+
+// throughput of awaits of primitives and native promises
+var count = 0;
+async function loop(n) {
+    for (var i = 0; i < n; i++) {
+        count += await i;
+        count += await Promise.resolve(1);
+    }
+    return count;
+}
+loop(10000).then(result => print("awaits: " + result));
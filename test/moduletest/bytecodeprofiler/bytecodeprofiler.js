@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// only the interpreter written in c++ counts the bytecodes, so this test does not run on the asm interpreter
+function getX(obj) {
+    return obj.x;
+}
+
+// every iteration runs one incdyn and one createemptyobject, which always enters SlowRuntimeStub
+function loop(n) {
+    let objs = 0;
+    for (let i = 0; i < n; i++) {
+        let obj = {};
+        objs += Object.keys(obj).length + 1;
+    }
+    return objs;
+}
+
+// the count and the slow paths of an opcode in the profile
+function getOpcodeStat(profile, opcode) {
+    for (let line of profile.split("\n")) {
+        let fields = line.split(/ +/);
+        if (fields[0] === opcode) {
+            return fields[1] + "," + fields[3];
+        }
+    }
+    return "none";
+}
+
+ArkTools.startBytecodeProfiler();
+let sum = 0;
+[{x : 1}, {y : 2, x : 2}, {z : 3, y : 3, x : 3}].forEach(obj => {
+    sum += getX(obj);
+});
+let objs = loop(100);
+ArkTools.stopBytecodeProfiler();
+
+let profile = ArkTools.getBytecodeProfile();
+print(sum);
+print(objs);
+print(profile.startsWith("Bytecodes: "));
+print(getOpcodeStat(profile, "INCDYN"));
+print(getOpcodeStat(profile, "CREATEEMPTYOBJECT"));
+print(profile.indexOf("loop@") > 0);
+print(profile.indexOf("getX@") > 0);
+print(profile.indexOf("IC site") > 0);
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+// Every function but the main one is translated when it is called first, so each one below is checked on its
+// first call.
+function add(a, b) {
+    return a + b;
+}
+print(add(1, 2));
+
+// a base constructor returns the this object unless it returns an object
+function Point(x) {
+    this.x = x;
+}
+print(new Point(1).x);
+
+function Primitive() {
+    this.y = 2;
+    return 3;
+}
+print(new Primitive().y);
+
+function Wrapper() {
+    this.z = 3;
+    return { z: 4 };
+}
+print(new Wrapper().z);
+
+class Shape {
+    constructor(name) {
+        this.name = name;
+    }
+}
+print(new Shape("shape").name);
+
+// the derived constructor is translated on its first new, the base one on its first super call
+class Base {
+    constructor() {
+        this.base = 5;
+    }
+}
+class Derived extends Base {
+    constructor() {
+        super();
+        this.derived = 6;
+    }
+}
+let derived = new Derived();
+print(derived.base + "," + derived.derived);
+
+// a class constructor throws when it is called without new, also on its first call
+class Circle {
+    constructor() {
+        this.r = 7;
+    }
+}
+try {
+    Circle();
+} catch (e) {
+    print(e instanceof TypeError);
+}
+print(new Circle().r);
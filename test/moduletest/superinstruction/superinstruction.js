@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// register moves
+function swap(a, b) {
+    let t = a;
+    a = b;
+    b = t;
+    return a + "," + b;
+}
+print(swap(1, 2));
+
+// compare and jump with ints, doubles, strings, bigints and objects
+function countLess(x, n) {
+    let count = 0;
+    for (let i = x; i < n; i++) {
+        count++;
+    }
+    return count;
+}
+print(countLess(0, 100));
+print(countLess(0.5, 10));
+print(countLess(10, 0));
+
+function less(a, b) {
+    if (a < b) {
+        return "less";
+    }
+    return "not less";
+}
+print(less(1, 2));
+print(less(2, 1));
+print(less(1.5, 2));
+print(less("a", "b"));
+print(less("b", "a"));
+print(less(1n, 2n));
+print(less({ valueOf() { return 1; } }, 2));
+print(less(NaN, 1));
+
+try {
+    less({ valueOf() { throw new Error("valueOf"); } }, 1);
+} catch (e) {
+    print(e.message);
+}
+
+// method calls
+class Counter {
+    constructor() {
+        this.value = 0;
+    }
+    add(a, b) {
+        this.value += a + b;
+        return this;
+    }
+}
+let counter = new Counter();
+for (let i = 0; i < 10; i++) {
+    counter.add(i, 1).add(1, i);
+}
+print(counter.value);